@@ -0,0 +1,330 @@
+#ifndef WHOLF_BENCHMARK_HPP
+#define WHOLF_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Wholf {
+    namespace Bench {
+        // Derleyicinin sonucu atmasını engelle
+        template<typename T>
+        inline void doNotOptimize(const T& value) {
+            asm volatile("" : : "g"(&value) : "memory");
+        }
+
+        // Tek bir ölçüm turunun durumu
+        class State {
+        public:
+            const size_t iterations;
+
+            explicit State(size_t iterations) : iterations(iterations) {}
+
+            // Tur başına işlenen bayt/öğe (GB/s, öğe/s hesaplamak için)
+            void setBytesPerIteration(uint64_t bytes) { bytesPerIteration = bytes; }
+            void setItemsPerIteration(uint64_t items) { itemsPerIteration = items; }
+
+            // Hazırlık süresini ölçümden çıkar
+            void pauseTiming() { pausedAt = std::chrono::steady_clock::now(); }
+            void resumeTiming() { paused += std::chrono::steady_clock::now() - pausedAt; }
+
+            // Ek ölçüm (ör. gecikme yüzdelikleri); son turun değeri raporlanır
+            void setCounter(const std::string& name, double value) { counters[name] = value; }
+
+            uint64_t bytesPerIteration = 0;
+            uint64_t itemsPerIteration = 0;
+            std::chrono::steady_clock::duration paused{0};
+            std::map<std::string, double> counters;
+
+        private:
+            std::chrono::steady_clock::time_point pausedAt;
+        };
+
+        using Function = std::function<void(State&)>;
+
+        struct Case {
+            std::string name;
+            Function function;
+        };
+
+        // Bir benchmark'ın sonucu
+        struct Result {
+            std::string name;
+            size_t iterations = 0;
+            double nsPerIteration = 0;
+            double minNs = 0;
+            double stddevNs = 0;
+            double bytesPerSecond = 0;
+            double itemsPerSecond = 0;
+            std::map<std::string, double> counters;
+        };
+
+        inline std::vector<Case>& registry() {
+            static std::vector<Case> cases;
+            return cases;
+        }
+
+        // Statik kayıt yardımcısı
+        struct Registration {
+            Registration(const std::string& name, Function function) {
+                registry().push_back(Case{name, std::move(function)});
+            }
+        };
+
+        // Çalıştırma seçenekleri
+        struct Options {
+            std::string filter = ".*";
+            std::string jsonPath;
+            std::string baselinePath;
+            double threshold = 0.05;
+            size_t repetitions = 5;
+            double minSeconds = 0.2;
+        };
+
+        // Ölçüm ve karşılaştırma
+        class Runner {
+        public:
+            explicit Runner(const Options& options) : options(options) {}
+
+            std::vector<Result> run() {
+                std::vector<Result> results;
+                std::regex filter(options.filter);
+                for (const auto& benchmark : registry()) {
+                    if (!std::regex_search(benchmark.name, filter)) continue;
+                    Result result = measure(benchmark);
+                    std::printf("%-48s %14.1f ns/iter %12zu iters", result.name.c_str(), result.nsPerIteration, result.iterations);
+                    if (result.bytesPerSecond > 0) std::printf(" %10.3f GB/s", result.bytesPerSecond / 1e9);
+                    if (result.itemsPerSecond > 0) std::printf(" %12.0f items/s", result.itemsPerSecond);
+                    for (const auto& counter : result.counters) std::printf(" %s=%.1f", counter.first.c_str(), counter.second);
+                    std::printf("\n");
+                    results.push_back(result);
+                }
+                return results;
+            }
+
+            // JSON metin kaçışı (isimler serbest metindir: tırnak, ters bölü, kontrol karakterleri)
+            static std::string escapeJson(const std::string& text) {
+                std::string out;
+                out.reserve(text.size());
+                for (char c : text) {
+                    switch (c) {
+                        case '"': out += "\\\""; break;
+                        case '\\': out += "\\\\"; break;
+                        case '\n': out += "\\n"; break;
+                        case '\r': out += "\\r"; break;
+                        case '\t': out += "\\t"; break;
+                        default:
+                            if (static_cast<unsigned char>(c) < 0x20) {
+                                char buffer[8];
+                                std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+                                out += buffer;
+                            } else {
+                                out += c;
+                            }
+                    }
+                }
+                return out;
+            }
+
+            static std::string unescapeJson(const std::string& text) {
+                std::string out;
+                out.reserve(text.size());
+                for (size_t i = 0; i < text.size(); i++) {
+                    if (text[i] != '\\' || i + 1 == text.size()) {
+                        out += text[i];
+                        continue;
+                    }
+                    char escaped = text[++i];
+                    switch (escaped) {
+                        case 'n': out += '\n'; break;
+                        case 'r': out += '\r'; break;
+                        case 't': out += '\t'; break;
+                        case 'u':
+                            if (i + 4 < text.size()) {
+                                out += static_cast<char>(std::stoul(text.substr(i + 1, 4), nullptr, 16));
+                                i += 4;
+                            }
+                            break;
+                        default: out += escaped; break;
+                    }
+                }
+                return out;
+            }
+
+            static std::string toJson(const std::vector<Result>& results) {
+                std::ostringstream out;
+                out.precision(6);
+                out << std::fixed;
+                out << "{\n  \"context\": {\"threads\": " << std::thread::hardware_concurrency() << "},\n";
+                out << "  \"benchmarks\": [\n";
+                for (size_t i = 0; i < results.size(); i++) {
+                    const Result& result = results[i];
+                    out << "    {\"name\": \"" << escapeJson(result.name) << "\", "
+                        << "\"iterations\": " << result.iterations << ", "
+                        << "\"ns_per_iter\": " << result.nsPerIteration << ", "
+                        << "\"min_ns\": " << result.minNs << ", "
+                        << "\"stddev_ns\": " << result.stddevNs << ", "
+                        << "\"bytes_per_second\": " << result.bytesPerSecond << ", "
+                        << "\"items_per_second\": " << result.itemsPerSecond;
+                    for (const auto& counter : result.counters) out << ", \"" << escapeJson(counter.first) << "\": " << counter.second;
+                    out << "}" << (i + 1 < results.size() ? ",\n" : "\n");
+                }
+                out << "  ]\n}\n";
+                return out.str();
+            }
+
+            // Kayıtlı temel çizgiyi oku: isim -> ns/iter
+            static std::map<std::string, double> loadBaseline(const std::string& path) {
+                std::ifstream file(path);
+                if (!file) throw std::runtime_error("Cannot read baseline: " + path);
+                std::stringstream buffer;
+                buffer << file.rdbuf();
+                std::string json = buffer.str();
+
+                std::map<std::string, double> baseline;
+                std::regex entry("\"name\":\\s*\"((?:[^\"\\\\]|\\\\.)*)\"[^}]*?\"ns_per_iter\":\\s*([0-9.eE+-]+)");
+                for (std::sregex_iterator it(json.begin(), json.end(), entry), end; it != end; ++it) {
+                    baseline[unescapeJson((*it)[1].str())] = std::stod((*it)[2].str());
+                }
+                return baseline;
+            }
+
+            // Eşiği aşan gerilemeleri raporla; gerileme sayısını döndürür
+            size_t compare(const std::vector<Result>& results, const std::map<std::string, double>& baseline) const {
+                size_t regressions = 0;
+                std::printf("\n%-48s %14s %14s %9s\n", "benchmark", "baseline ns", "current ns", "change");
+                for (const auto& result : results) {
+                    auto it = baseline.find(result.name);
+                    if (it == baseline.end() || it->second <= 0) continue;
+                    double change = result.nsPerIteration / it->second - 1.0;
+                    bool regressed = change > options.threshold;
+                    if (regressed) regressions++;
+                    std::printf("%-48s %14.1f %14.1f %+8.1f%%%s\n", result.name.c_str(), it->second,
+                                result.nsPerIteration, change * 100.0, regressed ? "  REGRESSION" : "");
+                }
+                return regressions;
+            }
+
+        private:
+            Options options;
+
+            struct Measurement {
+                double nanoseconds;
+                uint64_t bytesPerIteration;
+                uint64_t itemsPerIteration;
+                std::map<std::string, double> counters;
+            };
+
+            static Measurement runOnce(const Case& benchmark, size_t iterations) {
+                State state(iterations);
+                auto started = std::chrono::steady_clock::now();
+                benchmark.function(state);
+                auto elapsed = std::chrono::steady_clock::now() - started - state.paused;
+                return Measurement{std::chrono::duration<double, std::nano>(elapsed).count(),
+                                   state.bytesPerIteration, state.itemsPerIteration, state.counters};
+            }
+
+            Result measure(const Case& benchmark) {
+                // Isınma ve tur sayısı kalibrasyonu: her tekrar en az minSeconds sürsün
+                size_t iterations = 1;
+                Measurement measurement = runOnce(benchmark, iterations);
+                while (measurement.nanoseconds < options.minSeconds * 1e9 && iterations < (size_t(1) << 40)) {
+                    double scale = measurement.nanoseconds > 0
+                        ? std::min(10.0, std::max(2.0, options.minSeconds * 1e9 * 1.2 / measurement.nanoseconds))
+                        : 10.0;
+                    iterations = static_cast<size_t>(static_cast<double>(iterations) * scale);
+                    measurement = runOnce(benchmark, iterations);
+                }
+
+                std::vector<double> samples;
+                for (size_t i = 0; i < std::max<size_t>(1, options.repetitions); i++) {
+                    measurement = runOnce(benchmark, iterations);
+                    samples.push_back(measurement.nanoseconds / static_cast<double>(iterations));
+                }
+                std::sort(samples.begin(), samples.end());
+
+                double mean = 0;
+                for (double sample : samples) mean += sample;
+                mean /= static_cast<double>(samples.size());
+                double variance = 0;
+                for (double sample : samples) variance += (sample - mean) * (sample - mean);
+
+                Result result;
+                result.name = benchmark.name;
+                result.iterations = iterations;
+                // Gürültüye dayanıklılık için medyan
+                result.nsPerIteration = samples[samples.size() / 2];
+                result.minNs = samples.front();
+                result.stddevNs = std::sqrt(variance / static_cast<double>(samples.size()));
+                result.counters = measurement.counters;
+                if (measurement.bytesPerIteration) {
+                    result.bytesPerSecond = static_cast<double>(measurement.bytesPerIteration) * 1e9 / result.nsPerIteration;
+                }
+                if (measurement.itemsPerIteration) {
+                    result.itemsPerSecond = static_cast<double>(measurement.itemsPerIteration) * 1e9 / result.nsPerIteration;
+                }
+                return result;
+            }
+        };
+
+        // Komut satırı: --filter=REGEX --json=PATH --baseline=PATH --threshold=0.05 --repetitions=N --min-time=SEC
+        inline int main(int argc, char** argv) {
+            Options options;
+            for (int i = 1; i < argc; i++) {
+                std::string argument = argv[i];
+                auto value = [&](const std::string& prefix) { return argument.substr(prefix.size()); };
+                if (argument.rfind("--filter=", 0) == 0) options.filter = value("--filter=");
+                else if (argument.rfind("--json=", 0) == 0) options.jsonPath = value("--json=");
+                else if (argument.rfind("--baseline=", 0) == 0) options.baselinePath = value("--baseline=");
+                else if (argument.rfind("--threshold=", 0) == 0) options.threshold = std::stod(value("--threshold="));
+                else if (argument.rfind("--repetitions=", 0) == 0) options.repetitions = std::stoul(value("--repetitions="));
+                else if (argument.rfind("--min-time=", 0) == 0) options.minSeconds = std::stod(value("--min-time="));
+                else {
+                    std::fprintf(stderr, "Unknown argument: %s\n", argument.c_str());
+                    return 2;
+                }
+            }
+
+            Runner runner(options);
+            std::vector<Result> results = runner.run();
+
+            if (!options.jsonPath.empty()) {
+                std::ofstream file(options.jsonPath);
+                file << Runner::toJson(results);
+            }
+
+            if (!options.baselinePath.empty()) {
+                size_t regressions = runner.compare(results, Runner::loadBaseline(options.baselinePath));
+                if (regressions > 0) {
+                    std::printf("\n%zu benchmark(s) regressed beyond %.1f%%\n", regressions, options.threshold * 100.0);
+                    return 1;
+                }
+            }
+            return 0;
+        }
+    }
+}
+
+#define WHOLF_BENCH_CONCAT_INNER(a, b) a##b
+#define WHOLF_BENCH_CONCAT(a, b) WHOLF_BENCH_CONCAT_INNER(a, b)
+
+// Benchmark kaydı: WHOLF_BENCHMARK("grup/isim") { for (size_t i = 0; i < state.iterations; i++) ... }
+#define WHOLF_BENCHMARK(name) \
+    static void WHOLF_BENCH_CONCAT(wholfBenchmark, __LINE__)(::Wholf::Bench::State& state); \
+    static ::Wholf::Bench::Registration WHOLF_BENCH_CONCAT(wholfRegistration, __LINE__)(name, &WHOLF_BENCH_CONCAT(wholfBenchmark, __LINE__)); \
+    static void WHOLF_BENCH_CONCAT(wholfBenchmark, __LINE__)(::Wholf::Bench::State& state)
+
+#endif // WHOLF_BENCHMARK_HPP
@@ -0,0 +1,1790 @@
+// Wholf benchmark paketi
+//
+// Derleme: g++ -std=c++17 -O2 -pthread -I../src wholf_bench.cpp -o wholf_bench
+// Kullanım: ./wholf_bench --json=current.json
+//           ./wholf_bench --baseline=baseline.json --threshold=0.05   (gerileme varsa çıkış kodu 1)
+
+#include "benchmark.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "interpreter/Scanner.hpp"
+#include "interpreter/Parser.hpp"
+#include "interpreter/Scheduler.hpp"
+#include "interpreter/WholfInterpreter.hpp"
+#include "runtime/fegn.hpp"
+#include "runtime/durable.hpp"
+#include "runtime/events.hpp"
+#include "runtime/file.hpp"
+#include "runtime/http.hpp"
+#include "runtime/import.hpp"
+#include "runtime/json.hpp"
+#include "runtime/metrics.hpp"
+#include "runtime/module.hpp"
+#include "runtime/numeric.hpp"
+#include "runtime/package.hpp"
+#include "runtime/stdlib.hpp"
+#include "runtime/style.hpp"
+#include "runtime/table.hpp"
+
+namespace {
+    using Wholf::Bench::doNotOptimize;
+
+    // Sabit tohumlu, tekrarlanabilir kaynak üretimi
+    std::string generateSource(size_t statements) {
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> number(0, 9999);
+        std::string source;
+        source.reserve(statements * 48);
+        for (size_t i = 0; i < statements; i++) {
+            switch (i % 4) {
+                case 0:
+                    source += "let x" + std::to_string(i) + " = " + std::to_string(number(random)) + " + y * 3;\n";
+                    break;
+                case 1:
+                    source += "if (x" + std::to_string(i - 1) + " >= 10) { z = \"metin\"; }\n";
+                    break;
+                case 2:
+                    source += "// yorum satırı " + std::to_string(number(random)) + "\n";
+                    break;
+                default:
+                    source += "while (i < " + std::to_string(number(random)) + ") { i = i + 1; }\n";
+                    break;
+            }
+        }
+        return source;
+    }
+
+    // Uzun aritmetik ifade: 1 + 2 * 3 - 4 / 5 + ...
+    std::string generateArithmetic(size_t terms) {
+        static const char operators[] = {'+', '*', '-', '/'};
+        std::string expression = "1";
+        for (size_t i = 0; i < terms; i++) {
+            expression += ' ';
+            expression += operators[i % 4];
+            expression += ' ';
+            expression += std::to_string(i % 97 + 1);
+        }
+        return expression;
+    }
+
+    std::string temporaryPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("wholf_bench_" + name)).string();
+    }
+
+    int addIntegers(int a, int b) { return a + b; }
+}
+
+// --- Scanner ---
+
+WHOLF_BENCHMARK("scanner/scanTokens/1MB") {
+    state.pauseTiming();
+    std::string source = generateSource(24000);
+    state.resumeTiming();
+    state.setBytesPerIteration(source.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Scanner scanner(source);
+        auto tokens = scanner.scanTokens();
+        doNotOptimize(tokens);
+    }
+}
+
+// --- Parser ---
+
+WHOLF_BENCHMARK("parser/parse/generated-large") {
+    state.pauseTiming();
+    std::string source = generateSource(24000);
+    Wholf::Scanner scanner(source);
+    std::vector<Wholf::Token> tokens = scanner.scanTokens();
+    state.resumeTiming();
+    state.setItemsPerIteration(tokens.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Parser parser(tokens);
+        auto ast = parser.parse();
+        doNotOptimize(ast);
+    }
+}
+
+// --- Değerlendirici ---
+
+WHOLF_BENCHMARK("interpreter/arithmetic/1000-terms") {
+    state.pauseTiming();
+    std::string expression = generateArithmetic(1000);
+    Wholf::Interpreter interpreter;
+    state.resumeTiming();
+    state.setItemsPerIteration(1000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Value result = interpreter.interpret(expression);
+        doNotOptimize(result);
+    }
+}
+
+WHOLF_BENCHMARK("interpreter/nativeCall/slot") {
+    state.pauseTiming();
+    Wholf::Interpreter interpreter;
+    interpreter.bind<&addIntegers>("topla");
+    size_t slot = interpreter.resolveNative("topla");
+    std::vector<Wholf::Value> args{Wholf::Value(1), Wholf::Value(2)};
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Value result = interpreter.callNative(slot, args);
+        doNotOptimize(result);
+    }
+}
+
+WHOLF_BENCHMARK("interpreter/nativeCall/std-function-map") {
+    // Karşılaştırma: eski std::map + std::function yolu
+    state.pauseTiming();
+    std::map<std::string, std::function<Wholf::Value()>> functions;
+    functions["topla"] = []() { return Wholf::Value(addIntegers(1, 2)); };
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Value result = functions["topla"]();
+        doNotOptimize(result);
+    }
+}
+
+WHOLF_BENCHMARK("interpreter/startup/cold-prelude") {
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Interpreter interpreter;
+        for (int g = 0; g < 10000; g++) {
+            std::map<std::string, Wholf::Value> config;
+            config.emplace("id", Wholf::Value(g));
+            config.emplace("name", Wholf::Value(std::string("global_") + std::to_string(g)));
+            interpreter.setGlobal("g" + std::to_string(g), Wholf::Value(config));
+        }
+        Wholf::Value value(nullptr);
+        interpreter.getGlobal("g9999", value);
+        doNotOptimize(value);
+    }
+}
+
+WHOLF_BENCHMARK("interpreter/startup/snapshot-restore") {
+    state.pauseTiming();
+    std::string path = temporaryPath("prelude.snap");
+    {
+        Wholf::Interpreter prelude;
+        for (int g = 0; g < 10000; g++) {
+            std::map<std::string, Wholf::Value> config;
+            config.emplace("id", Wholf::Value(g));
+            config.emplace("name", Wholf::Value(std::string("global_") + std::to_string(g)));
+            prelude.setGlobal("g" + std::to_string(g), Wholf::Value(config));
+        }
+        prelude.saveSnapshot(path);
+    }
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Interpreter interpreter;
+        interpreter.restoreSnapshot(path);
+        Wholf::Value value(nullptr);
+        interpreter.getGlobal("g9999", value);
+        doNotOptimize(value);
+    }
+    std::remove(path.c_str());
+}
+
+// --- Metrics::Registry ---
+// Olay başına maliyet. WHOLF_METRICS'in toplam etkisi için wholf_bench ile wholf_bench_metrics
+// aynı süzgeçle karşılaştırılır (ör. --filter=^interpreter/)
+
+WHOLF_BENCHMARK("metrics/counter-add") {
+    state.pauseTiming();
+    Wholf::Metrics::Registry::add(Wholf::Metrics::Counter::NATIVE_CALLS, 1);
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Metrics::Registry::add(Wholf::Metrics::Counter::NATIVE_CALLS, 1);
+    }
+}
+
+WHOLF_BENCHMARK("metrics/histogram-record") {
+    state.pauseTiming();
+    Wholf::Metrics::Registry::record(Wholf::Metrics::Histogram::MODULE_CALL_LATENCY, 1);
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Metrics::Registry::record(Wholf::Metrics::Histogram::MODULE_CALL_LATENCY, 100 + (i & 0xffff));
+    }
+}
+
+WHOLF_BENCHMARK("metrics/thread-churn") {
+    // Sonlanan thread'lerin parçaları emekliye katılır; canlı parça sayısı büyümez
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::thread([]() { Wholf::Metrics::Registry::add(Wholf::Metrics::Counter::NATIVE_CALLS, 1); }).join();
+    }
+    state.setCounter("live_shards", static_cast<double>(Wholf::Metrics::Registry::instance().liveShards()));
+}
+
+// --- Scheduler ---
+
+namespace {
+    // Kısa betiklerin bitiş anı; betik sonunda bitti(id) ile yazılır
+    std::vector<std::chrono::steady_clock::time_point> shortFinished;
+
+    int finished(int id) {
+        shortFinished[id] = std::chrono::steady_clock::now();
+        return id;
+    }
+
+    // Uzun betikler çalışırken gelen kısa betiklerin gönderimden bitişe gecikmesi
+    void shortScriptLatency(Wholf::Bench::State& state, uint64_t sliceInstructions) {
+        const int shortCount = 200;
+        std::vector<double> latencies;
+        for (size_t i = 0; i < state.iterations; i++) {
+            Wholf::Scheduler::Options options;
+            options.threads = 2;
+            options.sliceInstructions = sliceInstructions;
+            Wholf::Scheduler scheduler(options);
+            std::vector<std::shared_ptr<Wholf::ScriptTask>> tasks;
+            for (int l = 0; l < 4; l++) {
+                tasks.push_back(scheduler.submit("batch", "let s = 0; for (let i = 0; i < 30000; i = i + 1) { s = s + i; } s"));
+            }
+            shortFinished.assign(shortCount, std::chrono::steady_clock::time_point());
+            std::vector<std::chrono::steady_clock::time_point> submitted(shortCount);
+            for (int id = 0; id < shortCount; id++) {
+                auto interpreter = std::make_shared<Wholf::Interpreter>();
+                interpreter->bind("bitti", &finished);
+                submitted[id] = std::chrono::steady_clock::now();
+                tasks.push_back(scheduler.submit("web", "let x = 1 + 2 * 3; bitti(" + std::to_string(id) + ")", interpreter));
+            }
+            for (const auto& task : tasks) task->result().wait();
+            for (int id = 0; id < shortCount; id++) {
+                latencies.push_back(std::chrono::duration<double, std::micro>(shortFinished[id] - submitted[id]).count());
+            }
+        }
+        std::sort(latencies.begin(), latencies.end());
+        state.setCounter("p50_us", latencies[latencies.size() / 2]);
+        state.setCounter("p99_us", latencies[latencies.size() * 99 / 100]);
+    }
+}
+
+WHOLF_BENCHMARK("scheduler/short-latency/time-sliced") {
+    shortScriptLatency(state, 1000);
+}
+
+WHOLF_BENCHMARK("scheduler/short-latency/fifo") {
+    // Karşılaştırma: dilimsiz, her betik bitene kadar worker'ı tutar
+    shortScriptLatency(state, Wholf::ExecutionControl::UNLIMITED);
+}
+
+// --- Fegn::DataStore ---
+
+WHOLF_BENCHMARK("fegn/DataStore/set") {
+    state.pauseTiming();
+    std::vector<std::string> keys;
+    for (int k = 0; k < 100000; k++) keys.push_back("anahtar:" + std::to_string(k));
+    state.resumeTiming();
+    state.setItemsPerIteration(keys.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Fegn::DataStore store;
+        for (const auto& key : keys) store.set(key, "deger");
+        doNotOptimize(store);
+    }
+}
+
+WHOLF_BENCHMARK("fegn/DataStore/get") {
+    state.pauseTiming();
+    Wholf::Fegn::DataStore store;
+    std::vector<std::string> keys;
+    for (int k = 0; k < 100000; k++) {
+        keys.push_back("anahtar:" + std::to_string(k));
+        store.set(keys.back(), "deger");
+    }
+    state.resumeTiming();
+    state.setItemsPerIteration(keys.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        for (const auto& key : keys) {
+            auto value = store.get(key);
+            doNotOptimize(value);
+        }
+    }
+}
+
+namespace {
+    // Eşzamanlı okuma ölçeklenmesi: her thread kendi anahtar dilimini okur
+    void concurrentGet(Wholf::Bench::State& state, size_t threads) {
+        state.pauseTiming();
+        Wholf::Fegn::DataStore store;
+        std::vector<std::string> keys;
+        for (int k = 0; k < 100000; k++) {
+            keys.push_back("anahtar:" + std::to_string(k));
+            store.set(keys.back(), "deger");
+        }
+        state.resumeTiming();
+        state.setItemsPerIteration(keys.size());
+        for (size_t i = 0; i < state.iterations; i++) {
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; t++) {
+                workers.emplace_back([&, t]() {
+                    std::string value;
+                    for (size_t k = t; k < keys.size(); k += threads) {
+                        store.tryGet(keys[k], value);
+                        doNotOptimize(value);
+                    }
+                });
+            }
+            for (auto& worker : workers) worker.join();
+        }
+    }
+}
+
+WHOLF_BENCHMARK("fegn/DataStore/concurrent-get/threads:1") { concurrentGet(state, 1); }
+WHOLF_BENCHMARK("fegn/DataStore/concurrent-get/threads:2") { concurrentGet(state, 2); }
+WHOLF_BENCHMARK("fegn/DataStore/concurrent-get/threads:4") { concurrentGet(state, 4); }
+WHOLF_BENCHMARK("fegn/DataStore/concurrent-get/threads:8") { concurrentGet(state, 8); }
+
+WHOLF_BENCHMARK("fegn/DataStore/set/byte-budget") {
+    state.pauseTiming();
+    std::vector<std::string> keys;
+    for (int k = 0; k < 100000; k++) keys.push_back("anahtar:" + std::to_string(k));
+    state.resumeTiming();
+    state.setItemsPerIteration(keys.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Fegn::DataStore::Options options;
+        options.byteBudget = 1 << 20;
+        Wholf::Fegn::DataStore store(options);
+        for (const auto& key : keys) store.set(key, "deger");
+        doNotOptimize(store);
+    }
+}
+
+// --- Fegn::EventBus ---
+
+WHOLF_BENCHMARK("fegn/EventBus/publish/1000-topics") {
+    state.pauseTiming();
+    Wholf::Fegn::EventBus bus;
+    std::atomic<uint64_t> received{0};
+    std::vector<Wholf::Fegn::EventBus::Channel> channels;
+    for (int t = 0; t < 1000; t++) {
+        std::string name = "olay:" + std::to_string(t);
+        for (int h = 0; h < 4; h++) bus.subscribe(name, [&](const Wholf::Fegn::EventMessage&) { received.fetch_add(1, std::memory_order_relaxed); });
+        channels.push_back(bus.channel(name));
+    }
+    state.resumeTiming();
+    state.setItemsPerIteration(10000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        for (int p = 0; p < 10000; p++) bus.publish("olay:" + std::to_string(p % 1000));
+        bus.flush();
+    }
+    doNotOptimize(received);
+}
+
+WHOLF_BENCHMARK("fegn/EventBus/publish/sync-fast-path") {
+    state.pauseTiming();
+    Wholf::Fegn::EventBus bus;
+    uint64_t received = 0;
+    bus.subscribe("olay", [&](const Wholf::Fegn::EventMessage&) { received++; }, Wholf::Fegn::Delivery::SYNC);
+    auto channel = bus.channel("olay");
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) bus.publish(channel);
+    doNotOptimize(received);
+}
+
+WHOLF_BENCHMARK("fegn/EventBus/end-to-end-latency") {
+    state.pauseTiming();
+    Wholf::Fegn::EventBus bus;
+    std::vector<uint64_t> latencies;
+    latencies.reserve(state.iterations);
+    bus.subscribe("olay", [&](const Wholf::Fegn::EventMessage& message) {
+        latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - message.publishedAt).count()));
+    });
+    auto channel = bus.channel("olay");
+    state.resumeTiming();
+    // Tek tek yayın: kuyruk birikmesi değil, uyanma + teslim gecikmesi ölçülür
+    for (size_t i = 0; i < state.iterations; i++) {
+        bus.publish(channel);
+        bus.flush();
+    }
+    state.pauseTiming();
+    std::sort(latencies.begin(), latencies.end());
+    if (!latencies.empty()) {
+        state.setCounter("p50_ns", static_cast<double>(latencies[latencies.size() / 2]));
+        state.setCounter("p99_ns", static_cast<double>(latencies[latencies.size() * 99 / 100]));
+        state.setCounter("p999_ns", static_cast<double>(latencies[latencies.size() * 999 / 1000]));
+    }
+    state.resumeTiming();
+}
+
+// --- Fegn::Stream ---
+
+namespace {
+    // Üç aşamalı boru hattı: ayrıştır -> süz -> dönüştür
+    void streamPipeline(Wholf::Bench::State& state, size_t parallelism, bool ordered) {
+        state.pauseTiming();
+        std::vector<Wholf::Fegn::Record> records;
+        for (int r = 0; r < 1000000; r++) records.emplace_back("kayit:" + std::to_string(r) + ":deger");
+        state.resumeTiming();
+        state.setItemsPerIteration(records.size());
+        Wholf::Fegn::StageOptions options;
+        options.parallelism = parallelism;
+        options.ordered = ordered;
+        for (size_t i = 0; i < state.iterations; i++) {
+            uint64_t bytes = 0;
+            Wholf::Fegn::Stream stream;
+            stream.fromRecords(records, 1024)
+                .map([](const Wholf::Fegn::Record& record) {
+                    // Sıfır kopya: aynı tamponun alt dilimi
+                    std::string_view view = record.view();
+                    return record.slice(view.find(':') + 1, view.rfind(':') - view.find(':') - 1);
+                }, options)
+                .filter([](const Wholf::Fegn::Record& record) { return record.view().back() != '7'; }, options)
+                .stage([](Wholf::Fegn::Batch& batch) {
+                    for (auto& record : batch) doNotOptimize(record);
+                }, options)
+                .pipe([&](const Wholf::Fegn::Batch& batch) {
+                    for (const auto& record : batch) bytes += record.size();
+                });
+            stream.run();
+            doNotOptimize(bytes);
+        }
+    }
+}
+
+WHOLF_BENCHMARK("fegn/Stream/3-stage/parallel:1") { streamPipeline(state, 1, true); }
+WHOLF_BENCHMARK("fegn/Stream/3-stage/parallel:4/ordered") { streamPipeline(state, 4, true); }
+WHOLF_BENCHMARK("fegn/Stream/3-stage/parallel:4/unordered") { streamPipeline(state, 4, false); }
+
+WHOLF_BENCHMARK("fegn/Stream/file-lines/64MB") {
+    state.pauseTiming();
+    std::string path = temporaryPath("stream.txt");
+    {
+        std::string content;
+        content.reserve(64 << 20);
+        for (size_t line = 0; content.size() < (64u << 20); line++) content += "satir " + std::to_string(line) + " metin\n";
+        Wholf::File::FileOperations files;
+        files.writeFile(path, content);
+        state.setBytesPerIteration(content.size());
+    }
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        uint64_t lines = 0;
+        Wholf::Fegn::Stream stream;
+        stream.fromFile(path).pipe([&](const Wholf::Fegn::Batch& batch) { lines += batch.size(); });
+        stream.run();
+        doNotOptimize(lines);
+    }
+    std::remove(path.c_str());
+}
+
+// --- Http::Client (yerel sunucuya karşı) ---
+
+namespace {
+    void httpLoad(Wholf::Bench::State& state, size_t concurrency, size_t pipelineDepth) {
+        state.pauseTiming();
+        Wholf::Http::LocalServer server([](const Wholf::Http::Request&, Wholf::Http::Response& response) {
+            response.body = "{\"durum\": \"tamam\"}";
+        });
+        Wholf::Http::Client client;
+        Wholf::Http::LoadGenerator::Options options;
+        options.url = server.url("/saglik");
+        options.concurrency = concurrency;
+        options.pipelineDepth = pipelineDepth;
+        options.requests = 2000;
+        state.resumeTiming();
+        state.setItemsPerIteration(options.requests);
+        Wholf::Http::LoadGenerator::Report report;
+        for (size_t i = 0; i < state.iterations; i++) report = Wholf::Http::LoadGenerator::run(client, options);
+        state.setCounter("p50_us", static_cast<double>(report.p50Micros));
+        state.setCounter("p99_us", static_cast<double>(report.p99Micros));
+        state.setCounter("errors", static_cast<double>(report.errors));
+    }
+}
+
+WHOLF_BENCHMARK("http/keep-alive/concurrency:4") { httpLoad(state, 4, 1); }
+WHOLF_BENCHMARK("http/pipelined/concurrency:4/depth:16") { httpLoad(state, 4, 16); }
+
+WHOLF_BENCHMARK("http/new-connection-per-request") {
+    // Karşılaştırma: havuz olmadan her istekte yeni bağlantı
+    state.pauseTiming();
+    Wholf::Http::LocalServer server([](const Wholf::Http::Request&, Wholf::Http::Response& response) {
+        response.body = "{\"durum\": \"tamam\"}";
+    });
+    Wholf::Http::Request request;
+    request.url = server.url("/saglik");
+    request.headers.emplace_back("Connection", "close");
+    Wholf::Http::Client client;
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Http::Response response = client.send(request);
+        doNotOptimize(response);
+    }
+}
+
+WHOLF_BENCHMARK("http/body-into-caller-buffer/4MB") {
+    state.pauseTiming();
+    Wholf::Http::LocalServer server([](const Wholf::Http::Request&, Wholf::Http::Response& response) {
+        response.body.assign(4 << 20, 'h');
+    });
+    Wholf::Http::Request request;
+    request.url = server.url("/veri");
+    Wholf::Http::Client client;
+    std::vector<char> buffer(4 << 20);
+    state.resumeTiming();
+    state.setBytesPerIteration(buffer.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Http::Response response = client.send(request, buffer.data(), buffer.size());
+        doNotOptimize(response);
+    }
+}
+
+// --- Fegn::DurableStore ---
+
+namespace {
+    // Yazma verimi: 4 thread, politika başına
+    void durableWrites(Wholf::Bench::State& state, Wholf::Fegn::FsyncPolicy policy) {
+        state.pauseTiming();
+        std::string directory = temporaryPath("durable_writes");
+        std::filesystem::remove_all(directory);
+        Wholf::Fegn::DurableStore::Options options;
+        options.fsync = policy;
+        options.compactionBytes = 0;
+        Wholf::Fegn::DurableStore store(directory, options);
+        const size_t threads = 4;
+        const size_t perThread = policy == Wholf::Fegn::FsyncPolicy::ALWAYS ? 256 : 25000;
+        state.resumeTiming();
+        state.setItemsPerIteration(threads * perThread);
+        for (size_t i = 0; i < state.iterations; i++) {
+            std::vector<std::thread> writers;
+            for (size_t t = 0; t < threads; t++) {
+                writers.emplace_back([&, t]() {
+                    for (size_t k = 0; k < perThread; k++) store.set("anahtar:" + std::to_string(t) + ":" + std::to_string(k), "deger");
+                });
+            }
+            for (auto& writer : writers) writer.join();
+        }
+        store.sync();
+        state.pauseTiming();
+        std::filesystem::remove_all(directory);
+        state.resumeTiming();
+    }
+
+    // Kurtarma: 10M anahtarlık snapshot + 1% günlük kuyruğu
+    void durableRecovery(Wholf::Bench::State& state, size_t keys) {
+        state.pauseTiming();
+        std::string directory = temporaryPath("durable_recovery");
+        std::filesystem::remove_all(directory);
+        {
+            Wholf::Fegn::DurableStore::Options options;
+            options.fsync = Wholf::Fegn::FsyncPolicy::NEVER;
+            options.compactionBytes = 0;
+            Wholf::Fegn::DurableStore store(directory, options);
+            for (size_t k = 0; k < keys; k++) store.set("anahtar:" + std::to_string(k), "deger");
+            store.compact();
+            for (size_t k = 0; k < keys / 100; k++) store.set("anahtar:" + std::to_string(k), "yeni");
+        }
+        state.resumeTiming();
+        state.setItemsPerIteration(keys);
+        for (size_t i = 0; i < state.iterations; i++) {
+            Wholf::Fegn::DurableStore store(directory);
+            doNotOptimize(store);
+        }
+        state.pauseTiming();
+        std::filesystem::remove_all(directory);
+        state.resumeTiming();
+    }
+}
+
+WHOLF_BENCHMARK("fegn/DurableStore/set/fsync:never") { durableWrites(state, Wholf::Fegn::FsyncPolicy::NEVER); }
+WHOLF_BENCHMARK("fegn/DurableStore/set/fsync:interval") { durableWrites(state, Wholf::Fegn::FsyncPolicy::INTERVAL); }
+WHOLF_BENCHMARK("fegn/DurableStore/set/fsync:always") { durableWrites(state, Wholf::Fegn::FsyncPolicy::ALWAYS); }
+WHOLF_BENCHMARK("fegn/DurableStore/recovery/10M") { durableRecovery(state, 10000000); }
+
+// --- File::FileOperations ---
+
+WHOLF_BENCHMARK("file/readFile/4MB") {
+    state.pauseTiming();
+    std::string path = temporaryPath("read.txt");
+    Wholf::File::FileOperations files;
+    std::string content(4 << 20, 'w');
+    files.writeFile(path, content);
+    state.resumeTiming();
+    state.setBytesPerIteration(content.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::string read;
+        files.readFile(path, read);
+        doNotOptimize(read);
+    }
+    files.deleteFile(path);
+}
+
+namespace {
+    // Tepe RSS'i (VmHWM) sıfırla; Linux 4.0+ clear_refs "5" destekler
+    void resetPeakRss() {
+        std::ofstream("/proc/self/clear_refs") << "5";
+    }
+
+    size_t statusKilobytes(const char* field) {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        size_t length = std::strlen(field);
+        while (std::getline(status, line)) {
+            if (line.compare(0, length, field) == 0) return std::strtoull(line.c_str() + length, nullptr, 10);
+        }
+        return 0;
+    }
+
+    // 256MB satır dosyası; okuma + tarama, tepe RSS artışı sayaç olarak raporlanır
+    const size_t LARGE_FILE_BYTES = 256u << 20;
+
+    std::string largeLineFile() {
+        std::string path = temporaryPath("read_large.txt");
+        if (std::filesystem::exists(path) && std::filesystem::file_size(path) == LARGE_FILE_BYTES) return path;
+        std::string line(63, 'w');
+        line += '\n';
+        std::string chunk;
+        while (chunk.size() < (1u << 20)) chunk += line;
+        std::ofstream out(path, std::ios::binary);
+        for (size_t written = 0; written < LARGE_FILE_BYTES; written += chunk.size()) out.write(chunk.data(), chunk.size());
+        return path;
+    }
+
+    // Her okuma ayrı bir süreçte (fork) yapılır: önceki varyantların yığında bıraktıkları ya da
+    // hâlâ eşli sayfalar tepe RSS'e karışmaz. Süreye fork/waitpid maliyeti de dahildir
+    template<typename Reader>
+    void largeFileRead(Wholf::Bench::State& state, Reader read) {
+        state.pauseTiming();
+        std::string path = largeLineFile();
+        state.resumeTiming();
+        state.setBytesPerIteration(LARGE_FILE_BYTES);
+        size_t peak = 0;
+        for (size_t i = 0; i < state.iterations; i++) {
+            int channel[2];
+            if (::pipe(channel) != 0) throw std::runtime_error("pipe failed");
+            pid_t child = ::fork();
+            if (child < 0) throw std::runtime_error("fork failed");
+            if (child == 0) {
+                ::close(channel[0]);
+                resetPeakRss();
+                size_t baseline = statusKilobytes("VmRSS:");
+                size_t lines = read(path);
+                doNotOptimize(lines);
+                size_t high = statusKilobytes("VmHWM:");
+                size_t growth = high > baseline ? high - baseline : 0;
+                bool sent = ::write(channel[1], &growth, sizeof(growth)) == static_cast<ssize_t>(sizeof(growth));
+                ::_exit(sent && lines > 0 ? 0 : 1);
+            }
+            ::close(channel[1]);
+            size_t growth = 0;
+            bool received = ::read(channel[0], &growth, sizeof(growth)) == static_cast<ssize_t>(sizeof(growth));
+            ::close(channel[0]);
+            int status = 0;
+            ::waitpid(child, &status, 0);
+            if (!received || !WIFEXITED(status) || WEXITSTATUS(status) != 0) throw std::runtime_error("large file read failed in child process");
+            peak = std::max(peak, growth);
+        }
+        state.setCounter("peak_rss_mb", static_cast<double>(peak) / 1024.0);
+    }
+
+    size_t countLines(std::string_view text) {
+        return static_cast<size_t>(std::count(text.begin(), text.end(), '\n'));
+    }
+}
+
+// Eski yol: ifstream + stringstream (iki kopya)
+WHOLF_BENCHMARK("file/read-256MB/stringstream") {
+    largeFileRead(state, [](const std::string& path) {
+        std::ifstream file(path);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return countLines(buffer.str());
+    });
+}
+
+WHOLF_BENCHMARK("file/read-256MB/readFile") {
+    Wholf::File::FileOperations files;
+    largeFileRead(state, [&](const std::string& path) {
+        std::string content;
+        files.readFile(path, content);
+        return countLines(content);
+    });
+}
+
+WHOLF_BENCHMARK("file/read-256MB/mmap-value") {
+    Wholf::File::FileOperations files;
+    largeFileRead(state, [&](const std::string& path) {
+        Wholf::Value value = files.readValue(path);
+        return countLines(value.text());
+    });
+}
+
+// Akan satır okuma: sabit tampon, tepe RSS dosya boyutundan bağımsız
+WHOLF_BENCHMARK("file/read-256MB/lines") {
+    Wholf::File::FileOperations files;
+    largeFileRead(state, [&](const std::string& path) {
+        size_t lines = 0;
+        for (std::string_view line : files.lines(path)) {
+            doNotOptimize(line);
+            lines++;
+        }
+        return lines;
+    });
+}
+
+WHOLF_BENCHMARK("file/writeFile/4MB") {
+    state.pauseTiming();
+    std::string path = temporaryPath("write.txt");
+    Wholf::File::FileOperations files;
+    std::string content(4 << 20, 'w');
+    state.resumeTiming();
+    state.setBytesPerIteration(content.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        files.writeFile(path, content);
+    }
+    files.deleteFile(path);
+}
+
+WHOLF_BENCHMARK("file/writeFile/small-many") {
+    state.pauseTiming();
+    std::string path = temporaryPath("small.txt");
+    Wholf::File::FileOperations files;
+    state.resumeTiming();
+    state.setItemsPerIteration(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        files.writeFile(path, "satir\n");
+    }
+    files.deleteFile(path);
+}
+
+// --- File::FileWriter ---
+
+namespace {
+    // 64 baytlık satırlarla 16MB; politika başına
+    void writerLines(Wholf::Bench::State& state, Wholf::File::FileWriter::Mode mode, Wholf::File::Durability durability) {
+        state.pauseTiming();
+        std::string path = temporaryPath("writer.log");
+        std::string line(63, 'g');
+        line += '\n';
+        const size_t lines = (16u << 20) / line.size();
+        Wholf::File::FileWriter::Options options;
+        options.mode = mode;
+        options.durability = durability;
+        options.bufferSize = 256 * 1024;
+        state.resumeTiming();
+        state.setBytesPerIteration(lines * line.size());
+        for (size_t i = 0; i < state.iterations; i++) {
+            Wholf::File::FileWriter writer(path, options);
+            for (size_t l = 0; l < lines; l++) writer.write(line);
+            writer.close();
+        }
+        state.pauseTiming();
+        std::filesystem::remove(path);
+        state.resumeTiming();
+    }
+}
+
+WHOLF_BENCHMARK("file/FileWriter/16MB-lines/durability:none") {
+    writerLines(state, Wholf::File::FileWriter::Mode::TRUNCATE, Wholf::File::Durability::NONE);
+}
+
+WHOLF_BENCHMARK("file/FileWriter/16MB-lines/durability:on-close") {
+    writerLines(state, Wholf::File::FileWriter::Mode::TRUNCATE, Wholf::File::Durability::ON_CLOSE);
+}
+
+WHOLF_BENCHMARK("file/FileWriter/16MB-lines/durability:always") {
+    writerLines(state, Wholf::File::FileWriter::Mode::TRUNCATE, Wholf::File::Durability::ALWAYS);
+}
+
+WHOLF_BENCHMARK("file/FileWriter/16MB-lines/atomic+on-close") {
+    writerLines(state, Wholf::File::FileWriter::Mode::ATOMIC, Wholf::File::Durability::ON_CLOSE);
+}
+
+// Eski yol: her satır için ofstream aç/kapat
+WHOLF_BENCHMARK("file/append-line/ofstream-per-call") {
+    state.pauseTiming();
+    std::string path = temporaryPath("append_legacy.log");
+    state.resumeTiming();
+    state.setItemsPerIteration(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::ofstream file(path, std::ios::app);
+        file << "satir\n";
+    }
+    std::filesystem::remove(path);
+}
+
+WHOLF_BENCHMARK("file/append-line/appendFile") {
+    state.pauseTiming();
+    std::string path = temporaryPath("append.log");
+    Wholf::File::FileOperations files;
+    state.resumeTiming();
+    state.setItemsPerIteration(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        files.appendFile(path, "satir\n");
+    }
+    std::filesystem::remove(path);
+}
+
+WHOLF_BENCHMARK("file/writeFileAtomic/4KB") {
+    state.pauseTiming();
+    std::string path = temporaryPath("atomic.txt");
+    Wholf::File::FileOperations files;
+    std::string content(4096, 'a');
+    state.resumeTiming();
+    state.setItemsPerIteration(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        files.writeFileAtomic(path, content);
+    }
+    files.deleteFile(path);
+}
+
+// --- File::AsyncFileOperations ---
+
+namespace {
+    const size_t SMALL_FILES = 10000;
+
+    std::vector<std::string> smallFilePaths() {
+        std::string directory = temporaryPath("small_files");
+        std::filesystem::create_directories(directory);
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < SMALL_FILES; i++) paths.push_back(directory + "/f" + std::to_string(i));
+        return paths;
+    }
+
+    // 10k x 4KB: toplu yaz, sonra toplu oku
+    void asyncSmallFiles(Wholf::Bench::State& state, Wholf::File::AsyncBackend backend) {
+        state.pauseTiming();
+        std::vector<std::string> paths = smallFilePaths();
+        Wholf::File::AsyncFileOperations::Options options;
+        options.backend = backend;
+        Wholf::File::AsyncFileOperations files(options);
+        std::string content(4096, 'k');
+        state.resumeTiming();
+        state.setItemsPerIteration(2 * SMALL_FILES);
+        for (size_t i = 0; i < state.iterations; i++) {
+            std::vector<Wholf::File::AsyncFileOperations::WriteRequest> requests;
+            for (const auto& path : paths) requests.push_back({path, content});
+            for (auto& written : files.writeFiles(std::move(requests))) doNotOptimize(written.get());
+            for (auto& read : files.readFiles(paths)) doNotOptimize(read.get());
+        }
+    }
+}
+
+WHOLF_BENCHMARK("file/small-files/10k/sync") {
+    state.pauseTiming();
+    std::vector<std::string> paths = smallFilePaths();
+    Wholf::File::FileOperations files;
+    std::string content(4096, 'k');
+    state.resumeTiming();
+    state.setItemsPerIteration(2 * SMALL_FILES);
+    for (size_t i = 0; i < state.iterations; i++) {
+        for (const auto& path : paths) files.writeFile(path, content);
+        for (const auto& path : paths) {
+            std::string read;
+            files.readFile(path, read);
+            doNotOptimize(read);
+        }
+    }
+}
+
+WHOLF_BENCHMARK("file/small-files/10k/async:uring") { asyncSmallFiles(state, Wholf::File::AsyncBackend::URING); }
+WHOLF_BENCHMARK("file/small-files/10k/async:threads") { asyncSmallFiles(state, Wholf::File::AsyncBackend::THREADS); }
+
+// --- File::DirectoryOperations ---
+
+namespace {
+    // 1000 dizinde 100k dosya; ağaç çalıştırmalar arasında yeniden kullanılır
+    std::string fileTree() {
+        std::string root = temporaryPath("watch_tree");
+        std::string marker = root + "/d999/f99";
+        if (std::filesystem::exists(marker)) return root;
+        for (int d = 0; d < 1000; d++) {
+            std::string directory = root + "/d" + std::to_string(d);
+            std::filesystem::create_directories(directory);
+            for (int f = 0; f < 100; f++) std::ofstream(directory + "/f" + std::to_string(f)) << "x";
+        }
+        return root;
+    }
+}
+
+WHOLF_BENCHMARK("file/walk/100k-files/recursive_directory_iterator") {
+    state.pauseTiming();
+    std::string root = fileTree();
+    state.resumeTiming();
+    state.setItemsPerIteration(101000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+            doNotOptimize(entry);
+            count++;
+        }
+        doNotOptimize(count);
+    }
+}
+
+namespace {
+    void walkTree(Wholf::Bench::State& state, Wholf::File::WalkOptions options) {
+        state.pauseTiming();
+        std::string root = fileTree();
+        Wholf::File::DirectoryOperations directories;
+        state.resumeTiming();
+        state.setItemsPerIteration(101000);
+        for (size_t i = 0; i < state.iterations; i++) {
+            std::atomic<size_t> count{0};
+            directories.walk(root, options, [&](const Wholf::File::DirectoryEntry& entry) {
+                doNotOptimize(entry);
+                count.fetch_add(1, std::memory_order_relaxed);
+                return Wholf::File::WalkAction::CONTINUE;
+            });
+            doNotOptimize(count);
+        }
+    }
+}
+
+WHOLF_BENCHMARK("file/walk/100k-files/threads:1") {
+    Wholf::File::WalkOptions options;
+    options.threads = 1;
+    walkTree(state, options);
+}
+
+WHOLF_BENCHMARK("file/walk/100k-files/threads:4") {
+    Wholf::File::WalkOptions options;
+    options.threads = 4;
+    walkTree(state, options);
+}
+
+WHOLF_BENCHMARK("file/walk/100k-files/glob+stat") {
+    Wholf::File::WalkOptions options;
+    options.glob = "f1*";
+    options.withStat = true;
+    walkTree(state, options);
+}
+
+// --- File::FileWatcher ---
+
+WHOLF_BENCHMARK("file/FileWatcher/watch/100k-files") {
+    state.pauseTiming();
+    std::string root = fileTree();
+    state.resumeTiming();
+    state.setItemsPerIteration(100000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::File::FileWatcher watcher;
+        watcher.watch(root, [](const Wholf::File::FileWatcher::ChangeSet&) {});
+        doNotOptimize(watcher);
+    }
+}
+
+// 1000 dosyaya yazma patlaması -> birleştirilmiş tek değişiklik kümesi
+WHOLF_BENCHMARK("file/FileWatcher/burst-1000-writes") {
+    state.pauseTiming();
+    std::string root = fileTree();
+    Wholf::File::FileWatcher::Options options;
+    options.debounce = std::chrono::milliseconds(5);
+    Wholf::File::FileWatcher watcher(options);
+    std::atomic<size_t> delivered{0};
+    watcher.watch(root, [&](const Wholf::File::FileWatcher::ChangeSet& changes) { delivered += changes.size(); });
+    state.resumeTiming();
+    state.setItemsPerIteration(1000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t target = delivered.load() + 1000;
+        for (int f = 0; f < 1000; f++) {
+            std::ofstream(root + "/d" + std::to_string(f) + "/f0") << i;
+        }
+        while (delivered.load() < target) std::this_thread::yield();
+    }
+    state.setCounter("batches", static_cast<double>(watcher.stats().batches) / static_cast<double>(state.iterations));
+}
+
+// --- Import::ImportManager ---
+
+namespace {
+    // 1000 modül; her modül kendinden küçük numaralı 3 modülü içe aktarır
+    std::string moduleProject() {
+        std::string root = temporaryPath("modules");
+        if (std::filesystem::exists(root + "/m999.wholf")) return root;
+        std::filesystem::create_directories(root);
+        std::mt19937 random(7);
+        for (int m = 0; m < 1000; m++) {
+            std::string source;
+            for (int d = 0; d < 3 && m > 0; d++) {
+                source += "import \"./m" + std::to_string(random() % m) + "\";\n";
+            }
+            source += generateSource(40);
+            std::ofstream(root + "/m" + std::to_string(m) + ".wholf") << source;
+        }
+        // Tüm modülleri bağlayan giriş noktası
+        std::ofstream main(root + "/main.wholf");
+        for (int m = 0; m < 1000; m++) main << "import \"./m" << m << "\";\n";
+        return root;
+    }
+}
+
+WHOLF_BENCHMARK("import/1000-modules/cold") {
+    state.pauseTiming();
+    std::string root = moduleProject();
+    state.resumeTiming();
+    state.setItemsPerIteration(1001);
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Import::ImportManager imports;
+        doNotOptimize(imports.importModule(root + "/main.wholf"));
+    }
+}
+
+WHOLF_BENCHMARK("import/1000-modules/warm") {
+    state.pauseTiming();
+    std::string root = moduleProject();
+    Wholf::Import::ImportManager imports;
+    imports.importModule(root + "/main.wholf");
+    state.resumeTiming();
+    state.setItemsPerIteration(1001);
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(imports.importModule(root + "/main.wholf"));
+    }
+}
+
+// Ortadaki bir modül değişti: yalnızca o ve bağımlıları yeniden okunur; içerik aynıysa derlenmez
+WHOLF_BENCHMARK("import/1000-modules/invalidate-one") {
+    state.pauseTiming();
+    std::string root = moduleProject();
+    Wholf::Import::ImportManager imports;
+    imports.importModule(root + "/main.wholf");
+    state.resumeTiming();
+    state.setItemsPerIteration(1);
+    for (size_t i = 0; i < state.iterations; i++) {
+        imports.invalidate(root + "/m500.wholf");
+        doNotOptimize(imports.importModule(root + "/main.wholf"));
+    }
+    state.setCounter("reads_per_iter", static_cast<double>(imports.stats().reads - 1001) / static_cast<double>(state.iterations));
+}
+
+// --- Json ---
+
+namespace {
+    // ~20 MB kayıt dizisi: sayılar, kaçışlı dizeler, iç içe nesneler
+    const std::string& jsonRecords() {
+        static std::string text;
+        if (!text.empty()) return text;
+        std::mt19937 random(3);
+        text = "[";
+        for (int i = 0; text.size() < 20 * 1024 * 1024; i++) {
+            if (i) text += ",\n";
+            text += "{\"id\": " + std::to_string(i) + ", \"name\": \"kullanıcı-" + std::to_string(random() % 100000) +
+                    "\", \"email\": \"u" + std::to_string(i) + "@ornek.com\", \"score\": " + std::to_string(random() % 1000) + "." +
+                    std::to_string(random() % 100) + ", \"active\": " + (i % 3 ? "true" : "false") +
+                    ", \"tags\": [\"a\", \"b\\n\", \"c\"], \"address\": {\"city\": \"İstanbul\", \"zip\": \"34" +
+                    std::to_string(random() % 1000) + "\", \"note\": null}}";
+        }
+        text += "]";
+        return text;
+    }
+
+    const char* jsonRecordSchema = R"({
+        "type": "object",
+        "required": ["id", "name", "email", "active"],
+        "additionalProperties": false,
+        "properties": {
+            "id": {"type": "integer", "minimum": 0},
+            "name": {"type": "string", "minLength": 1, "maxLength": 64},
+            "email": {"type": "string", "pattern": "^[^@]+@[^@]+$"},
+            "score": {"type": "number", "minimum": 0, "maximum": 1000},
+            "active": {"type": "boolean"},
+            "tags": {"type": "array", "items": {"type": "string"}, "maxItems": 16},
+            "address": {
+                "type": "object",
+                "properties": {
+                    "city": {"type": "string"},
+                    "zip": {"type": "string", "minLength": 4, "maxLength": 5},
+                    "note": {"type": ["string", "null"]}
+                }
+            }
+        }
+    })";
+}
+
+WHOLF_BENCHMARK("json/stage1-index/20MB") {
+    state.pauseTiming();
+    const std::string& text = jsonRecords();
+    Wholf::Json::StructuralIndex index;
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        index.build(text);
+        doNotOptimize(index.size());
+    }
+}
+
+WHOLF_BENCHMARK("json/document/20MB") {
+    state.pauseTiming();
+    const std::string& text = jsonRecords();
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Json::Document document(text, nullptr);
+        doNotOptimize(document.nodes().size());
+    }
+}
+
+WHOLF_BENCHMARK("json/parse-value/20MB") {
+    state.pauseTiming();
+    const std::string& text = jsonRecords();
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Value value = Wholf::Json::parse(text);
+        doNotOptimize(value);
+    }
+}
+
+// Belge başına doğrulama: şema bir kez derlenir, kayıtlar ayrıştırılmış belge üzerinde gezilir
+WHOLF_BENCHMARK("json/validate/record/compiled") {
+    state.pauseTiming();
+    Wholf::Json::Document document(jsonRecords(), nullptr);
+    std::vector<Wholf::Json::Element> records;
+    document.root().forEach([&](Wholf::Json::Element record) { records.push_back(record); });
+    Wholf::Json::Schema schema{std::string_view(jsonRecordSchema)};
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Json::ValidationResult result = schema.validate(records[i % records.size()]);
+        doNotOptimize(result.valid);
+    }
+}
+
+// Karşılaştırma: her belgede şemayı yeniden ayrıştırıp derlemek
+WHOLF_BENCHMARK("json/validate/record/compile-per-document") {
+    state.pauseTiming();
+    Wholf::Json::Document document(jsonRecords(), nullptr);
+    std::vector<Wholf::Json::Element> records;
+    document.root().forEach([&](Wholf::Json::Element record) { records.push_back(record); });
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::Json::Schema schema{std::string_view(jsonRecordSchema)};
+        Wholf::Json::ValidationResult result = schema.validate(records[i % records.size()]);
+        doNotOptimize(result.valid);
+    }
+}
+
+// --- Table ---
+
+namespace {
+    // ~64MB CSV: tam sayı, dize, ondalık, mantıksal ve ara sıra virgüllü tırnaklı alan
+    const size_t TABLE_FILE_BYTES = 64u << 20;
+
+    std::string tableFile() {
+        std::string path = temporaryPath("table.csv");
+        if (std::filesystem::exists(path) && std::filesystem::file_size(path) >= TABLE_FILE_BYTES) return path;
+        const char* cities[] = {"İstanbul", "Ankara", "İzmir", "Bursa", "Antalya", "Konya", "Adana", "Trabzon"};
+        std::mt19937 random(11);
+        std::string text = "id,city,price,quantity,active,note\n";
+        for (int i = 0; text.size() < TABLE_FILE_BYTES; i++) {
+            text += std::to_string(i) + "," + cities[random() % 8] + "," + std::to_string(random() % 100000) + "." +
+                    std::to_string(random() % 100) + "," + std::to_string(random() % 50) + "," + (i % 3 ? "true" : "false") + "," +
+                    (i % 10 ? "ok" : "\"kargo, gecikti\"") + "\n";
+        }
+        std::ofstream out(path, std::ios::binary);
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        return path;
+    }
+
+    void tableRead(Wholf::Bench::State& state, size_t threads) {
+        state.pauseTiming();
+        std::string path = tableFile();
+        state.resumeTiming();
+        state.setBytesPerIteration(std::filesystem::file_size(path));
+        Wholf::Table::Table::Options options;
+        options.threads = threads;
+        for (size_t i = 0; i < state.iterations; i++) {
+            Wholf::Table::Table table = Wholf::Table::Table::read(path, options);
+            doNotOptimize(table.column("price").sum());
+        }
+    }
+}
+
+// Eski yol: readFile + satır/virgül bölme + stod; tırnaklı alanlar yanlış bölünür
+WHOLF_BENCHMARK("table/read-64MB/readFile+split") {
+    state.pauseTiming();
+    std::string path = tableFile();
+    state.resumeTiming();
+    state.setBytesPerIteration(std::filesystem::file_size(path));
+    Wholf::File::FileOperations files;
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::string content;
+        files.readFile(path, content);
+        std::stringstream stream(content);
+        std::string line;
+        std::getline(stream, line);
+        std::vector<std::vector<std::string>> rows;
+        while (std::getline(stream, line)) {
+            std::vector<std::string> fields;
+            std::stringstream fieldStream(line);
+            std::string field;
+            while (std::getline(fieldStream, field, ',')) fields.push_back(field);
+            rows.push_back(std::move(fields));
+        }
+        double total = 0;
+        for (const auto& row : rows) total += std::stod(row[2]);
+        doNotOptimize(total);
+    }
+}
+
+WHOLF_BENCHMARK("table/read-64MB/columnar/threads:1") { tableRead(state, 1); }
+WHOLF_BENCHMARK("table/read-64MB/columnar/threads:4") { tableRead(state, 4); }
+
+WHOLF_BENCHMARK("table/aggregate/sum+min+max") {
+    state.pauseTiming();
+    Wholf::Table::Table table = Wholf::Table::Table::read(tableFile());
+    const Wholf::Table::Column& price = table.column("price");
+    const Wholf::Table::Column& quantity = table.column("quantity");
+    state.resumeTiming();
+    state.setItemsPerIteration(table.rowCount() * 2);
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(price.sum() + price.min() + price.max());
+        doNotOptimize(quantity.integerSum() + quantity.min() + quantity.max());
+    }
+}
+
+// Karşılaştırma: satır nesneleri üzerinde skaler döngü
+WHOLF_BENCHMARK("table/aggregate/row-values") {
+    state.pauseTiming();
+    Wholf::Table::Table table = Wholf::Table::Table::read(tableFile());
+    std::vector<Wholf::Value> prices = static_cast<std::vector<Wholf::Value>>(table.column("price").toValue());
+    std::vector<Wholf::Value> quantities = static_cast<std::vector<Wholf::Value>>(table.column("quantity").toValue());
+    state.resumeTiming();
+    state.setItemsPerIteration(table.rowCount() * 2);
+    for (size_t i = 0; i < state.iterations; i++) {
+        double total = 0, low = HUGE_VAL, high = -HUGE_VAL;
+        for (const auto& value : prices) {
+            double number = static_cast<float>(value);
+            total += number;
+            low = std::min(low, number);
+            high = std::max(high, number);
+        }
+        long long count = 0;
+        int least = std::numeric_limits<int>::max(), most = std::numeric_limits<int>::min();
+        for (const auto& value : quantities) {
+            int number = static_cast<int>(value);
+            count += number;
+            least = std::min(least, number);
+            most = std::max(most, number);
+        }
+        doNotOptimize(total + low + high);
+        doNotOptimize(count + least + most);
+    }
+}
+
+WHOLF_BENCHMARK("table/countBy/string") {
+    state.pauseTiming();
+    Wholf::Table::Table table = Wholf::Table::Table::read(tableFile());
+    const Wholf::Table::Column& city = table.column("city");
+    state.resumeTiming();
+    state.setItemsPerIteration(table.rowCount());
+    for (size_t i = 0; i < state.iterations; i++) {
+        auto counts = city.countBy();
+        doNotOptimize(counts.size());
+    }
+}
+
+// --- Numeric ---
+
+namespace {
+    const size_t NUMERIC_LENGTH = 1 << 20;
+
+    // Betik döngüsünün karşılığı: eleman başına kutulu Value
+    std::vector<Wholf::Value> boxedNumbers(uint32_t seed) {
+        std::mt19937 random(seed);
+        std::uniform_real_distribution<float> number(-100.0f, 100.0f);
+        std::vector<Wholf::Value> values;
+        values.reserve(NUMERIC_LENGTH);
+        for (size_t i = 0; i < NUMERIC_LENGTH; i++) values.emplace_back(number(random));
+        return values;
+    }
+
+    Wholf::TypedArray typedNumbers(Wholf::ElementType type, uint32_t seed) {
+        return Wholf::Numeric::fromValues(type, boxedNumbers(seed));
+    }
+
+    // Seçilen yolu zorla, bitince algılanan yola dön
+    template<typename Body>
+    void numericCase(Wholf::Bench::State& state, Wholf::Numeric::Isa isa, Body body) {
+        Wholf::Numeric::setIsa(isa);
+        state.setItemsPerIteration(NUMERIC_LENGTH);
+        for (size_t i = 0; i < state.iterations; i++) body();
+        Wholf::Numeric::setIsa(Wholf::Numeric::detectIsa());
+    }
+
+    void typedAdd(Wholf::Bench::State& state, Wholf::ElementType type, Wholf::Numeric::Isa isa) {
+        state.pauseTiming();
+        Wholf::TypedArray a = typedNumbers(type, 1), b = typedNumbers(type, 2);
+        Wholf::TypedArray out(type, NUMERIC_LENGTH);
+        state.resumeTiming();
+        numericCase(state, isa, [&]() {
+            Wholf::Numeric::compute(Wholf::Numeric::Operation::ADD, a, b, out);
+            doNotOptimize(out.data<char>());
+        });
+    }
+
+    void typedReduce(Wholf::Bench::State& state, Wholf::Numeric::Isa isa, bool dot) {
+        state.pauseTiming();
+        Wholf::TypedArray a = typedNumbers(Wholf::ElementType::FLOAT64, 1), b = typedNumbers(Wholf::ElementType::FLOAT64, 2);
+        state.resumeTiming();
+        numericCase(state, isa, [&]() { doNotOptimize(dot ? Wholf::Numeric::dot(a, b) : Wholf::Numeric::sum(a)); });
+    }
+}
+
+WHOLF_BENCHMARK("numeric/add/1M/boxed-values") {
+    state.pauseTiming();
+    std::vector<Wholf::Value> a = boxedNumbers(1), b = boxedNumbers(2);
+    state.resumeTiming();
+    state.setItemsPerIteration(NUMERIC_LENGTH);
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::vector<Wholf::Value> out;
+        out.reserve(a.size());
+        for (size_t k = 0; k < a.size(); k++) out.emplace_back(static_cast<float>(a[k]) + static_cast<float>(b[k]));
+        doNotOptimize(out.data());
+    }
+}
+
+WHOLF_BENCHMARK("numeric/add/1M/float64:scalar") { typedAdd(state, Wholf::ElementType::FLOAT64, Wholf::Numeric::Isa::SCALAR); }
+WHOLF_BENCHMARK("numeric/add/1M/float64:avx2") { typedAdd(state, Wholf::ElementType::FLOAT64, Wholf::Numeric::detectIsa()); }
+WHOLF_BENCHMARK("numeric/add/1M/float32:avx2") { typedAdd(state, Wholf::ElementType::FLOAT32, Wholf::Numeric::detectIsa()); }
+WHOLF_BENCHMARK("numeric/add/1M/int32:avx2") { typedAdd(state, Wholf::ElementType::INT32, Wholf::Numeric::detectIsa()); }
+
+WHOLF_BENCHMARK("numeric/sum/1M/boxed-values") {
+    state.pauseTiming();
+    std::vector<Wholf::Value> a = boxedNumbers(1);
+    state.resumeTiming();
+    state.setItemsPerIteration(NUMERIC_LENGTH);
+    for (size_t i = 0; i < state.iterations; i++) {
+        float total = 0;
+        for (const auto& value : a) total = static_cast<float>(Wholf::Value(total + static_cast<float>(value)));
+        doNotOptimize(total);
+    }
+}
+
+WHOLF_BENCHMARK("numeric/sum/1M/float64:scalar") { typedReduce(state, Wholf::Numeric::Isa::SCALAR, false); }
+WHOLF_BENCHMARK("numeric/sum/1M/float64:avx2") { typedReduce(state, Wholf::Numeric::detectIsa(), false); }
+
+WHOLF_BENCHMARK("numeric/dot/1M/boxed-values") {
+    state.pauseTiming();
+    std::vector<Wholf::Value> a = boxedNumbers(1), b = boxedNumbers(2);
+    state.resumeTiming();
+    state.setItemsPerIteration(NUMERIC_LENGTH);
+    for (size_t i = 0; i < state.iterations; i++) {
+        float total = 0;
+        for (size_t k = 0; k < a.size(); k++) {
+            Wholf::Value product(static_cast<float>(a[k]) * static_cast<float>(b[k]));
+            total = static_cast<float>(Wholf::Value(total + static_cast<float>(product)));
+        }
+        doNotOptimize(total);
+    }
+}
+
+WHOLF_BENCHMARK("numeric/dot/1M/float64:scalar") { typedReduce(state, Wholf::Numeric::Isa::SCALAR, true); }
+WHOLF_BENCHMARK("numeric/dot/1M/float64:avx2") { typedReduce(state, Wholf::Numeric::detectIsa(), true); }
+
+// --- StdLib::String ---
+
+namespace {
+    // ~4MB metin: kelime satırları, büyük/küçük harf karışık, ara sıra Türkçe karakter
+    const std::string& textCorpus() {
+        static std::string text;
+        if (!text.empty()) return text;
+        const char* words[] = {"Merhaba", "dünya", "Wholf", "betik", "DİL", "çalışma", "zamanı", "Veri", "işlem", "hızlı",
+                               "Şehir", "ağaç", "kod", "Derleyici", "bellek", "önbellek", "Dizi", "nesne", "satır", "SÜTUN"};
+        std::mt19937 random(5);
+        while (text.size() < (4u << 20)) {
+            size_t count = 4 + random() % 12;
+            for (size_t i = 0; i < count; i++) {
+                if (i) text += ' ';
+                text += words[random() % 20];
+            }
+            text += '\n';
+        }
+        return text;
+    }
+
+    // Eski API'nin karşılığı: her işlem yeni bir std::string ayırır ve ham işaretçi döndürür
+    std::vector<std::string*> splitRaw(const std::string& text, char delimiter) {
+        std::vector<std::string*> parts;
+        size_t start = 0;
+        while (true) {
+            size_t at = text.find(delimiter, start);
+            parts.push_back(new std::string(text.substr(start, at == std::string::npos ? std::string::npos : at - start)));
+            if (at == std::string::npos) return parts;
+            start = at + 1;
+        }
+    }
+
+    std::string* toLowerRaw(const std::string& text) {
+        auto* result = new std::string(text);
+        std::transform(result->begin(), result->end(), result->begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return result;
+    }
+}
+
+// Kelime sıklığı betiği: satırlara böl, kelimelere böl, küçült, say
+WHOLF_BENCHMARK("string/word-count/4MB/raw-pointers") {
+    state.pauseTiming();
+    const std::string& text = textCorpus();
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::unordered_map<std::string, int> counts;
+        std::vector<std::string*> lines = splitRaw(text, '\n');
+        for (std::string* line : lines) {
+            std::vector<std::string*> words = splitRaw(*line, ' ');
+            for (std::string* word : words) {
+                std::string* lower = toLowerRaw(*word);
+                counts[*lower]++;
+                delete lower;
+                delete word;
+            }
+            delete line;
+        }
+        doNotOptimize(counts.size());
+    }
+}
+
+WHOLF_BENCHMARK("string/word-count/4MB/slices") {
+    state.pauseTiming();
+    Wholf::StdLib::String text(textCorpus());
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::unordered_map<Wholf::StdLib::String, int, Wholf::StdLib::String::Hash> counts;
+        text.split("\n", [&](Wholf::StdLib::String&& line) {
+            line.split(" ", [&](Wholf::StdLib::String&& word) { counts[word.toLowerCase()]++; });
+        });
+        doNotOptimize(counts.size());
+    }
+}
+
+WHOLF_BENCHMARK("string/find/4MB/std::string::find") {
+    state.pauseTiming();
+    const std::string& text = textCorpus();
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t hits = 0;
+        for (size_t at = text.find("önbellek"); at != std::string::npos; at = text.find("önbellek", at + 1)) hits++;
+        doNotOptimize(hits);
+    }
+}
+
+WHOLF_BENCHMARK("string/find/4MB/simd") {
+    state.pauseTiming();
+    Wholf::StdLib::String text(textCorpus());
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t hits = 0;
+        for (size_t at = text.find("önbellek"); at != Wholf::StdLib::String::npos; at = text.find("önbellek", at + 1)) hits++;
+        doNotOptimize(hits);
+    }
+}
+
+WHOLF_BENCHMARK("string/toUpperCase/4MB/std::transform") {
+    state.pauseTiming();
+    const std::string& text = textCorpus();
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::string upper(text);
+        std::transform(upper.begin(), upper.end(), upper.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+        doNotOptimize(upper.data());
+    }
+}
+
+// Türkçe harfler de dönüştürülür (std::toupper yalnızca ASCII)
+WHOLF_BENCHMARK("string/toUpperCase/4MB/simd") {
+    state.pauseTiming();
+    Wholf::StdLib::String text(textCorpus());
+    state.resumeTiming();
+    state.setBytesPerIteration(text.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        Wholf::StdLib::String upper = text.toUpperCase();
+        doNotOptimize(upper.data());
+    }
+}
+
+// Özellik adı karşılaştırması: intern edilmiş adlar adresle karşılaştırılır
+WHOLF_BENCHMARK("string/property-equals/std::string") {
+    state.pauseTiming();
+    std::vector<std::string> names;
+    for (int k = 0; k < 64; k++) names.push_back("configuration_property_" + std::to_string(k));
+    std::vector<std::string> lookups(names.begin(), names.end());
+    state.resumeTiming();
+    state.setItemsPerIteration(64 * 64);
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t matches = 0;
+        for (const auto& name : names) {
+            for (const auto& lookup : lookups) matches += name == lookup;
+        }
+        doNotOptimize(matches);
+    }
+}
+
+WHOLF_BENCHMARK("string/property-equals/interned") {
+    state.pauseTiming();
+    std::vector<Wholf::StdLib::String> names, lookups;
+    for (int k = 0; k < 64; k++) names.push_back(Wholf::StdLib::String::intern("configuration_property_" + std::to_string(k)));
+    for (int k = 0; k < 64; k++) lookups.push_back(Wholf::StdLib::String::intern("configuration_property_" + std::to_string(k)));
+    state.resumeTiming();
+    state.setItemsPerIteration(64 * 64);
+    for (size_t i = 0; i < state.iterations; i++) {
+        size_t matches = 0;
+        for (const auto& name : names) {
+            for (const auto& lookup : lookups) matches += name == lookup;
+        }
+        doNotOptimize(matches);
+    }
+}
+
+// --- Packages::Store ---
+
+namespace {
+    // 40 paket x 3 sürüm x 30 dosya; ardışık sürümler dosyaların üçte ikisini paylaşır
+    std::string packageRegistry() {
+        std::string root = temporaryPath("registry");
+        if (std::filesystem::exists(root + "/paket39/2.0.0/wholf.deps")) return root;
+        std::string body = generateSource(60);
+        const char* versions[] = {"1.0.0", "1.1.0", "2.0.0"};
+        for (int p = 0; p < 40; p++) {
+            for (const char* version : versions) {
+                std::string directory = root + "/paket" + std::to_string(p) + "/" + version;
+                std::filesystem::create_directories(directory + "/lib");
+                for (int f = 0; f < 30; f++) {
+                    std::string header = "// paket" + std::to_string(p) + " dosya" + std::to_string(f);
+                    if (f % 3 == 0 || version[0] == '2') header += " " + std::string(version);
+                    std::ofstream(directory + "/lib/m" + std::to_string(f) + ".wholf") << header << "\n" << body;
+                }
+                std::ofstream deps(directory + "/wholf.deps");
+                for (int d = 1; d <= 2; d++) {
+                    int dependency = p + d + (p * 7) % 5;
+                    if (dependency < 40) deps << "paket" << dependency << " ^1.0\n";
+                }
+            }
+        }
+        return root;
+    }
+
+    // 50 proje; her biri rastgele 6 kök pakete bağımlı
+    std::vector<std::string> packageProjects() {
+        std::string root = temporaryPath("projects");
+        std::vector<std::string> projects;
+        std::mt19937 random(11);
+        for (int p = 0; p < 50; p++) {
+            std::string project = root + "/proje" + std::to_string(p);
+            std::filesystem::create_directories(project);
+            std::ofstream manifest(project + "/" + Wholf::Packages::MANIFEST_FILE);
+            for (int d = 0; d < 6; d++) manifest << "paket" << random() % 40 << " ^1.0\n";
+            projects.push_back(project);
+        }
+        return projects;
+    }
+
+    void resetProjects(const std::vector<std::string>& projects, bool keepLock) {
+        for (const auto& project : projects) {
+            std::filesystem::remove_all(project + "/" + Wholf::Packages::MODULES_DIRECTORY);
+            if (!keepLock) std::filesystem::remove(project + "/" + Wholf::Packages::LOCK_FILE);
+        }
+    }
+
+    // Sabit bağlantılar bir kez sayılır
+    double diskUsageMb(const std::vector<std::string>& roots) {
+        std::set<std::pair<dev_t, ino_t>> seen;
+        uint64_t bytes = 0;
+        for (const auto& root : roots) {
+            if (!std::filesystem::exists(root)) continue;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+                struct stat info;
+                if (::lstat(entry.path().c_str(), &info) != 0) continue;
+                if (seen.insert({info.st_dev, info.st_ino}).second) bytes += static_cast<uint64_t>(info.st_blocks) * 512;
+            }
+        }
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+}
+
+// Karşılaştırma: her proje çözülmüş bağımlılıklarını kayıttan kopyalar
+WHOLF_BENCHMARK("package/install/50-projects/copy") {
+    state.pauseTiming();
+    Wholf::Packages::Registry registry(packageRegistry());
+    std::vector<std::string> projects = packageProjects();
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        state.pauseTiming();
+        resetProjects(projects, false);
+        state.resumeTiming();
+        for (const auto& project : projects) {
+            auto roots = Wholf::Packages::readManifest(project + "/" + Wholf::Packages::MANIFEST_FILE);
+            auto lock = Wholf::Packages::resolve(roots, registry);
+            std::filesystem::create_directories(project + "/" + Wholf::Packages::MODULES_DIRECTORY);
+            for (const auto& package : lock.packages) {
+                std::filesystem::copy(registry.directory(package.name, package.version),
+                    project + "/" + Wholf::Packages::MODULES_DIRECTORY + "/" + package.name,
+                    std::filesystem::copy_options::recursive);
+            }
+        }
+    }
+    state.setCounter("disk_mb", diskUsageMb(projects));
+}
+
+// Boş depo: tüm paketler özetlenip depoya alınır, projelere sabit bağlantıyla dağıtılır
+WHOLF_BENCHMARK("package/install/50-projects/store-cold") {
+    state.pauseTiming();
+    Wholf::Packages::Registry registry(packageRegistry());
+    std::vector<std::string> projects = packageProjects();
+    std::string storeRoot = temporaryPath("store");
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        state.pauseTiming();
+        resetProjects(projects, false);
+        std::filesystem::remove_all(storeRoot);
+        state.resumeTiming();
+        Wholf::Packages::Store store(storeRoot);
+        for (const auto& project : projects) doNotOptimize(store.install(project, registry));
+    }
+    std::vector<std::string> roots = projects;
+    roots.push_back(storeRoot);
+    state.setCounter("disk_mb", diskUsageMb(roots));
+}
+
+// Kilit dosyası olan yeni çalışma kopyaları: çözümleme ve özetleme yok, yalnızca bağlama
+WHOLF_BENCHMARK("package/install/50-projects/store-relink") {
+    state.pauseTiming();
+    Wholf::Packages::Registry registry(packageRegistry());
+    std::vector<std::string> projects = packageProjects();
+    Wholf::Packages::Store store(temporaryPath("store"));
+    for (const auto& project : projects) store.install(project, registry);
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        state.pauseTiming();
+        resetProjects(projects, true);
+        state.resumeTiming();
+        for (const auto& project : projects) doNotOptimize(store.install(project, registry));
+    }
+}
+
+WHOLF_BENCHMARK("package/install/50-projects/up-to-date") {
+    state.pauseTiming();
+    Wholf::Packages::Registry registry(packageRegistry());
+    std::vector<std::string> projects = packageProjects();
+    Wholf::Packages::Store store(temporaryPath("store"));
+    for (const auto& project : projects) store.install(project, registry);
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        for (const auto& project : projects) doNotOptimize(store.install(project, registry));
+    }
+}
+
+WHOLF_BENCHMARK("package/verify/store") {
+    state.pauseTiming();
+    Wholf::Packages::Registry registry(packageRegistry());
+    std::vector<std::string> projects = packageProjects();
+    Wholf::Packages::Store store(temporaryPath("store"));
+    std::map<std::string, Wholf::Packages::LockedPackage> packages;
+    for (const auto& project : projects) {
+        store.install(project, registry);
+        for (auto& package : Wholf::Packages::Lockfile::read(project + "/" + Wholf::Packages::LOCK_FILE).packages) {
+            packages[package.name + "@" + package.version.toString()] = package;
+        }
+    }
+    std::vector<Wholf::Packages::LockedPackage> all;
+    for (auto& entry : packages) all.push_back(entry.second);
+    state.resumeTiming();
+    state.setItemsPerIteration(all.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        doNotOptimize(store.verify(all));
+    }
+}
+
+// --- Module::ModuleManager ---
+
+namespace {
+    // 64 modül x 16 export; çağrılar tüm modüllere dağılır
+    void moduleTable(Wholf::Module::ModuleManager& modules, uint64_t& counter) {
+        for (int m = 0; m < 64; m++) {
+            auto module = modules.loadModule("modul" + std::to_string(m), "");
+            for (int f = 0; f < 16; f++) {
+                module->exportFunction("fonksiyon" + std::to_string(f), [&counter] { counter++; });
+            }
+        }
+    }
+}
+
+WHOLF_BENCHMARK("module/call/1024-exports/by-name") {
+    state.pauseTiming();
+    Wholf::Module::ModuleManager modules;
+    uint64_t counter = 0;
+    moduleTable(modules, counter);
+    std::vector<std::pair<std::string, std::string>> names;
+    for (int m = 0; m < 64; m++) {
+        for (int f = 0; f < 16; f++) names.emplace_back("modul" + std::to_string(m), "fonksiyon" + std::to_string(f));
+    }
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        const auto& name = names[i % names.size()];
+        modules.callFunction(name.first, name.second);
+    }
+    doNotOptimize(counter);
+}
+
+WHOLF_BENCHMARK("module/call/1024-exports/handle") {
+    state.pauseTiming();
+    Wholf::Module::ModuleManager modules;
+    uint64_t counter = 0;
+    moduleTable(modules, counter);
+    std::vector<Wholf::Module::FunctionHandle> handles;
+    for (int m = 0; m < 64; m++) {
+        for (int f = 0; f < 16; f++) handles.push_back(modules.resolve("modul" + std::to_string(m), "fonksiyon" + std::to_string(f)));
+    }
+    state.resumeTiming();
+    for (size_t i = 0; i < state.iterations; i++) {
+        modules.call(handles[i % handles.size()]);
+    }
+    doNotOptimize(counter);
+}
+
+WHOLF_BENCHMARK("module/call/1024-exports/batch") {
+    state.pauseTiming();
+    Wholf::Module::ModuleManager modules;
+    uint64_t counter = 0;
+    moduleTable(modules, counter);
+    Wholf::Module::CallBatch batch;
+    for (int m = 0; m < 64; m++) {
+        for (int f = 0; f < 16; f++) batch.add(modules.resolve("modul" + std::to_string(m), "fonksiyon" + std::to_string(f)));
+    }
+    state.resumeTiming();
+    state.setItemsPerIteration(batch.size());
+    for (size_t i = 0; i < state.iterations; i++) {
+        modules.callBatch(batch);
+    }
+    doNotOptimize(counter);
+}
+
+// --- Style::StyleSheet ---
+
+WHOLF_BENCHMARK("style/generateCSS/1000-rules") {
+    state.pauseTiming();
+    Wholf::Style::StyleSheet sheet;
+    for (int r = 0; r < 1000; r++) {
+        sheet.addRule(".sinif-" + std::to_string(r), {
+            {"color", "#333"},
+            {"margin", std::to_string(r % 16) + "px"},
+            {"font-size", "14px"},
+            {"display", "flex"}
+        });
+    }
+    state.resumeTiming();
+    state.setItemsPerIteration(1000);
+    for (size_t i = 0; i < state.iterations; i++) {
+        std::string css = sheet.generateCSS();
+        doNotOptimize(css);
+    }
+}
+
+int main(int argc, char** argv) {
+    return Wholf::Bench::main(argc, argv);
+}
@@ -0,0 +1,269 @@
+#ifndef WHOLF_BINDING_HPP
+#define WHOLF_BINDING_HPP
+
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include "Value.hpp"
+
+namespace Wholf {
+    // Yerel (C++) fonksiyon bağlama altyapısı
+    namespace Native {
+        // Dizi argümanları için kopyasız görünüm
+        class ArrayView {
+        public:
+            const Value* data;
+            size_t size;
+
+            ArrayView(const Value* data, size_t size) : data(data), size(size) {}
+
+            const Value& operator[](size_t index) const { return data[index]; }
+            const Value* begin() const { return data; }
+            const Value* end() const { return data + size; }
+        };
+
+        // Value -> C++ tip dönüşümü; desteklenmeyen tipler derleme hatası verir
+        template<typename T>
+        struct ArgumentCast;
+
+        // C++ -> Value dönüşümü
+        template<typename R>
+        struct ResultCast;
+
+        // Desteklenen argüman tipleri
+        template<>
+        struct ArgumentCast<int> {
+            static int from(const Value& value) {
+                if (value.type == DataType::INTEGER) return std::get<int>(value.data);
+                if (value.type == DataType::FLOAT) {
+                    // NaN ve int aralığı dışındaki değerlerde static_cast tanımsız davranıştır
+                    float number = std::get<float>(value.data);
+                    if (!(number >= -2147483648.0f && number < 2147483648.0f)) {
+                        throw std::runtime_error("Native argument is out of int range");
+                    }
+                    return static_cast<int>(number);
+                }
+                throw std::runtime_error("Native argument is not a number");
+            }
+        };
+
+        template<>
+        struct ArgumentCast<float> {
+            static float from(const Value& value) {
+                if (value.type == DataType::FLOAT) return std::get<float>(value.data);
+                if (value.type == DataType::INTEGER) return static_cast<float>(std::get<int>(value.data));
+                throw std::runtime_error("Native argument is not a number");
+            }
+        };
+
+        template<>
+        struct ArgumentCast<double> {
+            static double from(const Value& value) {
+                if (value.type == DataType::FLOAT) return std::get<float>(value.data);
+                if (value.type == DataType::INTEGER) return std::get<int>(value.data);
+                throw std::runtime_error("Native argument is not a number");
+            }
+        };
+
+        template<>
+        struct ArgumentCast<bool> {
+            static bool from(const Value& value) {
+                if (value.type != DataType::BOOLEAN) throw std::runtime_error("Native argument is not a boolean");
+                return std::get<bool>(value.data);
+            }
+        };
+
+        // std::string parametresi: sahipli metin ödünç verilir, StringRef ise çağrı süresince kopyalanır
+        class StringArgument {
+        public:
+            explicit StringArgument(const std::string& borrowed) : borrowed(&borrowed) {}
+            explicit StringArgument(std::string_view text) : owned(text), borrowed(&owned) {}
+
+            StringArgument(const StringArgument&) = delete;
+            StringArgument& operator=(const StringArgument&) = delete;
+
+            operator const std::string&() const { return *borrowed; }
+
+        private:
+            std::string owned;
+            const std::string* borrowed;
+        };
+
+        template<>
+        struct ArgumentCast<std::string> {
+            static StringArgument from(const Value& value) {
+                if (value.type != DataType::STRING) throw std::runtime_error("Native argument is not a string");
+                if (const auto* text = std::get_if<std::string>(&value.data)) return StringArgument(*text);
+                return StringArgument(value.text());
+            }
+        };
+
+        template<>
+        struct ArgumentCast<std::string_view> {
+            static std::string_view from(const Value& value) {
+                if (value.type != DataType::STRING) throw std::runtime_error("Native argument is not a string");
+                return value.text();
+            }
+        };
+
+        template<>
+        struct ArgumentCast<ArrayView> {
+            static ArrayView from(const Value& value) {
+                if (value.type != DataType::ARRAY) throw std::runtime_error("Native argument is not an array");
+                const auto& elements = std::get<std::vector<Value>>(value.data);
+                return ArrayView(elements.data(), elements.size());
+            }
+        };
+
+        // Tipli dizi tamponu paylaşılır, kopyalanmaz
+        template<>
+        struct ArgumentCast<TypedArray> {
+            static const TypedArray& from(const Value& value) {
+                if (value.type != DataType::TYPED_ARRAY) throw std::runtime_error("Native argument is not a typed array");
+                return std::get<TypedArray>(value.data);
+            }
+        };
+
+        template<>
+        struct ArgumentCast<Value> {
+            static const Value& from(const Value& value) { return value; }
+        };
+
+        // Desteklenen dönüş tipleri. double bilerek yok: Value yalnızca float saklar ve sessiz
+        // daraltma yerine derleme hatası verilir (bkz. IsResultSupported)
+        template<> struct ResultCast<void> { static Value to() { return Value(nullptr); } };
+        template<> struct ResultCast<int> { static Value to(int result) { return Value(result); } };
+        template<> struct ResultCast<float> { static Value to(float result) { return Value(result); } };
+        template<> struct ResultCast<bool> { static Value to(bool result) { return Value(result); } };
+        template<> struct ResultCast<std::string> { static Value to(const std::string& result) { return Value(result); } };
+        template<> struct ResultCast<TypedArray> { static Value to(const TypedArray& result) { return Value(result); } };
+        template<> struct ResultCast<Value> { static Value to(Value result) { return result; } };
+
+        // Argüman tiplerinden referans/const niteliklerini temizle
+        template<typename T>
+        using ArgumentType = std::remove_cv_t<std::remove_reference_t<T>>;
+
+        // Tüm imza tiplerinin desteklendiğini derleme zamanında doğrula
+        template<typename T, typename = void>
+        struct IsArgumentSupported : std::false_type {};
+
+        template<typename T>
+        struct IsArgumentSupported<T, std::void_t<decltype(ArgumentCast<ArgumentType<T>>::from(std::declval<const Value&>()))>>
+            : std::true_type {};
+
+        template<typename R, typename = void>
+        struct IsResultSupported : std::false_type {};
+
+        template<>
+        struct IsResultSupported<void> : std::true_type {};
+
+        template<typename R>
+        struct IsResultSupported<R, std::void_t<decltype(ResultCast<std::decay_t<R>>::to(std::declval<R>()))>>
+            : std::true_type {};
+
+        // Dönüş tipini derleme zamanında doğrula
+        template<typename R>
+        constexpr void checkResultType() {
+            static_assert(!std::is_same_v<std::decay_t<R>, double>,
+                          "Native functions cannot return double: Value stores float, return float or Value explicitly");
+            static_assert(std::is_same_v<std::decay_t<R>, double> || IsResultSupported<R>::value,
+                          "Unsupported native return type (void, int, float, bool, std::string, TypedArray, Value)");
+        }
+
+        [[noreturn]] inline void arityError(size_t expected, size_t actual) {
+            throw std::runtime_error("Native function expects " + std::to_string(expected) +
+                                     " arguments, got " + std::to_string(actual));
+        }
+
+        // Tip silinmiş hedef fonksiyon işaretçisi
+        using ErasedFunction = void (*)();
+
+        // Trampolin: argümanları dönüştürüp hedef fonksiyonu çağırır
+        using Trampoline = Value (*)(ErasedFunction target, const Value* args, size_t count);
+
+        // Çalışma zamanında verilen fonksiyon işaretçisi için trampolin
+        template<typename R, typename... Args>
+        struct PointerTrampoline {
+            using Function = R (*)(Args...);
+
+            static Value call(ErasedFunction target, const Value* args, size_t count) {
+                if (count != sizeof...(Args)) arityError(sizeof...(Args), count);
+                return invoke(reinterpret_cast<Function>(target), args, std::index_sequence_for<Args...>{});
+            }
+
+        private:
+            template<size_t... I>
+            static Value invoke(Function function, const Value* args, std::index_sequence<I...>) {
+                if constexpr (std::is_void_v<R>) {
+                    function(ArgumentCast<ArgumentType<Args>>::from(args[I])...);
+                    return ResultCast<void>::to();
+                } else {
+                    return ResultCast<std::decay_t<R>>::to(function(ArgumentCast<ArgumentType<Args>>::from(args[I])...));
+                }
+            }
+        };
+
+        // Derleme zamanında bilinen fonksiyon için trampolin; çağrı doğrudan satır içine alınır
+        template<auto Fn>
+        struct StaticTrampoline;
+
+        template<typename R, typename... Args, R (*Fn)(Args...)>
+        struct StaticTrampoline<Fn> {
+            static Value call(ErasedFunction, const Value* args, size_t count) {
+                if (count != sizeof...(Args)) arityError(sizeof...(Args), count);
+                return invoke(args, std::index_sequence_for<Args...>{});
+            }
+
+        private:
+            template<size_t... I>
+            static Value invoke(const Value* args, std::index_sequence<I...>) {
+                if constexpr (std::is_void_v<R>) {
+                    Fn(ArgumentCast<ArgumentType<Args>>::from(args[I])...);
+                    return ResultCast<void>::to();
+                } else {
+                    return ResultCast<std::decay_t<R>>::to(Fn(ArgumentCast<ArgumentType<Args>>::from(args[I])...));
+                }
+            }
+        };
+
+        // Bağlanmış yerel fonksiyon
+        class Binding {
+        public:
+            std::string name;
+            Trampoline trampoline;
+            ErasedFunction target;
+            size_t arity;
+
+            Binding(const std::string& name, Trampoline trampoline, ErasedFunction target, size_t arity)
+                : name(name), trampoline(trampoline), target(target), arity(arity) {}
+
+            Value call(const Value* args, size_t count) const {
+                return trampoline(target, args, count);
+            }
+        };
+
+        // Fonksiyon işaretçisinden bağlama oluştur
+        template<typename R, typename... Args>
+        Binding makeBinding(const std::string& name, R (*function)(Args...)) {
+            checkResultType<R>();
+            static_assert((IsArgumentSupported<Args>::value && ...),
+                          "Unsupported native argument type (int, float, bool, std::string_view, std::string, ArrayView, Value)");
+            return Binding(name, &PointerTrampoline<R, Args...>::call,
+                           reinterpret_cast<ErasedFunction>(function), sizeof...(Args));
+        }
+
+        // Derleme zamanında bilinen fonksiyondan bağlama oluştur
+        template<auto Fn, typename R, typename... Args>
+        Binding makeStaticBinding(const std::string& name, R (*)(Args...)) {
+            checkResultType<R>();
+            static_assert((IsArgumentSupported<Args>::value && ...),
+                          "Unsupported native argument type (int, float, bool, std::string_view, std::string, ArrayView, Value)");
+            return Binding(name, &StaticTrampoline<Fn>::call, nullptr, sizeof...(Args));
+        }
+    }
+}
+
+#endif // WHOLF_BINDING_HPP
@@ -0,0 +1,121 @@
+#ifndef WHOLF_EXECUTION_HPP
+#define WHOLF_EXECUTION_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+namespace Wholf {
+    // Yürütmenin neden kesildiği
+    enum class InterruptReason {
+        BUDGET_EXCEEDED,
+        DEADLINE_EXCEEDED,
+        CANCELLED
+    };
+
+    // Bütçe/zaman aşımı/iptal durumunda fırlatılır
+    class ExecutionInterrupted : public std::runtime_error {
+    public:
+        InterruptReason reason;
+
+        ExecutionInterrupted(InterruptReason reason, const std::string& message)
+            : std::runtime_error(message), reason(reason) {}
+    };
+
+    // Tek bir yürütmenin bütçesi ve güvenli nokta (safepoint) denetimi
+    class ExecutionControl {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        // İptal bayrağı ve saat kaç komutta bir denetlenecek
+        static constexpr uint64_t SAFEPOINT_INTERVAL = 1024;
+        static constexpr uint64_t UNLIMITED = UINT64_MAX;
+
+        // Toplam komut bütçesi (UNLIMITED = sınırsız)
+        uint64_t instructionLimit = UNLIMITED;
+
+        // Duvar saati son tarihi
+        Clock::time_point deadline = Clock::time_point::max();
+
+        // Zaman dilimi sonu; zamanlayıcı her devam ettirmede ayarlar
+        uint64_t sliceEnd = UNLIMITED;
+
+        // Dilim dolduğunda çağrılır (zamanlayıcı betiği burada askıya alır)
+        std::function<void()> yieldHandler;
+
+        // Başka bir thread'den iptal isteği
+        std::atomic<bool> cancelRequested{false};
+
+        // Dilim bitmeden bir sonraki güvenli noktada yieldHandler'ı çağır (ör. askıya alma)
+        std::atomic<bool> yieldRequested{false};
+
+        ExecutionControl() { updateNextCheck(); }
+
+        // Hızlı yol: her değerlendirilen node için bir artırma ve karşılaştırma
+        void tick() {
+            if (++executed >= nextCheck) safepoint();
+        }
+
+        uint64_t executedInstructions() const { return executed; }
+
+        void setInstructionLimit(uint64_t limit) {
+            instructionLimit = limit;
+            updateNextCheck();
+        }
+
+        void setTimeout(std::chrono::nanoseconds timeout) {
+            deadline = Clock::now() + timeout;
+            updateNextCheck();
+        }
+
+        // Bir sonraki dilimi başlat
+        void beginSlice(uint64_t sliceInstructions) {
+            sliceEnd = sliceInstructions == UNLIMITED ? UNLIMITED : executed + sliceInstructions;
+            updateNextCheck();
+        }
+
+        // Herhangi bir thread'den çağrılabilir; en geç SAFEPOINT_INTERVAL komut sonra etkili olur
+        void cancel() {
+            cancelRequested.store(true, std::memory_order_relaxed);
+        }
+
+        // Herhangi bir thread'den çağrılabilir; cancel() ile aynı gecikmeyle yield eder
+        void requestYield() {
+            yieldRequested.store(true, std::memory_order_relaxed);
+        }
+
+    private:
+        uint64_t executed = 0;
+        uint64_t nextCheck = 0;
+
+        // Yavaş yol: sınırları denetle, gerekirse askıya al veya kes
+        void safepoint() {
+            if (cancelRequested.load(std::memory_order_relaxed)) {
+                throw ExecutionInterrupted(InterruptReason::CANCELLED, "Execution cancelled");
+            }
+            if (executed >= instructionLimit) {
+                throw ExecutionInterrupted(InterruptReason::BUDGET_EXCEEDED,
+                                           "Instruction budget exceeded: " + std::to_string(instructionLimit));
+            }
+            if (deadline != Clock::time_point::max() && Clock::now() >= deadline) {
+                throw ExecutionInterrupted(InterruptReason::DEADLINE_EXCEEDED, "Execution deadline exceeded");
+            }
+            bool yieldNow = yieldRequested.load(std::memory_order_relaxed) && yieldRequested.exchange(false, std::memory_order_relaxed);
+            if ((executed >= sliceEnd || yieldNow) && yieldHandler) {
+                sliceEnd = UNLIMITED;
+                yieldHandler();
+            }
+            updateNextCheck();
+        }
+
+        void updateNextCheck() {
+            nextCheck = std::min({instructionLimit, sliceEnd, executed + SAFEPOINT_INTERVAL});
+        }
+    };
+}
+
+#endif // WHOLF_EXECUTION_HPP
@@ -2,12 +2,20 @@
 #define WHOLF_NODE_HPP
 
 #include <string>
+#include <atomic>
 #include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
 
 namespace Wholf {
     // Temel node sınıfı
     class Node {
     public:
+        // Kaynak konumu (Token'dan aktarılır; 0 = bilinmiyor)
+        int line = 0;
+        int column = 0;
+        
         virtual ~Node() = default;
         virtual std::string toString() const = 0;
     };
@@ -24,6 +32,40 @@ namespace Wholf {
         }
     };
     
+    // Metin sabiti node
+    class StringNode : public Node {
+    public:
+        std::string value;
+        
+        StringNode(const std::string& value) : value(value) {}
+        
+        std::string toString() const override {
+            return "\"" + value + "\"";
+        }
+    };
+    
+    // true/false/null sabitleri
+    class LiteralNode : public Node {
+    public:
+        enum class Kind {
+            TRUE_VALUE,
+            FALSE_VALUE,
+            NULL_VALUE
+        };
+        
+        Kind kind;
+        
+        LiteralNode(Kind kind) : kind(kind) {}
+        
+        std::string toString() const override {
+            switch (kind) {
+                case Kind::TRUE_VALUE: return "true";
+                case Kind::FALSE_VALUE: return "false";
+                default: return "null";
+            }
+        }
+    };
+    
     // Identifier node
     class IdentifierNode : public Node {
     public:
@@ -51,15 +93,93 @@ namespace Wholf {
         }
     };
     
+    // Tekli işlem node (!x, -x)
+    class UnaryOperationNode : public Node {
+    public:
+        std::unique_ptr<Node> operand;
+        std::string operatorType;
+        
+        UnaryOperationNode(std::unique_ptr<Node> operand, const std::string& operatorType)
+            : operand(std::move(operand)), operatorType(operatorType) {}
+        
+        std::string toString() const override {
+            return "(" + operatorType + operand->toString() + ")";
+        }
+    };
+    
+    // Atama node; let/const bildirimleri de aynı node'u kullanır
+    class AssignmentNode : public Node {
+    public:
+        std::string name;
+        std::unique_ptr<Node> value;
+        bool declaration;
+        
+        AssignmentNode(const std::string& name, std::unique_ptr<Node> value, bool declaration = false)
+            : name(name), value(std::move(value)), declaration(declaration) {}
+        
+        std::string toString() const override {
+            return (declaration ? "let " : "") + name + " = " + (value ? value->toString() : "null");
+        }
+    };
+    
+    // Blok node; programın kökü de bir bloktur
+    class BlockNode : public Node {
+    public:
+        std::vector<std::unique_ptr<Node>> statements;
+        
+        BlockNode(std::vector<std::unique_ptr<Node>> statements) : statements(std::move(statements)) {}
+        
+        std::string toString() const override {
+            std::string result;
+            for (size_t i = 0; i < statements.size(); ++i) {
+                if (i > 0) result += "\n";
+                result += statements[i]->toString();
+            }
+            return result;
+        }
+    };
+    
+    // return/break/continue
+    class JumpNode : public Node {
+    public:
+        enum class Kind {
+            RETURN,
+            BREAK,
+            CONTINUE
+        };
+        
+        Kind kind;
+        std::unique_ptr<Node> value;
+        
+        JumpNode(Kind kind, std::unique_ptr<Node> value = nullptr) : kind(kind), value(std::move(value)) {}
+        
+        std::string toString() const override {
+            switch (kind) {
+                case Kind::RETURN: return value ? "return " + value->toString() : "return";
+                case Kind::BREAK: return "break";
+                default: return "continue";
+            }
+        }
+    };
+    
     // Fonksiyon çağırma node
     class FunctionCallNode : public Node {
     public:
         std::string functionName;
         std::vector<std::unique_ptr<Node>> arguments;
         
+        // Çözülmüş yerel fonksiyon slotu (yorumlayıcı ilk çağrıda doldurur). Üst 32 bit slotu çözen
+        // interpreter'ın kimliğidir: Program paylaşıldığında başka interpreter'ın slotu kullanılmaz
+        static constexpr uint64_t UNRESOLVED = static_cast<uint64_t>(-1);
+        std::atomic<uint64_t> nativeSlot{UNRESOLVED};
+        
         FunctionCallNode(const std::string& functionName, std::vector<std::unique_ptr<Node>> arguments)
             : functionName(functionName), arguments(std::move(arguments)) {}
         
+        // Profilleyici için interned fonksiyon kimliği
+        static constexpr uint32_t UNINTERNED = static_cast<uint32_t>(-1);
+        std::atomic<uint32_t> profileId{UNINTERNED};
+        
         std::string toString() const override {
             std::string result = functionName + "(";
             for (size_t i = 0; i < arguments.size(); ++i) {
@@ -77,6 +197,8 @@ namespace Wholf {
         std::string functionName;
         std::vector<std::string> parameters;
         std::unique_ptr<Node> body;
+        // Tanımın kaynak metni (parser'a kaynak verildiyse); snapshot'a bu yazılır
+        std::string source;
         
         FunctionDefinitionNode(const std::string& functionName, std::vector<std::string> parameters, std::unique_ptr<Node> body)
             : functionName(functionName), parameters(std::move(parameters)), body(std::move(body)) {}
@@ -136,6 +258,8 @@ namespace Wholf {
         std::string type;  // while, for, foreach
         std::unique_ptr<Node> condition;
         std::unique_ptr<Node> body;
+        // for döngüsünün adım ifadesi; continue'dan sonra da çalışır
+        std::unique_ptr<Node> increment;
         
         LoopNode(const std::string& type, std::unique_ptr<Node> condition, std::unique_ptr<Node> body)
             : type(type), condition(std::move(condition)), body(std::move(body)) {}
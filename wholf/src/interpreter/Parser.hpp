@@ -5,26 +5,44 @@
 #include "Token.hpp"
 #include <vector>
 #include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 
 namespace Wholf {
     // Parser sınıfı
     class Parser {
+    public:
+        struct Options {
+            // İç içe ifade/blok sınırı; derin girdiler yığın taşması yerine parse hatası verir.
+            // Betikler Scheduler'da 512 KB'lık yığınlarda da parse edilir
+            size_t maxDepth = 200;
+            // Token'ların ait olduğu kaynak; verilirse fonksiyon tanımları kendi metinlerini saklar
+            std::string_view source;
+        };
+    
     private:
         std::vector<Token> tokens;
         size_t current;
-        
+        Options options;
+        size_t depth = 0;
+    
     public:
-        Parser(const std::vector<Token>& tokens) : tokens(tokens), current(0) {}
+        Parser(const std::vector<Token>& tokens) : Parser(tokens, Options()) {}
+        Parser(std::vector<Token>&& tokens) : Parser(std::move(tokens), Options()) {}
+        Parser(const std::vector<Token>& tokens, const Options& options) : tokens(tokens), current(0), options(options) {}
+        Parser(std::vector<Token>&& tokens, const Options& options) : tokens(std::move(tokens)), current(0), options(options) {}
         
+        // Programın tamamı tek bir BlockNode olarak döner
         std::unique_ptr<Node> parse();
-        
+    
     private:
         // Yardımcı fonksiyonlar
-        bool isAtEnd() const { return current >= tokens.size(); }
+        bool isAtEnd() const { return current >= tokens.size() || tokens[current].type == TokenType::EOF_TOKEN; }
         
-        Token peek() const { return tokens[current]; }
+        const Token& peek() const { return tokens[current < tokens.size() ? current : tokens.size() - 1]; }
         
-        Token advance() {
+        const Token& advance() {
             if (!isAtEnd()) current++;
             return tokens[current - 1];
         }
@@ -40,18 +58,107 @@ namespace Wholf {
             return true;
         }
         
-        Token consume(TokenType type, const std::string& message) {
+        bool checkOperator(Operator op) const {
+            return check(TokenType::OPERATOR) && std::get<Operator>(tokens[current].value) == op;
+        }
+        
+        bool checkPunctuation(Punctuation punctuation) const {
+            return check(TokenType::PUNCTUATION) && std::get<Punctuation>(tokens[current].value) == punctuation;
+        }
+        
+        bool checkKeyword(Keyword keyword) const {
+            return check(TokenType::KEYWORD) && std::get<Keyword>(tokens[current].value) == keyword;
+        }
+        
+        bool matchOperator(Operator op) {
+            if (!checkOperator(op)) return false;
+            advance();
+            return true;
+        }
+        
+        bool matchPunctuation(Punctuation punctuation) {
+            if (!checkPunctuation(punctuation)) return false;
+            advance();
+            return true;
+        }
+        
+        bool matchKeyword(Keyword keyword) {
+            if (!checkKeyword(keyword)) return false;
+            advance();
+            return true;
+        }
+        
+        // Node'u token konumuyla oluştur
+        template<typename T, typename... Args>
+        std::unique_ptr<T> located(const Token& token, Args&&... args) {
+            auto node = std::make_unique<T>(std::forward<Args>(args)...);
+            node->line = token.line;
+            node->column = token.column;
+            return node;
+        }
+        
+        [[noreturn]] void error(const Token& token, const std::string& message) const {
+            throw std::runtime_error(message + " at line " + std::to_string(token.line) + ", column " + std::to_string(token.column));
+        }
+        
+        // Özyinelemeli bir kurala girişte derinliği sayar
+        class Nesting {
+        public:
+            explicit Nesting(Parser& parser) : parser(parser) {
+                if (parser.depth >= parser.options.maxDepth) parser.error(parser.peek(), "Nesting too deep");
+                parser.depth++;
+            }
+            ~Nesting() { parser.depth--; }
+            
+            Nesting(const Nesting&) = delete;
+            Nesting& operator=(const Nesting&) = delete;
+        
+        private:
+            Parser& parser;
+        };
+        
+        const Token& consume(TokenType type, const std::string& message) {
             if (check(type)) return advance();
-            throw std::runtime_error(message);
+            error(peek(), message);
+        }
+        
+        void consumePunctuation(Punctuation punctuation, const std::string& message) {
+            if (!matchPunctuation(punctuation)) error(peek(), message);
+        }
+        
+        // İfade sonu: ';' ya da blok/dosya sonu
+        void endStatement() {
+            if (matchPunctuation(Punctuation::SEMICOLON)) return;
+            if (isAtEnd() || checkPunctuation(Punctuation::RIGHT_BRACE)) return;
+            error(peek(), "Expected ';'");
+        }
+        
+        // Soldan birleşen ikili işlem seviyesi
+        template<typename Next>
+        std::unique_ptr<Node> binaryLevel(std::initializer_list<Operator> operators, Next next) {
+            std::unique_ptr<Node> left = (this->*next)();
+            while (check(TokenType::OPERATOR)) {
+                Operator op = std::get<Operator>(peek().value);
+                bool found = false;
+                for (Operator candidate : operators) found = found || candidate == op;
+                if (!found) break;
+                const Token& token = advance();
+                std::unique_ptr<Node> right = (this->*next)();
+                left = located<BinaryOperationNode>(token, std::move(left), std::move(right), token.toString());
+            }
+            return left;
         }
         
         // Parse fonksiyonları
         std::unique_ptr<Node> expression();
         std::unique_ptr<Node> assignment();
+        std::unique_ptr<Node> logicalOr();
+        std::unique_ptr<Node> logicalAnd();
         std::unique_ptr<Node> equality();
         std::unique_ptr<Node> comparison();
         std::unique_ptr<Node> term();
         std::unique_ptr<Node> factor();
+        std::unique_ptr<Node> power();
         std::unique_ptr<Node> unary();
         std::unique_ptr<Node> primary();
         
@@ -65,8 +172,288 @@ namespace Wholf {
         std::unique_ptr<Node> whileStatement();
         std::unique_ptr<Node> forStatement();
         std::unique_ptr<Node> foreachStatement();
+        std::unique_ptr<Node> jumpStatement();
+        std::unique_ptr<Node> expressionStatement();
         std::unique_ptr<Node> block();
     };
+    
+    inline std::unique_ptr<Node> Parser::parse() {
+        if (tokens.empty()) return std::make_unique<BlockNode>(std::vector<std::unique_ptr<Node>>());
+        const Token& first = peek();
+        std::vector<std::unique_ptr<Node>> statements;
+        while (!isAtEnd()) statements.push_back(declaration());
+        return located<BlockNode>(first, std::move(statements));
+    }
+    
+    inline std::unique_ptr<Node> Parser::declaration() {
+        if (checkKeyword(Keyword::LET) || checkKeyword(Keyword::CONST)) return variableDeclaration();
+        if (checkKeyword(Keyword::FUNCTION)) return functionDeclaration();
+        if (checkKeyword(Keyword::CLASS)) return classDeclaration();
+        return statement();
+    }
+    
+    inline std::unique_ptr<Node> Parser::variableDeclaration() {
+        advance();
+        const Token& name = consume(TokenType::IDENTIFIER, "Expected variable name");
+        std::unique_ptr<Node> value;
+        if (matchOperator(Operator::ASSIGN)) value = expression();
+        auto node = located<AssignmentNode>(name, std::get<std::string>(name.value), std::move(value), true);
+        endStatement();
+        return node;
+    }
+    
+    inline std::unique_ptr<Node> Parser::functionDeclaration() {
+        Nesting nesting(*this);
+        const Token& first = peek();
+        matchKeyword(Keyword::FUNCTION);
+        const Token& name = consume(TokenType::IDENTIFIER, "Expected function name");
+        consumePunctuation(Punctuation::LEFT_PAREN, "Expected '(' after function name");
+        std::vector<std::string> parameters;
+        if (!checkPunctuation(Punctuation::RIGHT_PAREN)) {
+            do {
+                parameters.push_back(std::get<std::string>(consume(TokenType::IDENTIFIER, "Expected parameter name").value));
+            } while (matchPunctuation(Punctuation::COMMA));
+        }
+        consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after parameters");
+        std::unique_ptr<Node> body = block();
+        auto function = located<FunctionDefinitionNode>(name, std::get<std::string>(name.value), std::move(parameters), std::move(body));
+        size_t end = tokens[current - 1].end;
+        if (end <= options.source.size() && first.begin < end) {
+            function->source = std::string(options.source.substr(first.begin, end - first.begin));
+        }
+        return function;
+    }
+    
+    // Metotlar 'function' anahtar kelimesiyle ya da doğrudan isimle yazılabilir
+    inline std::unique_ptr<Node> Parser::classDeclaration() {
+        advance();
+        const Token& name = consume(TokenType::IDENTIFIER, "Expected class name");
+        consumePunctuation(Punctuation::LEFT_BRACE, "Expected '{' before class body");
+        std::vector<std::unique_ptr<Node>> methods;
+        while (!checkPunctuation(Punctuation::RIGHT_BRACE) && !isAtEnd()) {
+            methods.push_back(functionDeclaration());
+        }
+        consumePunctuation(Punctuation::RIGHT_BRACE, "Expected '}' after class body");
+        return located<ClassDefinitionNode>(name, std::get<std::string>(name.value), std::move(methods));
+    }
+    
+    inline std::unique_ptr<Node> Parser::statement() {
+        Nesting nesting(*this);
+        if (checkPunctuation(Punctuation::LEFT_BRACE)) return block();
+        if (checkKeyword(Keyword::IF)) return ifStatement();
+        if (checkKeyword(Keyword::WHILE)) return whileStatement();
+        if (checkKeyword(Keyword::FOR)) return forStatement();
+        if (checkKeyword(Keyword::FOREACH)) return foreachStatement();
+        if (checkKeyword(Keyword::RETURN) || checkKeyword(Keyword::BREAK) || checkKeyword(Keyword::CONTINUE)) return jumpStatement();
+        return expressionStatement();
+    }
+    
+    inline std::unique_ptr<Node> Parser::block() {
+        const Token& brace = peek();
+        consumePunctuation(Punctuation::LEFT_BRACE, "Expected '{'");
+        std::vector<std::unique_ptr<Node>> statements;
+        while (!checkPunctuation(Punctuation::RIGHT_BRACE) && !isAtEnd()) {
+            statements.push_back(declaration());
+        }
+        consumePunctuation(Punctuation::RIGHT_BRACE, "Expected '}' after block");
+        return located<BlockNode>(brace, std::move(statements));
+    }
+    
+    inline std::unique_ptr<Node> Parser::ifStatement() {
+        const Token& keyword = advance();
+        consumePunctuation(Punctuation::LEFT_PAREN, "Expected '(' after 'if'");
+        std::unique_ptr<Node> condition = expression();
+        consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after condition");
+        std::unique_ptr<Node> thenBranch = statement();
+        std::unique_ptr<Node> elseBranch;
+        if (matchKeyword(Keyword::ELSE)) elseBranch = statement();
+        return located<IfNode>(keyword, std::move(condition), std::move(thenBranch), std::move(elseBranch));
+    }
+    
+    inline std::unique_ptr<Node> Parser::whileStatement() {
+        const Token& keyword = advance();
+        consumePunctuation(Punctuation::LEFT_PAREN, "Expected '(' after 'while'");
+        std::unique_ptr<Node> condition = expression();
+        consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after condition");
+        std::unique_ptr<Node> body = statement();
+        return located<LoopNode>(keyword, "while", std::move(condition), std::move(body));
+    }
+    
+    // for (başlangıç; koşul; adım) gövde  ->  { başlangıç; döngü }
+    inline std::unique_ptr<Node> Parser::forStatement() {
+        const Token& keyword = advance();
+        consumePunctuation(Punctuation::LEFT_PAREN, "Expected '(' after 'for'");
+        
+        std::unique_ptr<Node> initializer;
+        if (checkKeyword(Keyword::LET) || checkKeyword(Keyword::CONST)) {
+            initializer = variableDeclaration();
+        } else if (!matchPunctuation(Punctuation::SEMICOLON)) {
+            initializer = expression();
+            consumePunctuation(Punctuation::SEMICOLON, "Expected ';' after loop initializer");
+        }
+        
+        std::unique_ptr<Node> condition;
+        if (!checkPunctuation(Punctuation::SEMICOLON)) condition = expression();
+        else condition = located<LiteralNode>(keyword, LiteralNode::Kind::TRUE_VALUE);
+        consumePunctuation(Punctuation::SEMICOLON, "Expected ';' after loop condition");
+        
+        std::unique_ptr<Node> increment;
+        if (!checkPunctuation(Punctuation::RIGHT_PAREN)) increment = expression();
+        consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after for clauses");
+        
+        auto loop = located<LoopNode>(keyword, "for", std::move(condition), statement());
+        loop->increment = std::move(increment);
+        if (!initializer) return loop;
+        
+        std::vector<std::unique_ptr<Node>> statements;
+        statements.push_back(std::move(initializer));
+        statements.push_back(std::move(loop));
+        return located<BlockNode>(keyword, std::move(statements));
+    }
+    
+    // foreach için koleksiyon değerlendirmesi henüz yok; sessizce yanlış çalışmak yerine reddedilir
+    inline std::unique_ptr<Node> Parser::foreachStatement() {
+        error(peek(), "'foreach' is not supported yet");
+    }
+    
+    inline std::unique_ptr<Node> Parser::jumpStatement() {
+        const Token& keyword = advance();
+        Keyword kind = std::get<Keyword>(keyword.value);
+        std::unique_ptr<Node> node;
+        if (kind == Keyword::RETURN) {
+            std::unique_ptr<Node> value;
+            if (!checkPunctuation(Punctuation::SEMICOLON) && !checkPunctuation(Punctuation::RIGHT_BRACE) && !isAtEnd()) {
+                value = expression();
+            }
+            node = located<JumpNode>(keyword, JumpNode::Kind::RETURN, std::move(value));
+        } else {
+            node = located<JumpNode>(keyword, kind == Keyword::BREAK ? JumpNode::Kind::BREAK : JumpNode::Kind::CONTINUE);
+        }
+        endStatement();
+        return node;
+    }
+    
+    inline std::unique_ptr<Node> Parser::expressionStatement() {
+        std::unique_ptr<Node> node = expression();
+        endStatement();
+        return node;
+    }
+    
+    inline std::unique_ptr<Node> Parser::expression() {
+        Nesting nesting(*this);
+        return assignment();
+    }
+    
+    // Atama sağdan birleşir: a = b = 1
+    inline std::unique_ptr<Node> Parser::assignment() {
+        std::unique_ptr<Node> target = logicalOr();
+        if (checkOperator(Operator::ASSIGN)) {
+            const Token& token = advance();
+            auto identifier = dynamic_cast<IdentifierNode*>(target.get());
+            if (!identifier) error(token, "Invalid assignment target");
+            Nesting nesting(*this);
+            return located<AssignmentNode>(token, identifier->name, assignment());
+        }
+        return target;
+    }
+    
+    inline std::unique_ptr<Node> Parser::logicalOr() {
+        return binaryLevel({Operator::OR}, &Parser::logicalAnd);
+    }
+    
+    inline std::unique_ptr<Node> Parser::logicalAnd() {
+        return binaryLevel({Operator::AND}, &Parser::equality);
+    }
+    
+    inline std::unique_ptr<Node> Parser::equality() {
+        return binaryLevel({Operator::EQUAL, Operator::NOT_EQUAL}, &Parser::comparison);
+    }
+    
+    inline std::unique_ptr<Node> Parser::comparison() {
+        return binaryLevel({Operator::GREATER, Operator::GREATER_EQUAL, Operator::LESS, Operator::LESS_EQUAL}, &Parser::term);
+    }
+    
+    inline std::unique_ptr<Node> Parser::term() {
+        return binaryLevel({Operator::PLUS, Operator::MINUS}, &Parser::factor);
+    }
+    
+    inline std::unique_ptr<Node> Parser::factor() {
+        return binaryLevel({Operator::MULTIPLY, Operator::DIVIDE, Operator::MODULO}, &Parser::power);
+    }
+    
+    // Üs alma sağdan birleşir: 2 ^ 3 ^ 2 = 2 ^ 9
+    inline std::unique_ptr<Node> Parser::power() {
+        std::unique_ptr<Node> base = unary();
+        if (checkOperator(Operator::POWER)) {
+            const Token& token = advance();
+            Nesting nesting(*this);
+            return located<BinaryOperationNode>(token, std::move(base), power(), "^");
+        }
+        return base;
+    }
+    
+    inline std::unique_ptr<Node> Parser::unary() {
+        if (checkOperator(Operator::NOT) || checkOperator(Operator::MINUS)) {
+            const Token& token = advance();
+            Nesting nesting(*this);
+            return located<UnaryOperationNode>(token, unary(), token.toString());
+        }
+        return primary();
+    }
+    
+    inline std::unique_ptr<Node> Parser::primary() {
+        const Token& token = peek();
+        switch (token.type) {
+            case TokenType::NUMBER: {
+                advance();
+                double number = std::holds_alternative<int>(token.value) ? std::get<int>(token.value) : std::get<float>(token.value);
+                return located<NumberNode>(token, number);
+            }
+            case TokenType::STRING:
+                advance();
+                return located<StringNode>(token, std::get<std::string>(token.value));
+            case TokenType::KEYWORD:
+                switch (std::get<Keyword>(token.value)) {
+                    case Keyword::TRUE:
+                        advance();
+                        return located<LiteralNode>(token, LiteralNode::Kind::TRUE_VALUE);
+                    case Keyword::FALSE:
+                        advance();
+                        return located<LiteralNode>(token, LiteralNode::Kind::FALSE_VALUE);
+                    case Keyword::NULL_TOKEN:
+                    case Keyword::UNDEFINED:
+                        advance();
+                        return located<LiteralNode>(token, LiteralNode::Kind::NULL_VALUE);
+                    default:
+                        break;
+                }
+                break;
+            case TokenType::IDENTIFIER: {
+                advance();
+                const std::string& name = std::get<std::string>(token.value);
+                if (!matchPunctuation(Punctuation::LEFT_PAREN)) return located<IdentifierNode>(token, name);
+                std::vector<std::unique_ptr<Node>> arguments;
+                if (!checkPunctuation(Punctuation::RIGHT_PAREN)) {
+                    do {
+                        arguments.push_back(expression());
+                    } while (matchPunctuation(Punctuation::COMMA));
+                }
+                consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after arguments");
+                return located<FunctionCallNode>(token, name, std::move(arguments));
+            }
+            case TokenType::PUNCTUATION:
+                if (std::get<Punctuation>(token.value) == Punctuation::LEFT_PAREN) {
+                    advance();
+                    std::unique_ptr<Node> inner = expression();
+                    consumePunctuation(Punctuation::RIGHT_PAREN, "Expected ')' after expression");
+                    return inner;
+                }
+                break;
+            default:
+                break;
+        }
+        error(token, isAtEnd() ? "Unexpected end of input" : "Expected expression, got '" + token.toString() + "'");
+    }
 }
 
 #endif // WHOLF_PARSER_HPP
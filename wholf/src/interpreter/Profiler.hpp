@@ -0,0 +1,325 @@
+#ifndef WHOLF_PROFILER_HPP
+#define WHOLF_PROFILER_HPP
+
+#include <signal.h>
+#include <sys/time.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Wholf {
+    namespace Profiling {
+        // Betik seviyesinde bir çağrı çerçevesi
+        struct Frame {
+            uint32_t function;
+            int32_t line;
+        };
+
+        // Yorumlayıcının tuttuğu gölge çağrı yığını; sinyal işleyicisi aynı thread'de okur
+        class CallStack {
+        public:
+            static constexpr uint32_t MAX_DEPTH = 256;
+
+            // Bu thread'de şu an çalışan yığın (sinyal işleyicisi için)
+            static CallStack*& current() {
+                static thread_local CallStack* stack = nullptr;
+                return stack;
+            }
+
+            void push(uint32_t function, int32_t line) {
+                uint32_t index = depth.load(std::memory_order_relaxed);
+                if (index < MAX_DEPTH) frames[index] = Frame{function, line};
+                std::atomic_signal_fence(std::memory_order_release);
+                depth.store(index + 1, std::memory_order_relaxed);
+            }
+
+            void pop() {
+                depth.store(depth.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            }
+
+            // Tepedeki çerçevenin o an yürütülen satırı
+            void setLine(int32_t line) {
+                uint32_t index = depth.load(std::memory_order_relaxed);
+                if (index > 0 && index <= MAX_DEPTH) frames[index - 1].line = line;
+            }
+
+            uint32_t size() const {
+                return std::min(depth.load(std::memory_order_relaxed), MAX_DEPTH);
+            }
+
+            const Frame& operator[](uint32_t index) const { return frames[index]; }
+
+        private:
+            Frame frames[MAX_DEPTH];
+            std::atomic<uint32_t> depth{0};
+        };
+
+        // Çerçeve giriş/çıkışı için RAII
+        class ScopedFrame {
+        public:
+            ScopedFrame(CallStack& stack, uint32_t function, int32_t line) : stack(stack) {
+                stack.push(function, line);
+            }
+
+            ~ScopedFrame() { stack.pop(); }
+
+            ScopedFrame(const ScopedFrame&) = delete;
+            ScopedFrame& operator=(const ScopedFrame&) = delete;
+
+        private:
+            CallStack& stack;
+        };
+
+        // Thread'in aktif yığınını geçici olarak değiştir
+        class ActiveStack {
+        public:
+            explicit ActiveStack(CallStack* stack) : previous(CallStack::current()) {
+                CallStack::current() = stack;
+            }
+
+            ~ActiveStack() { CallStack::current() = previous; }
+
+            ActiveStack(const ActiveStack&) = delete;
+            ActiveStack& operator=(const ActiveStack&) = delete;
+
+        private:
+            CallStack* previous;
+        };
+
+        // SIGPROF tabanlı örnekleyici profilleyici. Sinyal işleyicisi yalnızca gölge yığını
+        // kilitsiz halka tampona kopyalar; toplama ayrı bir thread'de yapılır.
+        class Profiler {
+        public:
+            static constexpr uint32_t MAX_SAMPLE_DEPTH = 64;
+            static constexpr size_t RING_SIZE = 4096;
+            static constexpr uint32_t UNINTERNED = static_cast<uint32_t>(-1);
+
+            static Profiler& instance() {
+                static Profiler profiler;
+                return profiler;
+            }
+
+            // Fonksiyon ismini kimliğe çevir (sinyal bağlamı dışında çağrılır)
+            uint32_t intern(const std::string& name) {
+                std::lock_guard<std::mutex> lock(namesMutex);
+                auto it = ids.find(name);
+                if (it != ids.end()) return it->second;
+                uint32_t id = static_cast<uint32_t>(names.size());
+                names.push_back(name);
+                ids.emplace(name, id);
+                return id;
+            }
+
+            bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
+            // Örneklemeyi başlat
+            void start(std::chrono::microseconds interval = std::chrono::microseconds(1000)) {
+                if (running.exchange(true)) return;
+                samplingInterval = interval;
+
+                struct sigaction action;
+                std::memset(&action, 0, sizeof(action));
+                action.sa_handler = &Profiler::onSignal;
+                action.sa_flags = SA_RESTART;
+                sigemptyset(&action.sa_mask);
+                sigaction(SIGPROF, &action, &previousAction);
+
+                collector = std::thread([this]() { collectLoop(); });
+
+                itimerval timer;
+                timer.it_interval.tv_sec = static_cast<time_t>(interval.count() / 1000000);
+                timer.it_interval.tv_usec = static_cast<suseconds_t>(interval.count() % 1000000);
+                timer.it_value = timer.it_interval;
+                setitimer(ITIMER_PROF, &timer, nullptr);
+            }
+
+            // Örneklemeyi durdur ve kalan örnekleri topla
+            void stop() {
+                if (!running.exchange(false)) return;
+
+                itimerval timer;
+                std::memset(&timer, 0, sizeof(timer));
+                setitimer(ITIMER_PROF, &timer, nullptr);
+                sigaction(SIGPROF, &previousAction, nullptr);
+
+                wakeup.notify_all();
+                collector.join();
+                drain();
+            }
+
+            // WHOLF_PROFILE ortam değişkeni ayarlıysa başlat; çıkışta yazılacak dosya yolunu döndürür
+            std::string startFromEnvironment() {
+                const char* path = std::getenv("WHOLF_PROFILE");
+                if (!path || !*path) return "";
+                start();
+                return path;
+            }
+
+            void reset() {
+                std::lock_guard<std::mutex> lock(aggregateMutex);
+                stacks.clear();
+                totalSamples = 0;
+                dropped.store(0, std::memory_order_relaxed);
+            }
+
+            uint64_t droppedSamples() const { return dropped.load(std::memory_order_relaxed); }
+
+            // flamegraph.pl / speedscope için katlanmış yığın çıktısı: "<script>:1;topla:4 17"
+            void writeCollapsed(const std::string& path) {
+                std::ofstream file(path);
+                if (!file) throw std::runtime_error("Cannot write profile: " + path);
+                std::lock_guard<std::mutex> lock(aggregateMutex);
+                for (const auto& entry : stacks) {
+                    const auto& frames = entry.first;
+                    for (size_t i = 0; i < frames.size(); i++) {
+                        if (i > 0) file << ';';
+                        file << frameName(frames[i]);
+                    }
+                    file << ' ' << entry.second << '\n';
+                }
+            }
+
+            // Fonksiyon başına self/total süre tablosu (milisaniye)
+            void writeTable(const std::string& path) {
+                struct Row {
+                    uint64_t self = 0;
+                    uint64_t total = 0;
+                };
+                std::map<uint32_t, Row> rows;
+                uint64_t samples;
+                {
+                    std::lock_guard<std::mutex> lock(aggregateMutex);
+                    samples = totalSamples;
+                    for (const auto& entry : stacks) {
+                        const auto& frames = entry.first;
+                        if (frames.empty()) continue;
+                        rows[frames.back().function].self += entry.second;
+                        // Özyinelemede aynı fonksiyon bir kez sayılır
+                        std::set<uint32_t> seen;
+                        for (const auto& frame : frames) {
+                            if (seen.insert(frame.function).second) rows[frame.function].total += entry.second;
+                        }
+                    }
+                }
+
+                std::vector<std::pair<uint32_t, Row>> sorted(rows.begin(), rows.end());
+                std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.second.self > b.second.self; });
+
+                std::ofstream file(path);
+                if (!file) throw std::runtime_error("Cannot write profile: " + path);
+                double millisPerSample = static_cast<double>(samplingInterval.count()) / 1000.0;
+                file << "function\tself_ms\ttotal_ms\tself_pct\n";
+                for (const auto& row : sorted) {
+                    double percent = samples ? 100.0 * static_cast<double>(row.second.self) / static_cast<double>(samples) : 0.0;
+                    file << functionName(row.first) << '\t'
+                         << static_cast<double>(row.second.self) * millisPerSample << '\t'
+                         << static_cast<double>(row.second.total) * millisPerSample << '\t'
+                         << percent << '\n';
+                }
+            }
+
+        private:
+            // Halka tampon slotu: 0 boş, 1 yazılıyor, 2 hazır
+            struct Sample {
+                std::atomic<uint32_t> state{0};
+                uint32_t depth = 0;
+                Frame frames[MAX_SAMPLE_DEPTH];
+            };
+
+            struct FramesLess {
+                bool operator()(const std::vector<Frame>& a, const std::vector<Frame>& b) const {
+                    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), [](const Frame& x, const Frame& y) {
+                        return x.function != y.function ? x.function < y.function : x.line < y.line;
+                    });
+                }
+            };
+
+            std::atomic<bool> running{false};
+            std::chrono::microseconds samplingInterval{1000};
+            struct sigaction previousAction;
+            std::thread collector;
+            std::mutex wakeMutex;
+            std::condition_variable wakeup;
+
+            Sample ring[RING_SIZE];
+            std::atomic<uint64_t> writeIndex{0};
+            std::atomic<uint64_t> dropped{0};
+
+            std::mutex namesMutex;
+            std::vector<std::string> names;
+            std::unordered_map<std::string, uint32_t> ids;
+
+            std::mutex aggregateMutex;
+            std::map<std::vector<Frame>, uint64_t, FramesLess> stacks;
+            uint64_t totalSamples = 0;
+
+            Profiler() = default;
+
+            // Sinyal işleyicisi: yalnızca kilitsiz atomik işlemler ve düz kopyalama
+            static void onSignal(int) {
+                CallStack* stack = CallStack::current();
+                if (!stack) return;
+                Profiler& profiler = instance();
+
+                uint32_t depth = stack->size();
+                if (depth == 0) return;
+                std::atomic_signal_fence(std::memory_order_acquire);
+
+                Sample& sample = profiler.ring[profiler.writeIndex.fetch_add(1, std::memory_order_relaxed) % RING_SIZE];
+                uint32_t expected = 0;
+                if (!sample.state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+                    profiler.dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                // Derin yığınlarda kök tarafı korunur, uç kısım kesilir
+                uint32_t count = std::min(depth, MAX_SAMPLE_DEPTH);
+                for (uint32_t i = 0; i < count; i++) sample.frames[i] = (*stack)[i];
+                sample.depth = count;
+                sample.state.store(2, std::memory_order_release);
+            }
+
+            void collectLoop() {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                while (running.load(std::memory_order_relaxed)) {
+                    wakeup.wait_for(lock, std::chrono::milliseconds(20));
+                    drain();
+                }
+            }
+
+            void drain() {
+                std::lock_guard<std::mutex> lock(aggregateMutex);
+                for (auto& sample : ring) {
+                    if (sample.state.load(std::memory_order_acquire) != 2) continue;
+                    stacks[std::vector<Frame>(sample.frames, sample.frames + sample.depth)]++;
+                    totalSamples++;
+                    sample.state.store(0, std::memory_order_release);
+                }
+            }
+
+            std::string functionName(uint32_t id) {
+                std::lock_guard<std::mutex> lock(namesMutex);
+                return id < names.size() ? names[id] : "?";
+            }
+
+            std::string frameName(const Frame& frame) {
+                return functionName(frame.function) + ":" + std::to_string(frame.line);
+            }
+        };
+    }
+}
+
+#endif // WHOLF_PROFILER_HPP
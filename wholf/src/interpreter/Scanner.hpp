@@ -2,6 +2,11 @@
 #define WHOLF_SCANNER_HPP
 
 #include "Token.hpp"
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -10,24 +15,25 @@ namespace Wholf {
     class Scanner {
     private:
         std::string source;
-        int start;
-        int current;
+        std::vector<Token> tokens;
+        size_t start;
+        size_t current;
         int line;
         int column;
-        
+        int startColumn;
+    
     public:
-        Scanner(const std::string& source) : source(source), start(0), current(0), line(1), column(1) {}
+        Scanner(const std::string& source) : source(source), start(0), current(0), line(1), column(1), startColumn(1) {}
         
+        // Kaynağı token'lara ayır; liste her zaman EOF_TOKEN ile biter
         std::vector<Token> scanTokens();
-        
+    
     private:
-        // Token oluşturma
-        Token makeToken(TokenType type) {
-            return Token(type, source.substr(start, current - start), line, column);
-        }
+        void scanToken();
         
-        Token errorToken(const std::string& message) {
-            return Token(TokenType::EOF_TOKEN, message, line, column);
+        // Hata konumu token'ın başlangıcıdır
+        [[noreturn]] void error(const std::string& message) const {
+            throw std::runtime_error(message + " at line " + std::to_string(line) + ", column " + std::to_string(startColumn));
         }
         
         // Yardımcı fonksiyonlar
@@ -38,14 +44,15 @@ namespace Wholf {
             return source[current++];
         }
         
-        void addToken(TokenType type) {
-            tokens.push_back(makeToken(type));
-        }
-        
         void addToken(TokenType type, const std::variant<int, float, std::string, Keyword, Operator, Punctuation>& literal) {
-            tokens.push_back(Token(type, literal, line, column));
+            tokens.push_back(Token(type, literal, line, startColumn));
+            tokens.back().begin = start;
+            tokens.back().end = current;
         }
         
+        void addOperator(Operator op) { addToken(TokenType::OPERATOR, op); }
+        void addPunctuation(Punctuation punctuation) { addToken(TokenType::PUNCTUATION, punctuation); }
+        
         char peek() const {
             if (isAtEnd()) return '\0';
             return source[current];
@@ -64,6 +71,15 @@ namespace Wholf {
             return true;
         }
         
+        static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+        
+        // UTF-8 baytları da tanımlayıcıya dahildir (ör. Türkçe değişken isimleri)
+        static bool isIdentifierStart(char c) {
+            return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || static_cast<unsigned char>(c) >= 0x80;
+        }
+        
+        static bool isIdentifierPart(char c) { return isIdentifierStart(c) || isDigit(c); }
+        
         void skipWhitespace() {
             while (true) {
                 char c = peek();
@@ -74,9 +90,9 @@ namespace Wholf {
                         advance();
                         break;
                     case '\n':
+                        advance();
                         line++;
                         column = 1;
-                        advance();
                         break;
                     case '/':
                         if (peekNext() == '/') {
@@ -84,17 +100,18 @@ namespace Wholf {
                             while (peek() != '\n' && !isAtEnd()) advance();
                         } else if (peekNext() == '*') {
                             // Çoklu satır yorum
-                            while (peek() != '*' && peekNext() != '/' && !isAtEnd()) {
-                                if (peek() == '\n') {
+                            startColumn = column;
+                            advance();
+                            advance();
+                            while (!isAtEnd() && !(peek() == '*' && peekNext() == '/')) {
+                                if (advance() == '\n') {
                                     line++;
                                     column = 1;
                                 }
-                                advance();
-                            }
-                            if (!isAtEnd()) {
-                                advance(); // '*' karakterini atla
-                                advance(); // '/' karakterini atla
                             }
+                            if (isAtEnd()) error("Unterminated comment");
+                            advance(); // '*' karakterini atla
+                            advance(); // '/' karakterini atla
                         } else {
                             return;
                         }
@@ -105,39 +122,64 @@ namespace Wholf {
             }
         }
         
-        std::string string() {
+        void string() {
+            std::string value;
             while (peek() != '"' && !isAtEnd()) {
-                if (peek() == '\n') {
+                char c = advance();
+                if (c == '\n') {
                     line++;
                     column = 1;
+                } else if (c == '\\' && !isAtEnd()) {
+                    char escaped = advance();
+                    switch (escaped) {
+                        case 'n': c = '\n'; break;
+                        case 't': c = '\t'; break;
+                        case 'r': c = '\r'; break;
+                        default: c = escaped; break;
+                    }
                 }
-                advance();
+                value += c;
             }
             
-            if (isAtEnd()) {
-                tokens.push_back(errorToken("Unterminated string."));
-                return "";
-            }
+            if (isAtEnd()) error("Unterminated string");
             
             // Kapalı tırnak işaretini atla
             advance();
-            return source.substr(start + 1, current - 2 - start);
+            addToken(TokenType::STRING, value);
         }
         
-        double number() {
-            while (std::isdigit(peek())) advance();
+        // Tam sayılar int sığarsa int, aksi halde float olarak saklanır
+        void number() {
+            while (isDigit(peek())) advance();
             
-            if (peek() == '.' && std::isdigit(peekNext())) {
+            bool fractional = false;
+            if (peek() == '.' && isDigit(peekNext())) {
+                fractional = true;
                 advance();
-                while (std::isdigit(peek())) advance();
+                while (isDigit(peek())) advance();
             }
             
-            return std::stod(source.substr(start, current - start));
+            std::string text = source.substr(start, current - start);
+            if (!fractional) {
+                errno = 0;
+                long long integer = std::strtoll(text.c_str(), nullptr, 10);
+                if (errno == 0 && integer <= INT_MAX) {
+                    addToken(TokenType::NUMBER, static_cast<int>(integer));
+                    return;
+                }
+            }
+            addToken(TokenType::NUMBER, std::strtof(text.c_str(), nullptr));
         }
         
-        std::string identifier() {
-            while (std::isalnum(peek())) advance();
-            return source.substr(start, current - start);
+        void identifier() {
+            while (isIdentifierPart(peek())) advance();
+            std::string text = source.substr(start, current - start);
+            Keyword keyword = checkKeyword(text);
+            if (keyword == Keyword::IDENTIFIER) {
+                addToken(TokenType::IDENTIFIER, text);
+            } else {
+                addToken(TokenType::KEYWORD, keyword);
+            }
         }
         
         // Anahtar kelimeleri kontrol et
@@ -161,6 +203,68 @@ namespace Wholf {
             return Keyword::IDENTIFIER;
         }
     };
+    
+    inline std::vector<Token> Scanner::scanTokens() {
+        tokens.clear();
+        tokens.reserve(source.size() / 4 + 1);
+        while (true) {
+            skipWhitespace();
+            start = current;
+            startColumn = column;
+            if (isAtEnd()) break;
+            scanToken();
+        }
+        tokens.push_back(Token(TokenType::EOF_TOKEN, std::string(), line, column));
+        return std::move(tokens);
+    }
+    
+    inline void Scanner::scanToken() {
+        char c = advance();
+        switch (c) {
+            case '(': addPunctuation(Punctuation::LEFT_PAREN); break;
+            case ')': addPunctuation(Punctuation::RIGHT_PAREN); break;
+            case '{': addPunctuation(Punctuation::LEFT_BRACE); break;
+            case '}': addPunctuation(Punctuation::RIGHT_BRACE); break;
+            case '[': addPunctuation(Punctuation::LEFT_BRACKET); break;
+            case ']': addPunctuation(Punctuation::RIGHT_BRACKET); break;
+            case ',': addPunctuation(Punctuation::COMMA); break;
+            case ';': addPunctuation(Punctuation::SEMICOLON); break;
+            case '.': addPunctuation(Punctuation::DOT); break;
+            case ':': addPunctuation(Punctuation::COLON); break;
+            case '+': addOperator(Operator::PLUS); break;
+            case '-': addOperator(Operator::MINUS); break;
+            case '*': addOperator(Operator::MULTIPLY); break;
+            case '/': addOperator(Operator::DIVIDE); break;
+            case '%': addOperator(Operator::MODULO); break;
+            case '^': addOperator(Operator::POWER); break;
+            case '!': addOperator(match('=') ? Operator::NOT_EQUAL : Operator::NOT); break;
+            case '<': addOperator(match('=') ? Operator::LESS_EQUAL : Operator::LESS); break;
+            case '>': addOperator(match('=') ? Operator::GREATER_EQUAL : Operator::GREATER); break;
+            case '=':
+                if (match('=')) addOperator(Operator::EQUAL);
+                else if (match('>')) addPunctuation(Punctuation::ARROW);
+                else addOperator(Operator::ASSIGN);
+                break;
+            case '&':
+                if (!match('&')) error("Unexpected character '&'");
+                addOperator(Operator::AND);
+                break;
+            case '|':
+                if (!match('|')) error("Unexpected character '|'");
+                addOperator(Operator::OR);
+                break;
+            case '"': string(); break;
+            default:
+                if (isDigit(c)) {
+                    number();
+                } else if (isIdentifierStart(c)) {
+                    identifier();
+                } else {
+                    error(std::string("Unexpected character '") + c + "'");
+                }
+                break;
+        }
+    }
 }
 
 #endif // WHOLF_SCANNER_HPP
@@ -0,0 +1,328 @@
+#ifndef WHOLF_SCHEDULER_HPP
+#define WHOLF_SCHEDULER_HPP
+
+#include "WholfInterpreter.hpp"
+#include "Execution.hpp"
+#include <ucontext.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Wholf {
+    class Scheduler;
+
+    // Görevden zamanlayıcıya geri bağlantı; görev zamanlayıcıdan uzun yaşayabilir,
+    // bu yüzden zamanlayıcı yıkılırken işaretçi kilit altında boşaltılır
+    struct SchedulerLink {
+        std::mutex mutex;
+        Scheduler* scheduler = nullptr;
+    };
+
+    // Zamanlayıcıda çalışan tek bir betik; kendi yığınında yürür, dilim sonunda askıya alınır
+    class ScriptTask {
+    public:
+        enum class State {
+            READY,
+            RUNNING,
+            SUSPENDED,
+            FINISHED
+        };
+
+        std::string tenant;
+        std::string code;
+        ExecutionControl control;
+
+        ScriptTask(const std::string& tenant, const std::string& code, std::shared_ptr<Interpreter> interpreter, size_t stackSize)
+            : tenant(tenant), code(code), interpreter(std::move(interpreter)), stack(new char[stackSize]), stackSize(stackSize) {
+            this->interpreter->setExecutionControl(&control);
+            control.yieldHandler = [this]() {
+                swapcontext(&context, returnContext);
+                // Fiber hep aynı worker'da sürer, ama arada o thread başka fiber'ları çalıştırdı
+                Profiling::CallStack::current() = this->interpreter->getCallStack();
+            };
+        }
+
+        ScriptTask(const ScriptTask&) = delete;
+        ScriptTask& operator=(const ScriptTask&) = delete;
+
+        std::shared_future<Value> result() const { return future; }
+
+        State state() const { return currentState.load(std::memory_order_acquire); }
+
+        // Bir sonraki güvenli noktada (en geç SAFEPOINT_INTERVAL komut sonra) askıya al;
+        // resume() ile tekrar kuyruğa girer
+        void suspend() {
+            suspendRequested.store(true, std::memory_order_release);
+            control.requestYield();
+        }
+        void resume();
+
+        // Bir sonraki güvenli noktada ExecutionInterrupted ile sonlandır
+        void cancel() { control.cancel(); }
+
+        uint64_t slicesUsed() const { return slices.load(std::memory_order_relaxed); }
+
+    private:
+        friend class Scheduler;
+
+        std::shared_ptr<Interpreter> interpreter;
+        std::unique_ptr<char[]> stack;
+        size_t stackSize;
+        ucontext_t context;
+        ucontext_t* returnContext = nullptr;
+        bool started = false;
+        std::atomic<uint64_t> slices{0};
+        std::shared_ptr<SchedulerLink> owner;
+
+        // İlk dilimi çalıştıran worker; fiber yığınında thread_local durumu (CallStack::current,
+        // ActiveStack'in sakladığı önceki değer, metrik parçası) yaşadığı için başka thread'e geçmez
+        static constexpr size_t UNPINNED = static_cast<size_t>(-1);
+        size_t worker = UNPINNED;
+
+        std::atomic<State> currentState{State::READY};
+        std::atomic<bool> suspendRequested{false};
+        std::promise<Value> promise;
+        std::shared_future<Value> future = promise.get_future().share();
+
+        // makecontext yalnızca int argüman alır; işaretçi iki parçaya bölünür
+        static void entry(unsigned int high, unsigned int low) {
+            auto task = reinterpret_cast<ScriptTask*>((static_cast<uintptr_t>(high) << 32) | low);
+            try {
+                task->promise.set_value(task->interpreter->interpret(task->code));
+            } catch (...) {
+                task->promise.set_exception(std::current_exception());
+            }
+            task->currentState.store(State::FINISHED, std::memory_order_release);
+            // uc_link kullanılmaz; çağıran worker'a dön
+            swapcontext(&task->context, task->returnContext);
+        }
+
+        void prepare() {
+            getcontext(&context);
+            context.uc_stack.ss_sp = stack.get();
+            context.uc_stack.ss_size = stackSize;
+            context.uc_link = nullptr;
+            auto address = reinterpret_cast<uintptr_t>(this);
+            makecontext(&context, reinterpret_cast<void (*)()>(&ScriptTask::entry), 2,
+                        static_cast<unsigned int>(address >> 32), static_cast<unsigned int>(address & 0xffffffffu));
+            started = true;
+        }
+    };
+
+    // Sabit boyutlu thread havuzu üzerinde adil zaman paylaşımı.
+    // Yeni betikler ortak yüksek öncelikli kuyruğa girer ve boştaki herhangi bir worker alır;
+    // dilimini dolduran betik kendi worker'ının düşük öncelikli kuyruğuna iner. Böylece kısa
+    // betikler ilk dilimlerinde biter ve uzun betiklerin arkasında beklemez. Başlamış bir
+    // betik hep aynı worker'da devam eder (bkz. ScriptTask::worker).
+    class Scheduler {
+    public:
+        struct Options {
+            size_t threads = std::thread::hardware_concurrency();
+            uint64_t sliceInstructions = 100000;
+            size_t stackSize = 512 * 1024;
+            // Düşük öncelikli kuyruk her kaç seçimde bir öne alınır (açlığı önler)
+            unsigned lowPriorityInterval = 4;
+        };
+        
+        Scheduler() : Scheduler(Options()) {}
+        
+        explicit Scheduler(const Options& options) : options(options), link(std::make_shared<SchedulerLink>()) {
+            link->scheduler = this;
+            size_t count = options.threads == 0 ? 1 : options.threads;
+            pinned.resize(count);
+            for (size_t i = 0; i < count; i++) {
+                workers.emplace_back([this, i]() { workerLoop(i); });
+            }
+        }
+        
+        // Kuyrukta kalan bütün betikler ExecutionInterrupted (CANCELLED) ile sonlanır; yarıda
+        // kalanlar kendi worker'larında iptal edilip çözülür
+        ~Scheduler() {
+            {
+                // Bundan sonra resume() etkisizdir; süren bir resume() bitene kadar beklenir
+                std::lock_guard<std::mutex> lock(link->mutex);
+                link->scheduler = nullptr;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            available.notify_all();
+            for (auto& worker : workers) worker.join();
+            
+            // Hiç başlamamış betiklerin yığınında bir şey yok; yalnızca future'ları kapatılır
+            std::vector<std::shared_ptr<ScriptTask>> unstarted(fresh.begin(), fresh.end());
+            unstarted.insert(unstarted.end(), parked.begin(), parked.end());
+            for (const auto& task : unstarted) {
+                task->promise.set_exception(std::make_exception_ptr(
+                    ExecutionInterrupted(InterruptReason::CANCELLED, "Scheduler stopped before the script started")));
+                task->currentState.store(ScriptTask::State::FINISHED, std::memory_order_release);
+            }
+        }
+        
+        // Betiği yeni bir interpreter ile kuyruğa ekle
+        std::shared_ptr<ScriptTask> submit(const std::string& tenant, const std::string& code) {
+            return submit(tenant, code, std::make_shared<Interpreter>());
+        }
+        
+        // Hazır (ör. prelude yüklenmiş) bir interpreter ile kuyruğa ekle
+        std::shared_ptr<ScriptTask> submit(const std::string& tenant, const std::string& code, std::shared_ptr<Interpreter> interpreter) {
+            auto task = std::make_shared<ScriptTask>(tenant, code, std::move(interpreter), options.stackSize);
+            task->owner = link;
+            task->currentState.store(ScriptTask::State::READY, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                fresh.push_back(task);
+            }
+            available.notify_one();
+            return task;
+        }
+        
+        size_t pendingTasks() {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t count = fresh.size();
+            for (const auto& queue : pinned) count += queue.tasks.size();
+            return count;
+        }
+        
+    private:
+        friend class ScriptTask;
+        
+        // Bir worker'a bağlı, dilimini doldurmuş betikler
+        struct PinnedQueue {
+            std::deque<std::shared_ptr<ScriptTask>> tasks;
+            unsigned picks = 0;
+        };
+        
+        Options options;
+        std::shared_ptr<SchedulerLink> link;
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::shared_ptr<ScriptTask>> fresh;
+        std::vector<PinnedQueue> pinned;
+        std::vector<std::shared_ptr<ScriptTask>> parked;
+        bool stopping = false;
+        
+        // Askıdaki betiği tekrar kuyruğa al; park ile aynı kilit altında yapılır
+        void unpark(ScriptTask* task) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                task->suspendRequested.store(false, std::memory_order_relaxed);
+                task->control.yieldRequested.store(false, std::memory_order_relaxed);
+                if (task->state() != ScriptTask::State::SUSPENDED) return;
+                for (auto it = parked.begin(); it != parked.end(); ++it) {
+                    if (it->get() == task) {
+                        task->currentState.store(ScriptTask::State::READY, std::memory_order_release);
+                        if (task->worker == ScriptTask::UNPINNED) fresh.push_back(*it);
+                        else pinned[task->worker].tasks.push_back(*it);
+                        parked.erase(it);
+                        break;
+                    }
+                }
+            }
+            // Bağlı betik yalnızca kendi worker'ında çalışabilir; doğru olanı uyandırmak için hepsi
+            available.notify_all();
+        }
+        
+        std::shared_ptr<ScriptTask> next(size_t index) {
+            std::unique_lock<std::mutex> lock(mutex);
+            PinnedQueue& own = pinned[index];
+            while (true) {
+                available.wait(lock, [&]() { return stopping || !fresh.empty() || !own.tasks.empty(); });
+                if (stopping) return nullptr;
+                
+                bool preferPinned = !own.tasks.empty() &&
+                                    (fresh.empty() || ++own.picks % options.lowPriorityInterval == 0);
+                auto& queue = preferPinned ? own.tasks : fresh;
+                auto task = queue.front();
+                queue.pop_front();
+                
+                // Kuyruktayken askıya alınan betik çalıştırılmadan park edilir
+                if (task->suspendRequested.exchange(false, std::memory_order_acq_rel)) {
+                    task->control.yieldRequested.store(false, std::memory_order_relaxed);
+                    task->currentState.store(ScriptTask::State::SUSPENDED, std::memory_order_release);
+                    parked.push_back(task);
+                    continue;
+                }
+                return task;
+            }
+        }
+        
+        void runSlice(ScriptTask& task, ucontext_t& workerContext, uint64_t sliceInstructions) {
+            task.returnContext = &workerContext;
+            task.currentState.store(ScriptTask::State::RUNNING, std::memory_order_release);
+            task.control.beginSlice(sliceInstructions);
+            task.slices++;
+            swapcontext(&workerContext, &task.context);
+            Profiling::CallStack::current() = nullptr;
+        }
+        
+        void workerLoop(size_t index) {
+            ucontext_t workerContext;
+            while (auto task = next(index)) {
+                if (!task->started) {
+                    task->prepare();
+                    task->worker = index;
+                }
+                runSlice(*task, workerContext, options.sliceInstructions);
+                
+                if (task->state() == ScriptTask::State::FINISHED) continue;
+                
+                std::lock_guard<std::mutex> lock(mutex);
+                if (task->suspendRequested.exchange(false, std::memory_order_acq_rel)) {
+                    task->currentState.store(ScriptTask::State::SUSPENDED, std::memory_order_release);
+                    parked.push_back(task);
+                    continue;
+                }
+                // Dilimini dolduran betik bu worker'ın düşük öncelikli kuyruğuna iner;
+                // bir sonraki next() aynı thread'de olduğu için uyandırma gerekmez
+                task->currentState.store(ScriptTask::State::READY, std::memory_order_release);
+                pinned[index].tasks.push_back(task);
+            }
+            cancelPinned(index, workerContext);
+        }
+        
+        // Kapanış: bu worker'da yarıda kalmış fiber'ları iptal et ve bitene kadar sür; böylece
+        // yığınlarındaki nesnelerin yıkıcıları çalışır ve yığın bellekleri sızdırılmaz
+        void cancelPinned(size_t index, ucontext_t& workerContext) {
+            std::vector<std::shared_ptr<ScriptTask>> unfinished;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto& queue = pinned[index].tasks;
+                unfinished.assign(queue.begin(), queue.end());
+                queue.clear();
+                for (auto it = parked.begin(); it != parked.end();) {
+                    if ((*it)->worker == index) {
+                        unfinished.push_back(*it);
+                        it = parked.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+            for (const auto& task : unfinished) {
+                task->control.cancel();
+                while (task->state() != ScriptTask::State::FINISHED) {
+                    runSlice(*task, workerContext, ExecutionControl::UNLIMITED);
+                }
+            }
+        }
+    };
+    
+    inline void ScriptTask::resume() {
+        if (!owner) return;
+        std::lock_guard<std::mutex> lock(owner->mutex);
+        if (owner->scheduler) owner->scheduler->unpark(this);
+    }
+}
+
+#endif // WHOLF_SCHEDULER_HPP
@@ -0,0 +1,451 @@
+#ifndef WHOLF_SNAPSHOT_HPP
+#define WHOLF_SNAPSHOT_HPP
+
+#include "Value.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Wholf {
+    // Snapshot dosya düzeni: başlık | global tablosu (isme göre sıralı) | değer kayıtları |
+    // fonksiyon tablosu (isme göre sıralı) | string alanı.
+    // Tüm bağlantılar bölüm başına göre ofsettir; yükleme sırasında taban adrese eklenerek
+    // yer değiştirilir. Dosya MAP_PRIVATE ile eşlenir, bu yüzden sayfalar süreçler arasında
+    // paylaşılır ve yazma olursa kopyalanır.
+    namespace SnapshotFormat {
+        static constexpr char MAGIC[8] = {'W', 'H', 'S', 'N', 'A', 'P', '0', '1'};
+        static constexpr uint32_t VERSION = 2;
+        // İç içe dizi/nesne derinliği sınırı; yazıcı daha derin değeri reddeder, okuyucu bozuk sayar
+        static constexpr size_t MAX_DEPTH = 1024;
+
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t globalCount;
+            uint64_t globalsOffset;
+            uint64_t recordsOffset;
+            uint64_t recordCount;
+            uint64_t stringsOffset;
+            uint64_t stringsSize;
+            uint64_t fileSize;
+            uint64_t functionsOffset;
+            uint64_t functionCount;
+        };
+
+        // Global tablo satırı
+        struct Global {
+            uint64_t nameOffset;
+            uint64_t nameLength;
+            uint64_t record;
+        };
+
+        // Betik fonksiyonu; tanımın kaynak metni string alanındadır, ilk çağrıda parse edilir
+        struct Function {
+            uint64_t nameOffset;
+            uint64_t nameLength;
+            uint64_t sourceOffset;
+            uint64_t sourceLength;
+        };
+
+        // Sabit boyutlu değer kaydı.
+        // STRING: first = string ofseti, second = uzunluk
+        // ARRAY: first = ilk eleman kaydı, second = eleman sayısı
+        // OBJECT: first = ilk anahtar/değer kaydı çifti, second = çift sayısı
+        // TYPED_ARRAY: reserved = ElementType, first = ham baytların string alanındaki ofseti,
+        // second = eleman sayısı
+        struct Record {
+            uint32_t type;
+            uint32_t reserved;
+            uint64_t first;
+            uint64_t second;
+        };
+    }
+
+    // Eşlenmiş, salt okunur snapshot; globaller ilk erişimde tembel olarak Value'ya dönüştürülür.
+    // Metinler kopyalanmaz, eşlemeyi canlı tutan StringRef olarak verilir
+    class SnapshotImage : public std::enable_shared_from_this<SnapshotImage> {
+    public:
+        // Dosyayı eşle ve başlığı doğrula
+        static std::shared_ptr<const SnapshotImage> open(const std::string& path) {
+            int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) throw std::runtime_error("Cannot open snapshot: " + path);
+
+            struct stat info;
+            if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SnapshotFormat::Header)) {
+                ::close(fd);
+                throw std::runtime_error("Invalid snapshot: " + path);
+            }
+
+            size_t size = static_cast<size_t>(info.st_size);
+            void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (base == MAP_FAILED) throw std::runtime_error("Cannot map snapshot: " + path);
+
+            std::shared_ptr<SnapshotImage> image(new SnapshotImage(static_cast<const char*>(base), size));
+            image->validate(path);
+            return image;
+        }
+
+        ~SnapshotImage() {
+            munmap(const_cast<char*>(base), size);
+        }
+
+        SnapshotImage(const SnapshotImage&) = delete;
+        SnapshotImage& operator=(const SnapshotImage&) = delete;
+
+        size_t globalCount() const { return header->globalCount; }
+
+        // İkili arama ile global bul
+        bool contains(std::string_view name) const {
+            return findGlobal(name) != nullptr;
+        }
+
+        // Globali Value olarak oluştur; yoksa false döner
+        bool load(std::string_view name, Value& out) const {
+            const SnapshotFormat::Global* global = findGlobal(name);
+            if (!global) return false;
+            out = materialize(global->record);
+            return true;
+        }
+
+        // Betik fonksiyonunun kaynak metni; yoksa false döner
+        bool loadFunction(std::string_view name, std::string_view& source) const {
+            const SnapshotFormat::Function* end = functions + header->functionCount;
+            auto it = std::lower_bound(functions, end, name, [this](const SnapshotFormat::Function& function, std::string_view key) {
+                return string(function.nameOffset, function.nameLength) < key;
+            });
+            if (it == end || string(it->nameOffset, it->nameLength) != name) return false;
+            source = string(it->sourceOffset, it->sourceLength);
+            return true;
+        }
+
+        bool containsFunction(std::string_view name) const {
+            std::string_view source;
+            return loadFunction(name, source);
+        }
+
+        std::vector<std::string> functionNames() const {
+            std::vector<std::string> result;
+            result.reserve(header->functionCount);
+            for (uint64_t i = 0; i < header->functionCount; i++) {
+                result.emplace_back(string(functions[i].nameOffset, functions[i].nameLength));
+            }
+            return result;
+        }
+
+        // Tüm global isimleri (sıralı)
+        std::vector<std::string> names() const {
+            std::vector<std::string> result;
+            result.reserve(header->globalCount);
+            for (uint32_t i = 0; i < header->globalCount; i++) {
+                result.emplace_back(string(globals[i].nameOffset, globals[i].nameLength));
+            }
+            return result;
+        }
+
+    private:
+        const char* base;
+        size_t size;
+        const SnapshotFormat::Header* header = nullptr;
+        const SnapshotFormat::Global* globals = nullptr;
+        const SnapshotFormat::Record* records = nullptr;
+        const SnapshotFormat::Function* functions = nullptr;
+        const char* strings = nullptr;
+
+        SnapshotImage(const char* base, size_t size) : base(base), size(size) {}
+
+        // offset'ten başlayan count * elementSize bayt dosyaya sığıyor mu (taşmadan)
+        bool fits(uint64_t offset, uint64_t count, size_t elementSize, size_t alignment) const {
+            if (offset > size || offset % alignment != 0) return false;
+            return count <= (size - offset) / elementSize;
+        }
+
+        void validate(const std::string& path) {
+            header = reinterpret_cast<const SnapshotFormat::Header*>(base);
+            bool valid = std::memcmp(header->magic, SnapshotFormat::MAGIC, sizeof(header->magic)) == 0 &&
+                         header->version == SnapshotFormat::VERSION &&
+                         header->fileSize == size &&
+                         fits(header->globalsOffset, header->globalCount, sizeof(SnapshotFormat::Global), alignof(SnapshotFormat::Global)) &&
+                         fits(header->recordsOffset, header->recordCount, sizeof(SnapshotFormat::Record), alignof(SnapshotFormat::Record)) &&
+                         fits(header->functionsOffset, header->functionCount, sizeof(SnapshotFormat::Function), alignof(SnapshotFormat::Function)) &&
+                         fits(header->stringsOffset, header->stringsSize, 1, 1);
+            if (!valid) throw std::runtime_error("Corrupt or incompatible snapshot: " + path);
+
+            // Yer değiştirme: bölüm ofsetlerini taban adrese ekle
+            globals = reinterpret_cast<const SnapshotFormat::Global*>(base + header->globalsOffset);
+            records = reinterpret_cast<const SnapshotFormat::Record*>(base + header->recordsOffset);
+            functions = reinterpret_cast<const SnapshotFormat::Function*>(base + header->functionsOffset);
+            strings = base + header->stringsOffset;
+        }
+
+        std::string_view string(uint64_t offset, uint64_t length) const {
+            if (offset > header->stringsSize || length > header->stringsSize - offset) throw std::runtime_error("Snapshot string out of range");
+            return std::string_view(strings + offset, length);
+        }
+
+        const SnapshotFormat::Global* findGlobal(std::string_view name) const {
+            const SnapshotFormat::Global* end = globals + header->globalCount;
+            auto it = std::lower_bound(globals, end, name, [this](const SnapshotFormat::Global& global, std::string_view key) {
+                return string(global.nameOffset, global.nameLength) < key;
+            });
+            if (it == end || string(it->nameOffset, it->nameLength) != name) return nullptr;
+            return it;
+        }
+
+        // Dizi/nesne kaydının count alt kaydı [first, first + count) aralığında olmalı. Yazıcı alt
+        // kayıtları her zaman üst kayıttan sonra ayırır; first > index şartı döngüleri de engeller
+        void checkChildren(uint64_t index, const SnapshotFormat::Record& record, uint64_t count) const {
+            if (record.first <= index || record.first > header->recordCount || count > header->recordCount - record.first) {
+                throw std::runtime_error("Snapshot record out of range");
+            }
+        }
+
+        Value materialize(uint64_t index, size_t depth = 0) const {
+            if (index >= header->recordCount) throw std::runtime_error("Snapshot record out of range");
+            if (depth > SnapshotFormat::MAX_DEPTH) throw std::runtime_error("Snapshot value nested too deeply");
+            const SnapshotFormat::Record& record = records[index];
+
+            switch (static_cast<DataType>(record.type)) {
+                case DataType::INTEGER:
+                    return Value(static_cast<int>(static_cast<int64_t>(record.first)));
+                case DataType::FLOAT: {
+                    float value;
+                    uint32_t bits = static_cast<uint32_t>(record.first);
+                    std::memcpy(&value, &bits, sizeof(value));
+                    return Value(value);
+                }
+                case DataType::BOOLEAN:
+                    return Value(record.first != 0);
+                case DataType::STRING: {
+                    std::string_view text = string(record.first, record.second);
+                    return Value(StringRef(shared_from_this(), text.data(), text.size()));
+                }
+                case DataType::ARRAY: {
+                    if (record.second) checkChildren(index, record, record.second);
+                    std::vector<Value> elements;
+                    elements.reserve(record.second);
+                    for (uint64_t i = 0; i < record.second; i++) {
+                        elements.push_back(materialize(record.first + i, depth + 1));
+                    }
+                    return Value(elements);
+                }
+                case DataType::OBJECT: {
+                    if (record.second) {
+                        if (record.second > header->recordCount / 2) throw std::runtime_error("Snapshot record out of range");
+                        checkChildren(index, record, record.second * 2);
+                    }
+                    std::map<std::string, Value> fields;
+                    for (uint64_t i = 0; i < record.second; i++) {
+                        const SnapshotFormat::Record& key = records[record.first + i * 2];
+                        if (static_cast<DataType>(key.type) != DataType::STRING) throw std::runtime_error("Snapshot object key is not a string");
+                        fields.emplace(std::string(string(key.first, key.second)), materialize(record.first + i * 2 + 1, depth + 1));
+                    }
+                    return Value(fields);
+                }
+                case DataType::TYPED_ARRAY: {
+                    if (record.reserved > static_cast<uint32_t>(ElementType::INT32)) {
+                        throw std::runtime_error("Snapshot typed array has unknown element type");
+                    }
+                    auto elementType = static_cast<ElementType>(record.reserved);
+                    size_t elementSize = TypedArray::elementSize(elementType);
+                    if (record.second > header->stringsSize / elementSize) throw std::runtime_error("Snapshot string out of range");
+                    std::string_view bytes = string(record.first, record.second * elementSize);
+                    TypedArray array(elementType, record.second);
+                    if (!bytes.empty()) std::memcpy(array.data<char>(), bytes.data(), bytes.size());
+                    return Value(array);
+                }
+                default:
+                    return Value(nullptr);
+            }
+        }
+    };
+
+    // Globalleri snapshot dosyasına yazar
+    class SnapshotWriter {
+    public:
+        // Betik fonksiyonları (isim -> kaynak metin) ayrı tabloya yazılır. Fonksiyon ve sınıf
+        // değerleri (yerel geri çağırmalar, opak nesneler) serileştirilemez; bunların isimleri döndürülür
+        std::vector<std::string> write(const std::string& path, const std::map<std::string, Value>& variables,
+                                       const std::map<std::string, std::string>& functions = {}) {
+            records.clear();
+            strings.clear();
+            skipped.clear();
+
+            std::vector<SnapshotFormat::Global> globals;
+            globals.reserve(variables.size());
+            for (const auto& entry : variables) {
+                if (!isSerializable(entry.second)) {
+                    skipped.push_back(entry.first);
+                    continue;
+                }
+                uint64_t record = allocate(1);
+                SnapshotFormat::Global global;
+                global.nameOffset = addString(entry.first);
+                global.nameLength = entry.first.size();
+                global.record = record;
+                globals.push_back(global);
+                encode(record, entry.second);
+            }
+            // std::map zaten isme göre sıralı; tablolar ikili aramaya hazır
+            std::vector<SnapshotFormat::Function> functionTable;
+            functionTable.reserve(functions.size());
+            for (const auto& entry : functions) {
+                SnapshotFormat::Function function;
+                function.nameOffset = addString(entry.first);
+                function.nameLength = entry.first.size();
+                function.sourceOffset = addString(entry.second);
+                function.sourceLength = entry.second.size();
+                functionTable.push_back(function);
+            }
+
+            SnapshotFormat::Header header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, SnapshotFormat::MAGIC, sizeof(header.magic));
+            header.version = SnapshotFormat::VERSION;
+            header.globalCount = static_cast<uint32_t>(globals.size());
+            header.globalsOffset = align(sizeof(header));
+            header.recordsOffset = align(header.globalsOffset + globals.size() * sizeof(SnapshotFormat::Global));
+            header.recordCount = records.size();
+            header.functionsOffset = align(header.recordsOffset + records.size() * sizeof(SnapshotFormat::Record));
+            header.functionCount = functionTable.size();
+            header.stringsOffset = align(header.functionsOffset + functionTable.size() * sizeof(SnapshotFormat::Function));
+            header.stringsSize = strings.size();
+            header.fileSize = header.stringsOffset + strings.size();
+
+            std::string image(header.fileSize, '\0');
+            std::memcpy(&image[0], &header, sizeof(header));
+            if (!globals.empty()) {
+                std::memcpy(&image[header.globalsOffset], globals.data(), globals.size() * sizeof(SnapshotFormat::Global));
+            }
+            if (!records.empty()) {
+                std::memcpy(&image[header.recordsOffset], records.data(), records.size() * sizeof(SnapshotFormat::Record));
+            }
+            if (!functionTable.empty()) {
+                std::memcpy(&image[header.functionsOffset], functionTable.data(), functionTable.size() * sizeof(SnapshotFormat::Function));
+            }
+            if (!strings.empty()) {
+                std::memcpy(&image[header.stringsOffset], strings.data(), strings.size());
+            }
+
+            // Yarım yazılmış snapshot okunmasın diye geçici dosya + rename
+            std::string temporary = path + ".tmp";
+            int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (fd < 0) throw std::runtime_error("Cannot write snapshot: " + path);
+            size_t written = 0;
+            while (written < image.size()) {
+                ssize_t result = ::write(fd, image.data() + written, image.size() - written);
+                if (result <= 0) {
+                    ::close(fd);
+                    ::unlink(temporary.c_str());
+                    throw std::runtime_error("Cannot write snapshot: " + path);
+                }
+                written += static_cast<size_t>(result);
+            }
+            ::fsync(fd);
+            ::close(fd);
+            if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+                ::unlink(temporary.c_str());
+                throw std::runtime_error("Cannot write snapshot: " + path);
+            }
+            return skipped;
+        }
+
+    private:
+        std::vector<SnapshotFormat::Record> records;
+        std::string strings;
+        std::vector<std::string> skipped;
+
+        static uint64_t align(uint64_t offset) { return (offset + 7) & ~uint64_t(7); }
+
+        static bool isSerializable(const Value& value) {
+            return value.type != DataType::FUNCTION && value.type != DataType::CLASS;
+        }
+
+        uint64_t allocate(uint64_t count) {
+            uint64_t first = records.size();
+            records.resize(records.size() + count, SnapshotFormat::Record{static_cast<uint32_t>(DataType::NULL_TYPE), 0, 0, 0});
+            return first;
+        }
+
+        uint64_t addString(std::string_view value) {
+            uint64_t offset = strings.size();
+            strings += value;
+            return offset;
+        }
+
+        // Çocuklar ardışık kayıtlara yerleşir; records yeniden boyutlanabileceği için indeksle yazılır
+        void encode(uint64_t index, const Value& value, size_t depth = 0) {
+            if (depth > SnapshotFormat::MAX_DEPTH) throw std::runtime_error("Snapshot value nested too deeply");
+            SnapshotFormat::Record record{static_cast<uint32_t>(value.type), 0, 0, 0};
+
+            switch (value.type) {
+                case DataType::INTEGER:
+                    record.first = static_cast<uint64_t>(static_cast<int64_t>(std::get<int>(value.data)));
+                    break;
+                case DataType::FLOAT: {
+                    uint32_t bits;
+                    float number = std::get<float>(value.data);
+                    std::memcpy(&bits, &number, sizeof(bits));
+                    record.first = bits;
+                    break;
+                }
+                case DataType::BOOLEAN:
+                    record.first = std::get<bool>(value.data) ? 1 : 0;
+                    break;
+                case DataType::STRING: {
+                    std::string_view text = value.text();
+                    record.first = addString(text);
+                    record.second = text.size();
+                    break;
+                }
+                case DataType::ARRAY: {
+                    const auto& elements = std::get<std::vector<Value>>(value.data);
+                    record.first = allocate(elements.size());
+                    record.second = elements.size();
+                    for (size_t i = 0; i < elements.size(); i++) {
+                        encode(record.first + i, isSerializable(elements[i]) ? elements[i] : Value(nullptr), depth + 1);
+                    }
+                    break;
+                }
+                case DataType::OBJECT: {
+                    const auto& fields = std::get<std::map<std::string, Value>>(value.data);
+                    record.first = allocate(fields.size() * 2);
+                    record.second = fields.size();
+                    uint64_t slot = record.first;
+                    for (const auto& field : fields) {
+                        encode(slot, Value(field.first));
+                        encode(slot + 1, isSerializable(field.second) ? field.second : Value(nullptr), depth + 1);
+                        slot += 2;
+                    }
+                    break;
+                }
+                case DataType::TYPED_ARRAY: {
+                    // Ham baytlar string alanına; hizasız olabilir, okurken kopyalanır
+                    const auto& array = std::get<TypedArray>(value.data);
+                    record.reserved = static_cast<uint32_t>(array.type());
+                    record.first = addString(std::string_view(array.data<char>(), array.byteSize()));
+                    record.second = array.size();
+                    break;
+                }
+                default:
+                    record.type = static_cast<uint32_t>(DataType::NULL_TYPE);
+                    break;
+            }
+
+            records[index] = record;
+        }
+    };
+}
+
+#endif // WHOLF_SNAPSHOT_HPP
@@ -33,7 +33,8 @@ namespace Wholf {
         TRUE,
         FALSE,
         NULL_TOKEN,
-        UNDEFINED
+        UNDEFINED,
+        IDENTIFIER  // anahtar kelime değil
     };
     
     // Operatörler
@@ -52,7 +53,8 @@ namespace Wholf {
         GREATER,
         LESS,
         GREATER_EQUAL,
-        LESS_EQUAL
+        LESS_EQUAL,
+        ASSIGN
     };
     
     // Noktalama işaretleri
@@ -77,6 +79,9 @@ namespace Wholf {
         std::variant<int, float, std::string, Keyword, Operator, Punctuation> value;
         int line;
         int column;
+        // Kaynaktaki bayt aralığı [begin, end)
+        size_t begin = 0;
+        size_t end = 0;
         
         Token(TokenType type, const std::variant<int, float, std::string, Keyword, Operator, Punctuation>& value, int line, int column)
             : type(type), value(value), line(line), column(column) {}
@@ -84,7 +89,8 @@ namespace Wholf {
         std::string toString() const {
             switch (type) {
                 case TokenType::NUMBER:
-                    return std::to_string(std::get<int>(value));
+                    if (const int* integer = std::get_if<int>(&value)) return std::to_string(*integer);
+                    return std::to_string(std::get<float>(value));
                 case TokenType::STRING:
                     return std::get<std::string>(value);
                 case TokenType::IDENTIFIER:
@@ -142,6 +148,7 @@ namespace Wholf {
                 case Operator::LESS: return "<";
                 case Operator::GREATER_EQUAL: return ">=";
                 case Operator::LESS_EQUAL: return "<=";
+                case Operator::ASSIGN: return "=";
                 default: return "";
             }
         }
@@ -0,0 +1,177 @@
+#ifndef WHOLF_VALUE_HPP
+#define WHOLF_VALUE_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <variant>
+#include "../runtime/metrics.hpp"
+
+namespace Wholf {
+    // Veri tipleri
+    enum class DataType {
+        INTEGER,
+        FLOAT,
+        STRING,
+        BOOLEAN,
+        NULL_TYPE,
+        UNDEFINED,
+        ARRAY,
+        OBJECT,
+        FUNCTION,
+        CLASS,
+        // Sona eklendi: sayısal değerler snapshot/çerçeve biçimlerinde saklanıyor
+        TYPED_ARRAY
+    };
+    
+    // Başka bir nesnenin sahip olduğu salt okunur metin (ör. eşlenmiş dosya). owner yaşadıkça
+    // data geçerlidir; Value kopyalansa da metin kopyalanmaz.
+    class StringRef {
+    public:
+        StringRef() = default;
+        StringRef(std::shared_ptr<const void> owner, const char* data, size_t size)
+            : owner(std::move(owner)), data(data), size(size) {}
+        
+        std::string_view view() const { return std::string_view(data, size); }
+        
+    private:
+        std::shared_ptr<const void> owner;
+        const char* data = nullptr;
+        size_t size = 0;
+    };
+    
+    // Tipli dizinin eleman tipi
+    enum class ElementType : uint8_t {
+        FLOAT64,
+        FLOAT32,
+        INT32
+    };
+    
+    // Bitişik, 64 bayt hizalı sayı tamponu (Float64Array/Float32Array/Int32Array).
+    // Kopyalar aynı tamponu paylaşır; ayrı kopya için clone(). Çekirdekler runtime/numeric.hpp'de.
+    class TypedArray {
+    public:
+        static constexpr size_t ALIGNMENT = 64;
+        
+        TypedArray() = default;
+        
+        // Sıfırlarla dolu dizi
+        TypedArray(ElementType elementType, size_t length) : elementType(elementType), length(length) {
+            size_t bytes = length * elementSize(elementType);
+            if (bytes == 0) return;
+            void* memory = ::operator new(bytes, std::align_val_t(ALIGNMENT));
+            std::memset(memory, 0, bytes);
+            buffer = std::shared_ptr<void>(memory, [](void* pointer) { ::operator delete(pointer, std::align_val_t(ALIGNMENT)); });
+        }
+        
+        static size_t elementSize(ElementType type) {
+            return type == ElementType::FLOAT64 ? sizeof(double) : sizeof(float);
+        }
+        
+        ElementType type() const { return elementType; }
+        size_t size() const { return length; }
+        size_t byteSize() const { return length * elementSize(elementType); }
+        
+        const char* typeName() const {
+            switch (elementType) {
+                case ElementType::FLOAT64: return "Float64Array";
+                case ElementType::FLOAT32: return "Float32Array";
+                case ElementType::INT32: return "Int32Array";
+            }
+            return "TypedArray";
+        }
+        
+        // Ham eleman erişimi; T eleman tipiyle eşleşmelidir
+        template<typename T>
+        T* data() { return static_cast<T*>(buffer.get()); }
+        
+        template<typename T>
+        const T* data() const { return static_cast<const T*>(buffer.get()); }
+        
+        double get(size_t index) const {
+            switch (elementType) {
+                case ElementType::FLOAT64: return data<double>()[index];
+                case ElementType::FLOAT32: return data<float>()[index];
+                case ElementType::INT32: return data<int32_t>()[index];
+            }
+            return 0;
+        }
+        
+        // Int32Array'e yazarken sıfıra doğru kesilir; aralık dışı doyurulur, NaN 0 olur
+        void set(size_t index, double value) {
+            switch (elementType) {
+                case ElementType::FLOAT64: data<double>()[index] = value; break;
+                case ElementType::FLOAT32: data<float>()[index] = static_cast<float>(value); break;
+                case ElementType::INT32: {
+                    int32_t number = 0;
+                    if (value >= 2147483647.0) number = INT32_MAX;
+                    else if (value <= -2147483648.0) number = INT32_MIN;
+                    else if (value == value) number = static_cast<int32_t>(value);
+                    data<int32_t>()[index] = number;
+                    break;
+                }
+            }
+        }
+        
+        TypedArray clone() const {
+            TypedArray copy(elementType, length);
+            if (length) std::memcpy(copy.buffer.get(), buffer.get(), byteSize());
+            return copy;
+        }
+        
+        bool sharesBuffer(const TypedArray& other) const { return buffer == other.buffer; }
+        
+    private:
+        std::shared_ptr<void> buffer;
+        ElementType elementType = ElementType::FLOAT64;
+        size_t length = 0;
+    };
+    
+    // Değer sınıfı
+    class Value {
+    public:
+        std::variant<int, float, std::string, bool, std::nullptr_t, std::vector<Value>, std::map<std::string, Value>, std::function<Value()>, std::shared_ptr<void>, StringRef, TypedArray> data;
+        DataType type;
+        
+        Value(int value) : type(DataType::INTEGER) { data = value; }
+        Value(float value) : type(DataType::FLOAT) { data = value; }
+        Value(const std::string& value) : type(DataType::STRING) { WHOLF_COUNT(VALUE_ALLOCATIONS); data = value; }
+        Value(bool value) : type(DataType::BOOLEAN) { data = value; }
+        Value(std::nullptr_t value) : type(DataType::NULL_TYPE) { data = value; }
+        Value(const std::vector<Value>& value) : type(DataType::ARRAY) { WHOLF_COUNT(VALUE_ALLOCATIONS); data = value; }
+        Value(const std::map<std::string, Value>& value) : type(DataType::OBJECT) { WHOLF_COUNT(VALUE_ALLOCATIONS); data = value; }
+        // Geçici kaplar kopyalanmadan taşınır (ör. ayrıştırıcıların kurduğu diziler)
+        Value(std::string&& value) : data(std::move(value)), type(DataType::STRING) { WHOLF_COUNT(VALUE_ALLOCATIONS); }
+        Value(std::vector<Value>&& value) : data(std::move(value)), type(DataType::ARRAY) { WHOLF_COUNT(VALUE_ALLOCATIONS); }
+        Value(std::map<std::string, Value>&& value) : data(std::move(value)), type(DataType::OBJECT) { WHOLF_COUNT(VALUE_ALLOCATIONS); }
+        Value(const std::function<Value()>& value) : type(DataType::FUNCTION) { data = value; }
+        Value(const std::shared_ptr<void>& value) : type(DataType::CLASS) { data = value; }
+        Value(const StringRef& value) : type(DataType::STRING) { data = value; }
+        Value(const TypedArray& value) : type(DataType::TYPED_ARRAY) { data = value; }
+        
+        // STRING değerinin metni (sahipli ya da StringRef); kopya yapmaz
+        std::string_view text() const {
+            if (const auto* reference = std::get_if<StringRef>(&data)) return reference->view();
+            return std::get<std::string>(data);
+        }
+        
+        operator int() const { return std::get<int>(data); }
+        operator float() const { return std::get<float>(data); }
+        operator std::string() const { return std::string(text()); }
+        operator bool() const { return std::get<bool>(data); }
+        operator std::nullptr_t() const { return std::get<std::nullptr_t>(data); }
+        operator std::vector<Value>() const { return std::get<std::vector<Value>>(data); }
+        operator std::map<std::string, Value>() const { return std::get<std::map<std::string, Value>>(data); }
+        operator std::function<Value()>() const { return std::get<std::function<Value()>>(data); }
+        operator std::shared_ptr<void>() const { return std::get<std::shared_ptr<void>>(data); }
+        operator TypedArray() const { return std::get<TypedArray>(data); }
+    };
+}
+
+#endif // WHOLF_VALUE_HPP
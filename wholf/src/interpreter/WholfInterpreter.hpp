@@ -6,50 +6,38 @@
 #include <vector>
 #include <functional>
 #include <memory>
-#include <stack>
+#include <optional>
+#include <unordered_map>
 #include <variant>
 #include <any>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include "Node.hpp"
+#include "Scanner.hpp"
+#include "Parser.hpp"
+#include "Value.hpp"
+#include "Binding.hpp"
+#include "Execution.hpp"
+#include "Snapshot.hpp"
+#include "Profiler.hpp"
+#include "../runtime/metrics.hpp"
 
 namespace Wholf {
-    // Veri tipleri
-    enum class DataType {
-        INTEGER,
-        FLOAT,
-        STRING,
-        BOOLEAN,
-        NULL_TYPE,
-        UNDEFINED,
-        ARRAY,
-        OBJECT,
-        FUNCTION,
-        CLASS
-    };
-    
-    // Değer sınıfı
-    class Value {
+    // Parse edilmiş betik; Interpreter::execute ile tekrar tekrar çalıştırılabilir.
+    // Node önbellekleri interpreter kimliğiyle etiketlidir: bir Program birden çok interpreter'da
+    // (eşzamanlı da) çalıştırılabilir
+    class Program {
     public:
-        std::variant<int, float, std::string, bool, std::nullptr_t, std::vector<Value>, std::map<std::string, Value>, std::function<Value()>, std::shared_ptr<void>> data;
-        DataType type;
-        
-        Value(int value) : type(DataType::INTEGER) { data = value; }
-        Value(float value) : type(DataType::FLOAT) { data = value; }
-        Value(const std::string& value) : type(DataType::STRING) { data = value; }
-        Value(bool value) : type(DataType::BOOLEAN) { data = value; }
-        Value(std::nullptr_t value) : type(DataType::NULL_TYPE) { data = value; }
-        Value(const std::vector<Value>& value) : type(DataType::ARRAY) { data = value; }
-        Value(const std::map<std::string, Value>& value) : type(DataType::OBJECT) { data = value; }
-        Value(const std::function<Value()>& value) : type(DataType::FUNCTION) { data = value; }
-        Value(const std::shared_ptr<void>& value) : type(DataType::CLASS) { data = value; }
-        
-        operator int() const { return std::get<int>(data); }
-        operator float() const { return std::get<float>(data); }
-        operator std::string() const { return std::get<std::string>(data); }
-        operator bool() const { return std::get<bool>(data); }
-        operator std::nullptr_t() const { return std::get<std::nullptr_t>(data); }
-        operator std::vector<Value>() const { return std::get<std::vector<Value>>(data); }
-        operator std::map<std::string, Value>() const { return std::get<std::map<std::string, Value>>(data); }
-        operator std::function<Value()>() const { return std::get<std::function<Value()>>(data); }
-        operator std::shared_ptr<void>() const { return std::get<std::shared_ptr<void>>(data); }
+        explicit Program(std::unique_ptr<Node> root) : root(std::move(root)) {}
+        
+        Program(const Program&) = delete;
+        Program& operator=(const Program&) = delete;
+        
+    private:
+        friend class Interpreter;
+        std::unique_ptr<Node> root;
     };
     
     // Yorumlayıcı sınıfı
@@ -58,190 +46,505 @@ namespace Wholf {
         // Çevre değişkenleri
         std::map<std::string, Value> variables;
         
-        // Fonksiyonlar
-        std::map<std::string, std::function<Value()>> functions;
+        // Betikte tanımlanan fonksiyonlar; node'lar programs içinde yaşar
+        std::map<std::string, const FunctionDefinitionNode*> functions;
+        std::vector<std::shared_ptr<Program>> programs;
+        
+        // Yerel fonksiyonlar; slot numarası bağlama sırasıdır ve değişmez
+        std::vector<Native::Binding> natives;
+        std::map<std::string, size_t> nativeSlots;
         
         // Sınıflar
         std::map<std::string, std::shared_ptr<void>> classes;
         
-        // Stack
-        std::stack<Value> stack;
+        // return/break/continue sonrası kontrol akışı
+        enum class Flow {
+            NORMAL,
+            RETURN,
+            BREAK,
+            CONTINUE
+        };
+        
+        Flow flow = Flow::NORMAL;
+        Value returned = Value(nullptr);
+        size_t callDepth = 0;
+        bool definedFunction = false;
+        
+        // Bütçe ve güvenli nokta denetimi (nullptr = sınırsız)
+        ExecutionControl* control = nullptr;
         
-        // İşlem önceliği
-        std::map<std::string, int> operatorPrecedence;
+        // Node'lardaki yerel slot önbelleğinin etiketi; her interpreter'a ayrı
+        uint32_t identity = nextIdentity();
+        
+        // Profilleyicinin örneklediği betik çağrı yığını
+        Profiling::CallStack callStack;
+        uint32_t scriptFrame = Profiling::Profiler::UNINTERNED;
+        
+        // Geri yüklenen snapshot; globaller ilk erişimde buradan okunur
+        std::shared_ptr<const SnapshotImage> snapshot;
+        
+        // checkpoint() sonrası atanan globallerin önceki değerleri (yoksa nullopt)
+        bool journaling = false;
+        std::unordered_map<std::string, std::optional<Value>> journal;
+        std::map<std::string, const FunctionDefinitionNode*> checkpointFunctions;
+        size_t checkpointPrograms = 0;
         
     public:
-        // Yorumlayıcı başlatma
-        Interpreter() {
-            // İşlem öncelikleri
-            operatorPrecedence["+"] = 1;
-            operatorPrecedence["-"] = 1;
-            operatorPrecedence["*"] = 2;
-            operatorPrecedence["/"] = 2;
-            operatorPrecedence["%"] = 2;
-            operatorPrecedence["^"] = 3;
-            operatorPrecedence["&&"] = 4;
-            operatorPrecedence["||"] = 4;
-            operatorPrecedence["!"] = 5;
-            operatorPrecedence["=="] = 6;
-            operatorPrecedence["!="] = 6;
-            operatorPrecedence[">"] = 6;
-            operatorPrecedence["<"] = 6;
-            operatorPrecedence[">="] = 6;
-            operatorPrecedence["<="] = 6;
-        }
-        
-        // Kod yorumlama
+        // Betik fonksiyonlarının iç içe çağrı sınırı (yığın taşmasını önler)
+        static constexpr size_t MAX_CALL_DEPTH = 256;
+        
+        // Kod yorumlama; son ifadenin değerini döndürür
         Value interpret(const std::string& code) {
-            // Tokenize
-            std::vector<std::string> tokens = tokenize(code);
-            
-            // Parse
-            std::vector<std::unique_ptr<Node>> ast = parse(tokens);
-            
-            // Evaluate
-            return evaluate(ast);
+            return execute(parse(code));
         }
         
-    private:
-        // Tokenize
-        std::vector<std::string> tokenize(const std::string& code) {
-            std::vector<std::string> tokens;
-            std::string currentToken;
+        // Tokenize + parse; aynı betik tekrar çalışacaksa sonucu saklayıp execute() ile çağırın
+        static std::shared_ptr<Program> parse(const std::string& code) {
+            Scanner scanner(code);
+            Parser::Options parserOptions;
+            parserOptions.source = code;
+            return std::make_shared<Program>(Parser(scanner.scanTokens(), parserOptions).parse());
+        }
+        
+        // Parse edilmiş betiği çalıştır; son ifadenin değerini döndürür
+        Value execute(const std::shared_ptr<Program>& program) {
+            WHOLF_COUNT(INTERPRET_CALLS);
+            WHOLF_TIME_SCOPE(INTERPRET_LATENCY);
             
-            for (char c : code) {
-                if (c == ' ' || c == '\n' || c == '\t') {
-                    if (!currentToken.empty()) {
-                        tokens.push_back(currentToken);
-                        currentToken.clear();
-                    }
-                } else if (c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '^' ||
-                          c == '=' || c == '!' || c == '>' || c == '<' || c == '&' || c == '|' ||
-                          c == '(' || c == ')' || c == '{' || c == '}' || c == '[' || c == ']' ||
-                          c == ',' || c == ';') {
-                    if (!currentToken.empty()) {
-                        tokens.push_back(currentToken);
-                        currentToken.clear();
-                    }
-                    tokens.push_back(std::string(1, c));
-                } else {
-                    currentToken += c;
-                }
+            // Evaluate (betiğin kök çerçevesi profilleyici yığınına eklenir)
+            Profiling::ActiveStack active(&callStack);
+            Profiling::ScopedFrame root(callStack, scriptFrameId(), 1);
+            flow = Flow::NORMAL;
+            definedFunction = false;
+            Value result(nullptr);
+            try {
+                result = evaluateNode(program->root);
+            } catch (...) {
+                keepProgram(program);
+                throw;
             }
-            
-            if (!currentToken.empty()) {
-                tokens.push_back(currentToken);
+            if (flow == Flow::RETURN) result = returned;
+            flow = Flow::NORMAL;
+            keepProgram(program);
+            return result;
+        }
+        
+        // Yerel fonksiyon bağlama: interpreter.bind("topla", &topla)
+        template<typename R, typename... Args>
+        size_t bind(const std::string& name, R (*function)(Args...)) {
+            return addNative(Native::makeBinding(name, function));
+        }
+        
+        // Derleme zamanında bilinen fonksiyon: interpreter.bind<&topla>("topla")
+        template<auto Fn>
+        size_t bind(const std::string& name) {
+            return addNative(Native::makeStaticBinding<Fn>(name, Fn));
+        }
+        
+        // Komut bütçesi, son tarih ve zaman dilimi denetimi
+        void setExecutionControl(ExecutionControl* executionControl) {
+            control = executionControl;
+        }
+        
+        ExecutionControl* getExecutionControl() const {
+            return control;
+        }
+        
+        // Profilleyicinin okuduğu çağrı yığını (zamanlayıcı fiber geçişlerinde etkinleştirir)
+        Profiling::CallStack* getCallStack() {
+            return &callStack;
+        }
+        
+        // Global değişkenler
+        void setGlobal(const std::string& name, const Value& value) {
+            if (journaling && !journal.count(name)) {
+                auto it = variables.find(name);
+                journal.emplace(name, it != variables.end() ? std::optional<Value>(it->second) : std::nullopt);
             }
-            
-            return tokens;
+            variables.insert_or_assign(name, value);
         }
         
-        // Parse
-        std::vector<std::unique_ptr<Node>> parse(const std::vector<std::string>& tokens) {
-            std::vector<std::unique_ptr<Node>> ast;
-            std::stack<std::string> operators;
-            std::stack<std::unique_ptr<Node>> operands;
-            
-            for (const auto& token : tokens) {
-                if (isNumber(token)) {
-                    operands.push(std::make_unique<NumberNode>(std::stod(token)));
-                } else if (isIdentifier(token)) {
-                    operands.push(std::make_unique<IdentifierNode>(token));
-                } else if (isOperator(token)) {
-                    while (!operators.empty() && 
-                           operatorPrecedence[operators.top()] >= operatorPrecedence[token]) {
-                        auto right = operands.top(); operands.pop();
-                        auto left = operands.top(); operands.pop();
-                        operands.push(std::make_unique<BinaryOperationNode>(
-                            std::move(left), std::move(right), operators.top()
-                        ));
-                        operators.pop();
-                    }
-                    operators.push(token);
-                } else if (token == "(") {
-                    operators.push(token);
-                } else if (token == ")") {
-                    while (operators.top() != "(") {
-                        auto right = operands.top(); operands.pop();
-                        auto left = operands.top(); operands.pop();
-                        operands.push(std::make_unique<BinaryOperationNode>(
-                            std::move(left), std::move(right), operators.top()
-                        ));
-                        operators.pop();
-                    }
-                    operators.pop();
+        // Kalıcı interpreter'ı paylaşan istekler arası yalıtım: bundan sonra atanan globaller ve
+        // tanımlanan fonksiyonlar rollback() ile bu ana döner
+        void checkpoint() {
+            journaling = true;
+            journal.clear();
+            checkpointFunctions = functions;
+            checkpointPrograms = programs.size();
+        }
+        
+        void rollback() {
+            if (!journaling) return;
+            for (auto& entry : journal) {
+                // Snapshot'tan gelen global silinirse bir sonraki erişimde yeniden okunur
+                if (entry.second) variables.insert_or_assign(entry.first, std::move(*entry.second));
+                else variables.erase(entry.first);
+            }
+            journal.clear();
+            functions = checkpointFunctions;
+            programs.resize(checkpointPrograms);
+        }
+        
+        bool getGlobal(const std::string& name, Value& out) {
+            auto it = variables.find(name);
+            if (it != variables.end()) {
+                out = it->second;
+                return true;
+            }
+            if (snapshot && snapshot->load(name, out)) {
+                variables.emplace(name, out);
+                return true;
+            }
+            return false;
+        }
+        
+        // Başlatılmış globalleri ve betik fonksiyonlarını snapshot dosyasına yaz; yazılamayan
+        // (fonksiyon/sınıf tipli global) isimleri döner. Yerel fonksiyonlar snapshot'a girmez,
+        // yeni worker'da bind() ile tekrar bağlanmalıdır.
+        std::vector<std::string> saveSnapshot(const std::string& path) {
+            std::map<std::string, std::string> sources;
+            if (snapshot) {
+                for (const auto& name : snapshot->names()) {
+                    Value value(nullptr);
+                    getGlobal(name, value);
+                }
+                // Henüz çağrılmamış snapshot fonksiyonları olduğu gibi taşınır
+                for (const auto& name : snapshot->functionNames()) {
+                    std::string_view source;
+                    if (!functions.count(name) && snapshot->loadFunction(name, source)) sources.emplace(name, std::string(source));
                 }
             }
-            
-            while (!operators.empty()) {
-                auto right = operands.top(); operands.pop();
-                auto left = operands.top(); operands.pop();
-                operands.push(std::make_unique<BinaryOperationNode>(
-                    std::move(left), std::move(right), operators.top()
-                ));
-                operators.pop();
+            for (const auto& entry : functions) {
+                if (!entry.second->source.empty()) sources.insert_or_assign(entry.first, entry.second->source);
             }
-            
-            ast.push_back(std::move(operands.top()));
-            return ast;
+            return SnapshotWriter().write(path, variables, sources);
+        }
+        
+        // Snapshot'ı eşle; globaller kopyalanmadan, erişildikçe yüklenir
+        void restoreSnapshot(const std::string& path) {
+            snapshot = SnapshotImage::open(path);
+        }
+        
+        // İsmi bir kez çöz, sonra slot üzerinden doğrudan çağır
+        size_t resolveNative(const std::string& name) const {
+            auto it = nativeSlots.find(name);
+            if (it == nativeSlots.end()) throw std::runtime_error("Undefined native function: " + name);
+            return it->second;
         }
         
-        // Evaluate
-        Value evaluate(const std::vector<std::unique_ptr<Node>>& ast) {
-            for (const auto& node : ast) {
-                return evaluateNode(node);
+        Value callNative(size_t slot, const std::vector<Value>& args) const {
+            return natives[slot].call(args.data(), args.size());
+        }
+        
+    private:
+        size_t addNative(Native::Binding binding) {
+            // Çağrılar önce yerel slotlara bakar; script fonksiyonu sessizce gölgelenmesin
+            if (functions.count(binding.name) || (snapshot && snapshot->containsFunction(binding.name))) {
+                throw std::runtime_error("Native function shadows script function: " + binding.name);
             }
-            return Value(nullptr);
+            auto it = nativeSlots.find(binding.name);
+            if (it != nativeSlots.end()) {
+                natives[it->second] = std::move(binding);
+                return it->second;
+            }
+            nativeSlots[binding.name] = natives.size();
+            natives.push_back(std::move(binding));
+            return natives.size() - 1;
+        }
+        
+        // Snapshot'taki fonksiyon ilk çağrıda parse edilip tanımlanır
+        const FunctionDefinitionNode* snapshotFunction(const std::string& name) {
+            std::string_view stored;
+            if (!snapshot || !snapshot->loadFunction(name, stored)) return nullptr;
+            std::string source(stored);
+            Scanner scanner(source);
+            Parser::Options parserOptions;
+            parserOptions.source = source;
+            std::unique_ptr<Node> program = Parser(scanner.scanTokens(), parserOptions).parse();
+            const auto& statements = static_cast<BlockNode*>(program.get())->statements;
+            auto function = statements.size() == 1 ? dynamic_cast<FunctionDefinitionNode*>(statements[0].get()) : nullptr;
+            if (!function || function->functionName != name) throw std::runtime_error("Corrupt snapshot function: " + name);
+            functions[name] = function;
+            programs.push_back(std::make_shared<Program>(std::move(program)));
+            return function;
+        }
+        
+        // Fonksiyon tanımlayan programın node'ları fonksiyon çağrılabildiği sürece yaşamalı
+        void keepProgram(const std::shared_ptr<Program>& program) {
+            if (definedFunction && (programs.empty() || programs.back() != program)) programs.push_back(program);
+            definedFunction = false;
+        }
+        
+        uint32_t scriptFrameId() {
+            if (scriptFrame == Profiling::Profiler::UNINTERNED) {
+                scriptFrame = Profiling::Profiler::instance().intern("<script>");
+            }
+            return scriptFrame;
         }
         
         // Node evaluation
         Value evaluateNode(const std::unique_ptr<Node>& node) {
+            WHOLF_COUNT(NODES_EVALUATED);
+            if (control) control->tick();
+            if (node->line != 0) callStack.setLine(node->line);
+            
             if (auto number = dynamic_cast<NumberNode*>(node.get())) {
-                return Value(number->value);
+                return numberValue(number->value);
             } else if (auto identifier = dynamic_cast<IdentifierNode*>(node.get())) {
-                return variables[identifier->name];
+                Value value(nullptr);
+                getGlobal(identifier->name, value);
+                return value;
             } else if (auto binary = dynamic_cast<BinaryOperationNode*>(node.get())) {
-                Value left = evaluateNode(binary->left);
-                Value right = evaluateNode(binary->right);
-                return evaluateBinaryOperation(left, right, binary->operatorType);
+                return evaluateBinary(*binary);
+            } else if (auto call = dynamic_cast<FunctionCallNode*>(node.get())) {
+                return evaluateCall(*call);
+            } else if (auto block = dynamic_cast<BlockNode*>(node.get())) {
+                Value last(nullptr);
+                for (const auto& statement : block->statements) {
+                    last = evaluateNode(statement);
+                    if (flow != Flow::NORMAL) break;
+                }
+                return last;
+            } else if (auto assignment = dynamic_cast<AssignmentNode*>(node.get())) {
+                Value value = assignment->value ? evaluateNode(assignment->value) : Value(nullptr);
+                setGlobal(assignment->name, value);
+                return value;
+            } else if (auto text = dynamic_cast<StringNode*>(node.get())) {
+                return Value(text->value);
+            } else if (auto literal = dynamic_cast<LiteralNode*>(node.get())) {
+                if (literal->kind == LiteralNode::Kind::NULL_VALUE) return Value(nullptr);
+                return Value(literal->kind == LiteralNode::Kind::TRUE_VALUE);
+            } else if (auto unary = dynamic_cast<UnaryOperationNode*>(node.get())) {
+                Value operand = evaluateNode(unary->operand);
+                if (unary->operatorType == "!") return Value(!isTruthy(operand));
+                return numberValue(-toNumber(operand, "-"));
+            } else if (auto branch = dynamic_cast<IfNode*>(node.get())) {
+                if (isTruthy(evaluateNode(branch->condition))) return evaluateNode(branch->thenBranch);
+                if (branch->elseBranch) return evaluateNode(branch->elseBranch);
+            } else if (auto loop = dynamic_cast<LoopNode*>(node.get())) {
+                return evaluateLoop(*loop);
+            } else if (auto jump = dynamic_cast<JumpNode*>(node.get())) {
+                return evaluateJump(*jump);
+            } else if (auto function = dynamic_cast<FunctionDefinitionNode*>(node.get())) {
+                if (nativeSlots.count(function->functionName)) {
+                    throw std::runtime_error("Script function shadows native function: " + function->functionName);
+                }
+                functions[function->functionName] = function;
+                definedFunction = true;
+            } else if (auto definition = dynamic_cast<ClassDefinitionNode*>(node.get())) {
+                throw std::runtime_error("Classes are not supported by the evaluator yet: " + definition->className);
             }
             return Value(nullptr);
         }
         
-        // Binary operation evaluation
-        Value evaluateBinaryOperation(const Value& left, const Value& right, const std::string& operatorType) {
-            if (operatorType == "+") return left + right;
-            if (operatorType == "-") return left - right;
-            if (operatorType == "*") return left * right;
-            if (operatorType == "/") return left / right;
-            if (operatorType == "%") return left % right;
-            if (operatorType == "^") return std::pow(left, right);
-            if (operatorType == "&&") return left && right;
-            if (operatorType == "||") return left || right;
-            if (operatorType == "!") return !left;
-            if (operatorType == "==") return left == right;
-            if (operatorType == "!=") return left != right;
-            if (operatorType == ">") return left > right;
-            if (operatorType == "<") return left < right;
-            if (operatorType == ">=") return left >= right;
-            if (operatorType == "<=") return left <= right;
+        // Döngü: her tur koşul ve gövde node'ları üzerinden bütçeye sayılır
+        Value evaluateLoop(LoopNode& loop) {
+            while (isTruthy(evaluateNode(loop.condition))) {
+                evaluateNode(loop.body);
+                if (flow == Flow::BREAK) {
+                    flow = Flow::NORMAL;
+                    break;
+                }
+                if (flow == Flow::RETURN) break;
+                flow = Flow::NORMAL;
+                if (loop.increment) evaluateNode(loop.increment);
+            }
             return Value(nullptr);
         }
         
+        Value evaluateJump(JumpNode& jump) {
+            switch (jump.kind) {
+                case JumpNode::Kind::RETURN:
+                    returned = jump.value ? evaluateNode(jump.value) : Value(nullptr);
+                    flow = Flow::RETURN;
+                    return returned;
+                case JumpNode::Kind::BREAK:
+                    flow = Flow::BREAK;
+                    break;
+                case JumpNode::Kind::CONTINUE:
+                    flow = Flow::CONTINUE;
+                    break;
+            }
+            return Value(nullptr);
+        }
+        
+        static uint32_t nextIdentity() {
+            static std::atomic<uint32_t> counter{0};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        // Fonksiyon çağrısı: yerel slot ilk çağrıda çözülür ve node üzerinde bu interpreter'ın kimliğiyle saklanır
+        Value evaluateCall(FunctionCallNode& call) {
+            uint32_t profileId = call.profileId.load(std::memory_order_relaxed);
+            if (profileId == FunctionCallNode::UNINTERNED) {
+                profileId = Profiling::Profiler::instance().intern(call.functionName);
+                call.profileId.store(profileId, std::memory_order_relaxed);
+            }
+            Profiling::ScopedFrame frame(callStack, profileId, call.line);
+            
+            uint64_t cached = call.nativeSlot.load(std::memory_order_relaxed);
+            size_t slot = static_cast<uint32_t>(cached);
+            if (cached == FunctionCallNode::UNRESOLVED || static_cast<uint32_t>(cached >> 32) != identity) {
+                auto it = nativeSlots.find(call.functionName);
+                if (it == nativeSlots.end()) {
+                    auto function = functions.find(call.functionName);
+                    if (function != functions.end()) return callScript(*function->second, call);
+                    if (auto restored = snapshotFunction(call.functionName)) return callScript(*restored, call);
+                    throw std::runtime_error("Undefined function: " + call.functionName);
+                }
+                slot = it->second;
+                call.nativeSlot.store(static_cast<uint64_t>(identity) << 32 | slot, std::memory_order_relaxed);
+            }
+            
+            WHOLF_COUNT(NATIVE_CALLS);
+            std::vector<Value> args;
+            args.reserve(call.arguments.size());
+            for (const auto& argument : call.arguments) {
+                args.push_back(evaluateNode(argument));
+            }
+            return natives[slot].call(args.data(), args.size());
+        }
+        
+        // Betik fonksiyonu: parametreler global olarak bağlanır, çağrı sonunda önceki değerler geri yüklenir
+        Value callScript(const FunctionDefinitionNode& function, FunctionCallNode& call) {
+            if (call.arguments.size() != function.parameters.size()) {
+                throw std::runtime_error("Function " + function.functionName + " expects " + std::to_string(function.parameters.size()) +
+                                         " arguments, got " + std::to_string(call.arguments.size()));
+            }
+            if (callDepth >= MAX_CALL_DEPTH) throw std::runtime_error("Maximum call depth exceeded in " + function.functionName);
+            
+            std::vector<Value> args;
+            args.reserve(call.arguments.size());
+            for (const auto& argument : call.arguments) {
+                args.push_back(evaluateNode(argument));
+            }
+            
+            std::vector<std::pair<bool, Value>> shadowed;
+            shadowed.reserve(args.size());
+            for (size_t i = 0; i < args.size(); i++) {
+                auto it = variables.find(function.parameters[i]);
+                shadowed.emplace_back(it != variables.end(), it != variables.end() ? it->second : Value(nullptr));
+                setGlobal(function.parameters[i], args[i]);
+            }
+            
+            struct Restore {
+                Interpreter& interpreter;
+                const FunctionDefinitionNode& function;
+                std::vector<std::pair<bool, Value>>& shadowed;
+                ~Restore() {
+                    interpreter.callDepth--;
+                    for (size_t i = 0; i < shadowed.size(); i++) {
+                        if (shadowed[i].first) interpreter.variables.insert_or_assign(function.parameters[i], shadowed[i].second);
+                        else interpreter.variables.erase(function.parameters[i]);
+                    }
+                }
+            } restore{*this, function, shadowed};
+            callDepth++;
+            
+            evaluateNode(function.body);
+            Value result(nullptr);
+            if (flow == Flow::RETURN) result = returned;
+            flow = Flow::NORMAL;
+            return result;
+        }
+        
+        // && ve || kısa devre yapar
+        Value evaluateBinary(BinaryOperationNode& binary) {
+            const std::string& operatorType = binary.operatorType;
+            if (operatorType == "&&" || operatorType == "||") {
+                bool left = isTruthy(evaluateNode(binary.left));
+                if (operatorType == "&&" ? !left : left) return Value(left);
+                return Value(isTruthy(evaluateNode(binary.right)));
+            }
+            Value left = evaluateNode(binary.left);
+            Value right = evaluateNode(binary.right);
+            return evaluateBinaryOperation(left, right, operatorType);
+        }
+        
+        // Binary operation evaluation. Sayılar tek bir sayı tipi gibi davranır: sonuç tam sayıysa
+        // ve int'e sığıyorsa INTEGER, aksi halde FLOAT olur.
+        Value evaluateBinaryOperation(const Value& left, const Value& right, const std::string& operatorType) {
+            if (operatorType == "==") return Value(equals(left, right));
+            if (operatorType == "!=") return Value(!equals(left, right));
+            if (operatorType == "+" && (left.type == DataType::STRING || right.type == DataType::STRING)) {
+                return Value(toText(left) + toText(right));
+            }
+            if (left.type == DataType::STRING && right.type == DataType::STRING) {
+                int order = left.text().compare(right.text());
+                if (operatorType == ">") return Value(order > 0);
+                if (operatorType == "<") return Value(order < 0);
+                if (operatorType == ">=") return Value(order >= 0);
+                if (operatorType == "<=") return Value(order <= 0);
+            }
+            
+            double a = toNumber(left, operatorType);
+            double b = toNumber(right, operatorType);
+            if (operatorType == "+") return numberValue(a + b);
+            if (operatorType == "-") return numberValue(a - b);
+            if (operatorType == "*") return numberValue(a * b);
+            if (operatorType == "/") return numberValue(a / b);
+            if (operatorType == "%") return numberValue(std::fmod(a, b));
+            if (operatorType == "^") return numberValue(std::pow(a, b));
+            if (operatorType == ">") return Value(a > b);
+            if (operatorType == "<") return Value(a < b);
+            if (operatorType == ">=") return Value(a >= b);
+            if (operatorType == "<=") return Value(a <= b);
+            throw std::runtime_error("Unknown operator: " + operatorType);
+        }
+        
         // Helper functions
-        bool isNumber(const std::string& str) {
-            return !str.empty() && std::all_of(str.begin(), str.end(), ::isdigit);
+        static Value numberValue(double number) {
+            if (number >= -2147483648.0 && number <= 2147483647.0 && number == static_cast<double>(static_cast<int>(number))) {
+                return Value(static_cast<int>(number));
+            }
+            return Value(static_cast<float>(number));
         }
         
-        bool isIdentifier(const std::string& str) {
-            return !str.empty() && std::isalpha(str[0]);
+        static double toNumber(const Value& value, const std::string& operatorType) {
+            if (value.type == DataType::INTEGER) return std::get<int>(value.data);
+            if (value.type == DataType::FLOAT) return std::get<float>(value.data);
+            throw std::runtime_error("Operator " + operatorType + " expects numbers");
         }
         
-        bool isOperator(const std::string& str) {
-            return str == "+" || str == "-" || str == "*" || str == "/" || str == "%" ||
-                   str == "^" || str == "&&" || str == "||" || str == "!" ||
-                   str == "==" || str == "!=" || str == ">" || str == "<" ||
-                   str == ">=" || str == "<=";
+        static bool equals(const Value& left, const Value& right) {
+            bool leftNumber = left.type == DataType::INTEGER || left.type == DataType::FLOAT;
+            bool rightNumber = right.type == DataType::INTEGER || right.type == DataType::FLOAT;
+            if (leftNumber && rightNumber) return toNumber(left, "==") == toNumber(right, "==");
+            bool leftEmpty = left.type == DataType::NULL_TYPE || left.type == DataType::UNDEFINED;
+            bool rightEmpty = right.type == DataType::NULL_TYPE || right.type == DataType::UNDEFINED;
+            if (leftEmpty || rightEmpty) return leftEmpty && rightEmpty;
+            if (left.type != right.type) return false;
+            if (left.type == DataType::STRING) return left.text() == right.text();
+            if (left.type == DataType::BOOLEAN) return std::get<bool>(left.data) == std::get<bool>(right.data);
+            return false;
+        }
+        
+        static std::string toText(const Value& value) {
+            switch (value.type) {
+                case DataType::STRING: return std::string(value.text());
+                case DataType::INTEGER: return std::to_string(std::get<int>(value.data));
+                case DataType::FLOAT: {
+                    char buffer[32];
+                    std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(std::get<float>(value.data)));
+                    return buffer;
+                }
+                case DataType::BOOLEAN: return std::get<bool>(value.data) ? "true" : "false";
+                case DataType::NULL_TYPE: return "null";
+                case DataType::UNDEFINED: return "undefined";
+                default: return "[object]";
+            }
+        }
+        
+        bool isTruthy(const Value& value) const {
+            switch (value.type) {
+                case DataType::BOOLEAN: return std::get<bool>(value.data);
+                case DataType::INTEGER: return std::get<int>(value.data) != 0;
+                case DataType::FLOAT: return std::get<float>(value.data) != 0.0f;
+                case DataType::STRING: return !value.text().empty();
+                case DataType::NULL_TYPE:
+                case DataType::UNDEFINED: return false;
+                default: return true;
+            }
         }
     };
 }
@@ -0,0 +1,594 @@
+#ifndef WHOLF_DURABLE_HPP
+#define WHOLF_DURABLE_HPP
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "fegn.hpp"
+
+namespace Wholf {
+    namespace Fegn {
+        // Kalıcı depo dosya düzenleri. Tüm tamsayılar makinenin bayt sırasıyla yazılır.
+        //
+        // wal.log: [Record başlığı | anahtar | değer]* — yalnızca sona eklenir. Yarım kalmış son
+        // kayıt (sağlama toplamı tutmaz) kurtarmada kesilip atılır.
+        //
+        // snapshot: Header | Entry[count] (anahtara göre sıralı) | veri alanı. Değişmezdir; sıkıştırma
+        // eski snapshot ile kapanmış günlüğü (wal.old) birleştirip geçici isimle yazar ve rename eder.
+        namespace DurableFormat {
+            static constexpr char MAGIC[8] = {'W', 'H', 'K', 'V', 'S', 'N', '0', '1'};
+            static constexpr uint32_t VERSION = 1;
+
+            enum Operation : uint8_t {
+                SET = 1,
+                REMOVE = 2
+            };
+
+            struct Record {
+                uint32_t checksum;
+                uint8_t operation;
+                uint8_t reserved[3];
+                uint32_t keyLength;
+                uint32_t valueLength;
+                // Duvar saati, epoch milisaniyesi; 0 süresiz
+                int64_t expiresAt;
+            };
+
+            struct Header {
+                char magic[8];
+                uint32_t version;
+                uint32_t reserved;
+                uint64_t count;
+                uint64_t entriesOffset;
+                uint64_t dataOffset;
+                uint64_t fileSize;
+            };
+
+            struct Entry {
+                uint64_t keyOffset;
+                uint64_t valueOffset;
+                uint32_t keyLength;
+                uint32_t valueLength;
+                int64_t expiresAt;
+            };
+
+            // FNV-1a; yırtık yazmaları yakalamak için yeterli
+            inline uint32_t checksum(const char* data, size_t length, uint32_t hash = 2166136261u) {
+                for (size_t i = 0; i < length; i++) {
+                    hash ^= static_cast<uint8_t>(data[i]);
+                    hash *= 16777619u;
+                }
+                return hash;
+            }
+
+            inline uint32_t recordChecksum(const Record& record, std::string_view key, std::string_view value) {
+                const char* fields = reinterpret_cast<const char*>(&record) + sizeof(record.checksum);
+                uint32_t hash = checksum(fields, sizeof(Record) - sizeof(record.checksum));
+                hash = checksum(key.data(), key.size(), hash);
+                return checksum(value.data(), value.size(), hash);
+            }
+        }
+
+        // fsync politikası
+        enum class FsyncPolicy {
+            // fsync yok. Kayıtlar süreç içi tamponda birikir ve arka planda (tampon 1 MB'ı ya da
+            // fsyncInterval dolunca) yazılır; süreç çökmesinde yazılmamış son aralık kaybolur
+            NEVER,
+            // Arka planda aralıklı fsync; en fazla bir aralık kaybedilir
+            INTERVAL,
+            // set/remove, kayıt diske inene kadar döner; eşzamanlı yazarlar tek fsync'i paylaşır
+            ALWAYS
+        };
+
+        // DataStore üzerine yazma-önden günlüklü (WAL) kalıcı katman.
+        // Okumalar doğrudan bellekteki depodan yapılır; yazmalar önce günlüğe eklenir, sonra depoya
+        // uygulanır (ALWAYS politikasında okuyucular yalnızca diske inmiş değeri görür). Günlük
+        // büyüdüğünde sıralı, değişmez bir snapshot'a sıkıştırılır. Sıkıştırma bellekteki depoyu
+        // okumaz: byteBudget ile çıkarılan anahtarlar diskte kalır.
+        class DurableStore {
+        public:
+            struct Options {
+                FsyncPolicy fsync = FsyncPolicy::INTERVAL;
+                std::chrono::milliseconds fsyncInterval{100};
+                // Günlük bu boyutu aşınca arka planda sıkıştır; 0 kapalı
+                uint64_t compactionBytes = 64ull << 20;
+                DataStore::Options memory;
+            };
+
+            explicit DurableStore(const std::string& directory) : DurableStore(directory, Options()) {}
+
+            DurableStore(const std::string& directory, const Options& options)
+                : options(options), directory(directory), memory(options.memory) {
+                if (::mkdir(directory.c_str(), 0755) != 0 && errno != EEXIST) {
+                    throw std::runtime_error("Cannot create store directory: " + directory);
+                }
+                recover();
+                flusher = std::thread([this]() { flushLoop(); });
+                compactor = std::thread([this]() { compactLoop(); });
+            }
+
+            ~DurableStore() {
+                {
+                    std::lock_guard<std::mutex> lock(logMutex);
+                    stopping = true;
+                }
+                flushNeeded.notify_all();
+                compactNeeded.notify_all();
+                flusher.join();
+                compactor.join();
+                if (logFd >= 0) {
+                    ::fdatasync(logFd);
+                    ::close(logFd);
+                }
+            }
+
+            DurableStore(const DurableStore&) = delete;
+            DurableStore& operator=(const DurableStore&) = delete;
+
+            void set(const std::string& key, const std::string& value) {
+                std::lock_guard<std::mutex> lock(keyLock(key));
+                append(DurableFormat::SET, key, value, 0);
+                memory.set(key, value);
+            }
+
+            void set(const std::string& key, const std::string& value, std::chrono::milliseconds ttl) {
+                std::lock_guard<std::mutex> lock(keyLock(key));
+                append(DurableFormat::SET, key, value, wallClock() + ttl.count());
+                memory.set(key, value, ttl);
+            }
+
+            void remove(const std::string& key) {
+                std::lock_guard<std::mutex> lock(keyLock(key));
+                append(DurableFormat::REMOVE, key, std::string_view(), 0);
+                memory.remove(key);
+            }
+
+            std::string get(const std::string& key) { return memory.get(key); }
+            bool tryGet(std::string_view key, std::string& value) { return memory.tryGet(key, value); }
+            bool contains(std::string_view key) { return memory.contains(key); }
+            size_t size() const { return memory.size(); }
+            DataStore::Stats stats() const { return memory.stats(); }
+
+            // Bekleyen tüm kayıtları yaz ve fsync et
+            void sync() {
+                std::unique_lock<std::mutex> lock(logMutex);
+                uint64_t target = appendedSequence;
+                if (syncedSequence >= target && !failed) return;
+                syncRequested = true;
+                flushNeeded.notify_one();
+                flushed.wait(lock, [&]() { return syncedSequence >= target || failed; });
+                if (failed) throw std::runtime_error("Cannot write store log: " + directory);
+            }
+
+            // Günlüğü döndür ve eski snapshot ile birleştirip yeni snapshot'a yaz
+            void compact() {
+                std::lock_guard<std::mutex> compactLock(compactMutex);
+
+                // Önceki sıkıştırma yarıda kaldıysa önce onu bitir: wal.old'un üzerine döndürmek
+                // içindeki, henüz snapshot'a girmemiş kayıtları silerdi
+                if (::access(oldLogPath().c_str(), F_OK) == 0) {
+                    writeSnapshot();
+                    ::unlink(oldLogPath().c_str());
+                    syncDirectory();
+                }
+
+                // Günlüğü wal.old olarak ayır; bundan sonraki yazmalar yeni günlüğe gider
+                {
+                    std::unique_lock<std::mutex> lock(logMutex);
+                    syncRequested = true;
+                    flushNeeded.notify_one();
+                    flushed.wait(lock, [&]() { return (!flushing && writtenSequence >= appendedSequence) || failed; });
+                    if (failed) throw std::runtime_error("Cannot write store log: " + directory);
+                    ::fdatasync(logFd);
+                    ::close(logFd);
+                    if (std::rename(logPath().c_str(), oldLogPath().c_str()) != 0) {
+                        logFd = openLog();
+                        throw std::runtime_error("Cannot rotate store log: " + directory);
+                    }
+                    logFd = openLog();
+                    logBytes = 0;
+                }
+
+                writeSnapshot();
+                ::unlink(oldLogPath().c_str());
+                syncDirectory();
+            }
+
+            // Kurtarmada yeniden oynatılan günlük kaydı sayısı
+            uint64_t replayedRecords() const { return replayed; }
+
+        private:
+            static constexpr size_t KEY_LOCKS = 64;
+            static constexpr size_t BUFFER_LIMIT = 1 << 20;
+
+            Options options;
+            std::string directory;
+            DataStore memory;
+            std::mutex keyLocks[KEY_LOCKS];
+
+            // Günlük durumu (logMutex altında)
+            std::mutex logMutex;
+            std::condition_variable flushNeeded;
+            std::condition_variable flushed;
+            std::string pending;
+            uint64_t appendedSequence = 0;
+            // Dosyaya yazılmış son kayıt (ALWAYS politikasında aynı zamanda fsync edilmiş)
+            uint64_t writtenSequence = 0;
+            // fsync edilmiş son kayıt
+            uint64_t syncedSequence = 0;
+            uint64_t logBytes = 0;
+            bool syncRequested = false;
+            bool flushing = false;
+            bool stopping = false;
+            bool failed = false;
+            int logFd = -1;
+            std::thread flusher;
+
+            std::mutex compactMutex;
+            std::condition_variable compactNeeded;
+            bool compactRequested = false;
+            std::thread compactor;
+
+            uint64_t replayed = 0;
+
+            std::string logPath() const { return directory + "/wal.log"; }
+            std::string oldLogPath() const { return directory + "/wal.old"; }
+            std::string snapshotPath() const { return directory + "/snapshot"; }
+
+            static int64_t wallClock() {
+                return std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+
+            std::mutex& keyLock(std::string_view key) {
+                return keyLocks[std::hash<std::string_view>()(key) % KEY_LOCKS];
+            }
+
+            int openLog() {
+                int fd = ::open(logPath().c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+                if (fd < 0) throw std::runtime_error("Cannot open store log: " + logPath());
+                return fd;
+            }
+
+            void syncDirectory() {
+                int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                if (fd < 0) return;
+                ::fsync(fd);
+                ::close(fd);
+            }
+
+            // Kaydı tampona ekle; ALWAYS politikasında diske inmesini bekle
+            void append(DurableFormat::Operation operation, std::string_view key, std::string_view value, int64_t expiresAt) {
+                DurableFormat::Record record{};
+                record.operation = operation;
+                record.keyLength = static_cast<uint32_t>(key.size());
+                record.valueLength = static_cast<uint32_t>(value.size());
+                record.expiresAt = expiresAt;
+                record.checksum = DurableFormat::recordChecksum(record, key, value);
+
+                std::unique_lock<std::mutex> lock(logMutex);
+                if (failed) throw std::runtime_error("Cannot write store log: " + directory);
+                pending.append(reinterpret_cast<const char*>(&record), sizeof(record));
+                pending.append(key.data(), key.size());
+                pending.append(value.data(), value.size());
+                uint64_t sequence = ++appendedSequence;
+
+                if (options.fsync == FsyncPolicy::ALWAYS) {
+                    flushNeeded.notify_one();
+                    flushed.wait(lock, [&]() { return writtenSequence >= sequence || failed; });
+                    if (failed) throw std::runtime_error("Cannot write store log: " + directory);
+                } else if (pending.size() >= BUFFER_LIMIT) {
+                    flushNeeded.notify_one();
+                }
+            }
+
+            // Grup commit: tampon bir kerede yazılır, tek fsync ile tüm bekleyenler serbest kalır
+            void flushLoop() {
+                std::unique_lock<std::mutex> lock(logMutex);
+                auto nextSync = std::chrono::steady_clock::now() + options.fsyncInterval;
+                bool unsynced = false;
+                while (true) {
+                    flushNeeded.wait_until(lock, nextSync, [&]() {
+                        return stopping || syncRequested || pending.size() >= BUFFER_LIMIT ||
+                               (options.fsync == FsyncPolicy::ALWAYS && !pending.empty());
+                    });
+                    auto current = std::chrono::steady_clock::now();
+                    bool due = current >= nextSync;
+                    if (due) nextSync = current + options.fsyncInterval;
+                    bool forced = syncRequested;
+                    bool intervalSync = due && unsynced && options.fsync == FsyncPolicy::INTERVAL;
+                    if (pending.empty() && !forced && !intervalSync) {
+                        if (stopping) return;
+                        continue;
+                    }
+
+                    std::string batch;
+                    batch.swap(pending);
+                    uint64_t target = appendedSequence;
+                    syncRequested = false;
+                    flushing = true;
+                    int fd = logFd;
+                    lock.unlock();
+
+                    bool ok = writeAll(fd, batch);
+                    bool durable = options.fsync == FsyncPolicy::ALWAYS || forced ||
+                                   (options.fsync == FsyncPolicy::INTERVAL && due);
+                    if (ok && durable) ok = ::fdatasync(fd) == 0;
+
+                    lock.lock();
+                    flushing = false;
+                    if (!ok) failed = true;
+                    unsynced = durable ? false : (unsynced || !batch.empty());
+                    writtenSequence = target;
+                    if (durable && ok) syncedSequence = target;
+                    logBytes += batch.size();
+                    if (options.compactionBytes && logBytes >= options.compactionBytes && !compactRequested) {
+                        compactRequested = true;
+                        compactNeeded.notify_one();
+                    }
+                    flushed.notify_all();
+                }
+            }
+
+            void compactLoop() {
+                std::unique_lock<std::mutex> lock(logMutex);
+                while (true) {
+                    compactNeeded.wait(lock, [&]() { return compactRequested || stopping; });
+                    if (stopping) return;
+                    lock.unlock();
+                    try {
+                        compact();
+                    } catch (const std::exception&) {
+                        // Sıkıştırma başarısızsa günlük büyümeye devam eder; veri kaybolmaz
+                    }
+                    lock.lock();
+                    compactRequested = false;
+                }
+            }
+
+            static bool writeAll(int fd, const std::string& data) {
+                size_t written = 0;
+                while (written < data.size()) {
+                    ssize_t result = ::write(fd, data.data() + written, data.size() - written);
+                    if (result < 0) {
+                        if (errno == EINTR) continue;
+                        return false;
+                    }
+                    written += static_cast<size_t>(result);
+                }
+                return true;
+            }
+
+            // Snapshot'ı yükle, ardından yalnızca günlük kuyruğunu oynat
+            void recover() {
+                loadSnapshot();
+                bool interrupted = ::access(oldLogPath().c_str(), F_OK) == 0;
+                if (interrupted) replayLog(oldLogPath(), false);
+                logBytes = replayLog(logPath(), true);
+                logFd = openLog();
+
+                // Yarıda kalmış sıkıştırmayı tamamla; wal.log olduğu gibi kalır
+                if (interrupted) {
+                    writeSnapshot();
+                    ::unlink(oldLogPath().c_str());
+                    syncDirectory();
+                }
+            }
+
+            void loadSnapshot() {
+                int64_t now = wallClock();
+                readSnapshot([&](std::string_view key, std::string_view value, int64_t expiresAt) {
+                    if (expiresAt && expiresAt <= now) return;
+                    apply(DurableFormat::SET, std::string(key), std::string(value), expiresAt, now);
+                });
+            }
+
+            // Snapshot girdilerini sırayla ver; dosya yoksa hiçbir şey yapmaz
+            void readSnapshot(const std::function<void(std::string_view, std::string_view, int64_t)>& visit) {
+                int fd = ::open(snapshotPath().c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) return;
+                struct stat info;
+                if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(DurableFormat::Header)) {
+                    ::close(fd);
+                    throw std::runtime_error("Invalid store snapshot: " + snapshotPath());
+                }
+                size_t size = static_cast<size_t>(info.st_size);
+                void* base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (base == MAP_FAILED) throw std::runtime_error("Cannot map store snapshot: " + snapshotPath());
+                ::madvise(base, size, MADV_SEQUENTIAL);
+
+                const char* data = static_cast<const char*>(base);
+                DurableFormat::Header header;
+                std::memcpy(&header, data, sizeof(header));
+                // Sınırlar çıkarma biçiminde denetlenir; dosyadan gelen sayılarla toplama/çarpma taşabilir
+                bool valid = std::memcmp(header.magic, DurableFormat::MAGIC, sizeof(header.magic)) == 0 &&
+                             header.version == DurableFormat::VERSION && header.fileSize == size &&
+                             header.dataOffset <= size &&
+                             header.entriesOffset >= sizeof(header) && header.entriesOffset <= header.dataOffset &&
+                             header.count <= (header.dataOffset - header.entriesOffset) / sizeof(DurableFormat::Entry);
+                if (!valid) {
+                    ::munmap(base, size);
+                    throw std::runtime_error("Corrupt or incompatible store snapshot: " + snapshotPath());
+                }
+
+                const char* entries = data + header.entriesOffset;
+                uint64_t dataSize = size - header.dataOffset;
+                try {
+                    for (uint64_t i = 0; i < header.count; i++) {
+                        DurableFormat::Entry entry;
+                        std::memcpy(&entry, entries + i * sizeof(entry), sizeof(entry));
+                        if (entry.keyOffset > dataSize || entry.keyLength > dataSize - entry.keyOffset ||
+                            entry.valueOffset > dataSize || entry.valueLength > dataSize - entry.valueOffset) {
+                            throw std::runtime_error("Store snapshot entry out of range");
+                        }
+                        visit(std::string_view(data + header.dataOffset + entry.keyOffset, entry.keyLength),
+                              std::string_view(data + header.dataOffset + entry.valueOffset, entry.valueLength),
+                              entry.expiresAt);
+                    }
+                } catch (...) {
+                    ::munmap(base, size);
+                    throw;
+                }
+                ::munmap(base, size);
+            }
+
+            // Günlüğü oynat; geçerli son kaydın bitiş ofsetini döndürür
+            uint64_t replayLog(const std::string& path, bool truncateTail) {
+                int64_t now = wallClock();
+                return readLog(path, truncateTail, [&](DurableFormat::Operation operation, std::string_view key, std::string_view value, int64_t expiresAt) {
+                    apply(operation, std::string(key), std::string(value), expiresAt, now);
+                    replayed++;
+                });
+            }
+
+            // Günlük kayıtlarını sırayla ver; sağlama toplamı tutmayan ilk kayıtta durur
+            uint64_t readLog(const std::string& path, bool truncateTail,
+                             const std::function<void(DurableFormat::Operation, std::string_view, std::string_view, int64_t)>& visit) {
+                int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC);
+                if (fd < 0) return 0;
+                struct stat info;
+                if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+                    ::close(fd);
+                    return 0;
+                }
+                size_t size = static_cast<size_t>(info.st_size);
+                void* base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (base == MAP_FAILED) {
+                    ::close(fd);
+                    throw std::runtime_error("Cannot map store log: " + path);
+                }
+                ::madvise(base, size, MADV_SEQUENTIAL);
+
+                const char* data = static_cast<const char*>(base);
+                size_t offset = 0;
+                while (offset + sizeof(DurableFormat::Record) <= size) {
+                    DurableFormat::Record record;
+                    std::memcpy(&record, data + offset, sizeof(record));
+                    size_t end = offset + sizeof(record) + record.keyLength + record.valueLength;
+                    if (end > size) break;
+                    std::string_view key(data + offset + sizeof(record), record.keyLength);
+                    std::string_view value(key.data() + key.size(), record.valueLength);
+                    if (DurableFormat::recordChecksum(record, key, value) != record.checksum) break;
+                    visit(static_cast<DurableFormat::Operation>(record.operation), key, value, record.expiresAt);
+                    offset = end;
+                }
+                ::munmap(base, size);
+
+                // Yırtık kuyruğu at ki yeni kayıtlar geçerli bir sınırdan devam etsin
+                if (truncateTail && offset < size) {
+                    if (::ftruncate(fd, static_cast<off_t>(offset)) == 0) ::fdatasync(fd);
+                }
+                ::close(fd);
+                return offset;
+            }
+
+            void apply(DurableFormat::Operation operation, const std::string& key, const std::string& value, int64_t expiresAt, int64_t now) {
+                if (operation == DurableFormat::REMOVE) {
+                    memory.remove(key);
+                } else if (expiresAt == 0) {
+                    memory.set(key, value);
+                } else if (expiresAt > now) {
+                    memory.set(key, value, std::chrono::milliseconds(expiresAt - now));
+                } else {
+                    memory.remove(key);
+                }
+            }
+
+            // Mevcut snapshot ile wal.old'u birleştirip sıralı snapshot olarak yaz (geçici dosya +
+            // fsync + rename). Yalnızca diskteki durum okunur; wal.log'daki kayıtlar sonraki
+            // sıkıştırmaya kalır
+            void writeSnapshot() {
+                struct Item {
+                    std::string key;
+                    std::string value;
+                    int64_t expiresAt;
+                };
+                std::map<std::string, Item> merged;
+                readSnapshot([&](std::string_view key, std::string_view value, int64_t expiresAt) {
+                    merged[std::string(key)] = Item{std::string(key), std::string(value), expiresAt};
+                });
+                readLog(oldLogPath(), false, [&](DurableFormat::Operation operation, std::string_view key, std::string_view value, int64_t expiresAt) {
+                    if (operation == DurableFormat::REMOVE) {
+                        merged.erase(std::string(key));
+                    } else {
+                        merged[std::string(key)] = Item{std::string(key), std::string(value), expiresAt};
+                    }
+                });
+
+                int64_t now = wallClock();
+                std::vector<Item> items;
+                items.reserve(merged.size());
+                for (auto& entry : merged) {
+                    if (entry.second.expiresAt && entry.second.expiresAt <= now) continue;
+                    items.push_back(std::move(entry.second));
+                }
+                merged.clear();
+
+                DurableFormat::Header header{};
+                std::memcpy(header.magic, DurableFormat::MAGIC, sizeof(header.magic));
+                header.version = DurableFormat::VERSION;
+                header.count = items.size();
+                header.entriesOffset = sizeof(DurableFormat::Header);
+                header.dataOffset = header.entriesOffset + items.size() * sizeof(DurableFormat::Entry);
+
+                std::vector<DurableFormat::Entry> entries(items.size());
+                uint64_t dataSize = 0;
+                for (size_t i = 0; i < items.size(); i++) {
+                    entries[i].keyOffset = dataSize;
+                    entries[i].keyLength = static_cast<uint32_t>(items[i].key.size());
+                    dataSize += items[i].key.size();
+                    entries[i].valueOffset = dataSize;
+                    entries[i].valueLength = static_cast<uint32_t>(items[i].value.size());
+                    dataSize += items[i].value.size();
+                    entries[i].expiresAt = items[i].expiresAt;
+                }
+                header.fileSize = header.dataOffset + dataSize;
+
+                std::string temporary = snapshotPath() + ".tmp";
+                int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                if (fd < 0) throw std::runtime_error("Cannot write store snapshot: " + snapshotPath());
+
+                std::string buffer;
+                buffer.reserve(BUFFER_LIMIT * 2);
+                buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+                buffer.append(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(DurableFormat::Entry));
+                bool ok = true;
+                for (const auto& item : items) {
+                    buffer += item.key;
+                    buffer += item.value;
+                    if (buffer.size() >= BUFFER_LIMIT) {
+                        ok = ok && writeAll(fd, buffer);
+                        buffer.clear();
+                    }
+                }
+                ok = ok && writeAll(fd, buffer) && ::fsync(fd) == 0;
+                ::close(fd);
+                if (!ok || std::rename(temporary.c_str(), snapshotPath().c_str()) != 0) {
+                    ::unlink(temporary.c_str());
+                    throw std::runtime_error("Cannot write store snapshot: " + snapshotPath());
+                }
+                syncDirectory();
+            }
+        };
+    }
+}
+
+#endif // WHOLF_DURABLE_HPP
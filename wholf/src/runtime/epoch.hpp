@@ -0,0 +1,183 @@
+#ifndef WHOLF_EPOCH_HPP
+#define WHOLF_EPOCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Wholf {
+    namespace Epoch {
+        // Dönem tabanlı bellek geri kazanımı (EBR).
+        // Okuyucular Guard ile bir döneme girer; yazarlar eski nesneleri retire() ile bırakır.
+        // Nesne, bırakıldığı dönemde aktif olan tüm okuyucular çıktıktan sonra silinir.
+        // Thread sayısı sınırlı değildir: slotlar bloklar halinde eklenir, thread bitince
+        // slotu yeniden kullanılır; bloklar süreç boyunca serbest bırakılmaz.
+        class Manager {
+        public:
+            static constexpr size_t SLOTS_PER_BLOCK = 64;
+            static constexpr uint64_t IDLE = UINT64_MAX;
+            static constexpr size_t RECLAIM_THRESHOLD = 128;
+
+            static Manager& instance() {
+                static Manager manager;
+                return manager;
+            }
+
+            // Okuma bölgesi; iç içe kullanılabilir
+            class Guard {
+            public:
+                Guard() : manager(Manager::instance()) { manager.enter(); }
+                ~Guard() { manager.exit(); }
+
+                Guard(const Guard&) = delete;
+                Guard& operator=(const Guard&) = delete;
+
+            private:
+                Manager& manager;
+            };
+
+            // Nesneyi güvenli olduğunda silinmek üzere bırak
+            void retire(std::function<void()> deleter) {
+                std::vector<std::function<void()>> ready;
+                {
+                    std::lock_guard<std::mutex> lock(retireMutex);
+                    // Çağıranın nesneyi yapıdan ayırması dönem okumasından önce görünür olmalı (enter() ile eş)
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    retired.emplace_back(globalEpoch.load(std::memory_order_acquire), std::move(deleter));
+                    if (retired.size() < RECLAIM_THRESHOLD) return;
+                    collect(ready);
+                }
+                for (auto& release : ready) release();
+            }
+
+            template<typename T>
+            void retire(T* object) {
+                retire([object]() { delete object; });
+            }
+
+            // Bekleyen tüm nesneleri mümkünse şimdi sil
+            void reclaim() {
+                std::vector<std::function<void()>> ready;
+                {
+                    std::lock_guard<std::mutex> lock(retireMutex);
+                    collect(ready);
+                }
+                for (auto& release : ready) release();
+            }
+
+        private:
+            struct alignas(64) Slot {
+                std::atomic<uint64_t> epoch{IDLE};
+                std::atomic<bool> used{false};
+            };
+
+            // Yalnızca başa eklenen slot listesi; okuyucular kilitsiz gezer
+            struct SlotBlock {
+                Slot slots[SLOTS_PER_BLOCK];
+                SlotBlock* next = nullptr;
+            };
+
+            // Thread'e ait slot; thread bitince serbest bırakılır
+            struct ThreadRecord {
+                Slot* slot = nullptr;
+                uint32_t depth = 0;
+
+                ~ThreadRecord() {
+                    if (slot) {
+                        slot->epoch.store(IDLE, std::memory_order_release);
+                        slot->used.store(false, std::memory_order_release);
+                    }
+                }
+            };
+
+            std::atomic<uint64_t> globalEpoch{1};
+            SlotBlock firstBlock;
+            std::atomic<SlotBlock*> blocks{&firstBlock};
+            std::mutex retireMutex;
+            std::vector<std::pair<uint64_t, std::function<void()>>> retired;
+
+            Manager() = default;
+
+            ~Manager() {
+                for (SlotBlock* block = blocks.load(); block != &firstBlock;) {
+                    SlotBlock* next = block->next;
+                    delete block;
+                    block = next;
+                }
+            }
+
+            static Slot* claim(SlotBlock* block) {
+                for (auto& slot : block->slots) {
+                    bool expected = false;
+                    if (slot.used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) return &slot;
+                }
+                return nullptr;
+            }
+
+            ThreadRecord& record() {
+                static thread_local ThreadRecord threadRecord;
+                if (!threadRecord.slot) {
+                    SlotBlock* head = blocks.load(std::memory_order_acquire);
+                    for (SlotBlock* block = head; block && !threadRecord.slot; block = block->next) {
+                        threadRecord.slot = claim(block);
+                    }
+                    if (!threadRecord.slot) {
+                        // Hepsi dolu: ilk slotu bu thread'e ayrılmış yeni blok ekle
+                        auto* block = new SlotBlock();
+                        block->slots[0].used.store(true, std::memory_order_relaxed);
+                        block->next = head;
+                        // seq_cst: collect() blok listesini ve slotları tek bir toplam sırada görür
+                        while (!blocks.compare_exchange_weak(block->next, block, std::memory_order_seq_cst)) {}
+                        threadRecord.slot = &block->slots[0];
+                    }
+                }
+                return threadRecord;
+            }
+
+            void enter() {
+                ThreadRecord& current = record();
+                if (current.depth++ == 0) {
+                    // Dekker el sıkışması: duyuru, okuyucunun paylaşılan işaretçileri okumasından önce
+                    // görünür olmalı. Tam bariyer olmadan depolama, sonraki yüklemelerin arkasına
+                    // kayabilir ve collect() okuyucuyu hiç görmeden nesneyi silebilir
+                    current.slot->epoch.store(globalEpoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                }
+            }
+
+            void exit() {
+                ThreadRecord& current = record();
+                if (--current.depth == 0) current.slot->epoch.store(IDLE, std::memory_order_release);
+            }
+
+            // retireMutex tutulurken çağrılır
+            void collect(std::vector<std::function<void()>>& ready) {
+                globalEpoch.fetch_add(1, std::memory_order_acq_rel);
+                // enter()'deki bariyerin eşi: slot taraması dönem artışından ve ayırmalardan sonra yapılır
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                uint64_t oldest = IDLE;
+                for (SlotBlock* block = blocks.load(std::memory_order_seq_cst); block; block = block->next) {
+                    for (auto& slot : block->slots) {
+                        uint64_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+                        if (epoch < oldest) oldest = epoch;
+                    }
+                }
+
+                auto keep = retired.begin();
+                for (auto it = retired.begin(); it != retired.end(); ++it) {
+                    if (it->first < oldest) {
+                        ready.push_back(std::move(it->second));
+                    } else {
+                        *keep++ = std::move(*it);
+                    }
+                }
+                retired.erase(keep, retired.end());
+            }
+        };
+    }
+}
+
+#endif // WHOLF_EPOCH_HPP
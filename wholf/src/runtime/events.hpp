@@ -0,0 +1,492 @@
+#ifndef WHOLF_EVENTS_HPP
+#define WHOLF_EVENTS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Wholf {
+    namespace Fegn {
+        // Yayınlanan olay
+        struct EventMessage {
+            std::string name;
+            std::string payload;
+            std::chrono::steady_clock::time_point publishedAt;
+        };
+
+        // Teslim biçimi
+        enum class Delivery {
+            // Dağıtıcı thread'de, işleyici başına yayın sırasıyla
+            ASYNC,
+            // Yayınlayan thread'de, publish() dönmeden önce
+            SYNC
+        };
+
+        // Çok üreticili, tek tüketicili kilitsiz kuyruk (Vyukov). push herhangi bir thread'den,
+        // pop yalnızca sahibi olan dağıtıcıdan çağrılır.
+        template<typename T>
+        class MpscQueue {
+        public:
+            MpscQueue() : head(&stub), tail(&stub) {}
+
+            ~MpscQueue() {
+                T item;
+                while (pop(item)) {}
+            }
+
+            MpscQueue(const MpscQueue&) = delete;
+            MpscQueue& operator=(const MpscQueue&) = delete;
+
+            void push(T item) {
+                Node* node = new Node;
+                node->item = std::move(item);
+                enqueue(node);
+            }
+
+            // Kuyruk boşsa ya da bir üretici bağlantıyı henüz tamamlamadıysa false
+            bool pop(T& item) {
+                Node* current = tail;
+                Node* next = current->next.load(std::memory_order_acquire);
+                if (current == &stub) {
+                    if (!next) return false;
+                    tail = next;
+                    current = next;
+                    next = next->next.load(std::memory_order_acquire);
+                }
+                if (next) {
+                    tail = next;
+                    item = std::move(current->item);
+                    delete current;
+                    return true;
+                }
+                if (current != head.load(std::memory_order_acquire)) return false;
+                // Son düğümü çıkarabilmek için stub'ı yeniden ekle
+                enqueue(&stub);
+                next = current->next.load(std::memory_order_acquire);
+                if (!next) return false;
+                tail = next;
+                item = std::move(current->item);
+                delete current;
+                return true;
+            }
+
+        private:
+            struct Node {
+                std::atomic<Node*> next{nullptr};
+                T item;
+            };
+
+            void enqueue(Node* node) {
+                node->next.store(nullptr, std::memory_order_relaxed);
+                Node* previous = head.exchange(node, std::memory_order_acq_rel);
+                previous->next.store(node, std::memory_order_release);
+            }
+
+            Node stub;
+            alignas(64) std::atomic<Node*> head;
+            alignas(64) Node* tail;
+        };
+
+        // İsim -> işleyici listesi indeksli olay veri yolu. Her asenkron işleyici tek bir
+        // dağıtıcıya bağlanır; böylece işleyici başına sıra korunur ve bir yayın en fazla
+        // dağıtıcı sayısı kadar kuyruğa itilir. Dağıtıcı thread'i ilk asenkron işleyicisi
+        // bağlandığında başlatılır; yalnızca senkron kullanan veri yolu thread açmaz.
+        class EventBus {
+        public:
+            using Handler = std::function<void(const EventMessage&)>;
+            using BatchHandler = std::function<void(const std::vector<std::shared_ptr<const EventMessage>>&)>;
+            using SubscriptionId = uint64_t;
+
+            struct Options {
+                size_t dispatchers = 2;
+                // Bir uyanışta kuyruktan alınan en fazla mesaj
+                size_t batchSize = 256;
+            };
+
+            struct Stats {
+                uint64_t published = 0;
+                uint64_t delivered = 0;
+                uint64_t failures = 0;
+            };
+
+        private:
+            struct Subscriber {
+                SubscriptionId id;
+                Handler handler;
+                BatchHandler batchHandler;
+                size_t dispatcher;
+                std::atomic<bool> active{true};
+                // Şu an çalışan teslimat sayısı; unsubscribe sıfıra inmesini bekler
+                std::atomic<uint32_t> running{0};
+                // Yalnızca sahibi olan dağıtıcı kullanır
+                std::vector<std::shared_ptr<const EventMessage>> batch;
+            };
+
+            using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;
+
+            // Değişmez işleyici görüntüsü; kayıt sırasında kopyala-yaz ile değiştirilir
+            struct Routing {
+                SubscriberList synchronous;
+                // Dağıtıcı başına asenkron işleyiciler
+                std::vector<std::shared_ptr<const SubscriberList>> asynchronous;
+            };
+
+            struct Topic {
+                std::string name;
+                std::shared_ptr<const Routing> routing;
+            };
+
+        public:
+            // Önceden çözülmüş olay; sıcak yolda isim araması yapmadan yayın için
+            class Channel {
+            public:
+                Channel() = default;
+                bool valid() const { return topic != nullptr; }
+
+            private:
+                friend class EventBus;
+                explicit Channel(std::shared_ptr<Topic> topic) : topic(std::move(topic)) {}
+                std::shared_ptr<Topic> topic;
+            };
+
+            EventBus() : EventBus(Options()) {}
+
+            explicit EventBus(const Options& options) : options(options) {
+                size_t count = std::max<size_t>(1, options.dispatchers);
+                for (size_t i = 0; i < count; i++) dispatchers.push_back(std::make_unique<Dispatcher>());
+            }
+
+            ~EventBus() {
+                for (auto& dispatcher : dispatchers) {
+                    {
+                        std::lock_guard<std::mutex> lock(dispatcher->mutex);
+                        dispatcher->stopping = true;
+                    }
+                    dispatcher->wakeup.notify_one();
+                }
+                for (auto& dispatcher : dispatchers) {
+                    if (dispatcher->thread.joinable()) dispatcher->thread.join();
+                }
+            }
+
+            EventBus(const EventBus&) = delete;
+            EventBus& operator=(const EventBus&) = delete;
+
+            SubscriptionId subscribe(const std::string& name, Handler handler, Delivery delivery = Delivery::ASYNC) {
+                auto subscriber = std::make_shared<Subscriber>();
+                subscriber->handler = std::move(handler);
+                return attach(name, subscriber, delivery == Delivery::SYNC);
+            }
+
+            // Dağıtıcının bir uyanışta aldığı tüm mesajları tek çağrıda teslim eder
+            SubscriptionId subscribeBatch(const std::string& name, BatchHandler handler) {
+                auto subscriber = std::make_shared<Subscriber>();
+                subscriber->batchHandler = std::move(handler);
+                return attach(name, subscriber, false);
+            }
+
+            // Döndükten sonra işleyici bir daha çağrılmaz: süren teslimatlar bitene dek bekler.
+            // İşleyicinin kendi içinden çağrılabilir (o teslimat beklenmez); iki işleyicinin
+            // birbirini karşılıklı çıkarması ise kilitlenir
+            bool unsubscribe(SubscriptionId id) {
+                std::shared_ptr<Subscriber> removed;
+                {
+                    std::unique_lock<std::shared_mutex> lock(topicsMutex);
+                    for (auto& entry : topics) {
+                        Topic& topic = *entry.second;
+                        auto routing = std::make_shared<Routing>(*topic.routing);
+                        removed = removeFrom(routing->synchronous, id);
+                        for (auto& list : routing->asynchronous) {
+                            SubscriberList copy = *list;
+                            if (auto subscriber = removeFrom(copy, id)) {
+                                list = std::make_shared<const SubscriberList>(std::move(copy));
+                                removed = subscriber;
+                            }
+                        }
+                        if (removed) {
+                            std::atomic_store(&topic.routing, std::shared_ptr<const Routing>(routing));
+                            break;
+                        }
+                    }
+                }
+                if (!removed) return false;
+                uint32_t own = 0;
+                for (const Subscriber* current : delivering()) {
+                    if (current == removed.get()) own++;
+                }
+                std::unique_lock<std::mutex> lock(quiescentMutex);
+                quiescent.wait(lock, [&]() { return removed->running.load(std::memory_order_seq_cst) <= own; });
+                return true;
+            }
+
+            Channel channel(const std::string& name) {
+                std::unique_lock<std::shared_mutex> lock(topicsMutex);
+                return Channel(topicFor(name));
+            }
+
+            void publish(const std::string& name, std::string payload = std::string()) {
+                std::shared_ptr<Topic> topic;
+                {
+                    std::shared_lock<std::shared_mutex> lock(topicsMutex);
+                    auto it = topics.find(name);
+                    if (it == topics.end()) return;
+                    topic = it->second;
+                }
+                publish(*topic, std::move(payload));
+            }
+
+            void publish(const Channel& channel, std::string payload = std::string()) {
+                if (!channel.topic) throw std::runtime_error("Invalid event channel");
+                publish(*channel.topic, std::move(payload));
+            }
+
+            // Bu çağrıdan önce yayınlanan tüm asenkron teslimatları bekle.
+            // Bir dağıtıcı thread'inden (asenkron işleyici içinden) çağrılamaz: o dağıtıcı
+            // işleyici dönene dek ilerleyemeyeceği için bekleme kilitlenirdi; bu durumda fırlatır
+            void flush() {
+                {
+                    // Dağıtıcı thread'leri attach içinde başlatılır
+                    std::shared_lock<std::shared_mutex> lock(topicsMutex);
+                    for (auto& dispatcher : dispatchers) {
+                        if (dispatcher->thread.get_id() == std::this_thread::get_id()) {
+                            throw std::runtime_error("EventBus::flush cannot be called from an event handler");
+                        }
+                    }
+                }
+                for (auto& dispatcher : dispatchers) {
+                    uint64_t target = dispatcher->enqueued.load(std::memory_order_acquire);
+                    std::unique_lock<std::mutex> lock(dispatcher->mutex);
+                    dispatcher->drained.wait(lock, [&]() {
+                        return dispatcher->processed.load(std::memory_order_acquire) >= target;
+                    });
+                }
+            }
+
+            Stats stats() const {
+                Stats result;
+                result.published = published.load(std::memory_order_relaxed);
+                result.delivered = delivered.load(std::memory_order_relaxed);
+                result.failures = failures.load(std::memory_order_relaxed);
+                return result;
+            }
+
+        private:
+            // Dağıtıcı kuyruğundaki öğe: mesaj + o dağıtıcıya düşen işleyiciler
+            struct Envelope {
+                std::shared_ptr<const EventMessage> message;
+                std::shared_ptr<const SubscriberList> subscribers;
+            };
+
+            struct Dispatcher {
+                MpscQueue<Envelope> queue;
+                std::thread thread;
+                std::mutex mutex;
+                std::condition_variable wakeup;
+                std::condition_variable drained;
+                std::atomic<bool> sleeping{false};
+                std::atomic<uint64_t> enqueued{0};
+                std::atomic<uint64_t> processed{0};
+                bool stopping = false;
+            };
+
+            Options options;
+            std::vector<std::unique_ptr<Dispatcher>> dispatchers;
+            std::mutex quiescentMutex;
+            std::condition_variable quiescent;
+            std::shared_mutex topicsMutex;
+            std::unordered_map<std::string, std::shared_ptr<Topic>> topics;
+            uint64_t nextId = 1;
+            size_t nextDispatcher = 0;
+            std::atomic<uint64_t> published{0};
+            std::atomic<uint64_t> delivered{0};
+            std::atomic<uint64_t> failures{0};
+
+            // topicsMutex yazma kilidi altında
+            std::shared_ptr<Topic> topicFor(const std::string& name) {
+                auto& topic = topics[name];
+                if (!topic) {
+                    topic = std::make_shared<Topic>();
+                    topic->name = name;
+                    auto routing = std::make_shared<Routing>();
+                    for (size_t i = 0; i < dispatchers.size(); i++) {
+                        routing->asynchronous.push_back(std::make_shared<const SubscriberList>());
+                    }
+                    topic->routing = routing;
+                }
+                return topic;
+            }
+
+            SubscriptionId attach(const std::string& name, const std::shared_ptr<Subscriber>& subscriber, bool synchronous) {
+                std::unique_lock<std::shared_mutex> lock(topicsMutex);
+                subscriber->id = nextId++;
+                std::shared_ptr<Topic> topic = topicFor(name);
+                auto routing = std::make_shared<Routing>(*topic->routing);
+                if (synchronous) {
+                    routing->synchronous.push_back(subscriber);
+                } else {
+                    subscriber->dispatcher = nextDispatcher++ % dispatchers.size();
+                    Dispatcher& dispatcher = *dispatchers[subscriber->dispatcher];
+                    if (!dispatcher.thread.joinable()) {
+                        dispatcher.thread = std::thread([this, &dispatcher]() { dispatchLoop(dispatcher); });
+                    }
+                    SubscriberList copy = *routing->asynchronous[subscriber->dispatcher];
+                    copy.push_back(subscriber);
+                    routing->asynchronous[subscriber->dispatcher] = std::make_shared<const SubscriberList>(std::move(copy));
+                }
+                std::atomic_store(&topic->routing, std::shared_ptr<const Routing>(routing));
+                return subscriber->id;
+            }
+
+            static std::shared_ptr<Subscriber> removeFrom(SubscriberList& list, SubscriptionId id) {
+                auto it = std::find_if(list.begin(), list.end(), [&](const auto& subscriber) { return subscriber->id == id; });
+                if (it == list.end()) return nullptr;
+                std::shared_ptr<Subscriber> subscriber = *it;
+                subscriber->active.store(false, std::memory_order_seq_cst);
+                list.erase(it);
+                return subscriber;
+            }
+
+            // Bu thread'de o an teslim edilen işleyiciler (iç içe yayınlar için yığın)
+            static std::vector<const Subscriber*>& delivering() {
+                static thread_local std::vector<const Subscriber*> stack;
+                return stack;
+            }
+
+            // Teslimattan önce çağrılır; çıkarılmış işleyici için false.
+            // Sayaç etkinlik kontrolünden önce artar: unsubscribe ya sayacı görür ya da biz bayrağı
+            bool enter(Subscriber& subscriber) {
+                subscriber.running.fetch_add(1, std::memory_order_seq_cst);
+                if (!subscriber.active.load(std::memory_order_seq_cst)) {
+                    leave(subscriber);
+                    return false;
+                }
+                delivering().push_back(&subscriber);
+                return true;
+            }
+
+            void leave(Subscriber& subscriber) {
+                subscriber.running.fetch_sub(1, std::memory_order_seq_cst);
+                if (!subscriber.active.load(std::memory_order_seq_cst)) {
+                    // Bekleyen unsubscribe kilidi tutarken koşulu okur; uyandırma kaçmaz
+                    std::lock_guard<std::mutex> lock(quiescentMutex);
+                    quiescent.notify_all();
+                }
+            }
+
+            void deliver(Subscriber& subscriber, const EventMessage& message) {
+                if (!enter(subscriber)) return;
+                invoke(subscriber, message);
+                delivering().pop_back();
+                leave(subscriber);
+            }
+
+            void publish(const Topic& topic, std::string payload) {
+                std::shared_ptr<const Routing> routing = std::atomic_load(&topic.routing);
+                published.fetch_add(1, std::memory_order_relaxed);
+
+                auto message = std::make_shared<EventMessage>();
+                message->name = topic.name;
+                message->payload = std::move(payload);
+                message->publishedAt = std::chrono::steady_clock::now();
+
+                for (size_t i = 0; i < routing->asynchronous.size(); i++) {
+                    const auto& subscribers = routing->asynchronous[i];
+                    if (subscribers->empty()) continue;
+                    Dispatcher& dispatcher = *dispatchers[i];
+                    dispatcher.enqueued.fetch_add(1, std::memory_order_acq_rel);
+                    dispatcher.queue.push(Envelope{message, subscribers});
+                    // Yalnızca uyuyan dağıtıcı için kilit alınır
+                    if (dispatcher.sleeping.load(std::memory_order_seq_cst)) {
+                        std::lock_guard<std::mutex> lock(dispatcher.mutex);
+                        dispatcher.wakeup.notify_one();
+                    }
+                }
+
+                // Senkron hızlı yol: kuyruk ve tahsis yok, doğrudan çağrı
+                for (const auto& subscriber : routing->synchronous) {
+                    deliver(*subscriber, *message);
+                }
+            }
+
+            void invoke(Subscriber& subscriber, const EventMessage& message) {
+                try {
+                    subscriber.handler(message);
+                    delivered.fetch_add(1, std::memory_order_relaxed);
+                } catch (...) {
+                    // İşleyici hatası diğer işleyicileri durdurmaz
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            void dispatchLoop(Dispatcher& dispatcher) {
+                std::vector<Envelope> batch;
+                std::vector<Subscriber*> batched;
+                batch.reserve(options.batchSize);
+                while (true) {
+                    Envelope envelope;
+                    while (batch.size() < options.batchSize && dispatcher.queue.pop(envelope)) {
+                        batch.push_back(std::move(envelope));
+                    }
+
+                    if (batch.empty()) {
+                        std::unique_lock<std::mutex> lock(dispatcher.mutex);
+                        dispatcher.drained.notify_all();
+                        if (dispatcher.stopping &&
+                            dispatcher.processed.load(std::memory_order_acquire) >= dispatcher.enqueued.load(std::memory_order_acquire)) {
+                            return;
+                        }
+                        dispatcher.sleeping.store(true, std::memory_order_seq_cst);
+                        // Uyumadan önce tekrar bak: uyku bayrağından önce eklenen mesaj kaçmasın
+                        if (dispatcher.processed.load(std::memory_order_acquire) >= dispatcher.enqueued.load(std::memory_order_seq_cst)) {
+                            dispatcher.wakeup.wait_for(lock, std::chrono::milliseconds(10));
+                        }
+                        dispatcher.sleeping.store(false, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    for (const auto& item : batch) {
+                        for (const auto& subscriber : *item.subscribers) {
+                            if (!subscriber->active.load(std::memory_order_acquire)) continue;
+                            if (subscriber->batchHandler) {
+                                if (subscriber->batch.empty()) batched.push_back(subscriber.get());
+                                subscriber->batch.push_back(item.message);
+                            } else {
+                                deliver(*subscriber, *item.message);
+                            }
+                        }
+                    }
+                    for (Subscriber* subscriber : batched) {
+                        if (enter(*subscriber)) {
+                            try {
+                                subscriber->batchHandler(subscriber->batch);
+                                delivered.fetch_add(subscriber->batch.size(), std::memory_order_relaxed);
+                            } catch (...) {
+                                failures.fetch_add(subscriber->batch.size(), std::memory_order_relaxed);
+                            }
+                            delivering().pop_back();
+                            leave(*subscriber);
+                        }
+                        subscriber->batch.clear();
+                    }
+                    batched.clear();
+
+                    dispatcher.processed.fetch_add(batch.size(), std::memory_order_acq_rel);
+                    batch.clear();
+                }
+            }
+        };
+    }
+}
+
+#endif // WHOLF_EVENTS_HPP
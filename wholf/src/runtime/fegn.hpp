@@ -3,41 +3,500 @@
 
 #include <string>
 #include <map>
+#include <algorithm>
 #include <memory>
 #include <vector>
+#include <functional>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <future>
+#include <stdexcept>
+
+#include "epoch.hpp"
+#include "http.hpp"
+#include "events.hpp"
+#include "stream.hpp"
 
 namespace Wholf {
     namespace Fegn {
-        // API entegrasyonu
+        // API entegrasyonu: istekler süreç genelindeki havuzlu HTTP istemcisinden geçer,
+        // aynı host'a giden çağrılar keep-alive bağlantıları paylaşır
         class Api {
         public:
             std::string baseUrl;
             std::map<std::string, std::string> headers;
             
-            Api(const std::string& baseUrl) : baseUrl(baseUrl) {}
+            Api(const std::string& baseUrl) : baseUrl(baseUrl), client(Http::Client::shared()) {}
+            Api(const std::string& baseUrl, std::shared_ptr<Http::Client> client) : baseUrl(baseUrl), client(std::move(client)) {}
+            
+            // Senkron çağrılar yanıt gövdesini döndürür; 2xx dışı durumlar hata fırlatır
+            std::string get(const std::string& endpoint) {
+                return checked(client->send(request("GET", endpoint, ""))).body;
+            }
+            
+            std::string post(const std::string& endpoint, const std::string& data) {
+                return checked(client->send(request("POST", endpoint, data))).body;
+            }
+            
+            std::string put(const std::string& endpoint, const std::string& data) {
+                return checked(client->send(request("PUT", endpoint, data))).body;
+            }
+            
+            std::string deleteRequest(const std::string& endpoint) {
+                return checked(client->send(request("DELETE", endpoint, ""))).body;
+            }
+            
+            // Asenkron çağrılar tam yanıtı döndürür (durum kontrolü çağırana kalır)
+            std::future<Http::Response> getAsync(const std::string& endpoint) {
+                return client->sendAsync(request("GET", endpoint, ""));
+            }
+            
+            std::future<Http::Response> postAsync(const std::string& endpoint, const std::string& data) {
+                return client->sendAsync(request("POST", endpoint, data));
+            }
+            
+            std::future<Http::Response> putAsync(const std::string& endpoint, const std::string& data) {
+                return client->sendAsync(request("PUT", endpoint, data));
+            }
             
-            std::string get(const std::string& endpoint);
-            std::string post(const std::string& endpoint, const std::string& data);
-            std::string put(const std::string& endpoint, const std::string& data);
-            std::string deleteRequest(const std::string& endpoint);
+            std::future<Http::Response> deleteAsync(const std::string& endpoint) {
+                return client->sendAsync(request("DELETE", endpoint, ""));
+            }
+            
+            // Gövdeyi ara kopya olmadan çağıranın tamponuna al; yazılan bayt sayısını döndürür
+            size_t getInto(const std::string& endpoint, char* buffer, size_t capacity) {
+                return checked(client->send(request("GET", endpoint, ""), buffer, capacity)).bodySize;
+            }
+            
+            // Çok sayıda GET'i host başına ardışık (pipelined) gruplar halinde gönder
+            std::vector<std::future<Http::Response>> getBatch(const std::vector<std::string>& endpoints) {
+                std::vector<Http::Request> requests;
+                requests.reserve(endpoints.size());
+                for (const auto& endpoint : endpoints) requests.push_back(request("GET", endpoint, ""));
+                return client->sendBatch(requests);
+            }
+            
+            Http::Request request(const std::string& method, const std::string& endpoint, const std::string& data) const {
+                Http::Request result;
+                result.method = method;
+                result.url = baseUrl + endpoint;
+                result.body = data;
+                for (const auto& header : headers) result.headers.emplace_back(header.first, header.second);
+                return result;
+            }
+            
+        private:
+            std::shared_ptr<Http::Client> client;
+            
+            Http::Response checked(Http::Response response) const {
+                if (!response.ok()) {
+                    throw std::runtime_error("HTTP " + std::to_string(response.status) + " " + response.reason + " from " + baseUrl);
+                }
+                return response;
+            }
         };
         
-        // Veri yönetimi
+        // Veri yönetimi: parçalı, eşzamanlı anahtar-değer deposu.
+        // Okumalar kilitsizdir (Epoch::Guard); yazarlar parça kilidi altında girdiyi değiştirip
+        // eskisini dönem yöneticisine bırakır. İsteğe bağlı TTL ve bayt bütçesi (CLOCK tahliyesi).
         class DataStore {
-        private:
-            std::map<std::string, std::string> data;
-            
         public:
+            using Clock = std::chrono::steady_clock;
+            
+            struct Options {
+                size_t shards = 64;
+                // Toplam anahtar + değer baytı; 0 sınırsız
+                size_t byteBudget = 0;
+            };
+            
+            struct Stats {
+                uint64_t hits = 0;
+                uint64_t misses = 0;
+                uint64_t evictions = 0;
+                uint64_t expirations = 0;
+                size_t entries = 0;
+                size_t bytes = 0;
+            };
+            
+            DataStore() : DataStore(Options()) {}
+            
+            explicit DataStore(const Options& options)
+                : byteBudget(options.byteBudget), shardCount(roundUp(options.shards ? options.shards : 1)),
+                  shards(new Shard[shardCount]) {}
+            
+            ~DataStore() {
+                // Bekleyen okuyucu kalmamalı; girdiler doğrudan silinir
+                Epoch::Manager::instance().reclaim();
+                for (size_t i = 0; i < shardCount; i++) {
+                    Table* table = shards[i].table.load(std::memory_order_relaxed);
+                    if (!table) continue;
+                    for (size_t slot = 0; slot < table->capacity; slot++) {
+                        Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                        if (entry && entry != tombstone()) delete entry;
+                    }
+                    delete table;
+                }
+            }
+            
+            DataStore(const DataStore&) = delete;
+            DataStore& operator=(const DataStore&) = delete;
+            
             void set(const std::string& key, const std::string& value) {
-                data[key] = value;
+                insert(key, value, 0);
             }
             
+            // Süreli kayıt; süre dolunca okunmaz ve tahliye taramasında silinir
+            void set(const std::string& key, const std::string& value, std::chrono::milliseconds ttl) {
+                insert(key, value, now() + std::chrono::duration_cast<std::chrono::nanoseconds>(ttl).count());
+            }
+            
+            // Eksik anahtar boş dize döndürür (eskisi gibi), ancak artık girdi eklemez
             std::string get(const std::string& key) {
-                return data[key];
+                std::string value;
+                tryGet(key, value);
+                return value;
+            }
+            
+            // Kilitsiz okuma; bulunursa değeri kopyalar
+            bool tryGet(std::string_view key, std::string& value) {
+                size_t hash = hashKey(key);
+                Shard& shard = shardFor(hash);
+                Epoch::Manager::Guard guard;
+                Entry* entry = find(shard.table.load(std::memory_order_acquire), key, hash);
+                if (!entry || expired(entry)) {
+                    stripe().misses.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                // CLOCK biti; önbellek satırını gereksiz yere kirletmemek için önce okunur
+                if (!entry->referenced.load(std::memory_order_relaxed)) {
+                    entry->referenced.store(true, std::memory_order_relaxed);
+                }
+                value.assign(entry->value);
+                stripe().hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            
+            bool contains(std::string_view key) {
+                size_t hash = hashKey(key);
+                Epoch::Manager::Guard guard;
+                Entry* entry = find(shardFor(hash).table.load(std::memory_order_acquire), key, hash);
+                return entry && !expired(entry);
             }
             
             void remove(const std::string& key) {
-                data.erase(key);
+                size_t hash = hashKey(key);
+                Shard& shard = shardFor(hash);
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                Table* table = shard.table.load(std::memory_order_relaxed);
+                if (!table) return;
+                size_t slot = locate(table, key, hash);
+                if (slot != NOT_FOUND) erase(shard, table, slot);
+            }
+            
+            // Süresi dolmuş tüm girdileri sil
+            size_t purgeExpired() {
+                size_t purged = 0;
+                int64_t current = now();
+                for (size_t i = 0; i < shardCount; i++) {
+                    Shard& shard = shards[i];
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    Table* table = shard.table.load(std::memory_order_relaxed);
+                    if (!table) continue;
+                    for (size_t slot = 0; slot < table->capacity; slot++) {
+                        Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                        if (entry && entry != tombstone() && entry->expiresAt && entry->expiresAt <= current) {
+                            erase(shard, table, slot);
+                            purged++;
+                        }
+                    }
+                }
+                expirations.fetch_add(purged, std::memory_order_relaxed);
+                return purged;
+            }
+            
+            // Süresi dolmamış tüm girdileri gez; kalan TTL süresi yoksa 0. Parça kilitleri sırayla tutulur.
+            void forEach(const std::function<void(const std::string&, const std::string&, std::chrono::milliseconds)>& visit) {
+                int64_t current = now();
+                for (size_t i = 0; i < shardCount; i++) {
+                    Shard& shard = shards[i];
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    Table* table = shard.table.load(std::memory_order_relaxed);
+                    if (!table) continue;
+                    for (size_t slot = 0; slot < table->capacity; slot++) {
+                        Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                        if (!entry || entry == tombstone()) continue;
+                        std::chrono::milliseconds remaining(0);
+                        if (entry->expiresAt) {
+                            if (entry->expiresAt <= current) continue;
+                            remaining = std::chrono::milliseconds(std::max<int64_t>(1, (entry->expiresAt - current) / 1000000));
+                        }
+                        visit(entry->key, entry->value, remaining);
+                    }
+                }
+            }
+            
+            size_t size() const {
+                size_t total = 0;
+                for (size_t i = 0; i < shardCount; i++) total += shards[i].live.load(std::memory_order_relaxed);
+                return total;
+            }
+            
+            size_t bytes() const { return usedBytes.load(std::memory_order_relaxed); }
+            
+            Stats stats() const {
+                Stats result;
+                for (const auto& counters : stripes) {
+                    result.hits += counters.hits.load(std::memory_order_relaxed);
+                    result.misses += counters.misses.load(std::memory_order_relaxed);
+                }
+                result.evictions = evictions.load(std::memory_order_relaxed);
+                result.expirations = expirations.load(std::memory_order_relaxed);
+                result.entries = size();
+                result.bytes = bytes();
+                return result;
+            }
+            
+        private:
+            static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+            static constexpr size_t INITIAL_CAPACITY = 16;
+            static constexpr size_t STRIPES = 16;
+            // Girdi başına yaklaşık sabit maliyet (düğüm + yuva)
+            static constexpr size_t ENTRY_OVERHEAD = 64;
+            // TTL'li girdi görüldükten sonra her yazma ibreyi bu kadar yuva ilerletir
+            static constexpr size_t SWEEP_SLOTS = 8;
+            
+            // Değişmez girdi; güncelleme yeni girdi ile yapılır
+            struct Entry {
+                std::string key;
+                std::string value;
+                size_t hash = 0;
+                int64_t expiresAt = 0;
+                std::atomic<bool> referenced{true};
+                
+                size_t bytes() const { return key.size() + value.size() + ENTRY_OVERHEAD; }
+            };
+            
+            // Açık adresli tablo; yuvalar kilitsiz okunur
+            struct Table {
+                size_t capacity;
+                std::unique_ptr<std::atomic<Entry*>[]> slots;
+                // Dolu + mezar taşı yuva sayısı (parça kilidi altında)
+                size_t used = 0;
+                
+                explicit Table(size_t capacity) : capacity(capacity), slots(new std::atomic<Entry*>[capacity]) {
+                    for (size_t i = 0; i < capacity; i++) slots[i].store(nullptr, std::memory_order_relaxed);
+                }
+            };
+            
+            struct alignas(64) Shard {
+                std::mutex mutex;
+                std::atomic<Table*> table{nullptr};
+                std::atomic<size_t> live{0};
+                size_t hand = 0;
+            };
+            
+            // İsabet sayaçları thread'lere dağıtılır; okuyucular tek bir satırda çarpışmaz
+            struct alignas(64) Counters {
+                std::atomic<uint64_t> hits{0};
+                std::atomic<uint64_t> misses{0};
+            };
+            
+            const size_t byteBudget;
+            const size_t shardCount;
+            std::unique_ptr<Shard[]> shards;
+            Counters stripes[STRIPES];
+            alignas(64) std::atomic<size_t> usedBytes{0};
+            std::atomic<size_t> evictShard{0};
+            std::atomic<uint64_t> evictions{0};
+            std::atomic<uint64_t> expirations{0};
+            // Hiç TTL verilmediyse yazmalar süpürme yapmaz
+            std::atomic<bool> expiring{false};
+            
+            static size_t roundUp(size_t value) {
+                size_t result = 1;
+                while (result < value) result <<= 1;
+                return result;
+            }
+            
+            static Entry* tombstone() {
+                static Entry marker;
+                return &marker;
+            }
+            
+            static size_t hashKey(std::string_view key) {
+                return std::hash<std::string_view>()(key);
+            }
+            
+            static int64_t now() {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+            }
+            
+            static bool expired(const Entry* entry) {
+                return entry->expiresAt && entry->expiresAt <= now();
+            }
+            
+            Shard& shardFor(size_t hash) {
+                // Parça için üst bitler, yuva için alt bitler
+                return shards[(hash >> 48) & (shardCount - 1)];
+            }
+            
+            Counters& stripe() {
+                static thread_local size_t index = std::hash<std::thread::id>()(std::this_thread::get_id()) % STRIPES;
+                return stripes[index];
+            }
+            
+            static Entry* find(Table* table, std::string_view key, size_t hash) {
+                if (!table) return nullptr;
+                size_t mask = table->capacity - 1;
+                for (size_t probe = 0, slot = hash & mask; probe < table->capacity; probe++, slot = (slot + 1) & mask) {
+                    Entry* entry = table->slots[slot].load(std::memory_order_acquire);
+                    if (!entry) return nullptr;
+                    if (entry != tombstone() && entry->hash == hash && entry->key == key) return entry;
+                }
+                return nullptr;
+            }
+            
+            // Parça kilidi altında: anahtarın yuvası
+            static size_t locate(Table* table, std::string_view key, size_t hash) {
+                size_t mask = table->capacity - 1;
+                for (size_t probe = 0, slot = hash & mask; probe < table->capacity; probe++, slot = (slot + 1) & mask) {
+                    Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                    if (!entry) return NOT_FOUND;
+                    if (entry != tombstone() && entry->hash == hash && entry->key == key) return slot;
+                }
+                return NOT_FOUND;
+            }
+            
+            void insert(const std::string& key, const std::string& value, int64_t expiresAt) {
+                Entry* entry = new Entry();
+                entry->key = key;
+                entry->value = value;
+                entry->hash = hashKey(key);
+                entry->expiresAt = expiresAt;
+                size_t added = entry->bytes();
+                if (expiresAt && !expiring.load(std::memory_order_relaxed)) expiring.store(true, std::memory_order_relaxed);
+                
+                Shard& shard = shardFor(entry->hash);
+                {
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    Table* table = shard.table.load(std::memory_order_relaxed);
+                    if (!table) {
+                        table = new Table(INITIAL_CAPACITY);
+                        shard.table.store(table, std::memory_order_release);
+                    }
+                    
+                    size_t slot = locate(table, key, entry->hash);
+                    if (slot != NOT_FOUND) {
+                        Entry* previous = table->slots[slot].load(std::memory_order_relaxed);
+                        table->slots[slot].store(entry, std::memory_order_release);
+                        usedBytes.fetch_sub(previous->bytes(), std::memory_order_relaxed);
+                        Epoch::Manager::instance().retire(previous);
+                    } else {
+                        // Yük oranı %75'i geçerse büyüt (mezar taşları da temizlenir)
+                        if ((table->used + 1) * 4 > table->capacity * 3) table = rehash(shard, table);
+                        place(table, entry);
+                        shard.live.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    usedBytes.fetch_add(added, std::memory_order_relaxed);
+                    if (expiring.load(std::memory_order_relaxed)) sweep(shard, table);
+                }
+                
+                // Tahliye kendi parça kilidi bırakıldıktan sonra yapılır (kilit sırası sorunu olmaz)
+                if (byteBudget && usedBytes.load(std::memory_order_relaxed) > byteBudget) evict();
+            }
+            
+            // Parça kilidi altında: boş ya da mezar taşı olan ilk yuvaya yerleştir
+            static void place(Table* table, Entry* entry) {
+                size_t mask = table->capacity - 1;
+                for (size_t slot = entry->hash & mask;; slot = (slot + 1) & mask) {
+                    Entry* current = table->slots[slot].load(std::memory_order_relaxed);
+                    if (!current || current == tombstone()) {
+                        if (!current) table->used++;
+                        table->slots[slot].store(entry, std::memory_order_release);
+                        return;
+                    }
+                }
+            }
+            
+            Table* rehash(Shard& shard, Table* table) {
+                size_t live = shard.live.load(std::memory_order_relaxed);
+                size_t capacity = INITIAL_CAPACITY;
+                while ((live + 1) * 2 > capacity) capacity <<= 1;
+                
+                Table* grown = new Table(capacity);
+                for (size_t slot = 0; slot < table->capacity; slot++) {
+                    Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                    if (entry && entry != tombstone()) place(grown, entry);
+                }
+                shard.table.store(grown, std::memory_order_release);
+                shard.hand = 0;
+                // Girdiler taşındı; yalnızca eski yuva dizisi bırakılır
+                Epoch::Manager::instance().retire(table);
+                return grown;
+            }
+            
+            // Parça kilidi altında
+            void erase(Shard& shard, Table* table, size_t slot) {
+                Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                table->slots[slot].store(tombstone(), std::memory_order_release);
+                shard.live.fetch_sub(1, std::memory_order_relaxed);
+                usedBytes.fetch_sub(entry->bytes(), std::memory_order_relaxed);
+                Epoch::Manager::instance().retire(entry);
+            }
+            
+            // Parça kilidi altında: saat ibresini birkaç yuva ilerletip geçtiği süresi dolmuş girdileri
+            // sil. Bütçe baskısı olmadan da (byteBudget = 0) okunmayan TTL'li girdiler geri kazanılır
+            void sweep(Shard& shard, Table* table) {
+                int64_t current = now();
+                size_t purged = 0;
+                for (size_t step = 0; step < SWEEP_SLOTS; step++) {
+                    size_t slot = shard.hand;
+                    shard.hand = (shard.hand + 1) & (table->capacity - 1);
+                    Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                    if (entry && entry != tombstone() && entry->expiresAt && entry->expiresAt <= current) {
+                        erase(shard, table, slot);
+                        purged++;
+                    }
+                }
+                if (purged) expirations.fetch_add(purged, std::memory_order_relaxed);
+            }
+            
+            // Yaklaşık LRU (CLOCK): parçalar sırayla taranır, referans biti temizlenir,
+            // bit tekrar set edilmemiş girdiler silinir. Süresi dolanlar önce gider.
+            void evict() {
+                size_t attempts = shardCount * 2;
+                while (usedBytes.load(std::memory_order_relaxed) > byteBudget && attempts-- > 0) {
+                    Shard& shard = shards[evictShard.fetch_add(1, std::memory_order_relaxed) & (shardCount - 1)];
+                    std::lock_guard<std::mutex> lock(shard.mutex);
+                    Table* table = shard.table.load(std::memory_order_relaxed);
+                    if (!table || shard.live.load(std::memory_order_relaxed) == 0) continue;
+                    
+                    int64_t current = now();
+                    // En fazla iki tur: ilk tur bitleri temizler, ikinci turda kurban bulunur
+                    for (size_t step = 0; step < table->capacity * 2; step++) {
+                        size_t slot = shard.hand;
+                        shard.hand = (shard.hand + 1) & (table->capacity - 1);
+                        Entry* entry = table->slots[slot].load(std::memory_order_relaxed);
+                        if (!entry || entry == tombstone()) continue;
+                        if (entry->expiresAt && entry->expiresAt <= current) {
+                            erase(shard, table, slot);
+                            expirations.fetch_add(1, std::memory_order_relaxed);
+                            if (usedBytes.load(std::memory_order_relaxed) <= byteBudget) break;
+                            continue;
+                        }
+                        if (entry->referenced.load(std::memory_order_relaxed)) {
+                            entry->referenced.store(false, std::memory_order_relaxed);
+                            continue;
+                        }
+                        erase(shard, table, slot);
+                        evictions.fetch_add(1, std::memory_order_relaxed);
+                        if (usedBytes.load(std::memory_order_relaxed) <= byteBudget) break;
+                    }
+                }
             }
         };
         
@@ -54,37 +513,44 @@ namespace Wholf {
         // Entegrasyon yöneticisi
         class Integration {
         private:
-            std::vector<std::shared_ptr<Event>> events;
             std::map<std::string, std::shared_ptr<Api>> apis;
+            // Olay ismi kayıtta bir kez hash'lenir; tetikleme yalnızca o olayın işleyicilerine gider
+            EventBus events;
             
         public:
+            Integration() = default;
+            explicit Integration(const EventBus::Options& options) : events(options) {}
+            
             void addApi(const std::string& name, const std::shared_ptr<Api>& api) {
                 apis[name] = api;
             }
             
-            void addEvent(const std::string& name, const std::function<void()>& callback) {
-                events.push_back(std::make_shared<Event>(name, callback));
+            // Varsayılan olarak triggerEvent dönmeden, tetikleyen thread'de çağrılır;
+            // Delivery::ASYNC dağıtıcı thread'de çağırır (ilk asenkron olayda başlatılır)
+            EventBus::SubscriptionId addEvent(const std::string& name, const std::function<void()>& callback,
+                                              Delivery delivery = Delivery::SYNC) {
+                return events.subscribe(name, [callback](const EventMessage&) { callback(); }, delivery);
             }
             
-            void triggerEvent(const std::string& name) {
-                for (const auto& event : events) {
-                    if (event->name == name) {
-                        event->callback();
-                    }
-                }
+            EventBus::SubscriptionId addEvent(const std::string& name, const EventBus::Handler& handler,
+                                              Delivery delivery = Delivery::SYNC) {
+                return events.subscribe(name, handler, delivery);
+            }
+            
+            bool removeEvent(EventBus::SubscriptionId id) {
+                return events.unsubscribe(id);
             }
-        };
-        
-        // Veri akışı yönetimi
-        class Stream {
-        public:
-            std::string source;
-            std::function<void(std::string)> transform;
-            std::function<void(std::string)> sink;
             
-            void pipe(const std::function<void(std::string)>& sink) {
-                this->sink = sink;
+            void triggerEvent(const std::string& name, const std::string& payload = std::string()) {
+                events.publish(name, payload);
             }
+            
+            // Tetiklenmiş asenkron olayların teslim edilmesini bekle; olay işleyicisi içinden fırlatır
+            void flushEvents() {
+                events.flush();
+            }
+            
+            EventBus& eventBus() { return events; }
         };
     }
 }
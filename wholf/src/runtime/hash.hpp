@@ -0,0 +1,145 @@
+#ifndef WHOLF_HASH_HPP
+#define WHOLF_HASH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace Wholf {
+    namespace Hash {
+        // 64 bit FNV-1a; içerik önbelleği anahtarı için (kriptografik değildir)
+        inline uint64_t fnv1a64(const void* data, size_t length, uint64_t hash = 14695981039346656037ull) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < length; i++) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        inline uint64_t fnv1a64(std::string_view text, uint64_t hash = 14695981039346656037ull) {
+            return fnv1a64(text.data(), text.size(), hash);
+        }
+
+        inline std::string toHex(uint64_t hash) {
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+            return std::string(buffer, 16);
+        }
+
+        inline std::string toHex(const uint8_t* bytes, size_t length) {
+            static const char digits[] = "0123456789abcdef";
+            std::string text(length * 2, '0');
+            for (size_t i = 0; i < length; i++) {
+                text[2 * i] = digits[bytes[i] >> 4];
+                text[2 * i + 1] = digits[bytes[i] & 15];
+            }
+            return text;
+        }
+
+        // SHA-256 (FIPS 180-4); içerik adresli depolama ve bütünlük denetimi için
+        class Sha256 {
+        public:
+            using Digest = std::array<uint8_t, 32>;
+
+            void update(const void* data, size_t length) {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                total += length;
+                if (used > 0) {
+                    size_t take = std::min(length, sizeof(block) - used);
+                    std::memcpy(block + used, bytes, take);
+                    used += take;
+                    bytes += take;
+                    length -= take;
+                    if (used < sizeof(block)) return;
+                    compress(block);
+                    used = 0;
+                }
+                while (length >= sizeof(block)) {
+                    compress(bytes);
+                    bytes += sizeof(block);
+                    length -= sizeof(block);
+                }
+                std::memcpy(block, bytes, length);
+                used = length;
+            }
+
+            void update(std::string_view text) {
+                update(text.data(), text.size());
+            }
+
+            Digest finish() {
+                uint64_t bits = total * 8;
+                uint8_t padding = 0x80;
+                update(&padding, 1);
+                uint8_t zero = 0;
+                while (used != 56) update(&zero, 1);
+                uint8_t length[8];
+                for (int i = 0; i < 8; i++) length[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+                update(length, 8);
+                Digest digest;
+                for (int i = 0; i < 8; i++) {
+                    for (int b = 0; b < 4; b++) digest[4 * i + b] = static_cast<uint8_t>(state[i] >> (24 - 8 * b));
+                }
+                return digest;
+            }
+
+        private:
+            uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+            uint8_t block[64];
+            size_t used = 0;
+            uint64_t total = 0;
+
+            static uint32_t rotate(uint32_t value, int count) {
+                return (value >> count) | (value << (32 - count));
+            }
+
+            void compress(const uint8_t* chunk) {
+                static const uint32_t k[64] = {
+                    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+                };
+                uint32_t w[64];
+                for (int i = 0; i < 16; i++) {
+                    w[i] = (uint32_t(chunk[4 * i]) << 24) | (uint32_t(chunk[4 * i + 1]) << 16) |
+                           (uint32_t(chunk[4 * i + 2]) << 8) | uint32_t(chunk[4 * i + 3]);
+                }
+                for (int i = 16; i < 64; i++) {
+                    uint32_t s0 = rotate(w[i - 15], 7) ^ rotate(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                    uint32_t s1 = rotate(w[i - 2], 17) ^ rotate(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+                uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+                uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+                for (int i = 0; i < 64; i++) {
+                    uint32_t t1 = h + (rotate(e, 6) ^ rotate(e, 11) ^ rotate(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+                    uint32_t t2 = (rotate(a, 2) ^ rotate(a, 13) ^ rotate(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                    h = g; g = f; f = e; e = d + t1;
+                    d = c; c = b; b = a; a = t1 + t2;
+                }
+                state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+                state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+            }
+        };
+
+        inline std::string sha256Hex(std::string_view text) {
+            Sha256 hasher;
+            hasher.update(text);
+            Sha256::Digest digest = hasher.finish();
+            return toHex(digest.data(), digest.size());
+        }
+    }
+}
+
+#endif // WHOLF_HASH_HPP
@@ -0,0 +1,1062 @@
+#ifndef WHOLF_HTTP_HPP
+#define WHOLF_HTTP_HPP
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "metrics.hpp"
+
+namespace Wholf {
+    namespace Http {
+        using Headers = std::vector<std::pair<std::string, std::string>>;
+
+        // Yalnızca http:// (TLS yok)
+        struct Url {
+            std::string host;
+            uint16_t port = 80;
+            std::string target = "/";
+
+            static Url parse(const std::string& text) {
+                static const std::string scheme = "http://";
+                if (text.compare(0, 8, "https://") == 0) throw std::runtime_error("HTTPS is not supported: " + text);
+                if (text.compare(0, scheme.size(), scheme) != 0) throw std::runtime_error("Invalid URL: " + text);
+
+                Url url;
+                size_t hostStart = scheme.size();
+                size_t pathStart = text.find('/', hostStart);
+                std::string authority = text.substr(hostStart, pathStart == std::string::npos ? std::string::npos : pathStart - hostStart);
+                if (pathStart != std::string::npos) url.target = text.substr(pathStart);
+
+                size_t colon = authority.rfind(':');
+                if (colon != std::string::npos) {
+                    url.host = authority.substr(0, colon);
+                    int port = std::atoi(authority.c_str() + colon + 1);
+                    if (port <= 0 || port > 65535) throw std::runtime_error("Invalid URL port: " + text);
+                    url.port = static_cast<uint16_t>(port);
+                } else {
+                    url.host = authority;
+                }
+                if (url.host.empty()) throw std::runtime_error("Invalid URL: " + text);
+                return url;
+            }
+
+            // Havuz anahtarı ve Host başlığı
+            std::string authority() const {
+                return port == 80 ? host : host + ":" + std::to_string(port);
+            }
+        };
+
+        inline bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+            if (a.size() != b.size()) return false;
+            for (size_t i = 0; i < a.size(); i++) {
+                if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) return false;
+            }
+            return true;
+        }
+
+        // Başlık değeri (büyük/küçük harf duyarsız); yoksa boş
+        inline std::string findHeader(const Headers& headers, std::string_view name) {
+            for (const auto& entry : headers) {
+                if (equalsIgnoreCase(entry.first, name)) return entry.second;
+            }
+            return "";
+        }
+
+        struct Request {
+            std::string method = "GET";
+            std::string url;
+            Headers headers;
+            std::string body;
+        };
+
+        struct Response {
+            int status = 0;
+            std::string reason;
+            Headers headers;
+            std::string body;
+            // Gövde çağıranın tamponuna ya da geri çağrıya aktarıldıysa body boş kalır
+            size_t bodySize = 0;
+
+            bool ok() const { return status >= 200 && status < 300; }
+
+            std::string header(std::string_view name) const { return findHeader(headers, name); }
+        };
+
+        // Yanıt gövdesinin gideceği yer
+        struct BodyTarget {
+            // Çağıranın tamponu: Content-Length gövdesi doğrudan bu tampona recv edilir
+            char* buffer = nullptr;
+            size_t capacity = 0;
+            // Parça parça teslim; görünümler alım tamponunun içini gösterir
+            std::function<void(std::string_view)> callback;
+        };
+
+        inline bool isIdempotent(const std::string& method) {
+            return method == "GET" || method == "HEAD" || method == "PUT" || method == "DELETE" || method == "OPTIONS";
+        }
+
+        // Karşı taraftan gelen uzunluğu (Content-Length onluk, parça boyu onaltılık) doğrula.
+        // Rakamla başlamayan, sonunda fazlalık olan ya da taşan değer için false
+        inline bool parseLength(const char* text, int base, uint64_t& value, const char** end = nullptr) {
+            if (!std::isxdigit(static_cast<unsigned char>(*text)) || (base == 10 && !std::isdigit(static_cast<unsigned char>(*text)))) {
+                return false;
+            }
+            char* stop = nullptr;
+            errno = 0;
+            unsigned long long parsed = std::strtoull(text, &stop, base);
+            if (errno == ERANGE) return false;
+            if (end) {
+                *end = stop;
+            } else if (*stop != '\0') {
+                return false;
+            }
+            value = parsed;
+            return true;
+        }
+
+        // Başlık satırlarını ayrıştır (durum/istek satırından sonrası)
+        inline void parseHeaderLines(std::string_view block, Headers& headers) {
+            size_t position = 0;
+            while (position < block.size()) {
+                size_t end = block.find("\r\n", position);
+                if (end == std::string_view::npos) end = block.size();
+                std::string_view line = block.substr(position, end - position);
+                position = end + 2;
+                size_t colon = line.find(':');
+                if (colon == std::string_view::npos) continue;
+                std::string_view value = line.substr(colon + 1);
+                while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) value.remove_prefix(1);
+                while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) value.remove_suffix(1);
+                headers.emplace_back(std::string(line.substr(0, colon)), std::string(value));
+            }
+        }
+
+        // Tek bir TCP bağlantısı ve alım tamponu
+        class Connection {
+        public:
+            Connection(const Url& url, std::chrono::milliseconds connectTimeout, std::chrono::milliseconds ioTimeout)
+                : authority(url.authority()) {
+                addrinfo hints{};
+                hints.ai_family = AF_UNSPEC;
+                hints.ai_socktype = SOCK_STREAM;
+                addrinfo* addresses = nullptr;
+                std::string port = std::to_string(url.port);
+                if (::getaddrinfo(url.host.c_str(), port.c_str(), &hints, &addresses) != 0 || !addresses) {
+                    throw std::runtime_error("Cannot resolve host: " + url.host);
+                }
+
+                for (addrinfo* address = addresses; address && fd < 0; address = address->ai_next) {
+                    int candidate = ::socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC | SOCK_NONBLOCK, address->ai_protocol);
+                    if (candidate < 0) continue;
+                    if (connectWithTimeout(candidate, address, connectTimeout)) {
+                        fd = candidate;
+                    } else {
+                        ::close(candidate);
+                    }
+                }
+                ::freeaddrinfo(addresses);
+                if (fd < 0) throw std::runtime_error("Cannot connect to " + authority);
+
+                int flags = ::fcntl(fd, F_GETFL, 0);
+                ::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK);
+                int one = 1;
+                ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                timeval timeout;
+                timeout.tv_sec = static_cast<time_t>(ioTimeout.count() / 1000);
+                timeout.tv_usec = static_cast<suseconds_t>((ioTimeout.count() % 1000) * 1000);
+                ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+                lastUsed = std::chrono::steady_clock::now();
+            }
+
+            ~Connection() {
+                if (fd >= 0) ::close(fd);
+            }
+
+            Connection(const Connection&) = delete;
+            Connection& operator=(const Connection&) = delete;
+
+            const std::string authority;
+            // Önceki istekten kalan bağlantı (yeniden deneme kararı için)
+            bool reused = false;
+            bool reusable = true;
+            std::chrono::steady_clock::time_point lastUsed;
+
+            void write(const std::string& data) {
+                size_t sent = 0;
+                while (sent < data.size()) {
+                    ssize_t result = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+                    if (result < 0) {
+                        if (errno == EINTR) continue;
+                        reusable = false;
+                        throw std::runtime_error("Send failed to " + authority);
+                    }
+                    sent += static_cast<size_t>(result);
+                }
+            }
+
+            // Boşta beklerken karşı taraf kapattıysa false
+            bool alive() {
+                char probe;
+                ssize_t result = ::recv(fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+                if (result == 0) return false;
+                if (result < 0) return errno == EAGAIN || errno == EWOULDBLOCK;
+                // Beklenmedik veri: bağlantının durumu belirsiz
+                return false;
+            }
+
+            // Alınan hiç bayt yoksa (yeniden denenebilir hata) true
+            bool receivedNothing() const { return !receivedAny; }
+
+            Response readResponse(const std::string& method, BodyTarget* target) {
+                receivedAny = false;
+                Response response;
+                bool http10 = false;
+                // Ara yanıtlar (100 Continue, 103 Early Hints) atlanır; 101 protokol değiştirdiği için son yanıttır
+                do {
+                    response = Response();
+                    size_t headerEnd;
+                    while ((headerEnd = buffer.find("\r\n\r\n", start)) == std::string::npos) {
+                        if (!fill()) {
+                            reusable = false;
+                            throw std::runtime_error("Connection closed by " + authority);
+                        }
+                    }
+
+                    std::string_view head(buffer.data() + start, headerEnd - start);
+                    size_t lineEnd = head.find("\r\n");
+                    std::string_view statusLine = head.substr(0, lineEnd);
+                    // "HTTP/1.1 200 OK"
+                    if (statusLine.size() < 12 || statusLine.compare(0, 5, "HTTP/") != 0) {
+                        reusable = false;
+                        throw std::runtime_error("Malformed HTTP response from " + authority);
+                    }
+                    http10 = statusLine.compare(0, 8, "HTTP/1.0") == 0;
+                    response.status = std::atoi(std::string(statusLine.substr(9, 3)).c_str());
+                    if (statusLine.size() > 13) response.reason = std::string(statusLine.substr(13));
+                    if (lineEnd != std::string_view::npos) parseHeaderLines(head.substr(lineEnd + 2), response.headers);
+                    start = headerEnd + 4;
+                } while (response.status >= 100 && response.status < 200 && response.status != 101);
+                if (response.status == 101) reusable = false;
+
+                std::string connection = response.header("Connection");
+                if (http10 ? !equalsIgnoreCase(connection, "keep-alive") : equalsIgnoreCase(connection, "close")) {
+                    reusable = false;
+                }
+
+                bool noBody = method == "HEAD" || response.status == 204 || response.status == 304 ||
+                              (response.status >= 100 && response.status < 200);
+                if (noBody) return finish(response);
+
+                std::string length = response.header("Content-Length");
+                if (equalsIgnoreCase(response.header("Transfer-Encoding"), "chunked")) {
+                    readChunked(response, target);
+                } else if (!length.empty()) {
+                    uint64_t size = 0;
+                    if (!parseLength(length.c_str(), 10, size) || size > SIZE_MAX) {
+                        reusable = false;
+                        throw std::runtime_error("Invalid Content-Length from " + authority + ": " + length);
+                    }
+                    readSized(response, target, static_cast<size_t>(size));
+                } else {
+                    // Uzunluk yok: bağlantı kapanana kadar oku
+                    reusable = false;
+                    while (true) {
+                        if (start < buffer.size()) {
+                            deliver(response, target, buffer.data() + start, buffer.size() - start);
+                            start = buffer.size();
+                        }
+                        if (!fill()) break;
+                    }
+                }
+                return finish(response);
+            }
+
+        private:
+            static constexpr size_t READ_SIZE = 64 * 1024;
+            // Content-Length'e güvenip önceden ayrılan en fazla gövde; ötesi geldikçe büyür
+            static constexpr size_t MAX_RESERVE = 16 * READ_SIZE;
+
+            int fd = -1;
+            std::string buffer;
+            size_t start = 0;
+            bool receivedAny = false;
+
+            static bool connectWithTimeout(int fd, addrinfo* address, std::chrono::milliseconds timeout) {
+                if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) return true;
+                if (errno != EINPROGRESS) return false;
+                pollfd poller{fd, POLLOUT, 0};
+                if (::poll(&poller, 1, static_cast<int>(timeout.count())) != 1) return false;
+                int error = 0;
+                socklen_t length = sizeof(error);
+                return ::getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0 && error == 0;
+            }
+
+            // Tampona daha fazla veri al; EOF'ta false
+            bool fill() {
+                if (start > 0 && start == buffer.size()) {
+                    buffer.clear();
+                    start = 0;
+                } else if (start > READ_SIZE) {
+                    buffer.erase(0, start);
+                    start = 0;
+                }
+                size_t used = buffer.size();
+                buffer.resize(used + READ_SIZE);
+                ssize_t result;
+                do {
+                    result = ::recv(fd, &buffer[used], READ_SIZE, 0);
+                } while (result < 0 && errno == EINTR);
+                if (result < 0) {
+                    buffer.resize(used);
+                    reusable = false;
+                    throw std::runtime_error("Receive failed from " + authority);
+                }
+                buffer.resize(used + static_cast<size_t>(result));
+                if (result > 0) receivedAny = true;
+                return result > 0;
+            }
+
+            void deliver(Response& response, BodyTarget* target, const char* data, size_t size) {
+                if (target && target->callback) {
+                    target->callback(std::string_view(data, size));
+                } else if (target && target->buffer) {
+                    if (response.bodySize + size > target->capacity) {
+                        reusable = false;
+                        throw std::runtime_error("Response body exceeds caller buffer");
+                    }
+                    std::memcpy(target->buffer + response.bodySize, data, size);
+                } else {
+                    response.body.append(data, size);
+                }
+                response.bodySize += size;
+            }
+
+            void readSized(Response& response, BodyTarget* target, size_t length) {
+                if (!target) response.body.reserve(std::min(length, MAX_RESERVE));
+                size_t buffered = std::min(length, buffer.size() - start);
+                if (buffered) deliver(response, target, buffer.data() + start, buffered);
+                start += buffered;
+                size_t remaining = length - buffered;
+
+                // Çağıranın tamponu: kalan gövde ara kopya olmadan doğrudan hedefe alınır
+                if (target && target->buffer && !target->callback && remaining) {
+                    if (response.bodySize + remaining > target->capacity) {
+                        reusable = false;
+                        throw std::runtime_error("Response body exceeds caller buffer");
+                    }
+                    while (remaining) {
+                        ssize_t result = ::recv(fd, target->buffer + response.bodySize, remaining, 0);
+                        if (result < 0 && errno == EINTR) continue;
+                        if (result <= 0) {
+                            reusable = false;
+                            throw std::runtime_error("Connection closed by " + authority);
+                        }
+                        receivedAny = true;
+                        response.bodySize += static_cast<size_t>(result);
+                        remaining -= static_cast<size_t>(result);
+                    }
+                    return;
+                }
+
+                while (remaining) {
+                    if (!fill()) {
+                        reusable = false;
+                        throw std::runtime_error("Connection closed by " + authority);
+                    }
+                    size_t available = std::min(remaining, buffer.size() - start);
+                    deliver(response, target, buffer.data() + start, available);
+                    start += available;
+                    remaining -= available;
+                }
+            }
+
+            void readChunked(Response& response, BodyTarget* target) {
+                while (true) {
+                    size_t lineEnd;
+                    while ((lineEnd = buffer.find("\r\n", start)) == std::string::npos) {
+                        if (!fill()) {
+                            reusable = false;
+                            throw std::runtime_error("Connection closed by " + authority);
+                        }
+                    }
+                    // "1a;uzanti=deger": boyuttan sonra yalnızca uzantı ya da boşluk gelebilir
+                    uint64_t size = 0;
+                    const char* sizeEnd = nullptr;
+                    const char* lineLimit = buffer.data() + lineEnd;
+                    if (!parseLength(buffer.c_str() + start, 16, size, &sizeEnd) || sizeEnd > lineLimit ||
+                        (sizeEnd < lineLimit && *sizeEnd != ';' && *sizeEnd != ' ' && *sizeEnd != '\t')) {
+                        reusable = false;
+                        throw std::runtime_error("Malformed chunk size from " + authority);
+                    }
+                    start = lineEnd + 2;
+                    if (size == 0) {
+                        // Son parça: ek başlıkları ve boş satırı atla
+                        while (true) {
+                            while ((lineEnd = buffer.find("\r\n", start)) == std::string::npos) {
+                                if (!fill()) return;
+                            }
+                            bool empty = lineEnd == start;
+                            start = lineEnd + 2;
+                            if (empty) return;
+                        }
+                    }
+                    while (size) {
+                        if (start == buffer.size() && !fill()) {
+                            reusable = false;
+                            throw std::runtime_error("Connection closed by " + authority);
+                        }
+                        size_t available = static_cast<size_t>(std::min<uint64_t>(size, buffer.size() - start));
+                        deliver(response, target, buffer.data() + start, available);
+                        start += available;
+                        size -= available;
+                    }
+                    while (buffer.size() - start < 2) {
+                        if (!fill()) {
+                            reusable = false;
+                            throw std::runtime_error("Connection closed by " + authority);
+                        }
+                    }
+                    if (buffer.compare(start, 2, "\r\n") != 0) {
+                        reusable = false;
+                        throw std::runtime_error("Malformed chunk from " + authority);
+                    }
+                    start += 2;
+                }
+            }
+
+            Response finish(Response& response) {
+                lastUsed = std::chrono::steady_clock::now();
+                return std::move(response);
+            }
+        };
+
+        // Host başına keep-alive bağlantı havuzu
+        class ConnectionPool {
+        public:
+            struct Options {
+                size_t maxConnectionsPerHost = 8;
+                std::chrono::milliseconds connectTimeout{5000};
+                std::chrono::milliseconds ioTimeout{30000};
+                std::chrono::milliseconds idleTimeout{60000};
+            };
+
+            explicit ConnectionPool(const Options& options) : options(options) {}
+
+            // Boşta bağlantı varsa onu, yoksa (sınır içinde) yenisini verir; sınırdaysa bekler
+            std::unique_ptr<Connection> acquire(const Url& url) {
+                std::string key = url.authority();
+                std::unique_lock<std::mutex> lock(mutex);
+                Host& host = hosts[key];
+                while (true) {
+                    if (!host.idle.empty()) {
+                        std::unique_ptr<Connection> connection = std::move(host.idle.back());
+                        host.idle.pop_back();
+                        // Yoklama (recv) ve kapatma kilit dışında; bağlantı bu sırada açık sayılmaya devam eder
+                        lock.unlock();
+                        bool fresh = std::chrono::steady_clock::now() - connection->lastUsed < options.idleTimeout;
+                        if (fresh && connection->alive()) {
+                            connection->reused = true;
+                            lock.lock();
+                            reusedCount++;
+                            return connection;
+                        }
+                        connection.reset();
+                        lock.lock();
+                        host.open--;
+                        released.notify_one();
+                        continue;
+                    }
+                    if (host.open < options.maxConnectionsPerHost) break;
+                    released.wait(lock);
+                }
+                host.open++;
+                createdCount++;
+                lock.unlock();
+                try {
+                    return std::make_unique<Connection>(url, options.connectTimeout, options.ioTimeout);
+                } catch (...) {
+                    lock.lock();
+                    host.open--;
+                    released.notify_one();
+                    throw;
+                }
+            }
+
+            void release(std::unique_ptr<Connection> connection) {
+                std::lock_guard<std::mutex> lock(mutex);
+                Host& host = hosts[connection->authority];
+                if (connection->reusable) {
+                    host.idle.push_back(std::move(connection));
+                } else {
+                    host.open--;
+                    connection.reset();
+                }
+                released.notify_one();
+            }
+
+            uint64_t created() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return createdCount;
+            }
+
+            uint64_t reused() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return reusedCount;
+            }
+
+        private:
+            struct Host {
+                std::vector<std::unique_ptr<Connection>> idle;
+                // Boşta + kullanımda
+                size_t open = 0;
+            };
+
+            Options options;
+            std::mutex mutex;
+            std::condition_variable released;
+            std::map<std::string, Host> hosts;
+            uint64_t createdCount = 0;
+            uint64_t reusedCount = 0;
+        };
+
+        // Havuzlu HTTP/1.1 istemcisi: senkron, future tabanlı asenkron, ardışık (pipelined) ve toplu istekler
+        class Client {
+        public:
+            struct Options {
+                ConnectionPool::Options pool;
+                // Asenkron istekleri yürüten thread sayısı
+                size_t workers = 4;
+                // Toplu isteklerde bir bağlantıya art arda yazılan en fazla istek
+                size_t pipelineDepth = 16;
+                std::string userAgent = "Wholf";
+            };
+
+            struct Stats {
+                uint64_t requests = 0;
+                uint64_t connectionsCreated = 0;
+                uint64_t connectionsReused = 0;
+                uint64_t retries = 0;
+            };
+
+            Client() : Client(Options()) {}
+
+            explicit Client(const Options& options) : options(options), pool(options.pool) {
+                for (size_t i = 0; i < std::max<size_t>(1, options.workers); i++) {
+                    workers.emplace_back([this]() { workLoop(); });
+                }
+            }
+
+            ~Client() {
+                {
+                    std::lock_guard<std::mutex> lock(tasksMutex);
+                    stopping = true;
+                }
+                tasksReady.notify_all();
+                for (auto& worker : workers) worker.join();
+            }
+
+            Client(const Client&) = delete;
+            Client& operator=(const Client&) = delete;
+
+            // Süreç genelinde paylaşılan istemci (Fegn::Api örnekleri aynı havuzu kullanır)
+            static std::shared_ptr<Client> shared() {
+                static std::shared_ptr<Client> client = std::make_shared<Client>();
+                return client;
+            }
+
+            Response send(const Request& request) {
+                return execute(request, nullptr);
+            }
+
+            // Gövdeyi çağıranın tamponuna yaz; Response::bodySize yazılan bayt sayısıdır
+            Response send(const Request& request, char* buffer, size_t capacity) {
+                BodyTarget target;
+                target.buffer = buffer;
+                target.capacity = capacity;
+                return execute(request, &target);
+            }
+
+            // Gövdeyi geldikçe parça parça ilet
+            Response stream(const Request& request, std::function<void(std::string_view)> onData) {
+                BodyTarget target;
+                target.callback = std::move(onData);
+                return execute(request, &target);
+            }
+
+            std::future<Response> sendAsync(Request request) {
+                auto task = std::make_shared<std::packaged_task<Response()>>([this, request = std::move(request)]() {
+                    return execute(request, nullptr);
+                });
+                std::future<Response> result = task->get_future();
+                submit([task]() { (*task)(); });
+                return result;
+            }
+
+            // Aynı host'a giden istekleri tek bağlantıda art arda yaz, yanıtları sırayla oku
+            std::vector<Response> pipeline(const std::vector<Request>& requests) {
+                std::vector<Response> responses;
+                if (requests.empty()) return responses;
+                Url url = Url::parse(requests.front().url);
+                std::string wire;
+                for (const auto& request : requests) {
+                    Url target = Url::parse(request.url);
+                    if (target.authority() != url.authority()) throw std::runtime_error("Pipelined requests must share a host");
+                    serialize(request, target, wire);
+                }
+
+                std::unique_ptr<Connection> connection = pool.acquire(url);
+                requestCount.fetch_add(requests.size(), std::memory_order_relaxed);
+                std::exception_ptr error;
+                try {
+                    connection->write(wire);
+                    for (const auto& request : requests) {
+                        responses.push_back(connection->readResponse(request.method, nullptr));
+                        if (!connection->reusable && responses.size() < requests.size()) break;
+                    }
+                } catch (const std::exception&) {
+                    connection->reusable = false;
+                    error = std::current_exception();
+                }
+                pool.release(std::move(connection));
+
+                // Yanıtı alınmamış istekler (hata ya da Connection: close sonrası) yalnızca hepsi
+                // idempotentse tek tek yeniden denenir; sunucu diğerlerini işlemiş olabilir
+                for (size_t i = responses.size(); i < requests.size(); i++) {
+                    if (isIdempotent(requests[i].method)) continue;
+                    if (error) std::rethrow_exception(error);
+                    throw std::runtime_error("Pipelined " + requests[i].method + " request was not answered by " + url.authority());
+                }
+                for (size_t i = responses.size(); i < requests.size(); i++) {
+                    retryCount.fetch_add(1, std::memory_order_relaxed);
+                    responses.push_back(execute(requests[i], nullptr));
+                }
+                return responses;
+            }
+
+            // İstekleri host'a göre grupla, pipelineDepth'lik dilimler halinde paralel gönder.
+            // Future'lar giriş sırasıyla döner.
+            std::vector<std::future<Response>> sendBatch(const std::vector<Request>& requests) {
+                std::vector<std::shared_ptr<std::promise<Response>>> promises;
+                std::vector<std::future<Response>> futures;
+                std::map<std::string, std::vector<size_t>> byHost;
+                for (size_t i = 0; i < requests.size(); i++) {
+                    promises.push_back(std::make_shared<std::promise<Response>>());
+                    futures.push_back(promises.back()->get_future());
+                    try {
+                        byHost[Url::parse(requests[i].url).authority()].push_back(i);
+                    } catch (...) {
+                        promises.back()->set_exception(std::current_exception());
+                    }
+                }
+
+                size_t depth = std::max<size_t>(1, options.pipelineDepth);
+                for (auto& entry : byHost) {
+                    const std::vector<size_t>& indices = entry.second;
+                    for (size_t first = 0; first < indices.size(); first += depth) {
+                        std::vector<size_t> slice(indices.begin() + static_cast<std::ptrdiff_t>(first),
+                                                  indices.begin() + static_cast<std::ptrdiff_t>(std::min(indices.size(), first + depth)));
+                        std::vector<Request> group;
+                        for (size_t index : slice) group.push_back(requests[index]);
+                        std::vector<std::shared_ptr<std::promise<Response>>> targets;
+                        for (size_t index : slice) targets.push_back(promises[index]);
+
+                        submit([this, group = std::move(group), targets = std::move(targets)]() {
+                            try {
+                                std::vector<Response> responses = pipeline(group);
+                                for (size_t i = 0; i < targets.size(); i++) targets[i]->set_value(std::move(responses[i]));
+                            } catch (...) {
+                                for (auto& target : targets) target->set_exception(std::current_exception());
+                            }
+                        });
+                    }
+                }
+                return futures;
+            }
+
+            Stats stats() {
+                Stats result;
+                result.requests = requestCount.load(std::memory_order_relaxed);
+                result.connectionsCreated = pool.created();
+                result.connectionsReused = pool.reused();
+                result.retries = retryCount.load(std::memory_order_relaxed);
+                return result;
+            }
+
+        private:
+            Options options;
+            ConnectionPool pool;
+            std::atomic<uint64_t> requestCount{0};
+            std::atomic<uint64_t> retryCount{0};
+
+            std::mutex tasksMutex;
+            std::condition_variable tasksReady;
+            std::deque<std::function<void()>> tasks;
+            std::vector<std::thread> workers;
+            bool stopping = false;
+
+            void submit(std::function<void()> task) {
+                {
+                    std::lock_guard<std::mutex> lock(tasksMutex);
+                    tasks.push_back(std::move(task));
+                }
+                tasksReady.notify_one();
+            }
+
+            void workLoop() {
+                while (true) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(tasksMutex);
+                        tasksReady.wait(lock, [&]() { return stopping || !tasks.empty(); });
+                        if (tasks.empty()) return;
+                        task = std::move(tasks.front());
+                        tasks.pop_front();
+                    }
+                    task();
+                }
+            }
+
+            void serialize(const Request& request, const Url& url, std::string& wire) const {
+                wire += request.method;
+                wire += ' ';
+                wire += url.target;
+                wire += " HTTP/1.1\r\nHost: ";
+                wire += url.authority();
+                wire += "\r\n";
+                bool hasAgent = false;
+                bool hasLength = false;
+                for (const auto& header : request.headers) {
+                    hasAgent = hasAgent || equalsIgnoreCase(header.first, "User-Agent");
+                    hasLength = hasLength || equalsIgnoreCase(header.first, "Content-Length");
+                    wire += header.first;
+                    wire += ": ";
+                    wire += header.second;
+                    wire += "\r\n";
+                }
+                if (!hasAgent) wire += "User-Agent: " + options.userAgent + "\r\n";
+                if (!hasLength && (!request.body.empty() || request.method == "POST" || request.method == "PUT")) {
+                    wire += "Content-Length: " + std::to_string(request.body.size()) + "\r\n";
+                }
+                wire += "\r\n";
+                wire += request.body;
+            }
+
+            Response execute(const Request& request, BodyTarget* target) {
+                Url url = Url::parse(request.url);
+                std::string wire;
+                serialize(request, url, wire);
+                requestCount.fetch_add(1, std::memory_order_relaxed);
+
+                // Eski keep-alive bağlantısı sessizce kapanmış olabilir: hiç yanıt baytı alınmadıysa
+                // idempotent istek yeni bağlantıyla bir kez daha denenir
+                for (int attempt = 0;; attempt++) {
+                    std::unique_ptr<Connection> connection = pool.acquire(url);
+                    bool reused = connection->reused;
+                    try {
+                        connection->write(wire);
+                        Response response = connection->readResponse(request.method, target);
+                        pool.release(std::move(connection));
+                        return response;
+                    } catch (const std::exception&) {
+                        bool retry = attempt == 0 && reused && connection->receivedNothing() && isIdempotent(request.method);
+                        connection->reusable = false;
+                        pool.release(std::move(connection));
+                        if (!retry) throw;
+                        retryCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        };
+
+        // Testler ve yük ölçümü için yerel HTTP/1.1 sunucusu: 127.0.0.1, bağlantı başına thread,
+        // keep-alive ve ardışık istekler desteklenir (istek gövdesi yalnızca Content-Length ile).
+        // İşleyici Transfer-Encoding: chunked başlığı koyarsa yanıt gövdesi parçalı gönderilir
+        class LocalServer {
+        public:
+            using Handler = std::function<void(const Request&, Response&)>;
+
+            explicit LocalServer(Handler handler, uint16_t port = 0) : handler(std::move(handler)) {
+                listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                if (listener < 0) throw std::runtime_error("Cannot create server socket");
+                int one = 1;
+                ::setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+                sockaddr_in address{};
+                address.sin_family = AF_INET;
+                address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                address.sin_port = htons(port);
+                if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 128) != 0) {
+                    ::close(listener);
+                    throw std::runtime_error("Cannot listen on port " + std::to_string(port));
+                }
+                socklen_t length = sizeof(address);
+                ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+                boundPort = ntohs(address.sin_port);
+                acceptor = std::thread([this]() { acceptLoop(); });
+            }
+
+            ~LocalServer() { stop(); }
+
+            LocalServer(const LocalServer&) = delete;
+            LocalServer& operator=(const LocalServer&) = delete;
+
+            uint16_t port() const { return boundPort; }
+            std::string url(const std::string& path = "/") const {
+                return "http://127.0.0.1:" + std::to_string(boundPort) + path;
+            }
+
+            void stop() {
+                if (stopped.exchange(true)) return;
+                ::shutdown(listener, SHUT_RDWR);
+                acceptor.join();
+                ::close(listener);
+                std::vector<std::thread> threads;
+                {
+                    std::lock_guard<std::mutex> lock(connectionsMutex);
+                    for (int fd : connections) ::shutdown(fd, SHUT_RDWR);
+                    threads.swap(connectionThreads);
+                }
+                for (auto& thread : threads) thread.join();
+            }
+
+        private:
+            static constexpr size_t CHUNK_SIZE = 4096;
+
+            Handler handler;
+            int listener = -1;
+            uint16_t boundPort = 0;
+            std::atomic<bool> stopped{false};
+            std::thread acceptor;
+            std::mutex connectionsMutex;
+            std::vector<int> connections;
+            std::vector<std::thread> connectionThreads;
+
+            void acceptLoop() {
+                while (!stopped.load()) {
+                    int fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+                    if (fd < 0) {
+                        if (errno == EINTR) continue;
+                        return;
+                    }
+                    int one = 1;
+                    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                    std::lock_guard<std::mutex> lock(connectionsMutex);
+                    connections.push_back(fd);
+                    connectionThreads.emplace_back([this, fd]() { serve(fd); });
+                }
+            }
+
+            void serve(int fd) {
+                std::string buffer;
+                size_t start = 0;
+                char chunk[64 * 1024];
+                bool open = true;
+                while (open) {
+                    size_t headerEnd;
+                    while ((headerEnd = buffer.find("\r\n\r\n", start)) == std::string::npos) {
+                        ssize_t result = ::recv(fd, chunk, sizeof(chunk), 0);
+                        if (result <= 0) {
+                            open = false;
+                            break;
+                        }
+                        buffer.append(chunk, static_cast<size_t>(result));
+                    }
+                    if (!open) break;
+
+                    Request request;
+                    std::string_view head(buffer.data() + start, headerEnd - start);
+                    size_t lineEnd = head.find("\r\n");
+                    std::string_view line = head.substr(0, lineEnd);
+                    size_t space = line.find(' ');
+                    size_t secondSpace = line.find(' ', space + 1);
+                    request.method = std::string(line.substr(0, space));
+                    request.url = std::string(line.substr(space + 1, secondSpace - space - 1));
+                    if (lineEnd != std::string_view::npos) parseHeaderLines(head.substr(lineEnd + 2), request.headers);
+                    start = headerEnd + 4;
+
+                    size_t length = 0;
+                    std::string contentLength = findHeader(request.headers, "Content-Length");
+                    if (!contentLength.empty()) length = static_cast<size_t>(std::stoull(contentLength));
+                    while (buffer.size() - start < length) {
+                        ssize_t result = ::recv(fd, chunk, sizeof(chunk), 0);
+                        if (result <= 0) {
+                            open = false;
+                            break;
+                        }
+                        buffer.append(chunk, static_cast<size_t>(result));
+                    }
+                    if (!open) break;
+                    request.body = buffer.substr(start, length);
+                    start += length;
+                    bool close = equalsIgnoreCase(findHeader(request.headers, "Connection"), "close");
+
+                    Response response;
+                    response.status = 200;
+                    response.reason = "OK";
+                    try {
+                        handler(request, response);
+                    } catch (const std::exception& error) {
+                        response = Response();
+                        response.status = 500;
+                        response.reason = "Internal Server Error";
+                        response.body = error.what();
+                    }
+
+                    bool chunked = equalsIgnoreCase(response.header("Transfer-Encoding"), "chunked");
+                    std::string wire = "HTTP/1.1 " + std::to_string(response.status) + " " + response.reason + "\r\n";
+                    for (const auto& header : response.headers) wire += header.first + ": " + header.second + "\r\n";
+                    if (!chunked) wire += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+                    if (close) wire += "Connection: close\r\n";
+                    wire += "\r\n";
+                    if (chunked) {
+                        for (size_t offset = 0; offset < response.body.size(); offset += CHUNK_SIZE) {
+                            size_t size = std::min(CHUNK_SIZE, response.body.size() - offset);
+                            char line[32];
+                            std::snprintf(line, sizeof(line), "%zx\r\n", size);
+                            wire += line;
+                            wire.append(response.body, offset, size);
+                            wire += "\r\n";
+                        }
+                        wire += "0\r\n\r\n";
+                    } else {
+                        wire += response.body;
+                    }
+                    size_t sent = 0;
+                    while (sent < wire.size()) {
+                        ssize_t result = ::send(fd, wire.data() + sent, wire.size() - sent, MSG_NOSIGNAL);
+                        if (result <= 0) {
+                            open = false;
+                            break;
+                        }
+                        sent += static_cast<size_t>(result);
+                    }
+                    if (close) open = false;
+
+                    if (start == buffer.size()) {
+                        buffer.clear();
+                        start = 0;
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(connectionsMutex);
+                connections.erase(std::remove(connections.begin(), connections.end(), fd), connections.end());
+                ::close(fd);
+            }
+        };
+
+        // Yük üreteci: sabit sayıda eşzamanlı istemci thread'i, istek başına gecikme histogramı
+        class LoadGenerator {
+        public:
+            struct Options {
+                std::string url;
+                std::string method = "GET";
+                std::string body;
+                size_t concurrency = 4;
+                size_t requests = 10000;
+                // 1'den büyükse istekler bu derinlikte ardışık gönderilir
+                size_t pipelineDepth = 1;
+            };
+
+            struct Report {
+                uint64_t requests = 0;
+                uint64_t errors = 0;
+                double seconds = 0;
+                double requestsPerSecond = 0;
+                uint64_t p50Micros = 0;
+                uint64_t p99Micros = 0;
+                uint64_t p999Micros = 0;
+            };
+
+            static Report run(Client& client, const Options& options) {
+                Metrics::HistogramSnapshot histogram;
+                std::mutex histogramMutex;
+                std::atomic<uint64_t> errors{0};
+                std::atomic<size_t> issued{0};
+                auto started = std::chrono::steady_clock::now();
+
+                Request request;
+                request.method = options.method;
+                request.url = options.url;
+                request.body = options.body;
+                size_t depth = std::max<size_t>(1, options.pipelineDepth);
+
+                std::vector<std::thread> threads;
+                for (size_t t = 0; t < std::max<size_t>(1, options.concurrency); t++) {
+                    threads.emplace_back([&]() {
+                        std::vector<uint64_t> samples;
+                        std::vector<Request> group(depth, request);
+                        while (true) {
+                            size_t first = issued.fetch_add(depth);
+                            if (first >= options.requests) break;
+                            size_t count = std::min(depth, options.requests - first);
+                            group.resize(count, request);
+                            auto sent = std::chrono::steady_clock::now();
+                            try {
+                                if (count == 1) {
+                                    if (!client.send(request).ok()) errors.fetch_add(1, std::memory_order_relaxed);
+                                } else {
+                                    for (const auto& response : client.pipeline(group)) {
+                                        if (!response.ok()) errors.fetch_add(1, std::memory_order_relaxed);
+                                    }
+                                }
+                            } catch (const std::exception&) {
+                                errors.fetch_add(count, std::memory_order_relaxed);
+                            }
+                            uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - sent).count());
+                            for (size_t i = 0; i < count; i++) samples.push_back(elapsed);
+                        }
+                        std::lock_guard<std::mutex> lock(histogramMutex);
+                        for (uint64_t sample : samples) {
+                            histogram.buckets[Metrics::BucketLayout::index(sample)]++;
+                            histogram.count++;
+                            histogram.sum += sample;
+                        }
+                    });
+                }
+                for (auto& thread : threads) thread.join();
+
+                Report report;
+                report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+                report.requests = histogram.count;
+                report.errors = errors.load();
+                report.requestsPerSecond = report.seconds > 0 ? static_cast<double>(report.requests) / report.seconds : 0;
+                report.p50Micros = histogram.percentile(0.50) / 1000;
+                report.p99Micros = histogram.percentile(0.99) / 1000;
+                report.p999Micros = histogram.percentile(0.999) / 1000;
+                return report;
+            }
+        };
+    }
+}
+
+#endif // WHOLF_HTTP_HPP
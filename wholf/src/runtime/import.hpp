@@ -1,30 +1,539 @@
 #ifndef WHOLF_IMPORT_HPP
 #define WHOLF_IMPORT_HPP
 
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <map>
 #include <functional>
+#include "file.hpp"
+#include "hash.hpp"
+#include "json.hpp"
+#include "package.hpp"
+#include "../interpreter/WholfInterpreter.hpp"
 
 namespace Wholf {
     namespace Import {
-        // İçe aktarma yöneticisi
+        // Kaynağın başındaki import yönergelerini tam ayrıştırma yapmadan çıkar.
+        // Desteklenen biçimler: import "yol"; ve import ad from "yol";
+        // Tarama ilk import/yorum/boş olmayan satırda durur. body verilirse son import'un bittiği konum yazılır.
+        inline std::vector<std::string> scanImports(std::string_view source, size_t* body = nullptr) {
+            std::vector<std::string> imports;
+            size_t position = 0;
+            if (body) *body = 0;
+            auto skipSpace = [&]() {
+                while (position < source.size() && (source[position] == ' ' || source[position] == '\t' ||
+                                                    source[position] == '\r' || source[position] == '\n')) position++;
+            };
+            auto startsWith = [&](std::string_view prefix) {
+                return source.compare(position, prefix.size(), prefix) == 0;
+            };
+            auto isIdentifier = [](char c) {
+                return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+            };
+            while (true) {
+                skipSpace();
+                if (position >= source.size()) break;
+                if (startsWith("//")) {
+                    size_t newline = source.find('\n', position);
+                    position = newline == std::string_view::npos ? source.size() : newline + 1;
+                    continue;
+                }
+                if (startsWith("/*")) {
+                    size_t close = source.find("*/", position + 2);
+                    position = close == std::string_view::npos ? source.size() : close + 2;
+                    continue;
+                }
+                if (!startsWith("import") || (position + 6 < source.size() && isIdentifier(source[position + 6]))) break;
+                position += 6;
+                skipSpace();
+                if (position < source.size() && source[position] != '"') {
+                    // import ad from "yol"
+                    while (position < source.size() && isIdentifier(source[position])) position++;
+                    skipSpace();
+                    if (!startsWith("from")) break;
+                    position += 4;
+                    skipSpace();
+                }
+                if (position >= source.size() || source[position] != '"') break;
+                size_t close = source.find('"', position + 1);
+                if (close == std::string_view::npos) break;
+                imports.emplace_back(source.substr(position + 1, close - position - 1));
+                position = close + 1;
+                skipSpace();
+                if (position < source.size() && source[position] == ';') position++;
+                if (body) *body = position;
+            }
+            return imports;
+        }
+        
+        // Yüklenmiş ve derlenmiş modül; değişmez, thread'ler arasında paylaşılabilir
+        class CompiledModule {
+        public:
+            std::string path;
+            uint64_t hash = 0;
+            // Çözülmüş bağımlılık yolları (kaynaktaki sırayla)
+            std::vector<std::string> dependencies;
+            // Derleyicinin ürettiği biçim (varsayılan: program)
+            std::shared_ptr<const void> compiled;
+            // Varsayılan derleyicinin parse ettiği program; özel derleyicide nullptr.
+            // Interpreter'lar arasında paylaşılır, execute() ile çalıştırılır
+            std::shared_ptr<Program> program;
+        };
+        
+        // İçe aktarma yöneticisi.
+        // Modül grafiği import ön taramasıyla kurulur; bağımsız modüller kalıcı bir worker havuzunda
+        // paralel okunur ve derlenir. Derlenmiş biçim yol ve içerik özetiyle önbelleğe alınır:
+        // değişmeyen içerik yeniden derlenmez, değişen dosyanın eski sürümü önbellekten çıkar.
+        // Bir dosya değişince yalnızca o modül ve ona (dolaylı) bağımlı olanlar geçersiz olur.
+        // Varsayılan derleyici modülleri worker'larda parse eder; execute() bunları bir interpreter'da çalıştırır.
         class ImportManager {
-        private:
-            std::map<std::string, std::shared_ptr<void>> modules;
-            
         public:
-            void importModule(const std::string& path) {
-                // Modülü içe aktar
+            using Compiler = std::function<std::shared_ptr<const void>(const std::string& path, const std::string& source)>;
+            
+            struct Options {
+                // 0: donanım thread sayısı
+                size_t threads = 0;
+                // Uzantısız import'lara eklenir
+                std::string extension = ".wholf";
+                // Göreli olmayan import'lar önce içe aktaran dosyanın dizininde, sonra burada aranır
+                std::vector<std::string> searchPaths;
+                // Boşsa kaynak Program'a parse edilir (import satırları hariç)
+                Compiler compiler;
+            };
+            
+            struct Stats {
+                uint64_t reads = 0;
+                uint64_t compiles = 0;
+                uint64_t cacheHits = 0;
+                uint64_t invalidations = 0;
+            };
+            
+            ImportManager() : ImportManager(Options()) {}
+            
+            explicit ImportManager(const Options& options) : options(options) {}
+            
+            ~ImportManager() {
+                {
+                    std::lock_guard<std::mutex> lock(poolMutex);
+                    stopping = true;
+                }
+                poolWake.notify_all();
+                for (auto& worker : pool) worker.join();
             }
             
+            ImportManager(const ImportManager&) = delete;
+            ImportManager& operator=(const ImportManager&) = delete;
+            
+            // Modülü ve geçişli bağımlılıklarını yükle; güncel olanlara dokunulmaz
+            std::shared_ptr<const CompiledModule> importModule(const std::string& path) {
+                std::lock_guard<std::mutex> loadLock(loading);
+                std::string entry = canonical(path);
+                load(entry);
+                std::lock_guard<std::mutex> lock(mutex);
+                return records.at(entry).module;
+            }
+            
+            // Yerel (host) modül kaydı; bu adla yapılan import'lar dosya aramaz
             void exportModule(const std::string& name, const std::shared_ptr<void>& module) {
-                // Modülü dışa aktar
+                std::lock_guard<std::mutex> lock(mutex);
+                hostModules[name] = module;
             }
             
+            // Kayıtlı yerel modül; yoksa nullptr (tabloya boş girdi eklenmez)
             std::shared_ptr<void> getModule(const std::string& name) {
-                return modules[name];
+                std::lock_guard<std::mutex> lock(mutex);
+                auto found = hostModules.find(name);
+                return found == hostModules.end() ? nullptr : found->second;
+            }
+            
+            // Çalıştırma sırası: bağımlılıklar önce. Döngü varsa runtime_error
+            std::vector<std::shared_ptr<const CompiledModule>> loadOrder(const std::string& path) {
+                std::string entry = canonical(path);
+                importModule(entry);
+                std::lock_guard<std::mutex> lock(mutex);
+                std::vector<std::shared_ptr<const CompiledModule>> order;
+                std::unordered_map<std::string, int> marks;
+                std::vector<std::string> trail;
+                visit(entry, marks, trail, order);
+                return order;
+            }
+            
+            // Modülü yükle ve bağımlılıklar önce olmak üzere interpreter'da çalıştır; giriş modülünün değerini döner.
+            // Program'lar önbellekten gelir: aynı modül her interpreter için yeniden parse edilmez
+            Value execute(Interpreter& interpreter, const std::string& path) {
+                Value result(nullptr);
+                for (const auto& module : loadOrder(path)) {
+                    if (!module->program) throw std::runtime_error("Module has no program (custom compiler): " + module->path);
+                    result = interpreter.execute(module->program);
+                }
+                return result;
+            }
+            
+            // Modülü ve ona bağımlı tüm modülleri geçersiz kıl; sonraki importModule yalnızca bunları yeniden okur
+            size_t invalidate(const std::string& path) {
+                std::string target = canonical(path);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!records.count(target)) return 0;
+                size_t count = 0;
+                std::vector<std::string> stack{target};
+                std::unordered_set<std::string> seen{target};
+                while (!stack.empty()) {
+                    std::string current = std::move(stack.back());
+                    stack.pop_back();
+                    auto record = records.find(current);
+                    if (record != records.end()) {
+                        // Sürmekte olan yükleme eski içeriği okumuş olabilir: bitince bayat kalır
+                        record->second.generation++;
+                        if (!record->second.stale) {
+                            record->second.stale = true;
+                            count++;
+                        }
+                    }
+                    auto users = dependents.find(current);
+                    if (users == dependents.end()) continue;
+                    for (const auto& dependent : users->second) {
+                        if (seen.insert(dependent).second) stack.push_back(dependent);
+                    }
+                }
+                counters.invalidations += count;
+                return count;
+            }
+            
+            // Dosya izleyicisine bağla: değişen kaynaklar otomatik geçersiz kılınır
+            File::FileWatcher::WatchId watchSources(File::FileWatcher& watcher, const std::string& root) {
+                return watcher.watch(root, [this](const File::FileWatcher::ChangeSet& changes) {
+                    for (const auto& change : changes) {
+                        if (change.kind == File::ChangeKind::RESCAN) {
+                            refresh();
+                        } else {
+                            invalidate(change.path);
+                        }
+                    }
+                });
+            }
+            
+            // İzleyici yoksa: mtime/boyutu değişen modülleri bul ve geçersiz kıl
+            size_t refresh() {
+                std::vector<std::string> changed;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (const auto& entry : records) {
+                        if (!entry.second.module) continue;
+                        struct stat info;
+                        if (::stat(entry.first.c_str(), &info) != 0 || modified(info) != entry.second.modified ||
+                            info.st_size != entry.second.size) {
+                            changed.push_back(entry.first);
+                        }
+                    }
+                }
+                size_t count = 0;
+                for (const auto& path : changed) count += invalidate(path);
+                return count;
+            }
+            
+            Stats stats() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return counters;
+            }
+            
+        private:
+            struct Record {
+                std::shared_ptr<const CompiledModule> module;
+                int64_t modified = 0;
+                off_t size = 0;
+                // İlk yükleme bitene kadar bayat
+                bool stale = true;
+                // Her geçersiz kılmada artar; yükleme okumadan önceki değeri görür
+                uint64_t generation = 0;
+            };
+            
+            // Bir yolun en son derlenmiş sürümü
+            struct CompiledEntry {
+                uint64_t hash = 0;
+                std::shared_ptr<const void> compiled;
+                std::shared_ptr<Program> program;
+            };
+            
+            Options options;
+            // Aynı anda tek yükleme; kayıtlar mutex ile korunur
+            std::mutex loading;
+            mutable std::mutex mutex;
+            std::unordered_map<std::string, Record> records;
+            // Ters kenarlar: bağımlılık -> onu içe aktaran modüller
+            std::unordered_map<std::string, std::unordered_set<std::string>> dependents;
+            // Yol başına tek sürüm: önbellek modül sayısıyla sınırlı kalır, özet çakışması başka
+            // bir dosyanın derlenmiş biçimini döndüremez
+            std::unordered_map<std::string, CompiledEntry> compiledByPath;
+            std::map<std::string, std::shared_ptr<void>> hostModules;
+            std::unordered_map<std::string, std::string> resolved;
+            Stats counters;
+            
+            // load() işlerini yürüten kalıcı worker'lar; ilk paralel yüklemede başlatılır
+            std::mutex poolMutex;
+            std::condition_variable poolWake;
+            std::condition_variable poolIdle;
+            std::vector<std::thread> pool;
+            std::function<void()> job;
+            uint64_t jobGeneration = 0;
+            size_t jobRunners = 0;
+            bool stopping = false;
+            
+            // import satırları boşlukla örtülür (satır sonları kalır: hata satırları kaynakla eşleşir)
+            static std::shared_ptr<Program> parseModule(const std::string& path, const std::string& source, size_t body) {
+                std::string code(source);
+                for (size_t i = 0; i < body; i++) {
+                    if (code[i] != '\n') code[i] = ' ';
+                }
+                try {
+                    return Interpreter::parse(code);
+                } catch (const std::exception& error) {
+                    throw std::runtime_error("Cannot parse module " + path + ": " + error.what());
+                }
+            }
+            
+            static int64_t modified(const struct stat& info) {
+                return static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+            }
+            
+            static std::string canonical(const std::string& path) {
+                return std::filesystem::absolute(path).lexically_normal().string();
+            }
+            
+            // import belirtecini dosya yoluna çevir; yerel modüller olduğu gibi kalır
+            std::string resolve(const std::string& importer, const std::string& specifier) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (hostModules.count(specifier)) return specifier;
+                }
+                // Mutlak ve ./ ../ ile başlayan belirteçler yalnızca dizine bağlıdır: sonuç önbelleğe alınır
+                std::string directory = importer.substr(0, importer.rfind('/') + 1);
+                bool deterministic = specifier.compare(0, 1, "/") == 0 || specifier.compare(0, 2, "./") == 0 ||
+                                     specifier.compare(0, 3, "../") == 0;
+                std::string key = directory + '\0' + specifier;
+                if (deterministic) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto found = resolved.find(key);
+                    if (found != resolved.end()) return found->second;
+                }
+                std::filesystem::path relative(specifier);
+                if (!relative.has_extension()) relative += options.extension;
+                std::filesystem::path local = relative.is_absolute() ? relative : std::filesystem::path(directory) / relative;
+                if (deterministic) {
+                    std::string result = canonical(local.string());
+                    std::lock_guard<std::mutex> lock(mutex);
+                    resolved.emplace(std::move(key), result);
+                    return result;
+                }
+                if (std::filesystem::exists(local)) return canonical(local.string());
+                for (const auto& directory : options.searchPaths) {
+                    std::filesystem::path candidate = std::filesystem::path(directory) / relative;
+                    if (std::filesystem::exists(candidate)) return canonical(candidate.string());
+                }
+                return canonical(local.string());
+            }
+            
+            // Bayat ya da hiç yüklenmemiş modülleri bağımlılıklarıyla birlikte paralel yükle
+            void load(const std::string& entry) {
+                struct Pending {
+                    std::string path;
+                    std::string importer;
+                };
+                std::vector<Pending> queue;
+                std::unordered_set<std::string> seen;
+                size_t busy = 0;
+                std::condition_variable ready;
+                std::exception_ptr failure;
+                
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto record = records.find(entry);
+                    // Güncel modülün bağımlılıkları da günceldir (geçersiz kılma bağımlılara yayılır)
+                    if (record != records.end() && !record->second.stale) return;
+                    seen.insert(entry);
+                    queue.push_back(Pending{entry, std::string()});
+                }
+                
+                auto work = [&]() {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        ready.wait(lock, [&]() { return !queue.empty() || busy == 0 || failure; });
+                        if (failure || queue.empty()) break;
+                        Pending next = std::move(queue.back());
+                        queue.pop_back();
+                        busy++;
+                        lock.unlock();
+                        
+                        std::vector<std::string> discovered;
+                        try {
+                            discovered = loadOne(next.path, next.importer);
+                        } catch (...) {
+                            lock.lock();
+                            if (!failure) failure = std::current_exception();
+                            busy--;
+                            ready.notify_all();
+                            break;
+                        }
+                        
+                        lock.lock();
+                        busy--;
+                        for (auto& dependency : discovered) {
+                            auto record = records.find(dependency);
+                            bool fresh = record != records.end() && !record->second.stale;
+                            if (!fresh && !hostModules.count(dependency) && seen.insert(dependency).second) {
+                                queue.push_back(Pending{std::move(dependency), next.path});
+                            }
+                        }
+                        ready.notify_all();
+                    }
+                    ready.notify_all();
+                };
+                
+                runOnPool(work);
+                if (failure) {
+                    // Yarım kalan grafik bir sonraki yüklemede baştan denenir
+                    std::lock_guard<std::mutex> lock(mutex);
+                    for (const auto& path : seen) {
+                        auto record = records.find(path);
+                        if (record != records.end()) record->second.stale = true;
+                    }
+                    std::rethrow_exception(failure);
+                }
+            }
+            
+            // İşi çağıran thread ve havuzdaki bütün worker'larla çalıştır; hepsi bitince döner.
+            // loading kilidi altında çağrıldığı için aynı anda tek iş vardır
+            void runOnPool(const std::function<void()>& work) {
+                size_t threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+                {
+                    std::lock_guard<std::mutex> lock(poolMutex);
+                    while (pool.size() + 1 < threads) {
+                        pool.emplace_back([this, seen = jobGeneration]() { poolLoop(seen); });
+                    }
+                    if (!pool.empty()) {
+                        job = work;
+                        jobGeneration++;
+                        jobRunners = pool.size();
+                    }
+                }
+                poolWake.notify_all();
+                work();
+                std::unique_lock<std::mutex> lock(poolMutex);
+                poolIdle.wait(lock, [&]() { return jobRunners == 0; });
+                job = nullptr;
+            }
+            
+            void poolLoop(uint64_t seen) {
+                std::unique_lock<std::mutex> lock(poolMutex);
+                while (true) {
+                    poolWake.wait(lock, [&]() { return stopping || jobGeneration != seen; });
+                    if (stopping) return;
+                    seen = jobGeneration;
+                    auto current = job;
+                    lock.unlock();
+                    current();
+                    lock.lock();
+                    if (--jobRunners == 0) poolIdle.notify_all();
+                }
+            }
+            
+            // Tek modülü oku, özetle, import'larını çıkar ve (önbellekte yoksa) derle. Bağımlılık yollarını döner
+            std::vector<std::string> loadOne(const std::string& path, const std::string& importer) {
+                // Okumadan önceki kuşak: bu arada gelen geçersiz kılma, yüklemenin sonunda modülü bayat bırakır
+                uint64_t generation;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    generation = records[path].generation;
+                }
+                int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) {
+                    std::string message = "Cannot load module: " + path;
+                    if (!importer.empty()) message += " (imported by " + importer + ")";
+                    throw std::runtime_error(message);
+                }
+                struct stat info;
+                std::string source;
+                bool ok = ::fstat(fd, &info) == 0 && File::MappedFile::readExact(fd, static_cast<size_t>(info.st_size), source);
+                ::close(fd);
+                if (!ok) throw std::runtime_error("Cannot read module: " + path);
+                
+                auto module = std::make_shared<CompiledModule>();
+                module->path = path;
+                module->hash = Hash::fnv1a64(source, Hash::fnv1a64(&info.st_size, sizeof(info.st_size)));
+                size_t body = 0;
+                for (const auto& specifier : scanImports(source, &body)) module->dependencies.push_back(resolve(path, specifier));
+                
+                CompiledEntry compiled;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    counters.reads++;
+                    auto cached = compiledByPath.find(path);
+                    if (cached != compiledByPath.end() && cached->second.hash == module->hash) {
+                        compiled = cached->second;
+                        counters.cacheHits++;
+                    }
+                }
+                if (!compiled.compiled) {
+                    compiled.hash = module->hash;
+                    if (options.compiler) {
+                        compiled.compiled = options.compiler(path, source);
+                    } else {
+                        compiled.program = parseModule(path, source, body);
+                        compiled.compiled = compiled.program;
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    // Eski sürüm değiştirilir; hâlâ kullanan CompiledModule'ler kendi kopyasını tutar
+                    compiledByPath[path] = compiled;
+                    counters.compiles++;
+                }
+                module->compiled = std::move(compiled.compiled);
+                module->program = std::move(compiled.program);
+                
+                std::lock_guard<std::mutex> lock(mutex);
+                Record& record = records[path];
+                if (record.module) {
+                    for (const auto& dependency : record.module->dependencies) dependents[dependency].erase(path);
+                }
+                for (const auto& dependency : module->dependencies) dependents[dependency].insert(path);
+                record.module = module;
+                record.modified = modified(info);
+                record.size = info.st_size;
+                record.stale = record.generation != generation;
+                return module->dependencies;
+            }
+            
+            // mutex tutulurken çağrılır; 1 = ziyarette, 2 = bitti
+            void visit(const std::string& path, std::unordered_map<std::string, int>& marks, std::vector<std::string>& trail,
+                       std::vector<std::shared_ptr<const CompiledModule>>& order) {
+                if (hostModules.count(path)) return;
+                int& mark = marks[path];
+                if (mark == 2) return;
+                if (mark == 1) {
+                    std::string cycle;
+                    auto begin = std::find(trail.begin(), trail.end(), path);
+                    for (auto it = begin; it != trail.end(); ++it) cycle += *it + " -> ";
+                    throw std::runtime_error("Import cycle: " + cycle + path);
+                }
+                mark = 1;
+                trail.push_back(path);
+                const auto& module = records.at(path).module;
+                for (const auto& dependency : module->dependencies) visit(dependency, marks, trail, order);
+                trail.pop_back();
+                marks[path] = 2;
+                order.push_back(module);
             }
         };
         
@@ -37,8 +546,7 @@ namespace Wholf {
             }
             
             std::vector<std::string> getDependencies(const std::string& code) {
-                // Bağımlılıkları bul
-                return {};
+                return scanImports(code);
             }
             
             std::map<std::string, std::string> getExports(const std::string& code) {
@@ -47,37 +555,135 @@ namespace Wholf {
             }
         };
         
-        // Paket yöneticisi
+        // Paket yöneticisi: projenin wholf.deps bildirimini düzenler ve paketleri
+        // içerik adresli depodan projenin wholf_modules dizinine bağlar
         class PackageManager {
+        public:
+            struct Options {
+                // Proje kökü (wholf.deps, wholf.lock, wholf_modules)
+                std::string project = ".";
+                // Yerel kayıt dizini; boşsa WHOLF_REGISTRY
+                std::string registry;
+                // Depo dizini; boşsa WHOLF_STORE, o da yoksa ~/.wholf/store
+                std::string store;
+                Packages::Store::Options storeOptions;
+            };
+            
+            PackageManager() : PackageManager(Options()) {}
+            
+            explicit PackageManager(const Options& options)
+                : options(options),
+                  registry(directoryOrEnvironment(options.registry, "WHOLF_REGISTRY", "")),
+                  store(directoryOrEnvironment(options.store, "WHOLF_STORE", defaultStore()), options.storeOptions) {}
+            
+            // Bildirime ekle (ya da aralığını değiştir) ve kur; boş sürüm "*" demektir
+            Packages::Store::InstallResult installPackage(const std::string& name, const std::string& version) {
+                Packages::checkName(name);
+                std::string range = version.empty() ? "*" : version;
+                Packages::Range::parse(range);
+                auto dependencies = Packages::readManifest(manifestPath());
+                auto existing = std::find_if(dependencies.begin(), dependencies.end(),
+                    [&](const Packages::Dependency& dependency) { return dependency.name == name; });
+                if (existing == dependencies.end()) {
+                    dependencies.push_back(Packages::Dependency{name, range});
+                } else {
+                    existing->range = range;
+                }
+                Packages::writeManifest(manifestPath(), dependencies);
+                return install();
+            }
+            
+            // Bildirimden çıkar; kurulumda artık erişilemeyen paketler kaldırılır
+            Packages::Store::InstallResult uninstallPackage(const std::string& name) {
+                auto dependencies = Packages::readManifest(manifestPath());
+                dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(),
+                    [&](const Packages::Dependency& dependency) { return dependency.name == name; }), dependencies.end());
+                Packages::writeManifest(manifestPath(), dependencies);
+                return install();
+            }
+            
+            // Aralığı değiştir ve kilidi yok sayarak kayıttan yeniden çöz
+            Packages::Store::InstallResult updatePackage(const std::string& name, const std::string& version) {
+                std::filesystem::remove(options.project + "/" + Packages::LOCK_FILE);
+                return installPackage(name, version);
+            }
+            
+            // Bildirim ve kilide göre kur; kilit güncelse kayıt hiç okunmaz
+            Packages::Store::InstallResult install() {
+                return store.install(options.project, Packages::Registry(registry));
+            }
+            
+            // Kilitli paketlerin depodaki içeriğini denetle; bozukların listesi
+            std::vector<std::string> verify() {
+                auto lock = Packages::Lockfile::read(options.project + "/" + Packages::LOCK_FILE);
+                return store.verify(lock.packages);
+            }
+            
+            Packages::Store& packageStore() { return store; }
+            
         private:
-            std::map<std::string, std::string> packages;
+            Options options;
+            std::string registry;
+            Packages::Store store;
             
-        public:
-            void installPackage(const std::string& name, const std::string& version) {
-                // Paketi yükle
+            std::string manifestPath() const {
+                return options.project + "/" + Packages::MANIFEST_FILE;
             }
             
-            void uninstallPackage(const std::string& name) {
-                // Paketi kaldır
+            static std::string directoryOrEnvironment(const std::string& value, const char* variable, const std::string& fallback) {
+                if (!value.empty()) return value;
+                const char* environment = std::getenv(variable);
+                return environment && *environment ? environment : fallback;
             }
             
-            void updatePackage(const std::string& name, const std::string& version) {
-                // Paketi güncelle
+            static std::string defaultStore() {
+                const char* home = std::getenv("HOME");
+                return std::string(home && *home ? home : ".") + "/.wholf/store";
             }
         };
         
-        // Veri yapısı çözümleyici
+        // Veri yapısı çözümleyici (JSON)
         class DataStructureAnalyzer {
         public:
+            // Kök nesnenin alanlarının tipleri; kök nesne değilse "" anahtarında kökün tipi.
+            // Bozuk JSON runtime_error fırlatır
             std::map<std::string, std::string> analyze(const std::string& data) {
-                // Veri yapısını çözümle
-                return {};
+                Json::Document document(data, nullptr);
+                Json::Element root = document.root();
+                std::map<std::string, std::string> fields;
+                if (!root.isObject()) {
+                    fields[""] = Json::typeName(root);
+                    return fields;
+                }
+                root.forEachMember([&](Json::Element key, Json::Element value) {
+                    fields[key.string()] = Json::typeName(value);
+                });
+                return fields;
             }
             
+            // "valid" ya da "<JSON işaretçisi>: <hata>". Şemalar bir kez derlenip metinleriyle önbellekte tutulur
             std::string validate(const std::string& data, const std::string& schema) {
-                // Veri yapısını doğrula
-                return "valid";
+                Json::ValidationResult result = compiled(schema)->validate(data);
+                return result.valid ? "valid" : result.path + ": " + result.error;
             }
+            
+            std::shared_ptr<const Json::Schema> compiled(const std::string& schema) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    auto found = schemas.find(schema);
+                    if (found != schemas.end()) return found->second;
+                }
+                auto program = std::make_shared<const Json::Schema>(schema);
+                std::lock_guard<std::mutex> lock(mutex);
+                // Sınırsız büyümesin; dolunca baştan başlar
+                if (schemas.size() >= 256) schemas.clear();
+                schemas.emplace(schema, program);
+                return program;
+            }
+            
+        private:
+            std::mutex mutex;
+            std::unordered_map<std::string, std::shared_ptr<const Json::Schema>> schemas;
         };
         
         // API entegrasyonu
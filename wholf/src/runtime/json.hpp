@@ -0,0 +1,1124 @@
+#ifndef WHOLF_JSON_HPP
+#define WHOLF_JSON_HPP
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../interpreter/Value.hpp"
+
+namespace Wholf {
+    namespace Json {
+        enum class Kind : uint8_t {
+            OBJECT,
+            ARRAY,
+            STRING,
+            NUMBER,
+            TRUE_VALUE,
+            FALSE_VALUE,
+            NULL_VALUE
+        };
+
+        struct Options {
+            // İç içe kap sınırı; derin girdiler yığın taşması yerine hata verir
+            size_t maxDepth = 1024;
+        };
+
+        class Element;
+
+        // Aşama 1: yapısal dizin. Girdi 64 baytlık bloklar halinde SIMD ile sınıflandırılır;
+        // dize dışındaki { } [ ] : , karakterlerinin, açılış tırnaklarının ve skaler başlangıçlarının
+        // konumları sırayla çıkarılır. Kaçışlı tırnaklar ve dize içleri bit maskeleriyle elenir.
+        class StructuralIndex {
+        public:
+            void build(std::string_view text) {
+                if (text.size() >= UINT32_MAX) throw std::runtime_error("JSON input too large");
+                count = 0;
+                reserve(text.size() / 4 + 64);
+                escapeCarry = false;
+                stringCarry = 0;
+                scalarCarry = 0;
+                nonAscii = 0;
+                size_t offset = 0;
+                for (; offset + 64 <= text.size(); offset += 64) {
+                    processBlock(reinterpret_cast<const uint8_t*>(text.data() + offset), offset);
+                }
+                if (offset < text.size()) {
+                    // Son yarım blok boşlukla doldurulur; boşluk hiçbir maskeyi değiştirmez
+                    uint8_t tail[64];
+                    std::memset(tail, ' ', sizeof(tail));
+                    std::memcpy(tail, text.data() + offset, text.size() - offset);
+                    processBlock(tail, offset);
+                }
+                if (stringCarry) fail(text.size(), "unterminated string");
+                if (nonAscii && !validUtf8(text)) fail(0, "invalid UTF-8");
+            }
+
+            size_t size() const { return count; }
+            const uint32_t* data() const { return positions.get(); }
+            uint32_t operator[](size_t index) const { return positions[index]; }
+
+            [[noreturn]] static void fail(size_t offset, const std::string& message) {
+                throw std::runtime_error("JSON parse error at offset " + std::to_string(offset) + ": " + message);
+            }
+
+        private:
+            // Sıfırlanmadan yeniden kullanılan konum tamponu; blok başına en az 64 boş yer bırakılır
+            std::unique_ptr<uint32_t[]> positions;
+            size_t capacity = 0;
+            size_t count = 0;
+            bool escapeCarry = false;
+            uint64_t stringCarry = 0;
+            uint64_t scalarCarry = 0;
+            uint64_t nonAscii = 0;
+
+            struct Masks {
+                uint64_t backslash;
+                uint64_t quote;
+                uint64_t whitespace;
+                uint64_t operators;
+                uint64_t control;
+                uint64_t high;
+            };
+
+            void reserve(size_t required) {
+                if (required <= capacity) return;
+                std::unique_ptr<uint32_t[]> grown(new uint32_t[required]);
+                if (count) std::memcpy(grown.get(), positions.get(), count * sizeof(uint32_t));
+                positions = std::move(grown);
+                capacity = required;
+            }
+
+#if defined(__SSE2__)
+            static Masks classify(const uint8_t* block) {
+                Masks masks{0, 0, 0, 0, 0, 0};
+                const __m128i backslash = _mm_set1_epi8('\\');
+                const __m128i quote = _mm_set1_epi8('"');
+                const __m128i space = _mm_set1_epi8(' ');
+                const __m128i tab = _mm_set1_epi8('\t');
+                const __m128i newline = _mm_set1_epi8('\n');
+                const __m128i carriage = _mm_set1_epi8('\r');
+                const __m128i colon = _mm_set1_epi8(':');
+                const __m128i comma = _mm_set1_epi8(',');
+                // '[' ']' '{' '}' 0x20 biti maskelendiğinde '[' ve ']' olur
+                const __m128i caseBit = _mm_set1_epi8(0x20);
+                const __m128i openBracket = _mm_set1_epi8('[');
+                const __m128i closeBracket = _mm_set1_epi8(']');
+                const __m128i controlLimit = _mm_set1_epi8(0x1f);
+                for (int lane = 0; lane < 4; lane++) {
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * lane));
+                    int shift = 16 * lane;
+                    auto bits = [&](__m128i mask) {
+                        return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(mask))) << shift;
+                    };
+                    masks.backslash |= bits(_mm_cmpeq_epi8(chunk, backslash));
+                    masks.quote |= bits(_mm_cmpeq_epi8(chunk, quote));
+                    masks.whitespace |= bits(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+                                                         _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage))));
+                    __m128i folded = _mm_andnot_si128(caseBit, chunk);
+                    masks.operators |= bits(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, colon), _mm_cmpeq_epi8(chunk, comma)),
+                                                        _mm_or_si128(_mm_cmpeq_epi8(folded, openBracket), _mm_cmpeq_epi8(folded, closeBracket))));
+                    // İşaretsiz x <= 0x1f  <=>  max(x, 0x1f) == 0x1f
+                    masks.control |= bits(_mm_cmpeq_epi8(_mm_max_epu8(chunk, controlLimit), controlLimit));
+                    masks.high |= bits(chunk);
+                }
+                return masks;
+            }
+#else
+            static Masks classify(const uint8_t* block) {
+                Masks masks{0, 0, 0, 0, 0, 0};
+                for (int i = 0; i < 64; i++) {
+                    uint8_t c = block[i];
+                    uint64_t bit = uint64_t(1) << i;
+                    if (c == '\\') masks.backslash |= bit;
+                    if (c == '"') masks.quote |= bit;
+                    if (c == ' ' || c == '\t' || c == '\n' || c == '\r') masks.whitespace |= bit;
+                    if (c == ':' || c == ',' || c == '[' || c == ']' || c == '{' || c == '}') masks.operators |= bit;
+                    if (c <= 0x1f) masks.control |= bit;
+                    if (c & 0x80) masks.high |= bit;
+                }
+                return masks;
+            }
+#endif
+
+            // Tek sayıda ters eğik çizgiden sonra gelen karakterler kaçışlıdır
+            uint64_t escapedCharacters(uint64_t backslash) {
+                if (!backslash && !escapeCarry) return 0;
+                uint64_t escaped = escapeCarry ? 1 : 0;
+                escapeCarry = false;
+                while (backslash) {
+                    int bit = __builtin_ctzll(backslash);
+                    backslash &= backslash - 1;
+                    if (escaped & (uint64_t(1) << bit)) continue;
+                    if (bit == 63) {
+                        escapeCarry = true;
+                    } else {
+                        escaped |= uint64_t(1) << (bit + 1);
+                    }
+                }
+                return escaped;
+            }
+
+            // Önek XOR: her bit, kendisi dahil soldaki tırnak sayısının tekliği
+            static uint64_t prefixXor(uint64_t bits) {
+                bits ^= bits << 1;
+                bits ^= bits << 2;
+                bits ^= bits << 4;
+                bits ^= bits << 8;
+                bits ^= bits << 16;
+                bits ^= bits << 32;
+                return bits;
+            }
+
+            void processBlock(const uint8_t* block, size_t offset) {
+                Masks masks = classify(block);
+                nonAscii |= masks.high;
+                uint64_t quotes = masks.quote & ~escapedCharacters(masks.backslash);
+                // Açılış tırnağı ve dize içi 1, kapanış tırnağı 0
+                uint64_t inside = prefixXor(quotes) ^ stringCarry;
+                stringCarry = static_cast<uint64_t>(static_cast<int64_t>(inside) >> 63);
+                if (masks.control & inside) fail(offset + __builtin_ctzll(masks.control & inside), "control character in string");
+
+                uint64_t scalar = ~(masks.operators | masks.whitespace | quotes);
+                uint64_t scalarStart = scalar & ~((scalar << 1) | scalarCarry);
+                scalarCarry = scalar >> 63;
+                uint64_t structural = ((masks.operators | scalarStart) & ~inside) | (quotes & inside);
+                if (capacity < count + 64) reserve(capacity * 2);
+                uint32_t* out = positions.get() + count;
+                count += static_cast<size_t>(__builtin_popcountll(structural));
+                uint32_t base = static_cast<uint32_t>(offset);
+                while (structural) {
+                    *out++ = base + static_cast<uint32_t>(__builtin_ctzll(structural));
+                    structural &= structural - 1;
+                }
+            }
+
+            static bool validUtf8(std::string_view text) {
+                const auto* bytes = reinterpret_cast<const uint8_t*>(text.data());
+                size_t size = text.size();
+                size_t i = 0;
+                while (i < size) {
+#if defined(__SSE2__)
+                    // ASCII koşularını 16 baytlık adımlarla geç
+                    while (i + 16 <= size && !_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i)))) i += 16;
+                    if (i >= size) break;
+#endif
+                    uint8_t c = bytes[i];
+                    if (c < 0x80) {
+                        i++;
+                        continue;
+                    }
+                    size_t length;
+                    uint32_t minimum;
+                    uint32_t code;
+                    if ((c & 0xe0) == 0xc0) {
+                        length = 2;
+                        minimum = 0x80;
+                        code = c & 0x1f;
+                    } else if ((c & 0xf0) == 0xe0) {
+                        length = 3;
+                        minimum = 0x800;
+                        code = c & 0x0f;
+                    } else if ((c & 0xf8) == 0xf0) {
+                        length = 4;
+                        minimum = 0x10000;
+                        code = c & 0x07;
+                    } else {
+                        return false;
+                    }
+                    if (i + length > size) return false;
+                    for (size_t k = 1; k < length; k++) {
+                        if ((bytes[i + k] & 0xc0) != 0x80) return false;
+                        code = (code << 6) | (bytes[i + k] & 0x3f);
+                    }
+                    if (code < minimum || code > 0x10ffff || (code >= 0xd800 && code <= 0xdfff)) return false;
+                    i += length;
+                }
+                return true;
+            }
+        };
+
+        // Aşama 2 çıktısı: belge sırasıyla düz düğüm dizisi. Kaplar alt ağaçlarının bittiği
+        // düğümü gösterir; böylece erişim sırasında kardeşlere atlamak O(1)'dir.
+        struct Node {
+            // Değerin girdideki başlangıcı (dizelerde açılış tırnağı)
+            uint32_t position;
+            // Dize/sayı: ham uzunluk (tırnaklar hariç); kap: eleman ya da üye sayısı
+            uint32_t length;
+            // Bu düğümün alt ağacından sonraki düğüm
+            uint32_t next;
+            Kind kind;
+            // Dize kaçış içeriyor / sayı tam sayı değil
+            bool flag;
+        };
+
+        // Ayrıştırılmış belge. Girdi metni belgeyle birlikte yaşar; değerler erişildikçe çözülür.
+        class Document {
+        public:
+            Document() = default;
+
+            // Metni sahiplenerek ayrıştır
+            static Document parse(std::string text, const Options& options = Options()) {
+                auto owned = std::make_shared<const std::string>(std::move(text));
+                std::string_view view(*owned);
+                return Document(view, owned, options);
+            }
+
+            // Başkasına ait metin üzerinde (ör. eşlenmiş dosya) kopyasız ayrıştır; owner yaşadıkça geçerli
+            Document(std::string_view text, std::shared_ptr<const void> owner, const Options& options = Options())
+                : source(text), owner(std::move(owner)) {
+                StructuralIndex index;
+                index.build(source);
+                buildTape(index, options);
+            }
+
+            Element root() const;
+
+            std::string_view text() const { return source; }
+            const std::vector<Node>& nodes() const { return tape; }
+
+        private:
+            std::string_view source;
+            std::shared_ptr<const void> owner;
+            std::vector<Node> tape;
+
+            static bool isWhitespace(char c) {
+                return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+            }
+
+            // Skalerin sonu: sonraki yapısal konumdan geriye boşlukları atla
+            size_t scalarEnd(size_t limit) const {
+                while (limit > 0 && isWhitespace(source[limit - 1])) limit--;
+                return limit;
+            }
+
+            void buildTape(const StructuralIndex& positions, const Options& options) {
+                if (positions.size() == 0) StructuralIndex::fail(0, "empty document");
+                tape.reserve(positions.size());
+                struct Open {
+                    uint32_t node;
+                    bool object;
+                };
+                std::vector<Open> stack;
+                size_t count = positions.size();
+                size_t k = 0;
+                auto limitOf = [&](size_t index) -> size_t {
+                    return index + 1 < count ? positions[index + 1] : source.size();
+                };
+                auto expect = [&](size_t index, char c, const char* message) {
+                    if (index >= count || source[positions[index]] != c) {
+                        StructuralIndex::fail(index < count ? positions[index] : source.size(), message);
+                    }
+                };
+
+                // Değer okunduktan sonra: kapta ',' ya da kapanış, kökte girdinin sonu
+                enum class State { VALUE, AFTER_VALUE, KEY };
+                State state = State::VALUE;
+                while (true) {
+                    if (state == State::VALUE) {
+                        if (k >= count) StructuralIndex::fail(source.size(), "unexpected end of input");
+                        size_t position = positions[k];
+                        char c = source[position];
+                        if (c == '{' || c == '[') {
+                            if (stack.size() >= options.maxDepth) StructuralIndex::fail(position, "nesting too deep");
+                            bool object = c == '{';
+                            stack.push_back(Open{static_cast<uint32_t>(tape.size()), object});
+                            tape.push_back(Node{static_cast<uint32_t>(position), 0, 0, object ? Kind::OBJECT : Kind::ARRAY, false});
+                            k++;
+                            char close = object ? '}' : ']';
+                            if (k < count && source[positions[k]] == close) {
+                                closeContainer(stack);
+                                k++;
+                                state = State::AFTER_VALUE;
+                            } else {
+                                state = object ? State::KEY : State::VALUE;
+                            }
+                            continue;
+                        }
+                        scalar(position, limitOf(k));
+                        k++;
+                        state = State::AFTER_VALUE;
+                        continue;
+                    }
+                    if (state == State::KEY) {
+                        if (k >= count || source[positions[k]] != '"') {
+                            StructuralIndex::fail(k < count ? positions[k] : source.size(), "expected object key");
+                        }
+                        scalar(positions[k], limitOf(k));
+                        k++;
+                        expect(k, ':', "expected ':'");
+                        k++;
+                        state = State::VALUE;
+                        continue;
+                    }
+                    // AFTER_VALUE
+                    if (stack.empty()) {
+                        if (k != count) StructuralIndex::fail(positions[k], "unexpected content after document");
+                        break;
+                    }
+                    Open& open = stack.back();
+                    tape[open.node].length++;
+                    if (k >= count) StructuralIndex::fail(source.size(), "unexpected end of input");
+                    char c = source[positions[k]];
+                    if (c == ',') {
+                        k++;
+                        state = open.object ? State::KEY : State::VALUE;
+                    } else if (c == (open.object ? '}' : ']')) {
+                        closeContainer(stack);
+                        k++;
+                    } else {
+                        StructuralIndex::fail(positions[k], open.object ? "expected ',' or '}'" : "expected ',' or ']'");
+                    }
+                }
+            }
+
+            template<typename Stack>
+            void closeContainer(Stack& stack) {
+                tape[stack.back().node].next = static_cast<uint32_t>(tape.size());
+                stack.pop_back();
+            }
+
+            void scalar(size_t position, size_t limit) {
+                char c = source[position];
+                size_t end = scalarEnd(limit);
+                Node node{static_cast<uint32_t>(position), 0, static_cast<uint32_t>(tape.size() + 1), Kind::NULL_VALUE, false};
+                if (c == '"') {
+                    // Kapanış tırnağı: sonraki yapısaldan önceki son boşluk olmayan karakter
+                    if (end <= position + 1 || source[end - 1] != '"') StructuralIndex::fail(position, "malformed string");
+                    node.kind = Kind::STRING;
+                    node.length = static_cast<uint32_t>(end - position - 2);
+                    const char* begin = source.data() + position + 1;
+                    if (std::memchr(begin, '\\', node.length)) {
+                        node.flag = true;
+                        validateEscapes(position + 1, node.length);
+                    }
+                } else if (c == '-' || (c >= '0' && c <= '9')) {
+                    node.kind = Kind::NUMBER;
+                    node.length = static_cast<uint32_t>(end - position);
+                    node.flag = !validNumber(source.substr(position, node.length));
+                } else {
+                    std::string_view literal = source.substr(position, end - position);
+                    if (literal == "true") {
+                        node.kind = Kind::TRUE_VALUE;
+                    } else if (literal == "false") {
+                        node.kind = Kind::FALSE_VALUE;
+                    } else if (literal == "null") {
+                        node.kind = Kind::NULL_VALUE;
+                    } else {
+                        StructuralIndex::fail(position, "invalid literal");
+                    }
+                    node.length = static_cast<uint32_t>(literal.size());
+                }
+                tape.push_back(node);
+            }
+
+            // Sayı dilbilgisini denetle; tam sayıysa true
+            bool validNumber(std::string_view text) const {
+                size_t i = 0;
+                size_t size = text.size();
+                auto digits = [&]() {
+                    size_t start = i;
+                    while (i < size && text[i] >= '0' && text[i] <= '9') i++;
+                    return i - start;
+                };
+                bool integral = true;
+                if (i < size && text[i] == '-') i++;
+                if (i < size && text[i] == '0') {
+                    i++;
+                } else if (digits() == 0) {
+                    StructuralIndex::fail(position(text), "invalid number");
+                }
+                if (i < size && text[i] == '.') {
+                    i++;
+                    integral = false;
+                    if (digits() == 0) StructuralIndex::fail(position(text), "invalid number");
+                }
+                if (i < size && (text[i] == 'e' || text[i] == 'E')) {
+                    i++;
+                    integral = false;
+                    if (i < size && (text[i] == '+' || text[i] == '-')) i++;
+                    if (digits() == 0) StructuralIndex::fail(position(text), "invalid number");
+                }
+                if (i != size) StructuralIndex::fail(position(text), "invalid number");
+                return integral;
+            }
+
+            void validateEscapes(size_t start, size_t length) const {
+                size_t end = start + length;
+                for (size_t i = start; i < end; i++) {
+                    if (source[i] != '\\') continue;
+                    char e = source[++i];
+                    if (e == 'u') {
+                        for (size_t h = 1; h <= 4; h++) {
+                            if (i + h >= end || !std::isxdigit(static_cast<unsigned char>(source[i + h]))) {
+                                StructuralIndex::fail(i, "invalid unicode escape");
+                            }
+                        }
+                        i += 4;
+                    } else if (!std::strchr("\"\\/bfnrt", e) || e == '\0') {
+                        StructuralIndex::fail(i, "invalid escape");
+                    }
+                }
+            }
+
+            size_t position(std::string_view part) const {
+                return static_cast<size_t>(part.data() - source.data());
+            }
+
+            friend class Element;
+        };
+
+        // Belgedeki bir değere hafif işaretçi; belge yaşadıkça geçerli.
+        // Geçersiz (bulunamayan) öğe false'a dönüşür
+        class Element {
+        public:
+            Element() = default;
+            Element(const Document* document, uint32_t index) : document(document), index(index) {}
+
+            explicit operator bool() const { return document != nullptr; }
+
+            Kind kind() const { return node().kind; }
+            bool isObject() const { return kind() == Kind::OBJECT; }
+            bool isArray() const { return kind() == Kind::ARRAY; }
+            bool isString() const { return kind() == Kind::STRING; }
+            bool isNumber() const { return kind() == Kind::NUMBER; }
+            bool isBoolean() const { return kind() == Kind::TRUE_VALUE || kind() == Kind::FALSE_VALUE; }
+            bool isNull() const { return kind() == Kind::NULL_VALUE; }
+            bool isInteger() const { return kind() == Kind::NUMBER && !node().flag; }
+
+            // Kaplarda eleman/üye sayısı
+            size_t size() const {
+                const Node& n = node();
+                return n.kind == Kind::OBJECT || n.kind == Kind::ARRAY ? n.length : 0;
+            }
+
+            // Dizi elemanı; doğrusal atlama (kardeşler O(1) geçilir)
+            Element operator[](size_t position) const {
+                if (!isArray() || position >= size()) throw std::runtime_error("JSON array index out of range");
+                uint32_t child = index + 1;
+                for (size_t i = 0; i < position; i++) child = document->tape[child].next;
+                return Element(document, child);
+            }
+
+            // Nesne üyesi; yoksa geçersiz öğe
+            Element find(std::string_view key) const {
+                if (!isObject()) return Element();
+                uint32_t child = index + 1;
+                for (size_t i = 0; i < size(); i++) {
+                    Element name(document, child);
+                    if (name.equals(key)) return Element(document, child + 1);
+                    child = document->tape[child + 1].next;
+                }
+                return Element();
+            }
+
+            Element operator[](std::string_view key) const {
+                Element found = find(key);
+                if (!found) throw std::runtime_error("JSON member not found: " + std::string(key));
+                return found;
+            }
+
+            template<typename Callback>
+            void forEach(Callback&& callback) const {
+                if (!isArray()) throw std::runtime_error("JSON value is not an array");
+                uint32_t child = index + 1;
+                for (size_t i = 0; i < size(); i++) {
+                    callback(Element(document, child));
+                    child = document->tape[child].next;
+                }
+            }
+
+            // callback(Element anahtar, Element değer)
+            template<typename Callback>
+            void forEachMember(Callback&& callback) const {
+                if (!isObject()) throw std::runtime_error("JSON value is not an object");
+                uint32_t child = index + 1;
+                for (size_t i = 0; i < size(); i++) {
+                    callback(Element(document, child), Element(document, child + 1));
+                    child = document->tape[child + 1].next;
+                }
+            }
+
+            // Dizenin tırnaksız ham metni; kaçış içeriyorsa çözülmemiştir
+            std::string_view raw() const {
+                const Node& n = node();
+                if (n.kind == Kind::STRING) return document->source.substr(n.position + 1, n.length);
+                return document->source.substr(n.position, n.length);
+            }
+
+            bool hasEscapes() const { return isString() && node().flag; }
+
+            // Çözülmüş dize; kaçış yoksa ham metnin kopyası
+            std::string string() const {
+                if (!isString()) throw std::runtime_error("JSON value is not a string");
+                if (!node().flag) return std::string(raw());
+                return unescape(raw());
+            }
+
+            // Çözülmüş dize eşitliği; kaçışsız dizelerde kopya yapmaz
+            bool equals(std::string_view text) const {
+                if (!isString()) return false;
+                return node().flag ? unescape(raw()) == text : raw() == text;
+            }
+
+            double number() const {
+                if (!isNumber()) throw std::runtime_error("JSON value is not a number");
+                std::string_view text = raw();
+                double result = 0;
+                auto parsed = std::from_chars(text.data(), text.data() + text.size(), result);
+                if (parsed.ec == std::errc::result_out_of_range) {
+                    return text[0] == '-' ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+                }
+                return result;
+            }
+
+            // Tam sayı; kesirli ya da int64 dışı değerlerde hata
+            int64_t integer() const {
+                if (!isInteger()) throw std::runtime_error("JSON value is not an integer");
+                std::string_view text = raw();
+                int64_t result = 0;
+                auto parsed = std::from_chars(text.data(), text.data() + text.size(), result);
+                if (parsed.ec != std::errc()) throw std::runtime_error("JSON integer out of range: " + std::string(text));
+                return result;
+            }
+
+            bool boolean() const {
+                if (!isBoolean()) throw std::runtime_error("JSON value is not a boolean");
+                return kind() == Kind::TRUE_VALUE;
+            }
+
+            // Alt ağacı Value'ya dönüştür. int aralığındaki tam sayılar INTEGER, diğer sayılar FLOAT olur
+            // (Value'da double yoktur; büyük tam sayılar ve çift duyarlıklı kesirler yuvarlanır).
+            Value toValue() const {
+                uint32_t cursor = index;
+                return materialize(cursor);
+            }
+
+            static std::string unescape(std::string_view text) {
+                std::string result;
+                result.reserve(text.size());
+                size_t i = 0;
+                while (i < text.size()) {
+                    const char* slash = static_cast<const char*>(std::memchr(text.data() + i, '\\', text.size() - i));
+                    size_t stop = slash ? static_cast<size_t>(slash - text.data()) : text.size();
+                    result.append(text.data() + i, stop - i);
+                    if (!slash) break;
+                    i = stop + 1;
+                    char e = text[i++];
+                    switch (e) {
+                        case 'b': result += '\b'; break;
+                        case 'f': result += '\f'; break;
+                        case 'n': result += '\n'; break;
+                        case 'r': result += '\r'; break;
+                        case 't': result += '\t'; break;
+                        case 'u': {
+                            uint32_t code = hex4(text, i);
+                            i += 4;
+                            // Vekil çift: \uD8xx\uDCxx
+                            if (code >= 0xd800 && code <= 0xdbff && i + 6 <= text.size() && text[i] == '\\' && text[i + 1] == 'u') {
+                                uint32_t low = hex4(text, i + 2);
+                                if (low >= 0xdc00 && low <= 0xdfff) {
+                                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                                    i += 6;
+                                }
+                            }
+                            // Eşsiz vekiller U+FFFD olur
+                            if (code >= 0xd800 && code <= 0xdfff) code = 0xfffd;
+                            appendUtf8(result, code);
+                            break;
+                        }
+                        default: result += e; break;
+                    }
+                }
+                return result;
+            }
+
+        private:
+            const Document* document = nullptr;
+            uint32_t index = 0;
+
+            const Node& node() const {
+                if (!document) throw std::runtime_error("Invalid JSON element");
+                return document->tape[index];
+            }
+
+            static uint32_t hex4(std::string_view text, size_t at) {
+                uint32_t code = 0;
+                for (size_t h = 0; h < 4; h++) {
+                    char c = text[at + h];
+                    code = (code << 4) | static_cast<uint32_t>(c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+                }
+                return code;
+            }
+
+            static void appendUtf8(std::string& out, uint32_t code) {
+                if (code < 0x80) {
+                    out += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    out += static_cast<char>(0xc0 | (code >> 6));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                } else if (code < 0x10000) {
+                    out += static_cast<char>(0xe0 | (code >> 12));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                } else {
+                    out += static_cast<char>(0xf0 | (code >> 18));
+                    out += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                    out += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    out += static_cast<char>(0x80 | (code & 0x3f));
+                }
+            }
+
+            Value materialize(uint32_t& cursor) const {
+                const std::vector<Node>& tape = document->tape;
+                const Node& n = tape[cursor];
+                Element element(document, cursor);
+                switch (n.kind) {
+                    case Kind::OBJECT: {
+                        std::map<std::string, Value> members;
+                        cursor++;
+                        for (uint32_t i = 0; i < n.length; i++) {
+                            std::string key = Element(document, cursor).string();
+                            cursor++;
+                            // Yinelenen anahtarlarda sonuncusu kalır
+                            members.insert_or_assign(std::move(key), materialize(cursor));
+                        }
+                        return Value(std::move(members));
+                    }
+                    case Kind::ARRAY: {
+                        std::vector<Value> items;
+                        items.reserve(n.length);
+                        cursor++;
+                        for (uint32_t i = 0; i < n.length; i++) items.push_back(materialize(cursor));
+                        return Value(std::move(items));
+                    }
+                    case Kind::STRING:
+                        cursor++;
+                        return Value(element.string());
+                    case Kind::NUMBER: {
+                        cursor++;
+                        if (!n.flag) {
+                            std::string_view text = element.raw();
+                            int integer = 0;
+                            auto parsed = std::from_chars(text.data(), text.data() + text.size(), integer);
+                            if (parsed.ec == std::errc()) return Value(integer);
+                        }
+                        return Value(static_cast<float>(element.number()));
+                    }
+                    case Kind::TRUE_VALUE:
+                        cursor++;
+                        return Value(true);
+                    case Kind::FALSE_VALUE:
+                        cursor++;
+                        return Value(false);
+                    case Kind::NULL_VALUE:
+                        break;
+                }
+                cursor++;
+                return Value(nullptr);
+            }
+        };
+
+        inline Element Document::root() const {
+            return Element(this, 0);
+        }
+
+        // Tek seferde: ayrıştır ve Value ağacı kur
+        inline Value parse(std::string_view text, const Options& options = Options()) {
+            Document document(text, nullptr, options);
+            return document.root().toValue();
+        }
+
+        // Şema sözcükleriyle tip adı: object, array, string, integer, number, boolean, null
+        inline std::string typeName(const Element& element) {
+            switch (element.kind()) {
+                case Kind::OBJECT: return "object";
+                case Kind::ARRAY: return "array";
+                case Kind::STRING: return "string";
+                case Kind::NUMBER: return element.isInteger() ? "integer" : "number";
+                case Kind::TRUE_VALUE:
+                case Kind::FALSE_VALUE: return "boolean";
+                case Kind::NULL_VALUE: return "null";
+            }
+            return "unknown";
+        }
+
+        struct ValidationResult {
+            bool valid = true;
+            // İlk hatanın JSON işaretçisi ve açıklaması
+            std::string path;
+            std::string error;
+
+            explicit operator bool() const { return valid; }
+        };
+
+        // JSON Schema alt kümesi bir kez düz bir doğrulama programına derlenir ve belgeler arasında
+        // yeniden kullanılır. Desteklenenler: type, properties, required, additionalProperties,
+        // items, enum, const, minimum, maximum, exclusiveMinimum, exclusiveMaximum, minLength,
+        // maxLength, pattern, minItems, maxItems. Doğrulama belge düğümleri üzerinde yürür;
+        // Value ağacı kurulmaz.
+        class Schema {
+        public:
+            Schema() = default;
+
+            explicit Schema(std::string_view text) {
+                Document document(text, nullptr);
+                compile(document.root());
+            }
+
+            explicit Schema(const Element& root) {
+                compile(root);
+            }
+
+            ValidationResult validate(const Element& element) const {
+                ValidationResult result;
+                if (program.empty()) return result;
+                std::string path;
+                check(0, element, path, result);
+                return result;
+            }
+
+            ValidationResult validate(std::string_view json) const {
+                Document document(json, nullptr);
+                return validate(document.root());
+            }
+
+            size_t instructions() const { return program.size(); }
+
+        private:
+            enum TypeBit : uint32_t {
+                OBJECT_TYPE = 1,
+                ARRAY_TYPE = 2,
+                STRING_TYPE = 4,
+                NUMBER_TYPE = 8,
+                INTEGER_TYPE = 16,
+                BOOLEAN_TYPE = 32,
+                NULL_TYPE = 64,
+                ANY_TYPE = 127
+            };
+
+            struct Property {
+                std::string name;
+                int32_t schema;
+                bool required;
+                // Zorunlu özelliklerin sıra numarası; yinelenen anahtarlar iki kez sayılmasın diye
+                uint32_t requiredSlot = 0;
+            };
+
+            // Bir şema düğümü; alt şemalar program içindeki sıra numarasıyla gösterilir
+            struct Instruction {
+                uint32_t types = ANY_TYPE;
+                bool rejectAll = false;
+                // Ada göre sıralı; aranırken ikili arama
+                std::vector<Property> properties;
+                size_t requiredCount = 0;
+                // -1: serbest, -2: yasak, >= 0: alt şema
+                int32_t additional = -1;
+                int32_t items = -1;
+                // Kapsayan ve dışlayan sınırlar ayrı tutulur; ikisi birlikte verilebilir
+                double minimum = -std::numeric_limits<double>::infinity();
+                double maximum = std::numeric_limits<double>::infinity();
+                double exclusiveMinimum = -std::numeric_limits<double>::infinity();
+                double exclusiveMaximum = std::numeric_limits<double>::infinity();
+                size_t minLength = 0;
+                size_t maxLength = SIZE_MAX;
+                size_t minItems = 0;
+                size_t maxItems = SIZE_MAX;
+                std::shared_ptr<const std::regex> pattern;
+                // Kanonik metin biçiminde izin verilen değerler
+                std::vector<std::string> allowed;
+            };
+
+            std::vector<Instruction> program;
+
+            static uint32_t typeBit(const std::string& name) {
+                if (name == "object") return OBJECT_TYPE;
+                if (name == "array") return ARRAY_TYPE;
+                if (name == "string") return STRING_TYPE;
+                if (name == "number") return NUMBER_TYPE | INTEGER_TYPE;
+                if (name == "integer") return INTEGER_TYPE;
+                if (name == "boolean") return BOOLEAN_TYPE;
+                if (name == "null") return NULL_TYPE;
+                throw std::runtime_error("Unknown schema type: " + name);
+            }
+
+            static size_t count(const Element& element, const char* keyword) {
+                if (!element.isNumber() || element.number() < 0) {
+                    throw std::runtime_error(std::string("Schema keyword must be a non-negative number: ") + keyword);
+                }
+                return static_cast<size_t>(element.number());
+            }
+
+            // Karşılaştırma için kanonik biçim: sayılar değerle, dizeler çözülmüş, kaplar boşluksuz
+            static std::string canonical(const Element& element) {
+                switch (element.kind()) {
+                    case Kind::STRING: return "s" + element.string();
+                    case Kind::NUMBER: {
+                        char buffer[32];
+                        auto written = std::to_chars(buffer, buffer + sizeof(buffer), element.number());
+                        return "n" + std::string(buffer, written.ptr);
+                    }
+                    case Kind::TRUE_VALUE: return "t";
+                    case Kind::FALSE_VALUE: return "f";
+                    case Kind::NULL_VALUE: return "z";
+                    case Kind::ARRAY: {
+                        std::string text = "[";
+                        element.forEach([&](Element item) { text += canonical(item) + ","; });
+                        return text + "]";
+                    }
+                    case Kind::OBJECT: {
+                        std::map<std::string, std::string> members;
+                        element.forEachMember([&](Element key, Element value) { members[key.string()] = canonical(value); });
+                        std::string text = "{";
+                        for (auto& member : members) text += member.first + ":" + member.second + ",";
+                        return text + "}";
+                    }
+                }
+                return std::string();
+            }
+
+            int32_t compile(const Element& schema) {
+                int32_t id = static_cast<int32_t>(program.size());
+                program.emplace_back();
+                Instruction instruction;
+                if (schema.isBoolean()) {
+                    instruction.rejectAll = !schema.boolean();
+                    program[id] = std::move(instruction);
+                    return id;
+                }
+                if (!schema.isObject()) throw std::runtime_error("Schema must be an object or boolean");
+
+                std::vector<std::string> required;
+                schema.forEachMember([&](Element keyElement, Element value) {
+                    std::string key = keyElement.string();
+                    if (key == "type") {
+                        if (value.isString()) {
+                            instruction.types = typeBit(value.string());
+                        } else {
+                            instruction.types = 0;
+                            value.forEach([&](Element type) { instruction.types |= typeBit(type.string()); });
+                        }
+                    } else if (key == "properties") {
+                        value.forEachMember([&](Element name, Element property) {
+                            int32_t child = compile(property);
+                            instruction.properties.push_back(Property{name.string(), child, false});
+                        });
+                    } else if (key == "required") {
+                        value.forEach([&](Element name) { required.push_back(name.string()); });
+                    } else if (key == "additionalProperties") {
+                        instruction.additional = value.isBoolean() ? (value.boolean() ? -1 : -2) : compile(value);
+                    } else if (key == "items") {
+                        instruction.items = compile(value);
+                    } else if (key == "enum") {
+                        value.forEach([&](Element item) { instruction.allowed.push_back(canonical(item)); });
+                    } else if (key == "const") {
+                        instruction.allowed.push_back(canonical(value));
+                    } else if (key == "minimum") {
+                        instruction.minimum = value.number();
+                    } else if (key == "maximum") {
+                        instruction.maximum = value.number();
+                    } else if (key == "exclusiveMinimum") {
+                        instruction.exclusiveMinimum = value.number();
+                    } else if (key == "exclusiveMaximum") {
+                        instruction.exclusiveMaximum = value.number();
+                    } else if (key == "minLength") {
+                        instruction.minLength = count(value, "minLength");
+                    } else if (key == "maxLength") {
+                        instruction.maxLength = count(value, "maxLength");
+                    } else if (key == "minItems") {
+                        instruction.minItems = count(value, "minItems");
+                    } else if (key == "maxItems") {
+                        instruction.maxItems = count(value, "maxItems");
+                    } else if (key == "pattern") {
+                        instruction.pattern = std::make_shared<const std::regex>(value.string(), std::regex::ECMAScript | std::regex::optimize);
+                    }
+                    // Diğer anahtar sözcükler (title, description, $schema ...) yok sayılır
+                });
+
+                for (const auto& name : required) {
+                    auto it = std::find_if(instruction.properties.begin(), instruction.properties.end(),
+                        [&](const Property& property) { return property.name == name; });
+                    if (it == instruction.properties.end()) {
+                        instruction.properties.push_back(Property{name, -1, true});
+                    } else {
+                        it->required = true;
+                    }
+                }
+                std::sort(instruction.properties.begin(), instruction.properties.end(),
+                    [](const Property& a, const Property& b) { return a.name < b.name; });
+                for (auto& property : instruction.properties) {
+                    if (property.required) property.requiredSlot = static_cast<uint32_t>(instruction.requiredCount++);
+                }
+                program[id] = std::move(instruction);
+                return id;
+            }
+
+            static uint32_t typeOf(const Element& element) {
+                switch (element.kind()) {
+                    case Kind::OBJECT: return OBJECT_TYPE;
+                    case Kind::ARRAY: return ARRAY_TYPE;
+                    case Kind::STRING: return STRING_TYPE;
+                    case Kind::NUMBER: {
+                        // 1.0 da tam sayıdır
+                        if (element.isInteger()) return NUMBER_TYPE | INTEGER_TYPE;
+                        double number = element.number();
+                        return std::isfinite(number) && std::floor(number) == number ? (NUMBER_TYPE | INTEGER_TYPE) : NUMBER_TYPE;
+                    }
+                    case Kind::TRUE_VALUE:
+                    case Kind::FALSE_VALUE: return BOOLEAN_TYPE;
+                    case Kind::NULL_VALUE: return NULL_TYPE;
+                }
+                return 0;
+            }
+
+            static bool failWith(ValidationResult& result, const std::string& path, std::string error) {
+                result.valid = false;
+                result.path = path.empty() ? "/" : path;
+                result.error = std::move(error);
+                return false;
+            }
+
+            // RFC 6901: özellik adındaki '~' "~0", '/' "~1" olarak yazılır
+            static void appendPointerToken(std::string& path, std::string_view key) {
+                path += '/';
+                for (char c : key) {
+                    if (c == '~') path += "~0";
+                    else if (c == '/') path += "~1";
+                    else path += c;
+                }
+            }
+
+            // UTF-8 kod noktası sayısı (minLength/maxLength JSON Schema'da karakter sayar)
+            static size_t characters(const std::string& text) {
+                size_t length = 0;
+                for (unsigned char c : text) length += (c & 0xc0) != 0x80;
+                return length;
+            }
+
+            bool check(int32_t id, const Element& element, std::string& path, ValidationResult& result) const {
+                const Instruction& instruction = program[id];
+                if (instruction.rejectAll) return failWith(result, path, "no value is allowed here");
+                uint32_t type = typeOf(element);
+                if (!(instruction.types & type)) return failWith(result, path, "unexpected type " + typeName(element));
+                if (!instruction.allowed.empty()) {
+                    std::string value = canonical(element);
+                    if (std::find(instruction.allowed.begin(), instruction.allowed.end(), value) == instruction.allowed.end()) {
+                        return failWith(result, path, "value is not one of the allowed values");
+                    }
+                }
+                switch (element.kind()) {
+                    case Kind::NUMBER: {
+                        double number = element.number();
+                        if (number < instruction.minimum || !(number > instruction.exclusiveMinimum)) {
+                            return failWith(result, path, "value below minimum");
+                        }
+                        if (number > instruction.maximum || !(number < instruction.exclusiveMaximum)) {
+                            return failWith(result, path, "value above maximum");
+                        }
+                        return true;
+                    }
+                    case Kind::STRING: {
+                        if (instruction.minLength == 0 && instruction.maxLength == SIZE_MAX && !instruction.pattern) return true;
+                        std::string text = element.string();
+                        size_t length = characters(text);
+                        if (length < instruction.minLength) return failWith(result, path, "string shorter than minLength");
+                        if (length > instruction.maxLength) return failWith(result, path, "string longer than maxLength");
+                        if (instruction.pattern && !std::regex_search(text, *instruction.pattern)) {
+                            return failWith(result, path, "string does not match pattern");
+                        }
+                        return true;
+                    }
+                    case Kind::ARRAY: {
+                        size_t size = element.size();
+                        if (size < instruction.minItems) return failWith(result, path, "array shorter than minItems");
+                        if (size > instruction.maxItems) return failWith(result, path, "array longer than maxItems");
+                        if (instruction.items < 0) return true;
+                        size_t base = path.size();
+                        size_t position = 0;
+                        bool valid = true;
+                        element.forEach([&](Element item) {
+                            if (!valid) return;
+                            path += "/" + std::to_string(position++);
+                            valid = check(instruction.items, item, path, result);
+                            path.resize(base);
+                        });
+                        return valid;
+                    }
+                    case Kind::OBJECT:
+                        return checkObject(instruction, element, path, result);
+                    default:
+                        return true;
+                }
+            }
+
+            bool checkObject(const Instruction& instruction, const Element& element, std::string& path, ValidationResult& result) const {
+                if (instruction.properties.empty() && instruction.additional == -1) return true;
+                // 64'e kadar zorunlu özellik bit maskesinde, fazlası vektörde izlenir
+                uint64_t seenMask = 0;
+                std::vector<bool> seenLarge(instruction.requiredCount > 64 ? instruction.requiredCount : 0);
+                size_t seenRequired = 0;
+                size_t base = path.size();
+                bool valid = true;
+                element.forEachMember([&](Element keyElement, Element value) {
+                    if (!valid) return;
+                    std::string decoded;
+                    std::string_view key = keyElement.raw();
+                    if (keyElement.hasEscapes()) {
+                        decoded = keyElement.string();
+                        key = decoded;
+                    }
+                    auto it = std::lower_bound(instruction.properties.begin(), instruction.properties.end(), key,
+                        [](const Property& property, std::string_view name) { return property.name < name; });
+                    int32_t child;
+                    if (it != instruction.properties.end() && it->name == key) {
+                        if (it->required) {
+                            uint32_t slot = it->requiredSlot;
+                            if (slot < 64) {
+                                if (!(seenMask & (uint64_t(1) << slot))) seenRequired++;
+                                seenMask |= uint64_t(1) << slot;
+                            } else if (!seenLarge[slot]) {
+                                seenLarge[slot] = true;
+                                seenRequired++;
+                            }
+                        }
+                        child = it->schema;
+                    } else {
+                        if (instruction.additional == -2) {
+                            valid = failWith(result, path, "unexpected property \"" + std::string(key) + "\"");
+                            return;
+                        }
+                        child = instruction.additional;
+                    }
+                    if (child < 0) return;
+                    appendPointerToken(path, key);
+                    valid = check(child, value, path, result);
+                    path.resize(base);
+                });
+                if (!valid) return false;
+                if (seenRequired < instruction.requiredCount) {
+                    for (const auto& property : instruction.properties) {
+                        if (property.required && !element.find(property.name)) {
+                            return failWith(result, path, "missing required property \"" + property.name + "\"");
+                        }
+                    }
+                }
+                return true;
+            }
+        };
+    }
+}
+
+#endif // WHOLF_JSON_HPP
@@ -0,0 +1,348 @@
+#ifndef WHOLF_METRICS_HPP
+#define WHOLF_METRICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// WHOLF_METRICS tanımlı değilse ölçüm makroları boş kalır ve sıcak yollara hiçbir kod eklenmez.
+#ifdef WHOLF_METRICS
+#define WHOLF_COUNT(counter) ::Wholf::Metrics::Registry::add(::Wholf::Metrics::Counter::counter, 1)
+#define WHOLF_COUNT_N(counter, amount) ::Wholf::Metrics::Registry::add(::Wholf::Metrics::Counter::counter, static_cast<uint64_t>(amount))
+#define WHOLF_TIME_SCOPE(histogram) ::Wholf::Metrics::ScopedTimer wholfScopedTimer##histogram(::Wholf::Metrics::Histogram::histogram)
+#else
+#define WHOLF_COUNT(counter) ((void)0)
+#define WHOLF_COUNT_N(counter, amount) ((void)0)
+#define WHOLF_TIME_SCOPE(histogram) ((void)0)
+#endif
+
+namespace Wholf {
+    namespace Metrics {
+        // Sayaçlar
+        enum class Counter {
+            INTERPRET_CALLS,
+            NODES_EVALUATED,
+            NATIVE_CALLS,
+            VALUE_ALLOCATIONS,
+            MODULE_CALLS,
+            FILE_READS,
+            FILE_WRITES,
+            FILE_BYTES_READ,
+            FILE_BYTES_WRITTEN,
+            COUNT
+        };
+
+        // Gecikme histogramları (nanosaniye)
+        enum class Histogram {
+            INTERPRET_LATENCY,
+            MODULE_CALL_LATENCY,
+            FILE_READ_LATENCY,
+            FILE_WRITE_LATENCY,
+            COUNT
+        };
+
+        inline const char* counterName(Counter counter) {
+            switch (counter) {
+                case Counter::INTERPRET_CALLS: return "wholf_interpret_calls_total";
+                case Counter::NODES_EVALUATED: return "wholf_nodes_evaluated_total";
+                case Counter::NATIVE_CALLS: return "wholf_native_calls_total";
+                case Counter::VALUE_ALLOCATIONS: return "wholf_value_allocations_total";
+                case Counter::MODULE_CALLS: return "wholf_module_calls_total";
+                case Counter::FILE_READS: return "wholf_file_reads_total";
+                case Counter::FILE_WRITES: return "wholf_file_writes_total";
+                case Counter::FILE_BYTES_READ: return "wholf_file_read_bytes_total";
+                case Counter::FILE_BYTES_WRITTEN: return "wholf_file_written_bytes_total";
+                default: return "";
+            }
+        }
+
+        inline const char* histogramName(Histogram histogram) {
+            switch (histogram) {
+                case Histogram::INTERPRET_LATENCY: return "wholf_interpret_latency_seconds";
+                case Histogram::MODULE_CALL_LATENCY: return "wholf_module_call_latency_seconds";
+                case Histogram::FILE_READ_LATENCY: return "wholf_file_read_latency_seconds";
+                case Histogram::FILE_WRITE_LATENCY: return "wholf_file_write_latency_seconds";
+                default: return "";
+            }
+        }
+
+        static constexpr size_t COUNTER_COUNT = static_cast<size_t>(Counter::COUNT);
+        static constexpr size_t HISTOGRAM_COUNT = static_cast<size_t>(Histogram::COUNT);
+
+        // HDR tarzı log-lineer kova düzeni: her 2'nin kuvveti 16 alt kovaya bölünür (~%6 hassasiyet)
+        class BucketLayout {
+        public:
+            static constexpr unsigned SUB_BUCKET_BITS = 4;
+            static constexpr unsigned SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+            static constexpr size_t BUCKETS = 64 * SUB_BUCKETS;
+
+            static size_t index(uint64_t value) {
+                if (value < SUB_BUCKETS) return static_cast<size_t>(value);
+                unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(value));
+                unsigned sub = static_cast<unsigned>(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+                return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+            }
+
+            // Kovanın üst sınırı
+            static uint64_t upperBound(size_t index) {
+                if (index < SUB_BUCKETS) return index;
+                unsigned exponent = static_cast<unsigned>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+                uint64_t sub = index % SUB_BUCKETS;
+                uint64_t base = (uint64_t(1) << exponent) | (sub << (exponent - SUB_BUCKET_BITS));
+                return base + (uint64_t(1) << (exponent - SUB_BUCKET_BITS)) - 1;
+            }
+        };
+
+        // Tek yazarlı (thread'e ait) sayaç; okuyucular atomik olarak okur
+        class LocalCounter {
+        public:
+            void add(uint64_t amount) {
+                value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+            }
+
+            uint64_t load() const { return value.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> value{0};
+        };
+
+        // Thread başına ölçüm parçası
+        class Shard {
+        public:
+            std::array<LocalCounter, COUNTER_COUNT> counters;
+            std::array<std::array<LocalCounter, BucketLayout::BUCKETS>, HISTOGRAM_COUNT> buckets;
+            std::array<LocalCounter, HISTOGRAM_COUNT> sums;
+        };
+
+        // Birleştirilmiş histogram görüntüsü
+        class HistogramSnapshot {
+        public:
+            std::vector<uint64_t> buckets = std::vector<uint64_t>(BucketLayout::BUCKETS, 0);
+            uint64_t count = 0;
+            uint64_t sum = 0;
+
+            // Yüzdelik (nanosaniye)
+            uint64_t percentile(double fraction) const {
+                if (count == 0) return 0;
+                uint64_t target = static_cast<uint64_t>(fraction * static_cast<double>(count - 1));
+                uint64_t seen = 0;
+                for (size_t i = 0; i < buckets.size(); i++) {
+                    seen += buckets[i];
+                    if (seen > target) return BucketLayout::upperBound(i);
+                }
+                return BucketLayout::upperBound(buckets.size() - 1);
+            }
+        };
+
+        // Tüm thread'lerin birleştirilmiş görüntüsü
+        class Snapshot {
+        public:
+            std::array<uint64_t, COUNTER_COUNT> counters{};
+            std::array<HistogramSnapshot, HISTOGRAM_COUNT> histograms;
+
+            uint64_t counter(Counter which) const { return counters[static_cast<size_t>(which)]; }
+            const HistogramSnapshot& histogram(Histogram which) const { return histograms[static_cast<size_t>(which)]; }
+
+            // Prometheus metin biçimi
+            std::string toPrometheus() const {
+                std::string out;
+                for (size_t i = 0; i < COUNTER_COUNT; i++) {
+                    const char* name = counterName(static_cast<Counter>(i));
+                    out += std::string("# TYPE ") + name + " counter\n";
+                    out += std::string(name) + " " + std::to_string(counters[i]) + "\n";
+                }
+                static const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+                for (size_t i = 0; i < HISTOGRAM_COUNT; i++) {
+                    const char* name = histogramName(static_cast<Histogram>(i));
+                    const HistogramSnapshot& histogram = histograms[i];
+                    out += std::string("# TYPE ") + name + " summary\n";
+                    for (double quantile : quantiles) {
+                        out += std::string(name) + "{quantile=\"" + formatDouble(quantile) + "\"} " +
+                               formatDouble(static_cast<double>(histogram.percentile(quantile)) / 1e9) + "\n";
+                    }
+                    out += std::string(name) + "_sum " + formatDouble(static_cast<double>(histogram.sum) / 1e9) + "\n";
+                    out += std::string(name) + "_count " + std::to_string(histogram.count) + "\n";
+                }
+                return out;
+            }
+
+        private:
+            static std::string formatDouble(double value) {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+                return buffer;
+            }
+        };
+
+        // Thread parçalarının kaydı; okuma anında birleştirir
+        class Registry {
+        public:
+            static Registry& instance() {
+                static Registry registry;
+                return registry;
+            }
+
+            // Çağıran thread'in parçası; sıcak yolda yalnızca ham işaretçi okunur.
+            // Thread sonlanırken (parçası emekliye katıldıktan sonra) nullptr döner
+            static Shard* local() {
+                Shard* shard = cached;
+                if (__builtin_expect(shard != nullptr, 1)) return shard;
+                return attach();
+            }
+
+            static void add(Counter counter, uint64_t amount) {
+                if (Shard* shard = local()) shard->counters[static_cast<size_t>(counter)].add(amount);
+                else instance().addLate(counter, amount);
+            }
+
+            static void record(Histogram histogram, uint64_t nanoseconds) {
+                Shard* shard = local();
+                if (!shard) {
+                    instance().recordLate(histogram, nanoseconds);
+                    return;
+                }
+                size_t index = static_cast<size_t>(histogram);
+                shard->buckets[index][BucketLayout::index(nanoseconds)].add(1);
+                shard->sums[index].add(nanoseconds);
+            }
+
+            Snapshot snapshot() {
+                Snapshot result;
+                std::lock_guard<std::mutex> lock(mutex);
+                merge(result, retired);
+                for (const Shard* shard : shards) merge(result, *shard);
+                return result;
+            }
+
+            // Canlı thread parçası sayısı (sonlanan thread'lerinkiler emekliye katılır)
+            size_t liveShards() {
+                std::lock_guard<std::mutex> lock(mutex);
+                return shards.size();
+            }
+
+            // Prometheus metnini dosyaya yaz (geçici dosya + rename, kazıyıcı yarım dosya görmez)
+            void writePrometheus(const std::string& path) {
+                std::string temporary = path + ".tmp";
+                {
+                    std::ofstream file(temporary, std::ios::trunc);
+                    if (!file) throw std::runtime_error("Cannot write metrics: " + path);
+                    file << snapshot().toPrometheus();
+                }
+                if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+                    throw std::runtime_error("Cannot write metrics: " + path);
+                }
+            }
+
+        private:
+            // Thread'in parçasının sahibi; thread sonlanınca parçayı emekliye katıp serbest bırakır
+            class ShardOwner {
+            public:
+                ShardOwner() : shard(new Shard()) {
+                    instance().attachShard(shard.get());
+                    cached = shard.get();
+                }
+
+                ~ShardOwner() {
+                    cached = nullptr;
+                    exited = true;
+                    instance().retire(shard.get());
+                }
+
+                ShardOwner(const ShardOwner&) = delete;
+                ShardOwner& operator=(const ShardOwner&) = delete;
+
+            private:
+                std::unique_ptr<Shard> shard;
+            };
+
+            // Sabit ilklendirilen thread_local'lar: erişimleri ilklendirme denetimi gerektirmez
+            static inline thread_local Shard* cached = nullptr;
+            static inline thread_local bool exited = false;
+
+            std::mutex mutex;
+            std::vector<Shard*> shards;
+            // Sonlanmış thread'lerin toplamı; yalnızca mutex altında yazılır ve okunur
+            Shard retired;
+
+            Registry() = default;
+
+            static Shard* attach() {
+                // Thread'in kendi yıkıcıları çalışırken gelen olaylar kilitli yoldan emekliye yazılır
+                if (exited) return nullptr;
+                static thread_local ShardOwner owner;
+                return cached;
+            }
+
+            void attachShard(Shard* shard) {
+                std::lock_guard<std::mutex> lock(mutex);
+                shards.push_back(shard);
+            }
+
+            void retire(Shard* shard) {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (size_t i = 0; i < COUNTER_COUNT; i++) retired.counters[i].add(shard->counters[i].load());
+                for (size_t h = 0; h < HISTOGRAM_COUNT; h++) {
+                    for (size_t b = 0; b < BucketLayout::BUCKETS; b++) retired.buckets[h][b].add(shard->buckets[h][b].load());
+                    retired.sums[h].add(shard->sums[h].load());
+                }
+                shards.erase(std::find(shards.begin(), shards.end(), shard));
+            }
+
+            void addLate(Counter counter, uint64_t amount) {
+                std::lock_guard<std::mutex> lock(mutex);
+                retired.counters[static_cast<size_t>(counter)].add(amount);
+            }
+
+            void recordLate(Histogram histogram, uint64_t nanoseconds) {
+                std::lock_guard<std::mutex> lock(mutex);
+                size_t index = static_cast<size_t>(histogram);
+                retired.buckets[index][BucketLayout::index(nanoseconds)].add(1);
+                retired.sums[index].add(nanoseconds);
+            }
+
+            static void merge(Snapshot& result, const Shard& shard) {
+                for (size_t i = 0; i < COUNTER_COUNT; i++) result.counters[i] += shard.counters[i].load();
+                for (size_t h = 0; h < HISTOGRAM_COUNT; h++) {
+                    HistogramSnapshot& histogram = result.histograms[h];
+                    for (size_t b = 0; b < BucketLayout::BUCKETS; b++) {
+                        uint64_t count = shard.buckets[h][b].load();
+                        histogram.buckets[b] += count;
+                        histogram.count += count;
+                    }
+                    histogram.sum += shard.sums[h].load();
+                }
+            }
+        };
+
+        // Kapsam süresini histograma kaydeder
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(Histogram histogram)
+                : histogram(histogram), started(std::chrono::steady_clock::now()) {}
+
+            ~ScopedTimer() {
+                auto elapsed = std::chrono::steady_clock::now() - started;
+                Registry::record(histogram, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            Histogram histogram;
+            std::chrono::steady_clock::time_point started;
+        };
+    }
+}
+
+#endif // WHOLF_METRICS_HPP
@@ -5,49 +5,240 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <stdexcept>
 #include <functional>
+#include "metrics.hpp"
 
 namespace Wholf {
     namespace Module {
-        // Modül tanımı
+        // Yönetici ile modüllerinin paylaştığı çağrı durumu
+        struct CallState {
+            // Yükleme, kaldırma ya da export değişikliğiyle artar; 0 hiçbir zaman geçerli dönem değildir
+            uint64_t epoch = 1;
+            size_t activeCalls = 0;
+            // Bir export çalışırken değiştirilen modül ve fonksiyonlar, en dıştaki çağrı bitene kadar canlı tutulur
+            std::vector<std::shared_ptr<const void>> retired;
+            
+            void retire(std::shared_ptr<const void> object) {
+                if (object && activeCalls > 0) retired.push_back(std::move(object));
+            }
+        };
+        
+        // Modül tanımı; export'lar yoğun bir dizide, isimden yuvaya eşleme ayrı tutulur
         class Module {
         public:
+            using Function = std::function<void()>;
+            
             std::string name;
             std::string path;
-            std::map<std::string, std::function<void()>> exports;
+            std::map<std::string, size_t> exports;
+            // Fonksiyonlar ayrı nesnelerdir: dizi büyüse de çalışan bir export'un adresi değişmez
+            std::vector<std::shared_ptr<const Function>> functions;
             
             Module(const std::string& name, const std::string& path)
                 : name(name), path(path) {}
             
-            void exportFunction(const std::string& name, const std::function<void()>& func) {
-                exports[name] = func;
+            // Aynı isim yeniden export edilirse yuvası korunur; eski tutamaçlar yeni fonksiyonu çağırır.
+            // Eski fonksiyon o anda çalışıyor olabilir: yerinde atanmaz, yeni nesne takılır ve eskisi çağrı bitene dek yaşar
+            size_t exportFunction(const std::string& name, const Function& func) {
+                auto function = std::make_shared<const Function>(func);
+                auto it = exports.find(name);
+                size_t slot;
+                if (it != exports.end()) {
+                    slot = it->second;
+                    std::shared_ptr<const Function> previous = std::move(functions[slot]);
+                    functions[slot] = std::move(function);
+                    if (state) state->retire(std::move(previous));
+                } else {
+                    slot = functions.size();
+                    exports[name] = slot;
+                    functions.push_back(std::move(function));
+                }
+                // Toplu çağrıların önbelleğe aldığı hedefler geçersizleşir
+                if (state) ++state->epoch;
+                return slot;
+            }
+            
+        private:
+            friend class ModuleManager;
+            std::shared_ptr<CallState> state;
+        };
+        
+        // Çözülmüş export: modül numarası + export yuvası + modülün yükleme kuşağı.
+        // Modül yeniden yüklenir ya da kaldırılırsa kuşak değişir ve tutamaç bayatlar
+        struct FunctionHandle {
+            uint32_t module = UINT32_MAX;
+            uint32_t slot = 0;
+            uint32_t generation = 0;
+            
+            bool valid() const { return module != UINT32_MAX; }
+        };
+        
+        // Aynı export listesini tekrar tekrar çağırmak için; hedef adresleri bir kez çözülür
+        // ve yöneticinin dönemi değişene kadar yeniden doğrulanmaz
+        class CallBatch {
+        public:
+            CallBatch() = default;
+            explicit CallBatch(std::vector<FunctionHandle> handles) : handles(std::move(handles)) {}
+            
+            void add(const FunctionHandle& handle) {
+                handles.push_back(handle);
+                epoch = 0;
             }
+            
+            size_t size() const { return handles.size(); }
+            
+        private:
+            friend class ModuleManager;
+            std::vector<FunctionHandle> handles;
+            std::vector<const Module::Function*> targets;
+            uint64_t epoch = 0;
         };
         
         // Modül yöneticisi
         class ModuleManager {
         private:
-            std::map<std::string, std::shared_ptr<Module>> modules;
+            struct Entry {
+                std::shared_ptr<Module> module;
+                uint32_t generation = 0;
+            };
+            
+            // Modül numaraları kalıcıdır: yeniden yükleme aynı numarayı yeni kuşakla kullanır
+            std::vector<Entry> table;
+            std::map<std::string, uint32_t> ids;
+            std::shared_ptr<CallState> state = std::make_shared<CallState>();
+            
+            class CallScope {
+            public:
+                explicit CallScope(CallState& state) : state(state) {
+                    state.activeCalls++;
+                }
+                
+                ~CallScope() {
+                    if (--state.activeCalls == 0) state.retired.clear();
+                }
+                
+                CallScope(const CallScope&) = delete;
+                CallScope& operator=(const CallScope&) = delete;
+                
+            private:
+                CallState& state;
+            };
+            
+            const Module::Function& target(const FunctionHandle& handle) const {
+                if (handle.module < table.size()) {
+                    const Entry& entry = table[handle.module];
+                    if (entry.generation == handle.generation && entry.module && handle.slot < entry.module->functions.size()) {
+                        return *entry.module->functions[handle.slot];
+                    }
+                }
+                throw std::runtime_error("Stale or invalid function handle");
+            }
             
         public:
-            // Modül yükleme
+            // Modül yükleme; aynı isimle tekrar yükleme önceki modülün tutamaçlarını bayatlatır
             std::shared_ptr<Module> loadModule(const std::string& name, const std::string& path) {
                 auto module = std::make_shared<Module>(name, path);
-                modules[name] = module;
+                module->state = state;
+                auto it = ids.find(name);
+                if (it == ids.end()) {
+                    ids[name] = static_cast<uint32_t>(table.size());
+                    table.push_back(Entry{module, 0});
+                } else {
+                    Entry& entry = table[it->second];
+                    state->retire(std::move(entry.module));
+                    entry.module = module;
+                    entry.generation++;
+                }
+                ++state->epoch;
                 return module;
             }
             
-            // Modül içe aktarma
-            std::shared_ptr<Module> importModule(const std::string& name) {
-                return modules[name];
+            // Modülü kaldır; numarası ileride aynı isimle yeniden kullanılır
+            bool unloadModule(const std::string& name) {
+                auto it = ids.find(name);
+                if (it == ids.end() || !table[it->second].module) return false;
+                Entry& entry = table[it->second];
+                state->retire(std::move(entry.module));
+                entry.module = nullptr;
+                entry.generation++;
+                ++state->epoch;
+                return true;
             }
             
-            // Fonksiyon çağırma
-            void callFunction(const std::string& moduleName, const std::string& functionName) {
-                auto module = modules[moduleName];
-                if (module && module->exports.find(functionName) != module->exports.end()) {
-                    module->exports[functionName]();
+            // Modül içe aktarma; bilinmeyen isim için nullptr (tabloya boş girdi eklemez)
+            std::shared_ptr<Module> importModule(const std::string& name) const {
+                auto it = ids.find(name);
+                return it == ids.end() ? nullptr : table[it->second].module;
+            }
+            
+            // İsimleri bir kez çöz; sıcak döngülerde call(handle) kullanılır
+            FunctionHandle resolve(const std::string& moduleName, const std::string& functionName) const {
+                auto it = ids.find(moduleName);
+                if (it == ids.end() || !table[it->second].module) throw std::runtime_error("Undefined module: " + moduleName);
+                const Entry& entry = table[it->second];
+                auto slot = entry.module->exports.find(functionName);
+                if (slot == entry.module->exports.end()) {
+                    throw std::runtime_error("Undefined export: " + moduleName + "." + functionName);
                 }
+                return FunctionHandle{it->second, static_cast<uint32_t>(slot->second), entry.generation};
+            }
+            
+            // Tutamaç hâlâ aynı modül yüklemesini gösteriyor mu
+            bool isValid(const FunctionHandle& handle) const {
+                if (handle.module >= table.size()) return false;
+                const Entry& entry = table[handle.module];
+                return entry.generation == handle.generation && entry.module && handle.slot < entry.module->functions.size();
+            }
+            
+            // Tutamaçla çağırma; bayat tutamaç runtime_error fırlatır
+            void call(const FunctionHandle& handle) {
+                WHOLF_COUNT(MODULE_CALLS);
+                WHOLF_TIME_SCOPE(MODULE_CALL_LATENCY);
+                const Module::Function& function = target(handle);
+                CallScope scope(*state);
+                function();
+            }
+            
+            // Toplu çağırma: tutamaçlar sırayla doğrulanır ve çağrılır; ölçüm bir kez yapılır
+            void callBatch(const std::vector<FunctionHandle>& handles) {
+                WHOLF_COUNT_N(MODULE_CALLS, handles.size());
+                WHOLF_TIME_SCOPE(MODULE_CALL_LATENCY);
+                CallScope scope(*state);
+                for (const FunctionHandle& handle : handles) target(handle)();
+            }
+            
+            // Hazırlanmış toplu çağırma: dönem değişmediyse doğrulama atlanır ve adresler doğrudan çağrılır.
+            // Bir export çalışırken dönem değişirse önbellek bayatlar; kalanlar tek tek doğrulanarak
+            // çağrılır ve önbellek bir sonraki toplu çağrıda bir kez yeniden kurulur
+            void callBatch(CallBatch& batch) {
+                WHOLF_COUNT_N(MODULE_CALLS, batch.handles.size());
+                WHOLF_TIME_SCOPE(MODULE_CALL_LATENCY);
+                CallScope scope(*state);
+                if (batch.epoch != state->epoch) {
+                    batch.targets.resize(batch.handles.size());
+                    for (size_t i = 0; i < batch.handles.size(); i++) batch.targets[i] = &target(batch.handles[i]);
+                    batch.epoch = state->epoch;
+                }
+                for (size_t i = 0; i < batch.handles.size(); i++) {
+                    if (batch.epoch == state->epoch) (*batch.targets[i])();
+                    else target(batch.handles[i])();
+                }
+            }
+            
+            // İsimle çağırma; bilinmeyen modül ya da export sessizce yok sayılır
+            void callFunction(const std::string& moduleName, const std::string& functionName) {
+                WHOLF_COUNT(MODULE_CALLS);
+                WHOLF_TIME_SCOPE(MODULE_CALL_LATENCY);
+                auto it = ids.find(moduleName);
+                if (it == ids.end() || !table[it->second].module) return;
+                const Module& module = *table[it->second].module;
+                auto slot = module.exports.find(functionName);
+                if (slot == module.exports.end()) return;
+                const Module::Function& function = *module.functions[slot->second];
+                CallScope scope(*state);
+                function();
             }
         };
         
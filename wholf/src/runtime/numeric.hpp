@@ -0,0 +1,541 @@
+#ifndef WHOLF_NUMERIC_HPP
+#define WHOLF_NUMERIC_HPP
+
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../interpreter/Value.hpp"
+
+// AVX2 çekirdekleri target özniteliğiyle derlenir; hangisinin çalışacağına çalışma zamanında karar verilir
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define WHOLF_NUMERIC_AVX2 1
+#define WHOLF_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define WHOLF_NUMERIC_AVX2 0
+#endif
+
+namespace Wholf {
+    namespace Numeric {
+        enum class Isa {
+            SCALAR,
+            AVX2
+        };
+
+        enum class Operation {
+            ADD,
+            SUBTRACT,
+            MULTIPLY,
+            DIVIDE
+        };
+
+        inline const char* isaName(Isa isa) {
+            return isa == Isa::AVX2 ? "avx2" : "scalar";
+        }
+
+        inline Isa detectIsa() {
+#if WHOLF_NUMERIC_AVX2
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return Isa::AVX2;
+#endif
+            return Isa::SCALAR;
+        }
+
+        namespace Detail {
+            inline std::atomic<Isa>& activeIsa() {
+                static std::atomic<Isa> isa{detectIsa()};
+                return isa;
+            }
+        }
+
+        inline Isa isa() {
+            return Detail::activeIsa().load(std::memory_order_relaxed);
+        }
+
+        // Karşılaştırma ve test için skaler yola zorlanabilir
+        inline void setIsa(Isa isa) {
+            if (isa == Isa::AVX2 && detectIsa() != Isa::AVX2) throw std::runtime_error("AVX2 is not supported on this CPU");
+            Detail::activeIsa().store(isa, std::memory_order_relaxed);
+        }
+
+        namespace Detail {
+            // Skaler yol; Int32 aritmetiği taşmada sarar
+            template<Operation Op>
+            inline double apply(double a, double b) {
+                if constexpr (Op == Operation::ADD) return a + b;
+                else if constexpr (Op == Operation::SUBTRACT) return a - b;
+                else if constexpr (Op == Operation::MULTIPLY) return a * b;
+                else return a / b;
+            }
+
+            template<Operation Op>
+            inline float apply(float a, float b) {
+                if constexpr (Op == Operation::ADD) return a + b;
+                else if constexpr (Op == Operation::SUBTRACT) return a - b;
+                else if constexpr (Op == Operation::MULTIPLY) return a * b;
+                else return a / b;
+            }
+
+            template<Operation Op>
+            inline int32_t apply(int32_t a, int32_t b) {
+                uint32_t left = static_cast<uint32_t>(a);
+                uint32_t right = static_cast<uint32_t>(b);
+                if constexpr (Op == Operation::ADD) return static_cast<int32_t>(left + right);
+                else if constexpr (Op == Operation::SUBTRACT) return static_cast<int32_t>(left - right);
+                else if constexpr (Op == Operation::MULTIPLY) return static_cast<int32_t>(left * right);
+                else {
+                    // Sıfır bölen önceden reddedilir; INT32_MIN / -1 sarar
+                    if (b == -1) return static_cast<int32_t>(0u - left);
+                    return a / b;
+                }
+            }
+
+            template<Operation Op, bool Broadcast, typename T>
+            void binaryScalar(const T* a, const T* b, T scalar, T* out, size_t count) {
+                for (size_t i = 0; i < count; i++) out[i] = apply<Op>(a[i], Broadcast ? scalar : b[i]);
+            }
+
+            template<typename T>
+            double sumScalar(const T* values, size_t count) {
+                if constexpr (std::is_same_v<T, int32_t>) {
+                    int64_t total = 0;
+                    for (size_t i = 0; i < count; i++) total += values[i];
+                    return static_cast<double>(total);
+                } else {
+                    double total = 0;
+                    for (size_t i = 0; i < count; i++) total += values[i];
+                    return total;
+                }
+            }
+
+            // NaN elemanlar atlanır
+            template<typename T>
+            T extremeScalar(const T* values, size_t count, T initial, bool maximum) {
+                T best = initial;
+                for (size_t i = 0; i < count; i++) {
+                    if (maximum ? values[i] > best : values[i] < best) best = values[i];
+                }
+                return best;
+            }
+
+            template<typename T>
+            double dotScalar(const T* a, const T* b, size_t count) {
+                double total = 0;
+                for (size_t i = 0; i < count; i++) total += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+                return total;
+            }
+
+#if WHOLF_NUMERIC_AVX2
+            namespace Avx2 {
+                WHOLF_TARGET_AVX2 inline __m256d load(const double* p) { return _mm256_loadu_pd(p); }
+                WHOLF_TARGET_AVX2 inline __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+                WHOLF_TARGET_AVX2 inline __m256i load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+                WHOLF_TARGET_AVX2 inline void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+                WHOLF_TARGET_AVX2 inline void store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+                WHOLF_TARGET_AVX2 inline void store(int32_t* p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+                WHOLF_TARGET_AVX2 inline __m256d broadcast(double v) { return _mm256_set1_pd(v); }
+                WHOLF_TARGET_AVX2 inline __m256 broadcast(float v) { return _mm256_set1_ps(v); }
+                WHOLF_TARGET_AVX2 inline __m256i broadcast(int32_t v) { return _mm256_set1_epi32(v); }
+
+                template<Operation Op>
+                WHOLF_TARGET_AVX2 inline __m256d apply(__m256d a, __m256d b) {
+                    if constexpr (Op == Operation::ADD) return _mm256_add_pd(a, b);
+                    else if constexpr (Op == Operation::SUBTRACT) return _mm256_sub_pd(a, b);
+                    else if constexpr (Op == Operation::MULTIPLY) return _mm256_mul_pd(a, b);
+                    else return _mm256_div_pd(a, b);
+                }
+
+                template<Operation Op>
+                WHOLF_TARGET_AVX2 inline __m256 apply(__m256 a, __m256 b) {
+                    if constexpr (Op == Operation::ADD) return _mm256_add_ps(a, b);
+                    else if constexpr (Op == Operation::SUBTRACT) return _mm256_sub_ps(a, b);
+                    else if constexpr (Op == Operation::MULTIPLY) return _mm256_mul_ps(a, b);
+                    else return _mm256_div_ps(a, b);
+                }
+
+                // Tam sayı bölmesinin vektör karşılığı yok; DIVIDE skaler yoldan gider
+                template<Operation Op>
+                WHOLF_TARGET_AVX2 inline __m256i apply(__m256i a, __m256i b) {
+                    if constexpr (Op == Operation::ADD) return _mm256_add_epi32(a, b);
+                    else if constexpr (Op == Operation::SUBTRACT) return _mm256_sub_epi32(a, b);
+                    else return _mm256_mullo_epi32(a, b);
+                }
+
+                template<Operation Op, bool Broadcast, typename T>
+                WHOLF_TARGET_AVX2 void binary(const T* a, const T* b, T scalar, T* out, size_t count) {
+                    constexpr size_t lanes = 32 / sizeof(T);
+                    const auto right = broadcast(scalar);
+                    size_t i = 0;
+                    for (; i + 2 * lanes <= count; i += 2 * lanes) {
+                        auto first = apply<Op>(load(a + i), Broadcast ? right : load(b + i));
+                        auto second = apply<Op>(load(a + i + lanes), Broadcast ? right : load(b + i + lanes));
+                        store(out + i, first);
+                        store(out + i + lanes, second);
+                    }
+                    for (; i < count; i++) out[i] = Detail::apply<Op>(a[i], Broadcast ? scalar : b[i]);
+                }
+
+                WHOLF_TARGET_AVX2 inline double horizontal(__m256d v) {
+                    __m128d low = _mm256_castpd256_pd128(v);
+                    __m128d high = _mm256_extractf128_pd(v, 1);
+                    low = _mm_add_pd(low, high);
+                    return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+                }
+
+                // Float32 ve Int32 toplamları double/int64'te biriktirilir
+                WHOLF_TARGET_AVX2 inline double sum(const double* values, size_t count) {
+                    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd(), c = _mm256_setzero_pd(), d = _mm256_setzero_pd();
+                    size_t i = 0;
+                    for (; i + 16 <= count; i += 16) {
+                        a = _mm256_add_pd(a, _mm256_loadu_pd(values + i));
+                        b = _mm256_add_pd(b, _mm256_loadu_pd(values + i + 4));
+                        c = _mm256_add_pd(c, _mm256_loadu_pd(values + i + 8));
+                        d = _mm256_add_pd(d, _mm256_loadu_pd(values + i + 12));
+                    }
+                    double total = horizontal(_mm256_add_pd(_mm256_add_pd(a, b), _mm256_add_pd(c, d)));
+                    for (; i < count; i++) total += values[i];
+                    return total;
+                }
+
+                WHOLF_TARGET_AVX2 inline double sum(const float* values, size_t count) {
+                    __m256d a = _mm256_setzero_pd(), b = _mm256_setzero_pd();
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8) {
+                        __m256 v = _mm256_loadu_ps(values + i);
+                        a = _mm256_add_pd(a, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+                        b = _mm256_add_pd(b, _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+                    }
+                    double total = horizontal(_mm256_add_pd(a, b));
+                    for (; i < count; i++) total += values[i];
+                    return total;
+                }
+
+                WHOLF_TARGET_AVX2 inline double sum(const int32_t* values, size_t count) {
+                    __m256i a = _mm256_setzero_si256(), b = _mm256_setzero_si256();
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8) {
+                        __m256i v = load(values + i);
+                        a = _mm256_add_epi64(a, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+                        b = _mm256_add_epi64(b, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+                    }
+                    int64_t lanes[4];
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(a, b));
+                    int64_t total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+                    for (; i < count; i++) total += values[i];
+                    return static_cast<double>(total);
+                }
+
+                // min/max(eleman, biriktirici): eleman NaN ise biriktirici korunur
+                WHOLF_TARGET_AVX2 inline double extreme(const double* values, size_t count, double initial, bool maximum) {
+                    __m256d best = _mm256_set1_pd(initial);
+                    size_t i = 0;
+                    if (maximum) {
+                        for (; i + 4 <= count; i += 4) best = _mm256_max_pd(_mm256_loadu_pd(values + i), best);
+                    } else {
+                        for (; i + 4 <= count; i += 4) best = _mm256_min_pd(_mm256_loadu_pd(values + i), best);
+                    }
+                    double lanes[4];
+                    _mm256_storeu_pd(lanes, best);
+                    double result = extremeScalar(lanes, 4, initial, maximum);
+                    return extremeScalar(values + i, count - i, result, maximum);
+                }
+
+                WHOLF_TARGET_AVX2 inline float extreme(const float* values, size_t count, float initial, bool maximum) {
+                    __m256 best = _mm256_set1_ps(initial);
+                    size_t i = 0;
+                    if (maximum) {
+                        for (; i + 8 <= count; i += 8) best = _mm256_max_ps(_mm256_loadu_ps(values + i), best);
+                    } else {
+                        for (; i + 8 <= count; i += 8) best = _mm256_min_ps(_mm256_loadu_ps(values + i), best);
+                    }
+                    float lanes[8];
+                    _mm256_storeu_ps(lanes, best);
+                    float result = extremeScalar(lanes, 8, initial, maximum);
+                    return extremeScalar(values + i, count - i, result, maximum);
+                }
+
+                WHOLF_TARGET_AVX2 inline int32_t extreme(const int32_t* values, size_t count, int32_t initial, bool maximum) {
+                    __m256i best = _mm256_set1_epi32(initial);
+                    size_t i = 0;
+                    if (maximum) {
+                        for (; i + 8 <= count; i += 8) best = _mm256_max_epi32(load(values + i), best);
+                    } else {
+                        for (; i + 8 <= count; i += 8) best = _mm256_min_epi32(load(values + i), best);
+                    }
+                    int32_t lanes[8];
+                    store(lanes, best);
+                    int32_t result = extremeScalar(lanes, 8, initial, maximum);
+                    return extremeScalar(values + i, count - i, result, maximum);
+                }
+
+                WHOLF_TARGET_AVX2 inline double dot(const double* a, const double* b, size_t count) {
+                    __m256d first = _mm256_setzero_pd(), second = _mm256_setzero_pd();
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8) {
+                        first = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), first);
+                        second = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), second);
+                    }
+                    double total = horizontal(_mm256_add_pd(first, second));
+                    for (; i < count; i++) total += a[i] * b[i];
+                    return total;
+                }
+
+                WHOLF_TARGET_AVX2 inline double dot(const float* a, const float* b, size_t count) {
+                    __m256d first = _mm256_setzero_pd(), second = _mm256_setzero_pd();
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8) {
+                        __m256 left = _mm256_loadu_ps(a + i);
+                        __m256 right = _mm256_loadu_ps(b + i);
+                        first = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(left)), _mm256_cvtps_pd(_mm256_castps256_ps128(right)), first);
+                        second = _mm256_fmadd_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(left, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(right, 1)), second);
+                    }
+                    double total = horizontal(_mm256_add_pd(first, second));
+                    for (; i < count; i++) total += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+                    return total;
+                }
+
+                WHOLF_TARGET_AVX2 inline double dot(const int32_t* a, const int32_t* b, size_t count) {
+                    __m256d first = _mm256_setzero_pd(), second = _mm256_setzero_pd();
+                    size_t i = 0;
+                    for (; i + 8 <= count; i += 8) {
+                        __m256i left = load(a + i);
+                        __m256i right = load(b + i);
+                        first = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(left)), _mm256_cvtepi32_pd(_mm256_castsi256_si128(right)), first);
+                        second = _mm256_fmadd_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(left, 1)), _mm256_cvtepi32_pd(_mm256_extracti128_si256(right, 1)), second);
+                    }
+                    double total = horizontal(_mm256_add_pd(first, second));
+                    for (; i < count; i++) total += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+                    return total;
+                }
+            }
+#endif
+
+            template<Operation Op, bool Broadcast, typename T>
+            void binary(const T* a, const T* b, T scalar, T* out, size_t count) {
+#if WHOLF_NUMERIC_AVX2
+                if constexpr (!(std::is_same_v<T, int32_t> && Op == Operation::DIVIDE)) {
+                    if (isa() == Isa::AVX2) {
+                        Avx2::binary<Op, Broadcast>(a, b, scalar, out, count);
+                        return;
+                    }
+                }
+#endif
+                binaryScalar<Op, Broadcast>(a, b, scalar, out, count);
+            }
+
+            template<bool Broadcast, typename T>
+            void dispatch(Operation op, const T* a, const T* b, T scalar, T* out, size_t count) {
+                switch (op) {
+                    case Operation::ADD: binary<Operation::ADD, Broadcast>(a, b, scalar, out, count); break;
+                    case Operation::SUBTRACT: binary<Operation::SUBTRACT, Broadcast>(a, b, scalar, out, count); break;
+                    case Operation::MULTIPLY: binary<Operation::MULTIPLY, Broadcast>(a, b, scalar, out, count); break;
+                    case Operation::DIVIDE: binary<Operation::DIVIDE, Broadcast>(a, b, scalar, out, count); break;
+                }
+            }
+
+            template<typename T>
+            double sum(const T* values, size_t count) {
+#if WHOLF_NUMERIC_AVX2
+                if (isa() == Isa::AVX2) return Avx2::sum(values, count);
+#endif
+                return sumScalar(values, count);
+            }
+
+            template<typename T>
+            T extreme(const T* values, size_t count, T initial, bool maximum) {
+#if WHOLF_NUMERIC_AVX2
+                if (isa() == Isa::AVX2) return Avx2::extreme(values, count, initial, maximum);
+#endif
+                return extremeScalar(values, count, initial, maximum);
+            }
+
+            template<typename T>
+            double dot(const T* a, const T* b, size_t count) {
+#if WHOLF_NUMERIC_AVX2
+                if (isa() == Isa::AVX2) return Avx2::dot(a, b, count);
+#endif
+                return dotScalar(a, b, count);
+            }
+
+            inline void checkSameShape(const TypedArray& a, const TypedArray& b) {
+                if (a.type() != b.type()) throw std::runtime_error(std::string("Typed array type mismatch: ") + a.typeName() + " and " + b.typeName());
+                if (a.size() != b.size()) throw std::runtime_error("Typed array length mismatch: " + std::to_string(a.size()) + " and " + std::to_string(b.size()));
+            }
+
+            inline void checkDivisors(const int32_t* values, size_t count) {
+                for (size_t i = 0; i < count; i++) {
+                    if (values[i] == 0) throw std::runtime_error("Division by zero");
+                }
+            }
+
+            inline int32_t toInt32(double value) {
+                if (!(value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) || value != std::trunc(value)) {
+                    throw std::runtime_error("Scalar operand is not a valid Int32: " + std::to_string(value));
+                }
+                return static_cast<int32_t>(value);
+            }
+        }
+
+        // out = a (op) b; out a ya da b'nin kendisi olabilir (yerinde işlem)
+        inline void compute(Operation op, const TypedArray& a, const TypedArray& b, TypedArray& out) {
+            Detail::checkSameShape(a, b);
+            Detail::checkSameShape(a, out);
+            size_t count = a.size();
+            switch (a.type()) {
+                case ElementType::FLOAT64:
+                    Detail::dispatch<false>(op, a.data<double>(), b.data<double>(), 0.0, out.data<double>(), count);
+                    break;
+                case ElementType::FLOAT32:
+                    Detail::dispatch<false>(op, a.data<float>(), b.data<float>(), 0.0f, out.data<float>(), count);
+                    break;
+                case ElementType::INT32:
+                    if (op == Operation::DIVIDE) Detail::checkDivisors(b.data<int32_t>(), count);
+                    Detail::dispatch<false>(op, a.data<int32_t>(), b.data<int32_t>(), 0, out.data<int32_t>(), count);
+                    break;
+            }
+        }
+
+        // out = a (op) skaler; skaler eleman tipine çevrilir (Int32 için tam sayı olmalı)
+        inline void compute(Operation op, const TypedArray& a, double scalar, TypedArray& out) {
+            Detail::checkSameShape(a, out);
+            size_t count = a.size();
+            switch (a.type()) {
+                case ElementType::FLOAT64:
+                    Detail::dispatch<true>(op, a.data<double>(), static_cast<const double*>(nullptr), scalar, out.data<double>(), count);
+                    break;
+                case ElementType::FLOAT32:
+                    Detail::dispatch<true>(op, a.data<float>(), static_cast<const float*>(nullptr), static_cast<float>(scalar), out.data<float>(), count);
+                    break;
+                case ElementType::INT32: {
+                    int32_t value = Detail::toInt32(scalar);
+                    if (op == Operation::DIVIDE && value == 0) throw std::runtime_error("Division by zero");
+                    Detail::dispatch<true>(op, a.data<int32_t>(), static_cast<const int32_t*>(nullptr), value, out.data<int32_t>(), count);
+                    break;
+                }
+            }
+        }
+
+        inline TypedArray compute(Operation op, const TypedArray& a, const TypedArray& b) {
+            TypedArray out(a.type(), a.size());
+            compute(op, a, b, out);
+            return out;
+        }
+
+        inline TypedArray compute(Operation op, const TypedArray& a, double scalar) {
+            TypedArray out(a.type(), a.size());
+            compute(op, a, scalar, out);
+            return out;
+        }
+
+        inline TypedArray add(const TypedArray& a, const TypedArray& b) { return compute(Operation::ADD, a, b); }
+        inline TypedArray subtract(const TypedArray& a, const TypedArray& b) { return compute(Operation::SUBTRACT, a, b); }
+        inline TypedArray multiply(const TypedArray& a, const TypedArray& b) { return compute(Operation::MULTIPLY, a, b); }
+        inline TypedArray divide(const TypedArray& a, const TypedArray& b) { return compute(Operation::DIVIDE, a, b); }
+        inline TypedArray add(const TypedArray& a, double b) { return compute(Operation::ADD, a, b); }
+        inline TypedArray subtract(const TypedArray& a, double b) { return compute(Operation::SUBTRACT, a, b); }
+        inline TypedArray multiply(const TypedArray& a, double b) { return compute(Operation::MULTIPLY, a, b); }
+        inline TypedArray divide(const TypedArray& a, double b) { return compute(Operation::DIVIDE, a, b); }
+
+        // Float32/Int32 toplamları double/int64'te biriktirilir; vektör yolu toplama sırasını değiştirir
+        inline double sum(const TypedArray& a) {
+            switch (a.type()) {
+                case ElementType::FLOAT64: return Detail::sum(a.data<double>(), a.size());
+                case ElementType::FLOAT32: return Detail::sum(a.data<float>(), a.size());
+                case ElementType::INT32: return Detail::sum(a.data<int32_t>(), a.size());
+            }
+            return 0;
+        }
+
+        inline double mean(const TypedArray& a) {
+            return a.size() ? sum(a) / static_cast<double>(a.size()) : std::numeric_limits<double>::quiet_NaN();
+        }
+
+        namespace Detail {
+            // NaN'lar atlanır; boş ya da tamamı NaN ise NaN
+            inline double extreme(const TypedArray& a, bool maximum) {
+                const double infinity = std::numeric_limits<double>::infinity();
+                double result;
+                switch (a.type()) {
+                    case ElementType::INT32: {
+                        if (a.size() == 0) return std::numeric_limits<double>::quiet_NaN();
+                        int32_t initial = maximum ? std::numeric_limits<int32_t>::min() : std::numeric_limits<int32_t>::max();
+                        return extreme(a.data<int32_t>(), a.size(), initial, maximum);
+                    }
+                    case ElementType::FLOAT64:
+                        result = extreme(a.data<double>(), a.size(), maximum ? -infinity : infinity, maximum);
+                        break;
+                    case ElementType::FLOAT32: {
+                        float initial = maximum ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::infinity();
+                        result = extreme(a.data<float>(), a.size(), initial, maximum);
+                        break;
+                    }
+                    default:
+                        return 0;
+                }
+                // Başlangıç değeri döndüyse gerçekten o değere sahip bir eleman var mı?
+                if (result == (maximum ? -infinity : infinity)) {
+                    for (size_t i = 0; i < a.size(); i++) {
+                        if (a.get(i) == result) return result;
+                    }
+                    return std::numeric_limits<double>::quiet_NaN();
+                }
+                return result;
+            }
+        }
+
+        inline double min(const TypedArray& a) { return Detail::extreme(a, false); }
+        inline double max(const TypedArray& a) { return Detail::extreme(a, true); }
+
+        inline double dot(const TypedArray& a, const TypedArray& b) {
+            Detail::checkSameShape(a, b);
+            switch (a.type()) {
+                case ElementType::FLOAT64: return Detail::dot(a.data<double>(), b.data<double>(), a.size());
+                case ElementType::FLOAT32: return Detail::dot(a.data<float>(), b.data<float>(), a.size());
+                case ElementType::INT32: return Detail::dot(a.data<int32_t>(), b.data<int32_t>(), a.size());
+            }
+            return 0;
+        }
+
+        // Kutulu dizi -> tipli dizi; elemanlar sayı olmalı (Int32'ye kesilerek)
+        inline TypedArray fromValues(ElementType type, const std::vector<Value>& values) {
+            TypedArray result(type, values.size());
+            for (size_t i = 0; i < values.size(); i++) {
+                const Value& value = values[i];
+                if (value.type == DataType::INTEGER) {
+                    result.set(i, std::get<int>(value.data));
+                } else if (value.type == DataType::FLOAT) {
+                    result.set(i, std::get<float>(value.data));
+                } else {
+                    throw std::runtime_error("Typed array element is not a number");
+                }
+            }
+            return result;
+        }
+
+        // Tipli dizi -> betik dizisi (Int32 -> int, diğerleri float)
+        inline Value toValue(const TypedArray& array) {
+            std::vector<Value> values;
+            values.reserve(array.size());
+            for (size_t i = 0; i < array.size(); i++) {
+                if (array.type() == ElementType::INT32) values.emplace_back(static_cast<int>(array.data<int32_t>()[i]));
+                else values.emplace_back(static_cast<float>(array.get(i)));
+            }
+            return Value(std::move(values));
+        }
+
+        // Eleman tipi dönüşümü (Int32'ye kesilerek, sınırlarda doyurarak)
+        inline TypedArray convert(const TypedArray& array, ElementType type) {
+            if (array.type() == type) return array.clone();
+            TypedArray result(type, array.size());
+            for (size_t i = 0; i < array.size(); i++) result.set(i, array.get(i));
+            return result;
+        }
+    }
+}
+
+#endif // WHOLF_NUMERIC_HPP
@@ -0,0 +1,830 @@
+#ifndef WHOLF_PACKAGE_HPP
+#define WHOLF_PACKAGE_HPP
+
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "file.hpp"
+#include "hash.hpp"
+
+namespace Wholf {
+    namespace Packages {
+        // Proje ve paket bildirimi: her satırda "ad aralık"; '#' sonrası yorum
+        inline const char* const MANIFEST_FILE = "wholf.deps";
+        inline const char* const LOCK_FILE = "wholf.lock";
+        inline const char* const MODULES_DIRECTORY = "wholf_modules";
+        // Kurulu paket dizinindeki bütünlük işareti; eşleşirse bağlama atlanır
+        inline const char* const INTEGRITY_MARKER = ".wholf-integrity";
+
+        // Paket adları dizin adı olarak kullanılır; yol kaçışına izin verilmez
+        inline void checkName(const std::string& name) {
+            bool valid = !name.empty() && name[0] != '.' && name.size() <= 214;
+            for (char c : name) {
+                if (!(std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.')) valid = false;
+            }
+            if (!valid) throw std::runtime_error("Invalid package name: " + name);
+        }
+
+        struct Version {
+            uint32_t major = 0;
+            uint32_t minor = 0;
+            uint32_t patch = 0;
+
+            // "1", "1.2" ve "1.2.3" kabul edilir; ön sürüm etiketleri desteklenmez
+            static bool tryParse(const std::string& text, Version& version) {
+                uint32_t parts[3] = {0, 0, 0};
+                size_t part = 0;
+                size_t position = 0;
+                while (true) {
+                    if (position >= text.size() || !std::isdigit(static_cast<unsigned char>(text[position]))) return false;
+                    uint64_t value = 0;
+                    while (position < text.size() && std::isdigit(static_cast<unsigned char>(text[position]))) {
+                        value = value * 10 + static_cast<uint64_t>(text[position++] - '0');
+                        if (value > UINT32_MAX) return false;
+                    }
+                    parts[part++] = static_cast<uint32_t>(value);
+                    if (position == text.size()) break;
+                    if (text[position] != '.' || part == 3) return false;
+                    position++;
+                }
+                version = Version{parts[0], parts[1], parts[2]};
+                return true;
+            }
+
+            static Version parse(const std::string& text) {
+                Version version;
+                if (!tryParse(text, version)) throw std::runtime_error("Invalid version: " + text);
+                return version;
+            }
+
+            std::string toString() const {
+                return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
+            }
+
+            bool operator<(const Version& other) const {
+                if (major != other.major) return major < other.major;
+                if (minor != other.minor) return minor < other.minor;
+                return patch < other.patch;
+            }
+
+            bool operator==(const Version& other) const {
+                return major == other.major && minor == other.minor && patch == other.patch;
+            }
+
+            bool operator!=(const Version& other) const { return !(*this == other); }
+        };
+
+        // Sürüm aralığı: "*", "1.2.3" (tam), "^1.2.3", "~1.2.3", ">=1.2.3"
+        struct Range {
+            enum class Kind {
+                ANY,
+                EXACT,
+                // Aynı ana sürüm (0.x için aynı ikincil sürüm, 0.0.x için tam sürüm) ve en az verilen
+                CARET,
+                // Aynı ana ve ikincil sürüm ve en az verilen
+                TILDE,
+                AT_LEAST
+            };
+
+            Kind kind = Kind::ANY;
+            Version version;
+
+            static Range parse(const std::string& text) {
+                Range range;
+                if (text.empty() || text == "*") return range;
+                std::string rest = text;
+                if (text[0] == '^') {
+                    range.kind = Kind::CARET;
+                    rest = text.substr(1);
+                } else if (text[0] == '~') {
+                    range.kind = Kind::TILDE;
+                    rest = text.substr(1);
+                } else if (text.compare(0, 2, ">=") == 0) {
+                    range.kind = Kind::AT_LEAST;
+                    rest = text.substr(2);
+                } else {
+                    range.kind = Kind::EXACT;
+                }
+                if (!Version::tryParse(rest, range.version)) throw std::runtime_error("Invalid version range: " + text);
+                return range;
+            }
+
+            bool matches(const Version& candidate) const {
+                switch (kind) {
+                    case Kind::ANY:
+                        return true;
+                    case Kind::EXACT:
+                        return candidate == version;
+                    case Kind::CARET:
+                        if (candidate < version || candidate.major != version.major) return false;
+                        if (version.major != 0) return true;
+                        if (candidate.minor != version.minor) return false;
+                        return version.minor != 0 || candidate.patch == version.patch;
+                    case Kind::TILDE:
+                        return !(candidate < version) && candidate.major == version.major && candidate.minor == version.minor;
+                    case Kind::AT_LEAST:
+                        return !(candidate < version);
+                }
+                return false;
+            }
+        };
+
+        struct Dependency {
+            std::string name;
+            std::string range;
+        };
+
+        // Bildirim dosyasını oku; dosya yoksa bağımlılık yoktur
+        inline std::vector<Dependency> readManifest(const std::string& path) {
+            std::vector<Dependency> dependencies;
+            if (!std::filesystem::exists(path)) return dependencies;
+            std::string content;
+            File::FileOperations().readFile(path, content);
+            std::istringstream lines(content);
+            std::string line;
+            size_t number = 0;
+            while (std::getline(lines, line)) {
+                number++;
+                line = line.substr(0, line.find('#'));
+                std::istringstream fields(line);
+                Dependency dependency;
+                if (!(fields >> dependency.name)) continue;
+                fields >> dependency.range;
+                std::string extra;
+                if (fields >> extra) throw std::runtime_error("Malformed manifest line " + std::to_string(number) + ": " + path);
+                checkName(dependency.name);
+                Range::parse(dependency.range);
+                dependencies.push_back(std::move(dependency));
+            }
+            return dependencies;
+        }
+
+        inline void writeManifest(const std::string& path, const std::vector<Dependency>& dependencies) {
+            std::string content;
+            for (const auto& dependency : dependencies) {
+                content += dependency.name + " " + (dependency.range.empty() ? "*" : dependency.range) + "\n";
+            }
+            File::FileOperations().writeFileAtomic(path, content, File::Durability::NONE);
+        }
+
+        struct LockedPackage {
+            std::string name;
+            Version version;
+            // "sha256-<hex>"; paket dizininin (dosya yolu + içerik özeti) listesinin özeti.
+            // Çözümleyici boş bırakır, ilk kurulumda doldurulur
+            std::string integrity;
+            std::vector<std::string> dependencies;
+        };
+
+        // Kilit dosyası: düz (her ad için tek sürüm) bağımlılık kapanışı.
+        // Satır biçimi: "ad sürüm sha256-<hex> bağımlılık..."; paketler ada göre sıralıdır
+        class Lockfile {
+        public:
+            std::vector<LockedPackage> packages;
+
+            static Lockfile read(const std::string& path) {
+                Lockfile lock;
+                if (!std::filesystem::exists(path)) return lock;
+                std::string content;
+                File::FileOperations().readFile(path, content);
+                std::istringstream lines(content);
+                std::string line;
+                while (std::getline(lines, line)) {
+                    if (line.empty() || line[0] == '#') continue;
+                    std::istringstream fields(line);
+                    LockedPackage package;
+                    std::string version;
+                    if (!(fields >> package.name >> version >> package.integrity)) {
+                        throw std::runtime_error("Malformed lockfile: " + path);
+                    }
+                    checkName(package.name);
+                    package.version = Version::parse(version);
+                    if (package.integrity == "-") package.integrity.clear();
+                    std::string dependency;
+                    while (fields >> dependency) package.dependencies.push_back(dependency);
+                    lock.packages.push_back(std::move(package));
+                }
+                lock.sort();
+                return lock;
+            }
+
+            void write(const std::string& path) const {
+                std::string content = "# wholf.lock: otomatik üretilir, elle düzenlemeyin\n";
+                for (const auto& package : packages) {
+                    content += package.name + " " + package.version.toString() + " " +
+                               (package.integrity.empty() ? "-" : package.integrity);
+                    for (const auto& dependency : package.dependencies) content += " " + dependency;
+                    content += "\n";
+                }
+                File::FileOperations().writeFileAtomic(path, content, File::Durability::NONE);
+            }
+
+            const LockedPackage* find(const std::string& name) const {
+                auto it = std::lower_bound(packages.begin(), packages.end(), name,
+                    [](const LockedPackage& package, const std::string& key) { return package.name < key; });
+                return it != packages.end() && it->name == name ? &*it : nullptr;
+            }
+
+            // Kilit, bildirimi karşılıyor mu: her kök uygun sürümde kilitli ve kapanış eksiksiz
+            bool satisfies(const std::vector<Dependency>& roots) const {
+                for (const auto& root : roots) {
+                    const LockedPackage* package = find(root.name);
+                    if (!package || !Range::parse(root.range).matches(package->version)) return false;
+                }
+                for (const auto& package : packages) {
+                    for (const auto& dependency : package.dependencies) {
+                        if (!find(dependency)) return false;
+                    }
+                }
+                return true;
+            }
+
+            // Köklerden erişilebilen paketler; bildirimden çıkarılanlar dahil edilmez
+            std::vector<LockedPackage> closure(const std::vector<Dependency>& roots) const {
+                std::set<std::string> seen;
+                std::vector<std::string> pending;
+                for (const auto& root : roots) pending.push_back(root.name);
+                std::vector<LockedPackage> result;
+                while (!pending.empty()) {
+                    std::string name = std::move(pending.back());
+                    pending.pop_back();
+                    if (!seen.insert(name).second) continue;
+                    const LockedPackage* package = find(name);
+                    if (!package) throw std::runtime_error("Package missing from lockfile: " + name);
+                    result.push_back(*package);
+                    for (const auto& dependency : package->dependencies) pending.push_back(dependency);
+                }
+                std::sort(result.begin(), result.end(),
+                    [](const LockedPackage& a, const LockedPackage& b) { return a.name < b.name; });
+                return result;
+            }
+
+            void sort() {
+                std::sort(packages.begin(), packages.end(),
+                    [](const LockedPackage& a, const LockedPackage& b) { return a.name < b.name; });
+            }
+        };
+
+        // Ağ erişimi olmayan yerel kayıt: <kök>/<ad>/<sürüm>/ altında açılmış paket dizinleri.
+        // Paketin kendi bağımlılıkları dizinindeki wholf.deps dosyasındadır.
+        // Kök boş olabilir; kilit güncelse kayda hiç başvurulmaz
+        class Registry {
+        public:
+            explicit Registry(const std::string& root) : root(root) {}
+
+            // Geçerli sürümler, büyükten küçüğe
+            std::vector<Version> versions(const std::string& name) const {
+                checkName(name);
+                if (root.empty()) throw std::runtime_error("No package registry configured (needed to resolve " + name + ")");
+                std::vector<Version> result;
+                std::error_code error;
+                for (const auto& entry : std::filesystem::directory_iterator(root + "/" + name, error)) {
+                    Version version;
+                    if (entry.is_directory() && Version::tryParse(entry.path().filename().string(), version)) {
+                        result.push_back(version);
+                    }
+                }
+                std::sort(result.begin(), result.end(), [](const Version& a, const Version& b) { return b < a; });
+                return result;
+            }
+
+            std::string directory(const std::string& name, const Version& version) const {
+                checkName(name);
+                if (root.empty()) throw std::runtime_error("No package registry configured (needed to fetch " + name + ")");
+                return root + "/" + name + "/" + version.toString();
+            }
+
+            std::vector<Dependency> dependencies(const std::string& name, const Version& version) const {
+                return readManifest(directory(name, version) + "/" + MANIFEST_FILE);
+            }
+
+        private:
+            std::string root;
+        };
+
+        // Düz çözümleyici: her ad için tek sürüm. Aralığa uyan en yüksek sürüm seçilir;
+        // önce bildirim sırasıyla kökler, sonra genişlik öncelikli bağımlılıklar.
+        // Geri izleme yoktur: sonradan gelen uyumsuz bir aralık çakışma hatasıdır
+        inline Lockfile resolve(const std::vector<Dependency>& roots, const Registry& registry) {
+            struct Request {
+                Dependency dependency;
+                std::string requiredBy;
+            };
+            std::map<std::string, LockedPackage> selected;
+            std::vector<Request> queue;
+            for (const auto& root : roots) queue.push_back(Request{root, "project"});
+            for (size_t index = 0; index < queue.size(); index++) {
+                Request request = queue[index];
+                Range range = Range::parse(request.dependency.range);
+                auto existing = selected.find(request.dependency.name);
+                if (existing != selected.end()) {
+                    if (!range.matches(existing->second.version)) {
+                        throw std::runtime_error("Version conflict: " + request.requiredBy + " requires " +
+                            request.dependency.name + " " + request.dependency.range + ", but " +
+                            existing->second.version.toString() + " is already selected");
+                    }
+                    continue;
+                }
+                const Version* chosen = nullptr;
+                std::vector<Version> available = registry.versions(request.dependency.name);
+                for (const auto& version : available) {
+                    if (range.matches(version)) {
+                        chosen = &version;
+                        break;
+                    }
+                }
+                if (!chosen) {
+                    throw std::runtime_error("No version of " + request.dependency.name + " matches " +
+                        (request.dependency.range.empty() ? "*" : request.dependency.range) + " (required by " + request.requiredBy + ")");
+                }
+                LockedPackage package;
+                package.name = request.dependency.name;
+                package.version = *chosen;
+                std::string label = package.name + "@" + package.version.toString();
+                for (auto& dependency : registry.dependencies(package.name, package.version)) {
+                    package.dependencies.push_back(dependency.name);
+                    queue.push_back(Request{std::move(dependency), label});
+                }
+                std::sort(package.dependencies.begin(), package.dependencies.end());
+                package.dependencies.erase(std::unique(package.dependencies.begin(), package.dependencies.end()), package.dependencies.end());
+                selected.emplace(package.name, std::move(package));
+            }
+            Lockfile lock;
+            for (auto& entry : selected) lock.packages.push_back(std::move(entry.second));
+            return lock;
+        }
+
+        enum class LinkMode {
+            // Sabit bağlantı; olmazsa (ör. farklı dosya sistemi) reflink, o da olmazsa kopya
+            AUTO,
+            HARDLINK,
+            REFLINK,
+            COPY
+        };
+
+        // İçerik adresli paket deposu.
+        //   objects/<2 hex>/<62 hex>   dosya içerikleri, SHA-256 ile adlandırılmış, salt okunur
+        //   packages/<ad>@<sürüm>      paket dizini: her satırda "<sha256> <göreli yol>";
+        //                              çalıştırılabilir dosyalar "<sha256>:x <yol>", bağlantılar
+        //                              "<sha256>:l <yol>" (nesne bağlantının hedefini tutar)
+        //   objects/.../<62 hex>x      çalıştırılabilir kopyası (sabit bağlantılar kipi paylaşır)
+        // Aynı içerik depoda bir kez bulunur; projeler dosyaları bağlantıyla paylaşır.
+        // Sabit bağlantılı dosyalar depodaki nesnenin kendisidir, bu yüzden salt okunurdur
+        class Store {
+        public:
+            struct Options {
+                // 0: donanım thread sayısı
+                size_t threads = 0;
+                LinkMode link = LinkMode::AUTO;
+            };
+
+            struct Stats {
+                uint64_t packagesIngested = 0;
+                uint64_t objectsWritten = 0;
+                uint64_t objectsReused = 0;
+                uint64_t bytesWritten = 0;
+                uint64_t filesLinked = 0;
+                uint64_t filesReflinked = 0;
+                uint64_t filesCopied = 0;
+                uint64_t packagesSkipped = 0;
+            };
+
+            struct InstallResult {
+                size_t packages = 0;
+                size_t ingested = 0;
+                size_t linked = 0;
+                bool lockfileWritten = false;
+            };
+
+            explicit Store(const std::string& root) : Store(root, Options()) {}
+
+            Store(const std::string& root, const Options& options) : root(root), options(options) {
+                std::filesystem::create_directories(root + "/objects");
+                std::filesystem::create_directories(root + "/packages");
+            }
+
+            Store(const Store&) = delete;
+            Store& operator=(const Store&) = delete;
+
+            const std::string& path() const { return root; }
+
+            bool contains(const std::string& name, const Version& version) const {
+                return ::access(indexPath(name, version).c_str(), F_OK) == 0;
+            }
+
+            // Açılmış paket dizinini depoya al; bütünlük özetini döner.
+            // Depoda zaten olan nesneler yeniden yazılmaz. expected verilirse paket dizini yalnızca
+            // özet tutuyorsa yayımlanır (nesneler içerikle adlandırıldığı için zararsızdır)
+            std::string ingest(const std::string& name, const Version& version, const std::string& directory,
+                               const std::string& expected = std::string()) {
+                std::vector<std::pair<std::string, char>> files;
+                std::string unsupported;
+                File::WalkOptions walk;
+                walk.threads = 1;
+                walk.includeDirectories = false;
+                walk.withStat = true;
+                File::DirectoryOperations().walk(directory, walk, [&](const File::DirectoryEntry& entry) {
+                    std::string relative(entry.path.substr(directory.size() + 1));
+                    if (entry.type == File::EntryType::FILE) {
+                        bool executable = entry.info && (entry.info->st_mode & S_IXUSR);
+                        files.emplace_back(std::move(relative), executable ? EXECUTABLE : REGULAR);
+                    } else if (entry.type == File::EntryType::SYMLINK) {
+                        files.emplace_back(std::move(relative), SYMLINK);
+                    } else {
+                        // Soket, FIFO ve aygıt dosyaları sessizce atlanmaz
+                        unsupported = std::string(entry.path);
+                        return File::WalkAction::STOP;
+                    }
+                    return File::WalkAction::CONTINUE;
+                });
+                if (!unsupported.empty()) throw std::runtime_error("Unsupported file type in package: " + unsupported);
+                std::sort(files.begin(), files.end());
+
+                std::string index;
+                std::string content;
+                File::FileOperations operations;
+                for (const auto& file : files) {
+                    std::string path = directory + "/" + file.first;
+                    if (file.second == SYMLINK) content = linkTarget(path, file.first);
+                    else operations.readFile(path, content);
+                    std::string hash = Hash::sha256Hex(content);
+                    storeObject(hash, content, file.second);
+                    index += hash;
+                    if (file.second != REGULAR) {
+                        index += ':';
+                        index += file.second;
+                    }
+                    index += " " + file.first + "\n";
+                }
+                std::string integrity = integrityOf(index);
+                if (!expected.empty() && integrity != expected) {
+                    throw std::runtime_error("Integrity mismatch for " + name + "@" + version.toString() + ": lockfile has " +
+                        expected + ", package has " + integrity);
+                }
+                File::FileOperations().writeFileAtomic(indexPath(name, version), index, File::Durability::NONE);
+                count(&Stats::packagesIngested, 1);
+                return integrity;
+            }
+
+            // Paketi hedef dizine bağla. Hedef aynı bütünlükle zaten kuruluysa dokunulmaz;
+            // değilse yanına kurulup yer değiştirilir
+            bool link(const LockedPackage& package, const std::string& target) {
+                std::string marker = target + "/" + INTEGRITY_MARKER;
+                std::string installed;
+                if (!package.integrity.empty() && ::access(marker.c_str(), F_OK) == 0) {
+                    File::FileOperations().readFile(marker, installed);
+                    if (installed == package.integrity) {
+                        count(&Stats::packagesSkipped, 1);
+                        return false;
+                    }
+                }
+                std::string index = readIndex(package);
+                std::string staging = target + ".tmp." + std::to_string(::getpid());
+                std::filesystem::remove_all(staging);
+                std::filesystem::create_directories(staging);
+                std::istringstream lines(index);
+                std::string line;
+                std::string content;
+                while (std::getline(lines, line)) {
+                    IndexEntry entry = parseIndexLine(line);
+                    std::string object = objectPath(entry.hash, entry.kind);
+                    // Depodaki nesne bu Store ile ilk kez bağlanıyorsa içeriği özetiyle karşılaştırılır
+                    verifyObject(object, entry.hash);
+                    std::string destination = staging + "/" + entry.path;
+                    auto parent = std::filesystem::path(destination).parent_path();
+                    if (parent != staging) std::filesystem::create_directories(parent);
+                    if (entry.kind == SYMLINK) {
+                        File::FileOperations().readFile(object, content);
+                        if (::symlink(content.c_str(), destination.c_str()) != 0) fail("symlink", destination);
+                    } else {
+                        place(object, destination, entry.kind == EXECUTABLE);
+                    }
+                }
+                File::FileOperations().writeFile(staging + "/" + INTEGRITY_MARKER, integrityOf(index));
+                std::filesystem::remove_all(target);
+                std::filesystem::rename(staging, target);
+                return true;
+            }
+
+            // Projeyi kur: bildirim -> kilit (yoksa ya da bildirimi karşılamıyorsa kayıttan çöz) ->
+            // eksik paketleri paralel depoya al -> paralel bağla -> artık paketleri kaldır
+            InstallResult install(const std::string& project, const Registry& registry) {
+                std::vector<Dependency> roots = readManifest(project + "/" + MANIFEST_FILE);
+                std::string lockPath = project + "/" + LOCK_FILE;
+                Lockfile lock = Lockfile::read(lockPath);
+                bool lockChanged = false;
+                if (!lock.satisfies(roots)) {
+                    lock = resolve(roots, registry);
+                    lockChanged = true;
+                }
+                std::vector<LockedPackage> packages = lock.closure(roots);
+                if (packages.size() != lock.packages.size()) lockChanged = true;
+
+                InstallResult result;
+                result.packages = packages.size();
+                std::atomic<size_t> ingested{0};
+                std::atomic<bool> integrityFilled{false};
+                parallelFor(packages.size(), [&](size_t i) {
+                    LockedPackage& package = packages[i];
+                    std::string label = package.name + "@" + package.version.toString();
+                    std::string integrity;
+                    if (contains(package.name, package.version)) {
+                        integrity = integrityOf(readIndex(package));
+                    } else {
+                        std::string directory = registry.directory(package.name, package.version);
+                        if (!std::filesystem::is_directory(directory)) throw std::runtime_error("Package not in registry: " + label);
+                        integrity = ingest(package.name, package.version, directory, package.integrity);
+                        ingested++;
+                    }
+                    if (package.integrity.empty()) {
+                        package.integrity = integrity;
+                        integrityFilled = true;
+                    } else if (package.integrity != integrity) {
+                        throw std::runtime_error("Integrity mismatch for " + label + ": lockfile has " +
+                            package.integrity + ", store has " + integrity);
+                    }
+                });
+                result.ingested = ingested.load();
+
+                std::string modules = project + "/" + MODULES_DIRECTORY;
+                std::filesystem::create_directories(modules);
+                std::atomic<size_t> linked{0};
+                parallelFor(packages.size(), [&](size_t i) {
+                    if (link(packages[i], modules + "/" + packages[i].name)) linked++;
+                });
+                result.linked = linked.load();
+
+                std::set<std::string> wanted;
+                for (const auto& package : packages) wanted.insert(package.name);
+                for (const auto& entry : std::filesystem::directory_iterator(modules)) {
+                    if (!wanted.count(entry.path().filename().string())) std::filesystem::remove_all(entry.path());
+                }
+
+                if (lockChanged || integrityFilled) {
+                    lock.packages = std::move(packages);
+                    lock.write(lockPath);
+                    result.lockfileWritten = true;
+                }
+                return result;
+            }
+
+            // Paketlerin depo kopyasını yeniden özetleyerek denetle (paralel).
+            // Bozuk ya da eksik paketlerin "ad@sürüm" listesini döner
+            std::vector<std::string> verify(const std::vector<LockedPackage>& packages) {
+                std::vector<char> broken(packages.size(), 0);
+                parallelFor(packages.size(), [&](size_t i) {
+                    const LockedPackage& package = packages[i];
+                    std::string index;
+                    try {
+                        index = readIndex(package);
+                    } catch (const std::runtime_error&) {
+                        broken[i] = 1;
+                        return;
+                    }
+                    if (!package.integrity.empty() && integrityOf(index) != package.integrity) {
+                        broken[i] = 1;
+                        return;
+                    }
+                    std::istringstream lines(index);
+                    std::string line;
+                    std::string content;
+                    while (std::getline(lines, line)) {
+                        IndexEntry entry = parseIndexLine(line);
+                        std::string object = objectPath(entry.hash, entry.kind);
+                        if (::access(object.c_str(), R_OK) != 0) {
+                            broken[i] = 1;
+                            return;
+                        }
+                        File::FileOperations().readFile(object, content);
+                        if (Hash::sha256Hex(content) != entry.hash) {
+                            broken[i] = 1;
+                            return;
+                        }
+                    }
+                });
+                std::vector<std::string> result;
+                for (size_t i = 0; i < packages.size(); i++) {
+                    if (broken[i]) result.push_back(packages[i].name + "@" + packages[i].version.toString());
+                }
+                return result;
+            }
+
+            Stats stats() const {
+                std::lock_guard<std::mutex> lock(statsMutex);
+                return counters;
+            }
+
+        private:
+            // Paket dizinindeki girdi türleri (satırdaki ':' sonrası harf)
+            static constexpr char REGULAR = 'f';
+            static constexpr char EXECUTABLE = 'x';
+            static constexpr char SYMLINK = 'l';
+
+            struct IndexEntry {
+                std::string hash;
+                char kind;
+                std::string path;
+            };
+
+            std::string root;
+            Options options;
+            mutable std::mutex statsMutex;
+            Stats counters;
+            // Bu Store ile bağlanırken özeti doğrulanmış nesneler
+            std::mutex verifiedMutex;
+            std::set<std::string> verified;
+            // Sabit bağlantı bir kez EXDEV/EPERM ile başarısız olursa tekrar denenmez
+            std::atomic<bool> hardlinkFailed{false};
+            std::atomic<bool> reflinkFailed{false};
+
+            static std::string integrityOf(const std::string& index) {
+                return "sha256-" + Hash::sha256Hex(index);
+            }
+
+            std::string indexPath(const std::string& name, const Version& version) const {
+                checkName(name);
+                return root + "/packages/" + name + "@" + version.toString();
+            }
+
+            std::string objectPath(const std::string& hash, char kind = REGULAR) const {
+                std::string path = root + "/objects/" + hash.substr(0, 2) + "/" + hash.substr(2);
+                if (kind == EXECUTABLE) path += EXECUTABLE;
+                return path;
+            }
+
+            static IndexEntry parseIndexLine(const std::string& line) {
+                IndexEntry entry;
+                if (line.size() < 66) throw std::runtime_error("Malformed package index line: " + line);
+                entry.hash = line.substr(0, 64);
+                entry.kind = REGULAR;
+                size_t pathStart = 65;
+                if (line[64] == ':') {
+                    entry.kind = line[65];
+                    pathStart = 67;
+                }
+                if (line.size() <= pathStart || line[pathStart - 1] != ' ') throw std::runtime_error("Malformed package index line: " + line);
+                entry.path = line.substr(pathStart);
+                return entry;
+            }
+
+            // Paket içinde kalan göreli bağlantılar saklanır; mutlak ya da kökten çıkanlar reddedilir
+            static std::string linkTarget(const std::string& path, const std::string& relative) {
+                std::string target(4096, '\0');
+                ssize_t length = ::readlink(path.c_str(), &target[0], target.size());
+                if (length < 0) fail("readlink", path);
+                target.resize(static_cast<size_t>(length));
+                std::filesystem::path resolved = (std::filesystem::path(relative).parent_path() / target).lexically_normal();
+                if (target.empty() || target[0] == '/' || resolved.empty() || *resolved.begin() == "..") {
+                    throw std::runtime_error("Symlink leaves the package: " + path + " -> " + target);
+                }
+                return target;
+            }
+
+            void verifyObject(const std::string& object, const std::string& hash) {
+                {
+                    std::lock_guard<std::mutex> lock(verifiedMutex);
+                    if (verified.count(object)) return;
+                }
+                std::string content;
+                File::FileOperations().readFile(object, content);
+                if (Hash::sha256Hex(content) != hash) throw std::runtime_error("Corrupt object in store: " + object);
+                std::lock_guard<std::mutex> lock(verifiedMutex);
+                verified.insert(object);
+            }
+
+            std::string readIndex(const LockedPackage& package) const {
+                std::string path = indexPath(package.name, package.version);
+                if (::access(path.c_str(), F_OK) != 0) {
+                    throw std::runtime_error("Package not in store: " + package.name + "@" + package.version.toString());
+                }
+                std::string index;
+                File::FileOperations().readFile(path, index);
+                return index;
+            }
+
+            void count(uint64_t Stats::*field, uint64_t amount) {
+                std::lock_guard<std::mutex> lock(statsMutex);
+                counters.*field += amount;
+            }
+
+            void storeObject(const std::string& hash, const std::string& content, char kind) {
+                std::string path = objectPath(hash, kind);
+                if (::access(path.c_str(), F_OK) == 0) {
+                    count(&Stats::objectsReused, 1);
+                    return;
+                }
+                std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+                // Aynı nesneyi iki thread yazarsa son rename kazanır; içerik aynıdır
+                File::FileWriter::Options writerOptions;
+                writerOptions.mode = File::FileWriter::Mode::ATOMIC;
+                writerOptions.permissions = kind == EXECUTABLE ? 0555 : 0444;
+                File::FileWriter writer(path, writerOptions);
+                writer.write(content);
+                writer.close();
+                std::lock_guard<std::mutex> lock(statsMutex);
+                counters.objectsWritten++;
+                counters.bytesWritten += content.size();
+            }
+
+            void place(const std::string& object, const std::string& destination, bool executable) {
+                LinkMode mode = options.link;
+                if (mode == LinkMode::AUTO || mode == LinkMode::HARDLINK) {
+                    if (mode == LinkMode::HARDLINK || !hardlinkFailed.load(std::memory_order_relaxed)) {
+                        if (::link(object.c_str(), destination.c_str()) == 0) {
+                            count(&Stats::filesLinked, 1);
+                            return;
+                        }
+                        if (mode == LinkMode::HARDLINK) fail("link", destination);
+                        // EMLINK yalnızca bu nesneye özgüdür; diğer hatalar dosya sistemine
+                        if (errno != EMLINK) hardlinkFailed = true;
+                    }
+                }
+                if (mode == LinkMode::AUTO || mode == LinkMode::REFLINK) {
+                    if (mode == LinkMode::REFLINK || !reflinkFailed.load(std::memory_order_relaxed)) {
+                        if (reflink(object, destination, executable)) {
+                            count(&Stats::filesReflinked, 1);
+                            return;
+                        }
+                        if (mode == LinkMode::REFLINK) fail("reflink", destination);
+                        reflinkFailed = true;
+                    }
+                }
+                std::error_code error;
+                std::filesystem::copy_file(object, destination, std::filesystem::copy_options::overwrite_existing, error);
+                if (error) throw std::runtime_error("Cannot copy " + object + " to " + destination + ": " + error.message());
+                // Kopyalar projeye aittir; yazılabilir bırakılır
+                ::chmod(destination.c_str(), executable ? 0755 : 0644);
+                count(&Stats::filesCopied, 1);
+            }
+
+            static bool reflink(const std::string& object, const std::string& destination, bool executable) {
+                int source = ::open(object.c_str(), O_RDONLY | O_CLOEXEC);
+                if (source < 0) return false;
+                int target = ::open(destination.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, executable ? 0755 : 0644);
+                if (target < 0) {
+                    ::close(source);
+                    return false;
+                }
+                bool cloned = ::ioctl(target, FICLONE, source) == 0;
+                ::close(source);
+                ::close(target);
+                if (!cloned) ::unlink(destination.c_str());
+                return cloned;
+            }
+
+            [[noreturn]] static void fail(const char* operation, const std::string& path) {
+                throw std::runtime_error(std::string("Cannot ") + operation + " " + path + ": " + std::strerror(errno));
+            }
+
+            // Bağımsız işleri thread'lere dağıt; ilk hata kalan işleri durdurur ve yeniden fırlatılır
+            template<typename Function>
+            void parallelFor(size_t jobs, Function&& function) {
+                std::atomic<size_t> next{0};
+                std::atomic<bool> stopped{false};
+                std::mutex failureMutex;
+                std::exception_ptr failure;
+                auto work = [&]() {
+                    while (!stopped.load(std::memory_order_relaxed)) {
+                        size_t index = next.fetch_add(1);
+                        if (index >= jobs) break;
+                        try {
+                            function(index);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(failureMutex);
+                            if (!failure) failure = std::current_exception();
+                            stopped = true;
+                        }
+                    }
+                };
+                size_t threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+                threads = std::min(threads, jobs);
+                std::vector<std::thread> workers;
+                for (size_t t = 1; t < threads; t++) workers.emplace_back(work);
+                work();
+                for (auto& worker : workers) worker.join();
+                if (failure) std::rethrow_exception(failure);
+            }
+        };
+    }
+}
+
+#endif // WHOLF_PACKAGE_HPP
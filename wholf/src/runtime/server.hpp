@@ -0,0 +1,989 @@
+#ifndef WHOLF_SERVER_HPP
+#define WHOLF_SERVER_HPP
+
+#include "../interpreter/WholfInterpreter.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Wholf {
+    namespace Server {
+        // Çerçeve türleri
+        enum class FrameType : uint8_t {
+            EVALUATE = 1,
+            REGISTER = 2,
+            METRICS = 3,
+            RESULT = 4,
+            ERROR = 5
+        };
+
+        // Çerçeve düzeni: [u32 uzunluk][u8 tür][u32 istek no][u32 betik no][gövde]
+        // Uzunluk kendisi hariç tüm baytları kapsar.
+        static constexpr size_t FRAME_PREFIX = 4;
+        static constexpr size_t FRAME_HEADER = 1 + 4 + 4;
+        static constexpr uint32_t MAX_FRAME = 64 * 1024 * 1024;
+
+        // Value ikili kodlaması: [u8 DataType][yük], diziler ve nesneler özyinelemeli.
+        // Tipli dizi yükü: [u8 ElementType][u32 eleman sayısı][ham baytlar]
+        class Codec {
+        public:
+            // İç içe dizi/nesne sınırı; daha derin gövde yığını taşırmadan reddedilir
+            static constexpr size_t MAX_DEPTH = 64;
+
+            static void put32(std::string& out, uint32_t value) {
+                out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+
+            static uint32_t get32(const char*& cursor, const char* end) {
+                if (end - cursor < 4) throw std::runtime_error("Truncated frame");
+                uint32_t value;
+                std::memcpy(&value, cursor, sizeof(value));
+                cursor += sizeof(value);
+                return value;
+            }
+
+            static void encode(std::string& out, const Value& value) {
+                out.push_back(static_cast<char>(value.type));
+                switch (value.type) {
+                    case DataType::INTEGER:
+                        put32(out, static_cast<uint32_t>(std::get<int>(value.data)));
+                        break;
+                    case DataType::FLOAT: {
+                        float number = std::get<float>(value.data);
+                        out.append(reinterpret_cast<const char*>(&number), sizeof(number));
+                        break;
+                    }
+                    case DataType::BOOLEAN:
+                        out.push_back(std::get<bool>(value.data) ? 1 : 0);
+                        break;
+                    case DataType::STRING: {
+                        std::string_view text = value.text();
+                        put32(out, static_cast<uint32_t>(text.size()));
+                        out += text;
+                        break;
+                    }
+                    case DataType::ARRAY: {
+                        const auto& elements = std::get<std::vector<Value>>(value.data);
+                        put32(out, static_cast<uint32_t>(elements.size()));
+                        for (const auto& element : elements) encode(out, element);
+                        break;
+                    }
+                    case DataType::OBJECT: {
+                        const auto& fields = std::get<std::map<std::string, Value>>(value.data);
+                        put32(out, static_cast<uint32_t>(fields.size()));
+                        for (const auto& field : fields) {
+                            put32(out, static_cast<uint32_t>(field.first.size()));
+                            out += field.first;
+                            encode(out, field.second);
+                        }
+                        break;
+                    }
+                    case DataType::TYPED_ARRAY: {
+                        const auto& array = std::get<TypedArray>(value.data);
+                        out.push_back(static_cast<char>(array.type()));
+                        put32(out, static_cast<uint32_t>(array.size()));
+                        out.append(array.data<char>(), array.byteSize());
+                        break;
+                    }
+                    default:
+                        // Fonksiyon/sınıf değerleri taşınamaz
+                        out.back() = static_cast<char>(DataType::NULL_TYPE);
+                        break;
+                }
+            }
+
+            static Value decode(const char*& cursor, const char* end, size_t depth = 0) {
+                if (cursor >= end) throw std::runtime_error("Truncated frame");
+                if (depth > MAX_DEPTH) throw std::runtime_error("Value nesting too deep");
+                auto type = static_cast<DataType>(*cursor++);
+                switch (type) {
+                    case DataType::INTEGER:
+                        return Value(static_cast<int>(get32(cursor, end)));
+                    case DataType::FLOAT: {
+                        uint32_t bits = get32(cursor, end);
+                        float number;
+                        std::memcpy(&number, &bits, sizeof(number));
+                        return Value(number);
+                    }
+                    case DataType::BOOLEAN:
+                        if (cursor >= end) throw std::runtime_error("Truncated frame");
+                        return Value(*cursor++ != 0);
+                    case DataType::STRING:
+                        return Value(getString(cursor, end));
+                    case DataType::ARRAY: {
+                        uint32_t count = get32(cursor, end);
+                        std::vector<Value> elements;
+                        elements.reserve(std::min<uint32_t>(count, static_cast<uint32_t>(end - cursor)));
+                        for (uint32_t i = 0; i < count; i++) elements.push_back(decode(cursor, end, depth + 1));
+                        return Value(elements);
+                    }
+                    case DataType::OBJECT: {
+                        uint32_t count = get32(cursor, end);
+                        std::map<std::string, Value> fields;
+                        for (uint32_t i = 0; i < count; i++) {
+                            std::string key = getString(cursor, end);
+                            fields.emplace(std::move(key), decode(cursor, end, depth + 1));
+                        }
+                        return Value(fields);
+                    }
+                    case DataType::TYPED_ARRAY: {
+                        if (cursor >= end) throw std::runtime_error("Truncated frame");
+                        auto elementType = static_cast<uint8_t>(*cursor++);
+                        if (elementType > static_cast<uint8_t>(ElementType::INT32)) throw std::runtime_error("Unknown typed array element type");
+                        uint32_t count = get32(cursor, end);
+                        size_t elementSize = TypedArray::elementSize(static_cast<ElementType>(elementType));
+                        if (static_cast<size_t>(end - cursor) / elementSize < count) throw std::runtime_error("Truncated frame");
+                        TypedArray array(static_cast<ElementType>(elementType), count);
+                        if (count) std::memcpy(array.data<char>(), cursor, array.byteSize());
+                        cursor += array.byteSize();
+                        return Value(array);
+                    }
+                    default:
+                        return Value(nullptr);
+                }
+            }
+
+            // Çerçeve oluştur
+            static std::string frame(FrameType type, uint32_t requestId, uint32_t scriptId, const std::string& body) {
+                std::string out;
+                out.reserve(FRAME_PREFIX + FRAME_HEADER + body.size());
+                put32(out, static_cast<uint32_t>(FRAME_HEADER + body.size()));
+                out.push_back(static_cast<char>(type));
+                put32(out, requestId);
+                put32(out, scriptId);
+                out += body;
+                return out;
+            }
+
+        private:
+            static std::string getString(const char*& cursor, const char* end) {
+                uint32_t length = get32(cursor, end);
+                if (static_cast<size_t>(end - cursor) < length) throw std::runtime_error("Truncated frame");
+                std::string text(cursor, length);
+                cursor += length;
+                return text;
+            }
+        };
+
+        // Gecikme histogramı: 2'nin kuvveti mikro saniye kovaları
+        class LatencyHistogram {
+        public:
+            static constexpr size_t BUCKETS = 32;
+
+            void record(std::chrono::nanoseconds latency) {
+                uint64_t micros = static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(latency).count()));
+                size_t bucket = 0;
+                while (bucket + 1 < BUCKETS && (uint64_t(1) << bucket) <= micros) bucket++;
+                counts[bucket].fetch_add(1, std::memory_order_relaxed);
+                total.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Yüzdelik değerin üst sınırı (mikro saniye)
+            uint64_t percentile(double fraction) const {
+                uint64_t count = total.load(std::memory_order_relaxed);
+                if (count == 0) return 0;
+                uint64_t target = static_cast<uint64_t>(fraction * static_cast<double>(count));
+                uint64_t seen = 0;
+                for (size_t i = 0; i < BUCKETS; i++) {
+                    seen += counts[i].load(std::memory_order_relaxed);
+                    if (seen > target) return uint64_t(1) << i;
+                }
+                return uint64_t(1) << (BUCKETS - 1);
+            }
+
+            uint64_t samples() const { return total.load(std::memory_order_relaxed); }
+
+        private:
+            std::atomic<uint64_t> counts[BUCKETS] = {};
+            std::atomic<uint64_t> total{0};
+        };
+
+        // Sunucu metrikleri
+        class Metrics {
+        public:
+            std::atomic<uint64_t> queueDepth{0};
+            std::atomic<uint64_t> inFlight{0};
+            std::atomic<uint64_t> completed{0};
+            std::atomic<uint64_t> failed{0};
+            std::atomic<uint64_t> connections{0};
+            LatencyHistogram latency;
+
+            std::string toString() const {
+                return "queue_depth " + std::to_string(queueDepth.load()) + "\n" +
+                       "in_flight " + std::to_string(inFlight.load()) + "\n" +
+                       "completed " + std::to_string(completed.load()) + "\n" +
+                       "failed " + std::to_string(failed.load()) + "\n" +
+                       "connections " + std::to_string(connections.load()) + "\n" +
+                       "latency_p50_us " + std::to_string(latency.percentile(0.50)) + "\n" +
+                       "latency_p99_us " + std::to_string(latency.percentile(0.99)) + "\n" +
+                       "latency_p999_us " + std::to_string(latency.percentile(0.999)) + "\n";
+            }
+        };
+
+        // Unix soketi üzerinden sıcak interpreter'lar ile değerlendirme yapan daemon.
+        // Tek bir IO thread'i epoll ile tüm bağlantıları çoğullar; değerlendirme worker
+        // havuzunda, her worker'ın kendi kalıcı Interpreter'ı ile yapılır.
+        // Geri basınç: iş kuyruğu, bağlantının bekleyen istekleri ya da yazılmamış çıktısı sınıra
+        // ulaşınca o bağlantıdan okuma durur; tamponda kalan çerçeveler yer açıldıkça işlenir.
+        class ScriptServer {
+        public:
+            struct Options {
+                std::string socketPath;
+                size_t workers = std::max(1u, std::thread::hardware_concurrency());
+                // Worker'lar başlarken geri yüklenecek snapshot (boş = yok)
+                std::string snapshotPath;
+                // Her değerlendirmenin komut bütçesi; sonsuz döngüdeki betik worker'ı tutmasın
+                // (ExecutionControl::UNLIMITED = sınırsız)
+                uint64_t instructionLimit = 10000000;
+                // Her worker interpreter'ını hazırlamak için (ör. bind() çağrıları)
+                std::function<void(Interpreter&)> setup;
+                // Tek çerçevenin en büyük boyutu (en fazla MAX_FRAME); bağlantının okuma tamponu da
+                // bir çerçeveyle sınırlıdır
+                uint32_t maxFrameSize = 4 * 1024 * 1024;
+                // Worker'ları bekleyen toplam istek
+                size_t maxQueuedJobs = 1024;
+                // Bağlantı başına kuyrukta ya da çalışmakta olan istek
+                size_t maxPendingPerConnection = 64;
+            };
+
+            explicit ScriptServer(const Options& options) : options(options) {}
+
+            ~ScriptServer() { stop(); }
+
+            ScriptServer(const ScriptServer&) = delete;
+            ScriptServer& operator=(const ScriptServer&) = delete;
+
+            // Betiği sunucu tarafında kaydet (istemci REGISTER çerçevesiyle de yapabilir)
+            void registerScript(uint32_t scriptId, const std::string& code) {
+                std::unique_lock<std::shared_mutex> lock(scriptsMutex);
+                scripts[scriptId] = std::make_shared<const std::string>(code);
+            }
+
+            const Metrics& metrics() const { return stats; }
+
+            void start() {
+                if (running) throw std::runtime_error("Server already started");
+                if (options.maxFrameSize < FRAME_HEADER || options.maxFrameSize > MAX_FRAME) throw std::runtime_error("Invalid maxFrameSize");
+
+                // Worker interpreter'ları burada hazırlanır: snapshot ya da setup hatası çağırana
+                // fırlar (worker thread'inde fırlasaydı std::terminate olurdu)
+                std::vector<std::unique_ptr<Interpreter>> interpreters;
+                for (size_t i = 0; i < std::max<size_t>(1, options.workers); i++) {
+                    auto interpreter = std::make_unique<Interpreter>();
+                    if (!options.snapshotPath.empty()) interpreter->restoreSnapshot(options.snapshotPath);
+                    if (options.setup) options.setup(*interpreter);
+                    // Her istek bu duruma döner: args ve betiğin tanımladıkları sonraki isteğe sızmaz
+                    interpreter->checkpoint();
+                    interpreters.push_back(std::move(interpreter));
+                }
+
+                try {
+                    openListener();
+                    epollFd = epoll_create1(EPOLL_CLOEXEC);
+                    if (epollFd < 0) fail("epoll_create1");
+                    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+                    if (wakeFd < 0) fail("eventfd");
+                    if (!addToEpoll(listenFd, EPOLLIN) || !addToEpoll(wakeFd, EPOLLIN)) fail("epoll_ctl");
+                } catch (...) {
+                    closeDescriptors();
+                    throw;
+                }
+
+                running = true;
+                for (auto& interpreter : interpreters) {
+                    workers.emplace_back([this, interpreter = std::move(interpreter)]() { workerLoop(*interpreter); });
+                }
+                ioThread = std::thread([this]() { ioLoop(); });
+            }
+
+            void stop() {
+                if (!running.exchange(false)) return;
+                {
+                    // Bekleyen worker'lar bayrağı kilit altında görsün
+                    std::lock_guard<std::mutex> lock(jobsMutex);
+                }
+                jobsAvailable.notify_all();
+                wake();
+                if (ioThread.joinable()) ioThread.join();
+                for (auto& worker : workers) worker.join();
+                workers.clear();
+                for (auto& connection : connections) ::close(connection.first);
+                connections.clear();
+                closeDescriptors();
+            }
+
+        private:
+            struct Connection {
+                // fd numaraları yeniden kullanılabilir; yanıtlar bu kimlikle eşleştirilir
+                uint64_t id = 0;
+                std::string input;
+                std::string output;
+                // Kuyrukta ya da worker'da olan istekler
+                size_t pending = 0;
+                // epoll'da dinlenen olaylar
+                uint32_t events = EPOLLIN;
+                // Eş yazma yönünü kapattı; tamponlanmış çerçeveler işlenip yanıtlar yazılınca kapanır
+                bool endOfInput = false;
+                // Sınır dolduğu için işlenemeyen tam bir çerçeve bekliyor
+                bool stalled = false;
+                // stalledConnections listesinde
+                bool listed = false;
+            };
+
+            struct Job {
+                int fd;
+                uint64_t connectionId;
+                FrameType type;
+                uint32_t requestId;
+                uint32_t scriptId;
+                std::string body;
+                std::chrono::steady_clock::time_point received;
+            };
+
+            struct Completion {
+                int fd;
+                uint64_t connectionId;
+                std::string frame;
+            };
+
+            // Worker'ın parse önbelleği; kayıtlı kod değişmedikçe AST tekrar kullanılır
+            struct CachedScript {
+                std::shared_ptr<const std::string> code;
+                std::shared_ptr<Program> program;
+            };
+
+            Options options;
+            Metrics stats;
+            std::atomic<bool> running{false};
+            int listenFd = -1;
+            int epollFd = -1;
+            int wakeFd = -1;
+            bool bound = false;
+            std::thread ioThread;
+            std::vector<std::thread> workers;
+
+            std::unordered_map<int, Connection> connections;
+            uint64_t nextConnectionId = 1;
+            // Genel kuyruk dolduğu için bekleyen bağlantılar (fd, kimlik); tamamlanmalarda yeniden denenir
+            std::vector<std::pair<int, uint64_t>> stalledConnections;
+
+            std::mutex jobsMutex;
+            std::condition_variable jobsAvailable;
+            std::deque<Job> jobs;
+
+            std::mutex completionsMutex;
+            std::vector<Completion> completions;
+
+            std::shared_mutex scriptsMutex;
+            std::unordered_map<uint32_t, std::shared_ptr<const std::string>> scripts;
+
+            [[noreturn]] static void fail(const std::string& what) {
+                throw std::runtime_error(what + " failed: " + std::strerror(errno));
+            }
+
+            void openListener() {
+                sockaddr_un address;
+                std::memset(&address, 0, sizeof(address));
+                address.sun_family = AF_UNIX;
+                if (options.socketPath.size() >= sizeof(address.sun_path)) throw std::runtime_error("Socket path too long");
+                std::strncpy(address.sun_path, options.socketPath.c_str(), sizeof(address.sun_path) - 1);
+                removeStaleSocket(address);
+
+                listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+                if (listenFd < 0) fail("socket");
+                if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) fail("bind " + options.socketPath);
+                bound = true;
+                if (::listen(listenFd, SOMAXCONN) != 0) fail("listen " + options.socketPath);
+            }
+
+            // Yol yalnızca kimsenin dinlemediği eski bir soketse silinir; normal dosyaya ya da
+            // çalışan başka bir sunucunun soketine dokunulmaz
+            void removeStaleSocket(const sockaddr_un& address) {
+                struct stat info;
+                if (::lstat(options.socketPath.c_str(), &info) != 0) return;
+                if (!S_ISSOCK(info.st_mode)) throw std::runtime_error("Socket path exists and is not a socket: " + options.socketPath);
+                int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                if (probe < 0) fail("socket");
+                int result = connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+                int error = errno;
+                ::close(probe);
+                if (result == 0) throw std::runtime_error("Another server is listening on " + options.socketPath);
+                if (error != ECONNREFUSED) {
+                    throw std::runtime_error("Cannot probe " + options.socketPath + ": " + std::strerror(error));
+                }
+                ::unlink(options.socketPath.c_str());
+            }
+
+            void closeDescriptors() {
+                if (wakeFd >= 0) ::close(wakeFd);
+                if (epollFd >= 0) ::close(epollFd);
+                if (listenFd >= 0) ::close(listenFd);
+                if (bound) ::unlink(options.socketPath.c_str());
+                wakeFd = epollFd = listenFd = -1;
+                bound = false;
+            }
+
+            bool addToEpoll(int fd, uint32_t events) {
+                epoll_event event;
+                std::memset(&event, 0, sizeof(event));
+                event.events = events;
+                event.data.fd = fd;
+                return epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0;
+            }
+
+            void modifyEpoll(int fd, uint32_t events) {
+                epoll_event event;
+                std::memset(&event, 0, sizeof(event));
+                event.events = events;
+                event.data.fd = fd;
+                epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event);
+            }
+
+            void wake() {
+                uint64_t one = 1;
+                ssize_t ignored = ::write(wakeFd, &one, sizeof(one));
+                (void)ignored;
+            }
+
+            // Okuma tamponu en fazla bir tam çerçeve tutar
+            size_t inputLimit() const { return FRAME_PREFIX + options.maxFrameSize; }
+
+            void ioLoop() {
+                epoll_event events[128];
+                while (running.load(std::memory_order_relaxed)) {
+                    int count = epoll_wait(epollFd, events, 128, 100);
+                    for (int i = 0; i < count; i++) {
+                        int fd = events[i].data.fd;
+                        if (fd == listenFd) {
+                            acceptConnections();
+                        } else if (fd == wakeFd) {
+                            uint64_t value;
+                            ssize_t ignored = ::read(wakeFd, &value, sizeof(value));
+                            (void)ignored;
+                            flushCompletions();
+                        } else {
+                            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                                closeConnection(fd);
+                                continue;
+                            }
+                            if (events[i].events & EPOLLIN) readConnection(fd);
+                            else if (events[i].events & EPOLLOUT) serviceConnection(fd);
+                        }
+                    }
+                }
+            }
+
+            void acceptConnections() {
+                while (true) {
+                    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (fd < 0) return;
+                    if (!addToEpoll(fd, EPOLLIN)) {
+                        ::close(fd);
+                        continue;
+                    }
+                    connections[fd].id = nextConnectionId++;
+                    stats.connections.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
+            void closeConnection(int fd) {
+                if (connections.erase(fd) == 0) return;
+                epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+                ::close(fd);
+                stats.connections.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // Tampon sınırına kadar oku; EOF bağlantıyı hemen kapatmaz, önce tamponlanmış
+            // çerçeveler işlenir ve yanıtları yazılır
+            void readConnection(int fd) {
+                auto it = connections.find(fd);
+                if (it == connections.end()) return;
+                Connection& connection = it->second;
+
+                char buffer[64 * 1024];
+                size_t limit = inputLimit();
+                while (connection.input.size() < limit) {
+                    ssize_t received = ::read(fd, buffer, std::min(sizeof(buffer), limit - connection.input.size()));
+                    if (received > 0) {
+                        connection.input.append(buffer, static_cast<size_t>(received));
+                        continue;
+                    }
+                    if (received == 0) {
+                        connection.endOfInput = true;
+                        break;
+                    }
+                    if (errno == EINTR) continue;
+                    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                        closeConnection(fd);
+                        return;
+                    }
+                    break;
+                }
+                serviceConnection(fd);
+            }
+
+            // Tamponlanmış çerçeveleri sınırlar elverdiğince işle, çıktıyı yaz ve dinlenen olayları
+            // güncelle. Bağlantı burada kapatılabilir; çağırandan sonra referansı kullanılmamalı
+            void serviceConnection(int fd) {
+                auto it = connections.find(fd);
+                if (it == connections.end()) return;
+                Connection& connection = it->second;
+                if (!dispatchFrames(fd, connection) || !writeOutput(fd, connection)) return;
+
+                if (connection.endOfInput && connection.pending == 0 && connection.output.empty() && !connection.stalled) {
+                    closeConnection(fd);
+                    return;
+                }
+                uint32_t events = 0;
+                if (!connection.endOfInput && !connection.stalled && connection.input.size() < inputLimit()) events |= EPOLLIN;
+                if (!connection.output.empty()) events |= EPOLLOUT;
+                if (events != connection.events) {
+                    connection.events = events;
+                    modifyEpoll(fd, events);
+                }
+            }
+
+            // Tamamlanmış çerçeveleri işle; protokol hatasında bağlantıyı kapatıp false döner
+            bool dispatchFrames(int fd, Connection& connection) {
+                size_t offset = 0;
+                size_t queued = stats.queueDepth.load(std::memory_order_relaxed);
+                auto now = std::chrono::steady_clock::now();
+                std::vector<Job> batch;
+                connection.stalled = false;
+                while (connection.input.size() - offset >= FRAME_PREFIX) {
+                    uint32_t length;
+                    std::memcpy(&length, connection.input.data() + offset, sizeof(length));
+                    if (length < FRAME_HEADER || length > options.maxFrameSize) {
+                        closeConnection(fd);
+                        return false;
+                    }
+                    if (connection.input.size() - offset - FRAME_PREFIX < length) break;
+
+                    // Yer açılana kadar çerçeve tamponda kalır
+                    auto type = static_cast<FrameType>(connection.input[offset + FRAME_PREFIX]);
+                    bool full = connection.output.size() >= options.maxFrameSize ||
+                                (type == FrameType::EVALUATE && (connection.pending >= options.maxPendingPerConnection ||
+                                                                 queued + batch.size() >= options.maxQueuedJobs));
+                    if (full) {
+                        connection.stalled = true;
+                        break;
+                    }
+
+                    const char* cursor = connection.input.data() + offset + FRAME_PREFIX;
+                    const char* end = cursor + length;
+                    Job job;
+                    job.fd = fd;
+                    job.connectionId = connection.id;
+                    job.type = static_cast<FrameType>(*cursor++);
+                    job.requestId = Codec::get32(cursor, end);
+                    job.scriptId = Codec::get32(cursor, end);
+                    job.body.assign(cursor, end);
+                    job.received = now;
+                    offset += FRAME_PREFIX + length;
+
+                    switch (job.type) {
+                        case FrameType::METRICS:
+                            connection.output += Codec::frame(FrameType::RESULT, job.requestId, 0, encodeString(stats.toString()));
+                            break;
+                        case FrameType::REGISTER:
+                            registerScript(job.scriptId, job.body);
+                            connection.output += Codec::frame(FrameType::RESULT, job.requestId, job.scriptId, encodeNull());
+                            break;
+                        case FrameType::EVALUATE:
+                            connection.pending++;
+                            batch.push_back(std::move(job));
+                            break;
+                        default:
+                            // RESULT/ERROR ya da bilinmeyen tür istemciden gelmez
+                            stats.failed.fetch_add(1, std::memory_order_relaxed);
+                            connection.output += Codec::frame(FrameType::ERROR, job.requestId, job.scriptId, encodeString("Unknown frame type"));
+                            break;
+                    }
+                }
+                connection.input.erase(0, offset);
+
+                if (!batch.empty()) {
+                    {
+                        std::lock_guard<std::mutex> lock(jobsMutex);
+                        for (auto& job : batch) jobs.push_back(std::move(job));
+                    }
+                    stats.queueDepth.fetch_add(batch.size(), std::memory_order_relaxed);
+                    if (batch.size() == 1) jobsAvailable.notify_one();
+                    else jobsAvailable.notify_all();
+                }
+                if (connection.stalled && !connection.listed) {
+                    connection.listed = true;
+                    stalledConnections.emplace_back(fd, connection.id);
+                }
+                return true;
+            }
+
+            // Gönderim hatasında bağlantıyı kapatıp false döner
+            bool writeOutput(int fd, Connection& connection) {
+                size_t written = 0;
+                while (written < connection.output.size()) {
+                    ssize_t result = ::send(fd, connection.output.data() + written, connection.output.size() - written, MSG_NOSIGNAL);
+                    if (result > 0) {
+                        written += static_cast<size_t>(result);
+                        continue;
+                    }
+                    if (result < 0 && errno == EINTR) continue;
+                    if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+                    closeConnection(fd);
+                    return false;
+                }
+                connection.output.erase(0, written);
+                return true;
+            }
+
+            void flushCompletions() {
+                std::vector<Completion> ready;
+                {
+                    std::lock_guard<std::mutex> lock(completionsMutex);
+                    ready.swap(completions);
+                }
+                std::vector<int> touched;
+                for (auto& completion : ready) {
+                    auto it = connections.find(completion.fd);
+                    if (it == connections.end() || it->second.id != completion.connectionId) continue;
+                    if (it->second.output.empty()) touched.push_back(completion.fd);
+                    it->second.output += completion.frame;
+                    it->second.pending--;
+                }
+                // Her bağlantı bir kez işlenir; işleme bağlantıyı kapatabilir, sonraki fd yeniden aranır
+                for (int fd : touched) serviceConnection(fd);
+
+                // Kuyrukta yer açıldı: bekleyen bağlantıları yeniden dene
+                std::vector<std::pair<int, uint64_t>> waiting;
+                waiting.swap(stalledConnections);
+                for (const auto& entry : waiting) {
+                    auto it = connections.find(entry.first);
+                    if (it == connections.end() || it->second.id != entry.second) continue;
+                    it->second.listed = false;
+                    serviceConnection(entry.first);
+                }
+            }
+
+            static std::string encodeString(const std::string& text) {
+                std::string body;
+                Codec::encode(body, Value(text));
+                return body;
+            }
+
+            static std::string encodeNull() {
+                std::string body;
+                Codec::encode(body, Value(nullptr));
+                return body;
+            }
+
+            void workerLoop(Interpreter& interpreter) {
+                std::unordered_map<uint32_t, CachedScript> cache;
+                while (true) {
+                    Job job;
+                    {
+                        std::unique_lock<std::mutex> lock(jobsMutex);
+                        jobsAvailable.wait(lock, [this]() { return !running.load() || !jobs.empty(); });
+                        if (!running.load()) return;
+                        job = std::move(jobs.front());
+                        jobs.pop_front();
+                    }
+                    stats.queueDepth.fetch_sub(1, std::memory_order_relaxed);
+                    stats.inFlight.fetch_add(1, std::memory_order_relaxed);
+
+                    std::string frame = evaluate(interpreter, cache, job);
+                    interpreter.rollback();
+
+                    stats.inFlight.fetch_sub(1, std::memory_order_relaxed);
+                    stats.latency.record(std::chrono::steady_clock::now() - job.received);
+                    {
+                        std::lock_guard<std::mutex> lock(completionsMutex);
+                        completions.push_back(Completion{job.fd, job.connectionId, std::move(frame)});
+                    }
+                    wake();
+                }
+            }
+
+            std::string evaluate(Interpreter& interpreter, std::unordered_map<uint32_t, CachedScript>& cache, const Job& job) {
+                std::shared_ptr<const std::string> code;
+                {
+                    std::shared_lock<std::shared_mutex> lock(scriptsMutex);
+                    auto it = scripts.find(job.scriptId);
+                    if (it != scripts.end()) code = it->second;
+                }
+                if (!code) {
+                    stats.failed.fetch_add(1, std::memory_order_relaxed);
+                    return Codec::frame(FrameType::ERROR, job.requestId, job.scriptId, encodeString("Unknown script id"));
+                }
+
+                std::string message;
+                try {
+                    // Betik yeniden kaydedilmedikçe bir kez parse edilir
+                    CachedScript& cached = cache[job.scriptId];
+                    if (cached.code != code) {
+                        cached.program = Interpreter::parse(*code);
+                        cached.code = code;
+                    }
+
+                    // Argümanlar betiğe "args" global dizisi olarak verilir
+                    const char* cursor = job.body.data();
+                    Value args = job.body.empty() ? Value(std::vector<Value>()) : Codec::decode(cursor, job.body.data() + job.body.size());
+                    interpreter.setGlobal("args", args);
+
+                    ExecutionControl control;
+                    control.setInstructionLimit(options.instructionLimit);
+                    interpreter.setExecutionControl(&control);
+                    Value result = interpreter.execute(cached.program);
+                    interpreter.setExecutionControl(nullptr);
+
+                    std::string body;
+                    Codec::encode(body, result);
+                    stats.completed.fetch_add(1, std::memory_order_relaxed);
+                    return Codec::frame(FrameType::RESULT, job.requestId, job.scriptId, body);
+                } catch (const std::exception& error) {
+                    message = error.what();
+                } catch (...) {
+                    message = "Unknown error";
+                }
+                interpreter.setExecutionControl(nullptr);
+                stats.failed.fetch_add(1, std::memory_order_relaxed);
+                return Codec::frame(FrameType::ERROR, job.requestId, job.scriptId, encodeString(message));
+            }
+        };
+
+        // Sunucunun ERROR çerçevesi; requestId hangi isteğin başarısız olduğunu söyler
+        class RemoteError : public std::runtime_error {
+        public:
+            uint32_t requestId;
+
+            RemoteError(uint32_t requestId, const std::string& message) : std::runtime_error(message), requestId(requestId) {}
+        };
+
+        // Basit, engelleyen istemci; istekler ardışık gönderilebilir (pipelining). Worker'lar
+        // paralel çalıştığı için yanıtlar gönderim sırasıyla gelmeyebilir: receive() geleni,
+        // wait() istenen numaralı yanıtı döndürür
+        class Client {
+        public:
+            explicit Client(const std::string& socketPath) {
+                fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                sockaddr_un address;
+                std::memset(&address, 0, sizeof(address));
+                address.sun_family = AF_UNIX;
+                std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+                if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+                    if (fd >= 0) ::close(fd);
+                    throw std::runtime_error("Cannot connect to " + socketPath);
+                }
+            }
+
+            ~Client() { ::close(fd); }
+
+            Client(const Client&) = delete;
+            Client& operator=(const Client&) = delete;
+
+            void registerScript(uint32_t scriptId, const std::string& code) {
+                uint32_t requestId = nextRequest++;
+                sendAll(Codec::frame(FrameType::REGISTER, requestId, scriptId, code));
+                wait(requestId);
+            }
+
+            // İstek gönder, yanıtı bekleme
+            uint32_t send(uint32_t scriptId, const Value& args) {
+                uint32_t requestId = nextRequest++;
+                std::string body;
+                Codec::encode(body, args);
+                sendAll(Codec::frame(FrameType::EVALUATE, requestId, scriptId, body));
+                return requestId;
+            }
+
+            // İlk gelen yanıtı al (sırası gönderimle aynı olmayabilir); hata çerçevesi RemoteError olur
+            Value receive(uint32_t* requestId = nullptr) {
+                if (!early.empty()) {
+                    auto first = early.begin();
+                    Response response = std::move(first->second);
+                    early.erase(first);
+                    if (requestId) *requestId = response.requestId;
+                    return unwrap(response.requestId, std::move(response));
+                }
+                Response response = receiveFrame();
+                if (requestId) *requestId = response.requestId;
+                return unwrap(response.requestId, std::move(response));
+            }
+
+            // Verilen isteğin yanıtını bekle; arada gelen diğer yanıtlar saklanır
+            Value wait(uint32_t requestId) {
+                auto stored = early.find(requestId);
+                if (stored == early.end()) {
+                    while (true) {
+                        Response response = receiveFrame();
+                        if (response.requestId == requestId) return unwrap(requestId, std::move(response));
+                        early.emplace(response.requestId, std::move(response));
+                    }
+                }
+                Response response = std::move(stored->second);
+                early.erase(stored);
+                return unwrap(requestId, std::move(response));
+            }
+
+            Value evaluate(uint32_t scriptId, const Value& args) {
+                return wait(send(scriptId, args));
+            }
+
+            std::string metrics() {
+                uint32_t requestId = nextRequest++;
+                sendAll(Codec::frame(FrameType::METRICS, requestId, 0, std::string()));
+                return std::get<std::string>(wait(requestId).data);
+            }
+
+        private:
+            struct Response {
+                uint32_t requestId = 0;
+                bool error = false;
+                Value value = Value(nullptr);
+            };
+
+            int fd = -1;
+            uint32_t nextRequest = 1;
+            // wait() beklerken gelen başka isteklerin yanıtları
+            std::map<uint32_t, Response> early;
+
+            static Value unwrap(uint32_t requestId, Response response) {
+                if (response.error) throw RemoteError(requestId, std::string(response.value.text()));
+                return std::move(response.value);
+            }
+
+            Response receiveFrame() {
+                char prefix[FRAME_PREFIX];
+                receiveAll(prefix, FRAME_PREFIX);
+                uint32_t length;
+                std::memcpy(&length, prefix, sizeof(length));
+                if (length < FRAME_HEADER || length > MAX_FRAME) throw std::runtime_error("Invalid frame");
+                std::string frame(length, '\0');
+                receiveAll(&frame[0], length);
+
+                const char* cursor = frame.data();
+                const char* end = cursor + frame.size();
+                Response response;
+                response.error = static_cast<FrameType>(*cursor++) == FrameType::ERROR;
+                response.requestId = Codec::get32(cursor, end);
+                Codec::get32(cursor, end);
+                response.value = Codec::decode(cursor, end);
+                return response;
+            }
+
+            void sendAll(const std::string& data) {
+                size_t sent = 0;
+                while (sent < data.size()) {
+                    ssize_t result = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+                    if (result <= 0) throw std::runtime_error("Connection lost");
+                    sent += static_cast<size_t>(result);
+                }
+            }
+
+            void receiveAll(char* buffer, size_t size) {
+                size_t received = 0;
+                while (received < size) {
+                    ssize_t result = ::read(fd, buffer + received, size - received);
+                    if (result <= 0) throw std::runtime_error("Connection lost");
+                    received += static_cast<size_t>(result);
+                }
+            }
+        };
+
+        // Yerel yük üreteci: her bağlantı sabit derinlikte ardışık istek tutar
+        class LoadGenerator {
+        public:
+            struct Options {
+                std::string socketPath;
+                uint32_t scriptId = 0;
+                size_t connections = 4;
+                size_t requestsPerConnection = 10000;
+                size_t pipelineDepth = 8;
+            };
+
+            struct Report {
+                uint64_t requests = 0;
+                uint64_t errors = 0;
+                double seconds = 0;
+                double requestsPerSecond = 0;
+                uint64_t p50Micros = 0;
+                uint64_t p99Micros = 0;
+                uint64_t p999Micros = 0;
+            };
+
+            static Report run(const Options& options, const Value& args) {
+                LatencyHistogram histogram;
+                std::atomic<uint64_t> errors{0};
+                auto started = std::chrono::steady_clock::now();
+
+                std::vector<std::thread> threads;
+                for (size_t c = 0; c < options.connections; c++) {
+                    threads.emplace_back([&]() {
+                        Client client(options.socketPath);
+                        // Yanıtlar sırasız gelebilir; gecikme istek numarasıyla eşlenir
+                        std::unordered_map<uint32_t, std::chrono::steady_clock::time_point> pending;
+                        size_t sent = 0;
+                        size_t received = 0;
+                        while (received < options.requestsPerConnection) {
+                            while (sent < options.requestsPerConnection && pending.size() < options.pipelineDepth) {
+                                auto now = std::chrono::steady_clock::now();
+                                pending.emplace(client.send(options.scriptId, args), now);
+                                sent++;
+                            }
+                            uint32_t requestId = 0;
+                            try {
+                                client.receive(&requestId);
+                            } catch (const RemoteError& error) {
+                                requestId = error.requestId;
+                                errors.fetch_add(1, std::memory_order_relaxed);
+                            } catch (const std::exception&) {
+                                // Bağlantı koptu: kalan istekler hata sayılır
+                                errors.fetch_add(options.requestsPerConnection - received, std::memory_order_relaxed);
+                                return;
+                            }
+                            auto request = pending.find(requestId);
+                            if (request == pending.end()) continue;
+                            histogram.record(std::chrono::steady_clock::now() - request->second);
+                            pending.erase(request);
+                            received++;
+                        }
+                    });
+                }
+                for (auto& thread : threads) thread.join();
+
+                Report report;
+                report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+                report.requests = histogram.samples();
+                report.errors = errors.load();
+                report.requestsPerSecond = report.seconds > 0 ? static_cast<double>(report.requests) / report.seconds : 0;
+                report.p50Micros = histogram.percentile(0.50);
+                report.p99Micros = histogram.percentile(0.99);
+                report.p999Micros = histogram.percentile(0.999);
+                return report;
+            }
+        };
+    }
+}
+
+#endif // WHOLF_SERVER_HPP
@@ -1,25 +1,268 @@
 #ifndef WHOLF_STDLIB_HPP
 #define WHOLF_STDLIB_HPP
 
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
+#include "file.hpp"
+#include "numeric.hpp"
+#include "table.hpp"
+#include "text.hpp"
 
 namespace Wholf {
     namespace StdLib {
         // Temel veri tipleri
+        
+        // Değer semantikli metin; işlemler ham işaretçi değil String döndürür. Üç depolama biçimi:
+        //  - satır içi (<= 22 bayt): ayırma yok
+        //  - paylaşılan: referans sayımlı tampon; substring/split dilimleri kopyalamaz
+        //  - intern: süreç boyu tabloda; kopyası sayaç güncellemez, eşitliği adres karşılaştırmasıdır
+        // Konumlar ve uzunluklar bayt cinsindendir (UTF-8).
         class String {
         public:
-            std::string value;
+            static constexpr size_t INLINE_CAPACITY = 22;
+            static constexpr size_t npos = Text::npos;
+            
+            String() = default;
+            String(std::string_view text) { assign(text); }
+            String(const char* text) : String(std::string_view(text)) {}
+            String(const std::string& text) : String(std::string_view(text)) {}
+            String(const String& other) { copyFrom(other); }
+            String(String&& other) noexcept { moveFrom(other); }
+            
+            String& operator=(const String& other) {
+                if (this != &other) {
+                    release();
+                    copyFrom(other);
+                }
+                return *this;
+            }
+            
+            String& operator=(String&& other) noexcept {
+                if (this != &other) {
+                    release();
+                    moveFrom(other);
+                }
+                return *this;
+            }
+            
+            ~String() { release(); }
+            
+            // Aynı metin için hep aynı depoyu döndürür (ör. özellik adları)
+            static String intern(std::string_view text) {
+                std::string_view stored = Text::Interner::global().intern(text);
+                String result;
+                result.mode = Mode::STATIC;
+                result.interned = true;
+                result.storage.slice.buffer = nullptr;
+                result.storage.slice.data = stored.data();
+                result.bytes = stored.size();
+                return result;
+            }
+            
+            bool isInterned() const { return interned; }
+            bool isInline() const { return mode == Mode::INLINE; }
+            // Başka bir String'le tampon paylaşıyor mu (dilimler için)
+            bool sharesBuffer(const String& other) const {
+                return mode == Mode::SHARED && other.mode == Mode::SHARED && storage.slice.buffer == other.storage.slice.buffer;
+            }
+            
+            int length() const { return static_cast<int>(bytes); }
+            size_t size() const { return bytes; }
+            bool empty() const { return bytes == 0; }
+            const char* data() const { return mode == Mode::INLINE ? storage.small : storage.slice.data; }
+            std::string_view view() const { return std::string_view(data(), bytes); }
+            operator std::string_view() const { return view(); }
+            std::string str() const { return std::string(data(), bytes); }
+            char operator[](size_t index) const { return data()[index]; }
+            
+            // JavaScript substring kuralları: sınırlar [0, length] aralığına çekilir, start > end ise yer değiştirir
+            String substring(int start, int end) const {
+                size_t from = clampIndex(start);
+                size_t to = clampIndex(end);
+                if (from > to) std::swap(from, to);
+                return slice(from, to - from);
+            }
+            
+            size_t find(std::string_view needle, size_t from = 0) const {
+                return Text::find(view(), needle, from);
+            }
+            
+            bool contains(std::string_view needle) const { return find(needle) != npos; }
+            
+            bool startsWith(std::string_view prefix) const {
+                return prefix.size() <= bytes && std::memcmp(data(), prefix.data(), prefix.size()) == 0;
+            }
+            
+            bool endsWith(std::string_view suffix) const {
+                return suffix.size() <= bytes && std::memcmp(data() + bytes - suffix.size(), suffix.data(), suffix.size()) == 0;
+            }
+            
+            // Parçaları sırayla ziyaret eder, vektör ayırmaz. Boş ayırıcı UTF-8 kod noktalarına böler
+            template<typename Visitor>
+            void split(std::string_view delimiter, Visitor&& visitor) const {
+                std::string_view text = view();
+                if (delimiter.empty()) {
+                    for (size_t i = 0; i < bytes;) {
+                        size_t length = codePointLength(text, i);
+                        visitor(slice(i, length));
+                        i += length;
+                    }
+                    return;
+                }
+                size_t start = 0;
+                while (true) {
+                    size_t at = Text::find(text, delimiter, start);
+                    if (at == npos) {
+                        visitor(slice(start, bytes - start));
+                        return;
+                    }
+                    visitor(slice(start, at - start));
+                    start = at + delimiter.size();
+                }
+            }
+            
+            std::vector<String> split(std::string_view delimiter) const {
+                std::vector<String> parts;
+                split(delimiter, [&](String&& part) { parts.push_back(std::move(part)); });
+                return parts;
+            }
+            
+            // Yerel ayardan bağımsız; ASCII, Latin-1 ve Latin Genişletilmiş-A harflerini dönüştürür
+            String toUpperCase() const { return convertCase(true); }
+            String toLowerCase() const { return convertCase(false); }
+            
+            String operator+(std::string_view other) const {
+                size_t total = bytes + other.size();
+                String result;
+                char* target = result.reserve(total);
+                std::memcpy(target, data(), bytes);
+                if (!other.empty()) std::memcpy(target + bytes, other.data(), other.size());
+                return result;
+            }
+            
+            bool operator==(const String& other) const {
+                if (bytes != other.bytes) return false;
+                if (interned && other.interned) return data() == other.data();
+                return data() == other.data() || std::memcmp(data(), other.data(), bytes) == 0;
+            }
             
-            String(const std::string& value) : value(value) {}
+            bool operator!=(const String& other) const { return !(*this == other); }
+            bool operator==(std::string_view other) const { return view() == other; }
+            bool operator!=(std::string_view other) const { return view() != other; }
+            bool operator==(const char* other) const { return view() == other; }
+            bool operator!=(const char* other) const { return view() != other; }
+            bool operator==(const std::string& other) const { return view() == other; }
+            bool operator!=(const std::string& other) const { return view() != other; }
+            bool operator<(const String& other) const { return view() < other.view(); }
             
-            // Metotlar
-            int length() const;
-            String* substring(int start, int end);
-            std::vector<String*> split(const String& delimiter);
-            String* toUpperCase();
-            String* toLowerCase();
+            struct Hash {
+                size_t operator()(const String& text) const { return std::hash<std::string_view>()(text.view()); }
+            };
+            
+        private:
+            enum class Mode : uint8_t {
+                INLINE,
+                SHARED,
+                STATIC
+            };
+            
+            union Storage {
+                char small[INLINE_CAPACITY];
+                struct {
+                    Text::Buffer* buffer;
+                    const char* data;
+                } slice;
+            } storage = {};
+            size_t bytes = 0;
+            Mode mode = Mode::INLINE;
+            bool interned = false;
+            
+            void assign(std::string_view text) {
+                if (text.size() <= INLINE_CAPACITY) {
+                    if (!text.empty()) std::memcpy(storage.small, text.data(), text.size());
+                    mode = Mode::INLINE;
+                } else {
+                    storage.slice.buffer = Text::Buffer::copy(text.data(), text.size());
+                    storage.slice.data = storage.slice.buffer->data();
+                    mode = Mode::SHARED;
+                }
+                bytes = text.size();
+            }
+            
+            // Boş bir String'e size baytlık yazılabilir alan ayırır
+            char* reserve(size_t size) {
+                bytes = size;
+                if (size <= INLINE_CAPACITY) return storage.small;
+                storage.slice.buffer = Text::Buffer::create(size);
+                storage.slice.data = storage.slice.buffer->data();
+                mode = Mode::SHARED;
+                return storage.slice.buffer->data();
+            }
+            
+            void copyFrom(const String& other) {
+                storage = other.storage;
+                bytes = other.bytes;
+                mode = other.mode;
+                interned = other.interned;
+                if (mode == Mode::SHARED) storage.slice.buffer->retain();
+            }
+            
+            void moveFrom(String& other) {
+                storage = other.storage;
+                bytes = other.bytes;
+                mode = other.mode;
+                interned = other.interned;
+                other.mode = Mode::INLINE;
+                other.bytes = 0;
+                other.interned = false;
+            }
+            
+            void release() {
+                if (mode == Mode::SHARED) storage.slice.buffer->release();
+                mode = Mode::INLINE;
+                bytes = 0;
+                interned = false;
+            }
+            
+            size_t clampIndex(int index) const {
+                if (index <= 0) return 0;
+                return std::min(static_cast<size_t>(index), bytes);
+            }
+            
+            // Küçük dilimler satır içine kopyalanır; büyükler tamponu paylaşır
+            String slice(size_t offset, size_t count) const {
+                if (count <= INLINE_CAPACITY || mode == Mode::INLINE) return String(std::string_view(data() + offset, count));
+                String result;
+                result.mode = mode;
+                result.storage.slice.buffer = storage.slice.buffer;
+                result.storage.slice.data = storage.slice.data + offset;
+                result.bytes = count;
+                if (mode == Mode::SHARED) storage.slice.buffer->retain();
+                return result;
+            }
+            
+            static size_t codePointLength(std::string_view text, size_t index) {
+                unsigned char lead = static_cast<unsigned char>(text[index]);
+                size_t expected = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+                size_t length = 1;
+                while (length < expected && index + length < text.size() &&
+                       (static_cast<unsigned char>(text[index + length]) & 0xC0) == 0x80) {
+                    length++;
+                }
+                return length;
+            }
+            
+            String convertCase(bool upper) const {
+                String result;
+                char* target = result.reserve(bytes);
+                // Çıktı girdiden uzun olamaz; kısalırsa (İ -> i) uzunluk düzeltilir
+                result.bytes = Text::convertCase(data(), bytes, target, upper);
+                return result;
+            }
         };
         
         class Number {
@@ -35,6 +278,15 @@ namespace Wholf {
             Number* divide(const Number& other);
         };
         
+        // Tipli sayı dizileri: kutusuz, bitişik elemanlar; işlemler Numeric:: çekirdekleriyle
+        // (Numeric::add(a, b), Numeric::sum(a), Numeric::dot(a, b) ...)
+        class TypedArrays {
+        public:
+            static TypedArray float64(size_t length) { return TypedArray(ElementType::FLOAT64, length); }
+            static TypedArray float32(size_t length) { return TypedArray(ElementType::FLOAT32, length); }
+            static TypedArray int32(size_t length) { return TypedArray(ElementType::INT32, length); }
+        };
+        
         // Koleksiyonlar
         template<typename T>
         class List {
@@ -52,15 +304,31 @@ namespace Wholf {
         // Dosya işlemleri
         class File {
         public:
-            static String* read(const String& path);
+            static String read(const String& path);
             static void write(const String& path, const String& content);
+            
+            // Tembel satır/kayıt yinelemesi: for (std::string_view line : File::lines(path))
+            static Wholf::File::LineReader lines(const String& path) {
+                return Wholf::File::LineReader(path.str());
+            }
+            
+            static Wholf::File::LineReader records(const String& path, char delimiter) {
+                Wholf::File::LineReader::Options options;
+                options.delimiter = delimiter;
+                return Wholf::File::LineReader(path.str(), options);
+            }
+            
+            // Sütunlu CSV/TSV: File::table(path).column("fiyat").sum()
+            static Wholf::Table::Table table(const String& path) {
+                return Wholf::Table::Table::read(path.str());
+            }
         };
         
         // Girdi/Çıktı
         class Console {
         public:
             static void writeLine(const String& message);
-            static String* readLine();
+            static String readLine();
         };
     }
 }
@@ -0,0 +1,469 @@
+#ifndef WHOLF_STREAM_HPP
+#define WHOLF_STREAM_HPP
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Wholf {
+    namespace Fegn {
+        // Akıştaki kayıt: paylaşılan bir tamponun dilimi. Aşamalar arasında kopyalanmadan taşınır;
+        // tampon son kayıt bırakılınca serbest kalır.
+        class Record {
+        public:
+            Record() = default;
+
+            explicit Record(std::string data)
+                : buffer(std::make_shared<const std::string>(std::move(data))), offset(0), length(buffer->size()) {}
+
+            Record(std::shared_ptr<const std::string> buffer, size_t offset, size_t length)
+                : buffer(std::move(buffer)), offset(offset), length(length) {}
+
+            std::string_view view() const {
+                return buffer ? std::string_view(buffer->data() + offset, length) : std::string_view();
+            }
+
+            size_t size() const { return length; }
+            std::string str() const { return std::string(view()); }
+
+            // Aynı tamponu paylaşan alt kayıt
+            Record slice(size_t from, size_t count = std::string::npos) const {
+                from = std::min(from, length);
+                return Record(buffer, offset + from, std::min(count, length - from));
+            }
+
+        private:
+            std::shared_ptr<const std::string> buffer;
+            size_t offset = 0;
+            size_t length = 0;
+        };
+
+        using Batch = std::vector<Record>;
+
+        // Sınırlı kuyruk: doluyken push bekler (geri basınç)
+        template<typename T>
+        class BoundedQueue {
+        public:
+            explicit BoundedQueue(size_t capacity) : capacity(capacity ? capacity : 1) {}
+
+            // Kuyruk kapatıldıysa false
+            bool push(T item) {
+                std::unique_lock<std::mutex> lock(mutex);
+                notFull.wait(lock, [&]() { return items.size() < capacity || closed; });
+                if (closed) return false;
+                items.push_back(std::move(item));
+                notEmpty.notify_one();
+                return true;
+            }
+
+            // Kapalı ve boşsa false
+            bool pop(T& item) {
+                std::unique_lock<std::mutex> lock(mutex);
+                notEmpty.wait(lock, [&]() { return !items.empty() || closed; });
+                if (items.empty()) return false;
+                item = std::move(items.front());
+                items.pop_front();
+                notFull.notify_one();
+                return true;
+            }
+
+            void close() {
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+                notFull.notify_all();
+                notEmpty.notify_all();
+            }
+
+            // Kapat ve bekleyenleri at; pop hemen false döner
+            void abort() {
+                std::lock_guard<std::mutex> lock(mutex);
+                closed = true;
+                items.clear();
+                notFull.notify_all();
+                notEmpty.notify_all();
+            }
+
+        private:
+            const size_t capacity;
+            std::mutex mutex;
+            std::condition_variable notFull;
+            std::condition_variable notEmpty;
+            std::deque<T> items;
+            bool closed = false;
+        };
+
+        // Ayraçla bölünmüş kayıt okuyucu (dosya ya da soket). Kayıtlar okunan parçaya işaret eder;
+        // parça sınırında kalan yarım kayıt bir sonraki parçanın başına taşınır.
+        class DelimitedReader {
+        public:
+            static constexpr size_t CHUNK_SIZE = 1 << 20;
+
+            DelimitedReader(int fd, bool ownsFd, char delimiter) : fd(fd), ownsFd(ownsFd), delimiter(delimiter) {}
+
+            ~DelimitedReader() {
+                if (ownsFd && fd >= 0) ::close(fd);
+            }
+
+            DelimitedReader(const DelimitedReader&) = delete;
+            DelimitedReader& operator=(const DelimitedReader&) = delete;
+
+            // En fazla batchSize kayıt ekle; akış bittiyse ve hiçbir şey eklenmediyse false
+            bool next(Batch& batch, size_t batchSize) {
+                while (batch.size() < batchSize) {
+                    if (position < chunk->size()) {
+                        const char* start = chunk->data() + position;
+                        size_t available = chunk->size() - position;
+                        const void* found = std::memchr(start, delimiter, available);
+                        if (found) {
+                            size_t length = static_cast<size_t>(static_cast<const char*>(found) - start);
+                            batch.emplace_back(chunk, position, length);
+                            position += length + 1;
+                            continue;
+                        }
+                        if (finished) {
+                            // Ayraçsız son kayıt
+                            batch.emplace_back(chunk, position, available);
+                            position = chunk->size();
+                            continue;
+                        }
+                    } else if (finished) {
+                        break;
+                    }
+                    if (!refill()) finished = true;
+                }
+                return !batch.empty();
+            }
+
+        private:
+            int fd;
+            bool ownsFd;
+            char delimiter;
+            std::shared_ptr<const std::string> chunk = std::make_shared<const std::string>();
+            size_t position = 0;
+            bool finished = false;
+
+            // Yeni parça oku; kalan yarım kayıt başa kopyalanır. Veri gelmediyse false
+            bool refill() {
+                auto next = std::make_shared<std::string>();
+                size_t carried = chunk->size() - position;
+                size_t capacity = std::max(CHUNK_SIZE, carried * 2);
+                next->resize(capacity);
+                if (carried) std::memcpy(&(*next)[0], chunk->data() + position, carried);
+
+                ssize_t result;
+                do {
+                    result = ::read(fd, &(*next)[carried], capacity - carried);
+                } while (result < 0 && errno == EINTR);
+                if (result < 0) throw std::runtime_error(std::string("Stream read failed: ") + std::strerror(errno));
+
+                next->resize(carried + static_cast<size_t>(result));
+                chunk = std::move(next);
+                position = 0;
+                return result > 0;
+            }
+        };
+
+        // Aşama ayarları
+        struct StageOptions {
+            // Aşamayı çalıştıran thread sayısı
+            size_t parallelism = 1;
+            // true: çıktı girişle aynı sırada; false: biten parti hemen iletilir
+            bool ordered = true;
+            // Aşamanın giriş kuyruğundaki en fazla parti; sıralı aşamada ayrıca çıkışa
+            // itilmeyi bekleyen (işlenen ya da sıra bekleyen) en fazla parti
+            size_t queueCapacity = 8;
+        };
+
+        // Veri akışı yönetimi: kaynak -> aşamalar -> hedef. Her aşama sınırlı bir kuyruktan
+        // parti alır; yavaş bir aşama kuyruğu doldurunca üst akış bekler.
+        class Stream {
+        public:
+            using Source = std::function<bool(Batch&)>;
+            using Stage = std::function<void(Batch&)>;
+            using Sink = std::function<void(const Batch&)>;
+
+            struct Stats {
+                uint64_t batches = 0;
+                uint64_t records = 0;
+                uint64_t bytes = 0;
+                std::chrono::nanoseconds elapsed{0};
+            };
+
+            Stream& from(Source source) {
+                this->source = std::move(source);
+                return *this;
+            }
+
+            Stream& fromFile(const std::string& path, char delimiter = '\n', size_t batchSize = 1024) {
+                int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if (fd < 0) throw std::runtime_error("Cannot open stream source: " + path);
+                ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+                return fromReader(std::make_shared<DelimitedReader>(fd, true, delimiter), batchSize);
+            }
+
+            // Bağlı bir soketten (ya da boru hattından) oku; fd sahipliği çağırana aittir
+            Stream& fromSocket(int fd, char delimiter = '\n', size_t batchSize = 1024) {
+                return fromReader(std::make_shared<DelimitedReader>(fd, false, delimiter), batchSize);
+            }
+
+            // Unix soket yoluna bağlanıp oku
+            Stream& fromUnixSocket(const std::string& path, char delimiter = '\n', size_t batchSize = 1024) {
+                int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+                if (fd < 0) throw std::runtime_error("Cannot create stream socket");
+                sockaddr_un address{};
+                address.sun_family = AF_UNIX;
+                if (path.size() >= sizeof(address.sun_path)) {
+                    ::close(fd);
+                    throw std::runtime_error("Socket path too long: " + path);
+                }
+                std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+                if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+                    ::close(fd);
+                    throw std::runtime_error("Cannot connect stream socket: " + path);
+                }
+                return fromReader(std::make_shared<DelimitedReader>(fd, true, delimiter), batchSize);
+            }
+
+            Stream& fromRecords(std::vector<Record> records, size_t batchSize = 1024) {
+                auto shared = std::make_shared<std::vector<Record>>(std::move(records));
+                auto position = std::make_shared<size_t>(0);
+                source = [shared, position, batchSize](Batch& batch) {
+                    size_t end = std::min(shared->size(), *position + batchSize);
+                    batch.insert(batch.end(), shared->begin() + static_cast<std::ptrdiff_t>(*position),
+                                 shared->begin() + static_cast<std::ptrdiff_t>(end));
+                    *position = end;
+                    return !batch.empty();
+                };
+                return *this;
+            }
+
+            // Parti üzerinde yerinde çalışan aşama
+            Stream& stage(Stage function, const StageOptions& options = StageOptions()) {
+                stages.push_back(StageSpec{std::move(function), options});
+                return *this;
+            }
+
+            Stream& map(std::function<Record(const Record&)> function, const StageOptions& options = StageOptions()) {
+                return stage([function](Batch& batch) {
+                    for (auto& record : batch) record = function(record);
+                }, options);
+            }
+
+            Stream& filter(std::function<bool(const Record&)> predicate, const StageOptions& options = StageOptions()) {
+                return stage([predicate](Batch& batch) {
+                    size_t kept = 0;
+                    for (size_t i = 0; i < batch.size(); i++) {
+                        if (predicate(batch[i])) {
+                            if (kept != i) batch[kept] = std::move(batch[i]);
+                            kept++;
+                        }
+                    }
+                    batch.resize(kept);
+                }, options);
+            }
+
+            Stream& pipe(Sink sink) {
+                this->sink = std::move(sink);
+                return *this;
+            }
+
+            // Akışı sonuna kadar çalıştır; hedef çağıran thread'de, sırayla çağrılır.
+            // Herhangi bir aşamadaki hata akışı durdurur ve burada yeniden fırlatılır.
+            Stats run(size_t sinkQueueCapacity = 8) {
+                if (!source) throw std::runtime_error("Stream has no source");
+                auto started = std::chrono::steady_clock::now();
+
+                std::vector<std::unique_ptr<BoundedQueue<Chunk>>> queues;
+                for (const auto& spec : stages) queues.push_back(std::make_unique<BoundedQueue<Chunk>>(spec.options.queueCapacity));
+                queues.push_back(std::make_unique<BoundedQueue<Chunk>>(sinkQueueCapacity));
+
+                Failure failure;
+                auto fail = [&](std::exception_ptr error) {
+                    {
+                        std::lock_guard<std::mutex> lock(failure.mutex);
+                        if (!failure.error) failure.error = error;
+                    }
+                    failure.failed.store(true, std::memory_order_release);
+                    for (auto& queue : queues) queue->abort();
+                };
+
+                std::vector<std::thread> threads;
+                threads.emplace_back([&]() {
+                    try {
+                        uint64_t sequence = 0;
+                        while (true) {
+                            Chunk chunk{sequence, Batch()};
+                            if (!source(chunk.batch)) break;
+                            sequence++;
+                            if (!queues[0]->push(std::move(chunk))) break;
+                        }
+                    } catch (...) {
+                        fail(std::current_exception());
+                    }
+                    queues[0]->close();
+                });
+
+                std::vector<std::unique_ptr<StageState>> states;
+                for (size_t i = 0; i < stages.size(); i++) {
+                    size_t workers = std::max<size_t>(1, stages[i].options.parallelism);
+                    auto state = std::make_unique<StageState>();
+                    state->remaining = workers;
+                    for (size_t worker = 0; worker < workers; worker++) {
+                        threads.emplace_back([&, i, current = state.get()]() {
+                            runStage(stages[i], *queues[i], *queues[i + 1], *current, fail);
+                        });
+                    }
+                    states.push_back(std::move(state));
+                }
+
+                Stats stats;
+                Chunk chunk;
+                while (queues.back()->pop(chunk)) {
+                    // Hata kaydedildikten sonra kuyruktan alınmış parti de hedefe verilmez
+                    if (failure.failed.load(std::memory_order_acquire)) break;
+                    try {
+                        if (sink) sink(chunk.batch);
+                    } catch (...) {
+                        fail(std::current_exception());
+                        break;
+                    }
+                    stats.batches++;
+                    stats.records += chunk.batch.size();
+                    for (const auto& record : chunk.batch) stats.bytes += record.size();
+                }
+
+                for (auto& thread : threads) thread.join();
+                if (failure.error) std::rethrow_exception(failure.error);
+                stats.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started);
+                return stats;
+            }
+
+        private:
+            struct StageSpec {
+                Stage function;
+                StageOptions options;
+            };
+
+            struct Chunk {
+                uint64_t sequence = 0;
+                Batch batch;
+            };
+
+            struct StageState {
+                std::mutex mutex;
+                // Sıralı çıktı için bekleyen partiler
+                std::map<uint64_t, Batch> reorder;
+                uint64_t nextSequence = 0;
+                // nextSequence ilerleyince ya da aşama durunca uyarılır
+                std::condition_variable window;
+                bool stopped = false;
+                // Bir thread sıradaki partileri çıkışa itiyor; itme kilit dışında yapılır
+                bool draining = false;
+                size_t remaining = 0;
+            };
+
+            struct Failure {
+                std::mutex mutex;
+                std::exception_ptr error;
+                std::atomic<bool> failed{false};
+            };
+
+            Source source;
+            std::vector<StageSpec> stages;
+            Sink sink;
+
+            Stream& fromReader(std::shared_ptr<DelimitedReader> reader, size_t batchSize) {
+                source = [reader, batchSize](Batch& batch) {
+                    batch.reserve(batchSize);
+                    return reader->next(batch, batchSize);
+                };
+                return *this;
+            }
+
+            static void stop(StageState& state) {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.stopped = true;
+                state.window.notify_all();
+            }
+
+            template<typename Fail>
+            static void runStage(const StageSpec& spec, BoundedQueue<Chunk>& input, BoundedQueue<Chunk>& output,
+                                 StageState& state, Fail& fail) {
+                const uint64_t window = std::max<size_t>(1, spec.options.queueCapacity);
+                try {
+                    Chunk chunk;
+                    while (input.pop(chunk)) {
+                        if (spec.options.ordered) {
+                            // Sıra penceresi: sıradaki partiden window kadar ileride olan parti beklenir.
+                            // Yoksa yavaş bir parti sürerken diğer thread'ler reorder'ı sınırsız büyütürdü.
+                            // Sıradaki parti her zaman pencerenin içindedir, bu yüzden bekleme kilitlenmez
+                            std::unique_lock<std::mutex> lock(state.mutex);
+                            state.window.wait(lock, [&]() {
+                                return chunk.sequence - state.nextSequence < window || state.stopped;
+                            });
+                            if (state.stopped) break;
+                        }
+                        spec.function(chunk.batch);
+                        if (!spec.options.ordered) {
+                            if (!output.push(std::move(chunk))) break;
+                            continue;
+                        }
+                        // Sıradaki parti gelene kadar bekletilir; boş partiler de sırayı korumak için iletilir.
+                        // Aynı anda tek thread iter, böylece sıra kilit tutulmadan korunur
+                        std::unique_lock<std::mutex> lock(state.mutex);
+                        state.reorder.emplace(chunk.sequence, std::move(chunk.batch));
+                        if (state.draining) continue;
+                        state.draining = true;
+                        bool open = true;
+                        while (true) {
+                            auto it = state.reorder.find(state.nextSequence);
+                            if (it == state.reorder.end() || !open) break;
+                            Chunk ready{it->first, std::move(it->second)};
+                            state.reorder.erase(it);
+                            state.nextSequence++;
+                            state.window.notify_all();
+                            lock.unlock();
+                            open = output.push(std::move(ready));
+                            lock.lock();
+                        }
+                        state.draining = false;
+                        if (!open) {
+                            stop(state);
+                            break;
+                        }
+                    }
+                } catch (...) {
+                    fail(std::current_exception());
+                    // Bu thread'in partisi hiç iletilmeyecek; pencerede bekleyenler bırakılır
+                    stop(state);
+                }
+
+                // Aşamanın son thread'i çıkış kuyruğunu kapatır
+                std::lock_guard<std::mutex> lock(state.mutex);
+                if (--state.remaining == 0) output.close();
+            }
+        };
+    }
+}
+
+#endif // WHOLF_STREAM_HPP
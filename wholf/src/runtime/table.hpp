@@ -0,0 +1,895 @@
+#ifndef WHOLF_TABLE_HPP
+#define WHOLF_TABLE_HPP
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "file.hpp"
+#include "../interpreter/Value.hpp"
+
+namespace Wholf {
+    namespace Table {
+        enum class ColumnType {
+            INTEGER,
+            FLOAT,
+            BOOLEAN,
+            STRING
+        };
+
+        // Tipli sütun tamponu. Boş (tırnaksız, uzunluğu 0) alanlar boş değerdir:
+        // valid[i] == 0 ve sayısal tamponda 0 yazılıdır, böylece toplamlar maskesiz yapılabilir.
+        class Column {
+        public:
+            std::string name;
+            ColumnType type = ColumnType::STRING;
+
+            size_t size() const { return valid.size(); }
+            size_t nullCount() const { return nulls; }
+            bool isNull(size_t row) const { return !valid[row]; }
+
+            const std::vector<int64_t>& integers() const { return integerValues; }
+            const std::vector<double>& floats() const { return floatValues; }
+            const std::vector<uint8_t>& booleans() const { return booleanValues; }
+
+            std::string_view string(size_t row) const {
+                return std::string_view(text.data() + offsets[row], offsets[row + 1] - offsets[row]);
+            }
+
+            // Sayısal ve mantıksal sütunlarda boş olmayan değerlerin toplamı (true = 1)
+            double sum() const {
+                switch (type) {
+                    case ColumnType::INTEGER: return static_cast<double>(integerSum());
+                    case ColumnType::FLOAT: return sumFloats(floatValues.data(), floatValues.size());
+                    case ColumnType::BOOLEAN: return static_cast<double>(countBytes(booleanValues.data(), booleanValues.size()));
+                    case ColumnType::STRING: break;
+                }
+                throw std::runtime_error("Column is not numeric: " + name);
+            }
+
+            // Tam sayı sütununun kesin toplamı (taşma sarar)
+            int64_t integerSum() const {
+                if (type != ColumnType::INTEGER) throw std::runtime_error("Column is not an integer column: " + name);
+                return sumIntegers(integerValues.data(), integerValues.size());
+            }
+
+            double mean() const {
+                size_t count = size() - nulls;
+                return count ? sum() / static_cast<double>(count) : std::numeric_limits<double>::quiet_NaN();
+            }
+
+            // Boş değerler atlanır; hiç değer yoksa NaN
+            double min() const { return extreme(false); }
+            double max() const { return extreme(true); }
+
+            // Değer -> satır sayısı; boş değerler sayılmaz
+            std::map<std::string, uint64_t> countBy() const {
+                std::map<std::string, uint64_t> result;
+                size_t rows = size();
+                switch (type) {
+                    case ColumnType::INTEGER: {
+                        std::unordered_map<int64_t, uint64_t> counts;
+                        for (size_t i = 0; i < rows; i++) {
+                            if (valid[i]) counts[integerValues[i]]++;
+                        }
+                        for (auto& entry : counts) result[std::to_string(entry.first)] = entry.second;
+                        break;
+                    }
+                    case ColumnType::FLOAT: {
+                        std::unordered_map<double, uint64_t> counts;
+                        for (size_t i = 0; i < rows; i++) {
+                            if (valid[i]) counts[floatValues[i]]++;
+                        }
+                        for (auto& entry : counts) result[formatFloat(entry.first)] = entry.second;
+                        break;
+                    }
+                    case ColumnType::BOOLEAN: {
+                        uint64_t trues = countBytes(booleanValues.data(), rows);
+                        uint64_t falses = rows - nulls - trues;
+                        if (trues) result["true"] = trues;
+                        if (falses) result["false"] = falses;
+                        break;
+                    }
+                    case ColumnType::STRING: {
+                        std::unordered_map<std::string_view, uint64_t> counts;
+                        for (size_t i = 0; i < rows; i++) {
+                            if (valid[i]) counts[string(i)]++;
+                        }
+                        for (auto& entry : counts) result[std::string(entry.first)] = entry.second;
+                        break;
+                    }
+                }
+                return result;
+            }
+
+            Value at(size_t row) const {
+                if (!valid[row]) return Value(nullptr);
+                switch (type) {
+                    case ColumnType::INTEGER: {
+                        int64_t value = integerValues[row];
+                        // Value'da 64 bit tam sayı yok; int dışındakiler float olur
+                        if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max()) {
+                            return Value(static_cast<int>(value));
+                        }
+                        return Value(static_cast<float>(value));
+                    }
+                    case ColumnType::FLOAT: return Value(static_cast<float>(floatValues[row]));
+                    case ColumnType::BOOLEAN: return Value(booleanValues[row] != 0);
+                    case ColumnType::STRING: return Value(std::string(string(row)));
+                }
+                return Value(nullptr);
+            }
+
+            // Betiklere dizi olarak
+            Value toValue() const {
+                std::vector<Value> items;
+                items.reserve(size());
+                for (size_t i = 0; i < size(); i++) items.push_back(at(i));
+                return Value(std::move(items));
+            }
+
+            // Vektör çekirdekleri; SSE2 yoksa çoklu biriktiricili skaler döngü
+            static int64_t sumIntegers(const int64_t* values, size_t count) {
+                size_t i = 0;
+                uint64_t total = 0;
+#if defined(__SSE2__)
+                __m128i a = _mm_setzero_si128();
+                __m128i b = _mm_setzero_si128();
+                for (; i + 4 <= count; i += 4) {
+                    a = _mm_add_epi64(a, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)));
+                    b = _mm_add_epi64(b, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i + 2)));
+                }
+                uint64_t lanes[2];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), _mm_add_epi64(a, b));
+                total = lanes[0] + lanes[1];
+#endif
+                for (; i < count; i++) total += static_cast<uint64_t>(values[i]);
+                return static_cast<int64_t>(total);
+            }
+
+            // Dört kulvarlı toplama: sıralı toplamadan farklı yuvarlanabilir
+            static double sumFloats(const double* values, size_t count) {
+                size_t i = 0;
+                double total = 0;
+#if defined(__SSE2__)
+                __m128d a = _mm_setzero_pd();
+                __m128d b = _mm_setzero_pd();
+                for (; i + 4 <= count; i += 4) {
+                    a = _mm_add_pd(a, _mm_loadu_pd(values + i));
+                    b = _mm_add_pd(b, _mm_loadu_pd(values + i + 2));
+                }
+                double lanes[2];
+                _mm_storeu_pd(lanes, _mm_add_pd(a, b));
+                total = lanes[0] + lanes[1];
+#endif
+                for (; i < count; i++) total += values[i];
+                return total;
+            }
+
+            static uint64_t countBytes(const uint8_t* values, size_t count) {
+                size_t i = 0;
+                uint64_t total = 0;
+#if defined(__SSE2__)
+                // Baytlar 0/1; SAD 8'li grupları toplar
+                __m128i sums = _mm_setzero_si128();
+                for (; i + 16 <= count; i += 16) {
+                    sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)), _mm_setzero_si128()));
+                }
+                uint64_t lanes[2];
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+                total = lanes[0] + lanes[1];
+#endif
+                for (; i < count; i++) total += values[i];
+                return total;
+            }
+
+        private:
+            friend class Table;
+
+            std::vector<uint8_t> valid;
+            size_t nulls = 0;
+            std::vector<int64_t> integerValues;
+            std::vector<double> floatValues;
+            std::vector<uint8_t> booleanValues;
+            // Dize sütunu: bitişik metin + satır başına başlangıç (size + 1 girdi)
+            std::string text;
+            std::vector<uint64_t> offsets;
+
+            static std::string formatFloat(double value) {
+                char buffer[32];
+                auto written = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                return std::string(buffer, written.ptr);
+            }
+
+            // 16 satırlık bloklar: hepsi doluysa vektör çekirdeği, hepsi boşsa atla, karışıksa tek tek
+            double extreme(bool maximum) const {
+                size_t rows = size();
+                if (type == ColumnType::STRING) throw std::runtime_error("Column is not numeric: " + name);
+                if (type == ColumnType::BOOLEAN) {
+                    if (rows == nulls) return std::numeric_limits<double>::quiet_NaN();
+                    uint64_t trues = countBytes(booleanValues.data(), rows);
+                    return maximum ? (trues ? 1.0 : 0.0) : (trues == rows - nulls ? 1.0 : 0.0);
+                }
+                bool found = false;
+                double best = maximum ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+                int64_t bestInteger = maximum ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
+                for (size_t block = 0; block < rows; block += 16) {
+                    size_t length = std::min<size_t>(16, rows - block);
+                    int present = validMask(block, length);
+                    if (present == 0) continue;
+                    found = true;
+                    if (present == (1 << length) - 1) {
+                        if (type == ColumnType::INTEGER) {
+                            bestInteger = integerExtreme(integerValues.data() + block, length, bestInteger, maximum);
+                        } else {
+                            best = floatExtreme(floatValues.data() + block, length, best, maximum);
+                        }
+                        continue;
+                    }
+                    for (size_t i = 0; i < length; i++) {
+                        if (!(present & (1 << i))) continue;
+                        if (type == ColumnType::INTEGER) {
+                            int64_t value = integerValues[block + i];
+                            bestInteger = maximum ? std::max(bestInteger, value) : std::min(bestInteger, value);
+                        } else {
+                            double value = floatValues[block + i];
+                            best = maximum ? std::max(best, value) : std::min(best, value);
+                        }
+                    }
+                }
+                if (!found) return std::numeric_limits<double>::quiet_NaN();
+                return type == ColumnType::INTEGER ? static_cast<double>(bestInteger) : best;
+            }
+
+            int validMask(size_t block, size_t length) const {
+#if defined(__SSE2__)
+                if (length == 16) {
+                    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(valid.data() + block));
+                    return (~_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_setzero_si128()))) & 0xffff;
+                }
+#endif
+                int mask = 0;
+                for (size_t i = 0; i < length; i++) {
+                    if (valid[block + i]) mask |= 1 << i;
+                }
+                return mask;
+            }
+
+            static double floatExtreme(const double* values, size_t count, double best, bool maximum) {
+                size_t i = 0;
+#if defined(__SSE2__)
+                __m128d accumulator = _mm_set1_pd(best);
+                for (; i + 2 <= count; i += 2) {
+                    __m128d pair = _mm_loadu_pd(values + i);
+                    accumulator = maximum ? _mm_max_pd(accumulator, pair) : _mm_min_pd(accumulator, pair);
+                }
+                double lanes[2];
+                _mm_storeu_pd(lanes, accumulator);
+                best = maximum ? std::max(lanes[0], lanes[1]) : std::min(lanes[0], lanes[1]);
+#endif
+                for (; i < count; i++) best = maximum ? std::max(best, values[i]) : std::min(best, values[i]);
+                return best;
+            }
+
+            // SSE2'de 64 bit karşılaştırma yok; dört bağımsız biriktirici derleyiciye bırakılır
+            static int64_t integerExtreme(const int64_t* values, size_t count, int64_t best, bool maximum) {
+                int64_t lanes[4] = {best, best, best, best};
+                size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    for (int lane = 0; lane < 4; lane++) {
+                        lanes[lane] = maximum ? std::max(lanes[lane], values[i + lane]) : std::min(lanes[lane], values[i + lane]);
+                    }
+                }
+                for (; i < count; i++) lanes[0] = maximum ? std::max(lanes[0], values[i]) : std::min(lanes[0], values[i]);
+                for (int lane = 1; lane < 4; lane++) lanes[0] = maximum ? std::max(lanes[0], lanes[lane]) : std::min(lanes[0], lanes[lane]);
+                return lanes[0];
+            }
+        };
+
+        // Sütunlu CSV/TSV tablosu.
+        // Okuma: dosya eşlenir, tırnak sayımıyla kayıt sınırında bölünmüş parçalar paralel taranır.
+        // Birinci geçiş her sütunun tipini çıkarır, ikinci geçiş alanları doğrudan tipli tamponlara çevirir.
+        class Table {
+        public:
+            struct Options {
+                // 0: uzantıdan (.tsv ise sekme, değilse virgül)
+                char delimiter = 0;
+                // 0: tırnak işleme kapalı. Tırnak içinde ayırıcı ve satır sonu olabilir, "" bir tırnaktır
+                char quote = '"';
+                bool header = true;
+                // 0: donanım thread sayısı
+                size_t threads = 0;
+                // Parça başına hedef bayt
+                size_t chunkSize = 4 << 20;
+                // false: ayırıcı ve tırnak taraması SSE2 yerine skaler döngüyle (karşılaştırma ve test için)
+                bool vectorized = true;
+            };
+
+            Table() = default;
+
+            static Table read(const std::string& path) {
+                return read(path, Options());
+            }
+
+            static Table read(const std::string& path, Options options) {
+                if (options.delimiter == 0) {
+                    bool tab = path.size() >= 4 && path.compare(path.size() - 4, 4, ".tsv") == 0;
+                    options.delimiter = tab ? '\t' : ',';
+                }
+                File::ReadOptions readOptions;
+                readOptions.advice = File::ReadAdvice::SEQUENTIAL;
+                auto file = File::MappedFile::open(path, readOptions);
+                return parse(file->view(), options);
+            }
+
+            static Table parse(std::string_view text) {
+                return parse(text, Options());
+            }
+
+            static Table parse(std::string_view text, Options options) {
+                if (options.delimiter == 0) options.delimiter = ',';
+                if (options.delimiter == '\n' || options.delimiter == '\r' || (options.quote && options.delimiter == options.quote)) {
+                    throw std::runtime_error("Invalid table delimiter");
+                }
+                Table table;
+                Reader reader(text, options);
+                reader.run(table);
+                return table;
+            }
+
+            size_t rowCount() const { return rows; }
+            size_t columnCount() const { return columnList.size(); }
+            const std::vector<Column>& columns() const { return columnList; }
+            const Column& column(size_t index) const { return columnList.at(index); }
+
+            const Column& column(const std::string& name) const {
+                for (const auto& column : columnList) {
+                    if (column.name == name) return column;
+                }
+                throw std::runtime_error("Unknown column: " + name);
+            }
+
+            // { sütun adı: [değerler] }
+            Value toValue() const {
+                std::map<std::string, Value> result;
+                for (const auto& column : columnList) result.insert_or_assign(column.name, column.toValue());
+                return Value(std::move(result));
+            }
+
+        private:
+            std::vector<Column> columnList;
+            size_t rows = 0;
+
+            // Alan sınıfları; birinci geçişte sütun başına OR'lanır
+            enum Kind : uint8_t {
+                EMPTY = 0,
+                INTEGER_KIND = 1,
+                FLOAT_KIND = 2,
+                BOOLEAN_KIND = 4,
+                STRING_KIND = 8
+            };
+
+            struct Field {
+                const char* data;
+                size_t size;
+                bool quoted;
+            };
+
+            class Reader {
+            public:
+                Reader(std::string_view text, const Options& options) : text(text), options(options) {}
+
+                void run(Table& table) {
+                    size_t start = 0;
+                    std::vector<std::string> names;
+                    if (options.header) {
+                        start = recordEnd(0);
+                        scan(0, start, [&](size_t, const Field& field) { names.push_back(unquote(field)); }, [](size_t) {});
+                        // Boş başlık satırı sütun değildir
+                        if (names.size() == 1 && names[0].empty()) names.clear();
+                    } else {
+                        size_t end = recordEnd(0);
+                        size_t count = 0;
+                        scan(0, end, [&](size_t, const Field&) { count++; }, [](size_t) {});
+                        for (size_t i = 0; i < count; i++) names.push_back("column" + std::to_string(i));
+                    }
+                    columns = names.size();
+                    if (columns == 0) return;
+
+                    std::vector<size_t> bounds = split(start);
+                    size_t chunks = bounds.size() - 1;
+
+                    // 1. geçiş: satır sayıları ve sütun tipleri
+                    std::vector<size_t> chunkRows(chunks, 0);
+                    std::vector<std::vector<uint8_t>> chunkKinds(chunks, std::vector<uint8_t>(columns, EMPTY));
+                    parallelFor(chunks, [&](size_t c) {
+                        std::vector<uint8_t>& kinds = chunkKinds[c];
+                        size_t count = 0;
+                        scan(bounds[c], bounds[c + 1], [&](size_t column, const Field& field) {
+                            if (column >= columns) tooManyFields(field);
+                            // Dizeye düşmüş sütunu sınıflandırmaya gerek yok
+                            if (!(kinds[column] & STRING_KIND)) kinds[column] |= classify(field);
+                        }, [&](size_t) { count++; });
+                        chunkRows[c] = count;
+                    });
+
+                    std::vector<size_t> rowOffsets(chunks + 1, 0);
+                    for (size_t c = 0; c < chunks; c++) rowOffsets[c + 1] = rowOffsets[c] + chunkRows[c];
+                    size_t total = rowOffsets[chunks];
+
+                    table.rows = total;
+                    table.columnList.resize(columns);
+                    for (size_t i = 0; i < columns; i++) {
+                        uint8_t kinds = 0;
+                        for (size_t c = 0; c < chunks; c++) kinds |= chunkKinds[c][i];
+                        Column& column = table.columnList[i];
+                        column.name = names[i];
+                        column.type = resolve(kinds);
+                        column.valid.assign(total, 0);
+                        switch (column.type) {
+                            case ColumnType::INTEGER: column.integerValues.assign(total, 0); break;
+                            case ColumnType::FLOAT: column.floatValues.assign(total, 0.0); break;
+                            case ColumnType::BOOLEAN: column.booleanValues.assign(total, 0); break;
+                            case ColumnType::STRING: column.offsets.assign(total + 1, 0); break;
+                        }
+                    }
+
+                    // 2. geçiş: doğrudan son tamponlara; dize sütunları parça başına ayrı metin biriktirir
+                    std::vector<std::vector<std::string>> chunkText(chunks, std::vector<std::string>(columns));
+                    parallelFor(chunks, [&](size_t c) {
+                        size_t row = rowOffsets[c];
+                        std::vector<uint8_t> seen(columns, 0);
+                        std::vector<std::string>& arenas = chunkText[c];
+                        // Parça uzunluğu üst sınırdır; yalnızca yazılan sayfalar ayrılır
+                        for (size_t index = 0; index < columns; index++) {
+                            if (table.columnList[index].type == ColumnType::STRING) arenas[index].reserve(bounds[c + 1] - bounds[c]);
+                        }
+                        scan(bounds[c], bounds[c + 1], [&](size_t index, const Field& field) {
+                            Column& column = table.columnList[index];
+                            seen[index] = 1;
+                            if (column.type == ColumnType::STRING) {
+                                std::string& arena = arenas[index];
+                                if (field.size == 0 && !field.quoted) {
+                                    column.offsets[row + 1] = arena.size();
+                                    return;
+                                }
+                                appendUnquoted(arena, field);
+                                column.offsets[row + 1] = arena.size();
+                                column.valid[row] = 1;
+                                return;
+                            }
+                            if (field.size == 0) return;
+                            column.valid[row] = 1;
+                            convert(column, row, field);
+                        }, [&](size_t) {
+                            // Eksik alanlar boştur; dize sütununda ofset bir öncekini tekrarlar
+                            for (size_t index = 0; index < columns; index++) {
+                                if (!seen[index] && table.columnList[index].type == ColumnType::STRING) {
+                                    table.columnList[index].offsets[row + 1] = arenas[index].size();
+                                }
+                                seen[index] = 0;
+                            }
+                            row++;
+                        });
+                    });
+
+                    // Dize parçalarını birleştir: parça tabanlarını ekle, metinleri uç uca koy
+                    for (size_t i = 0; i < columns; i++) {
+                        Column& column = table.columnList[i];
+                        if (column.type != ColumnType::STRING) continue;
+                        std::vector<uint64_t> bases(chunks + 1, 0);
+                        for (size_t c = 0; c < chunks; c++) bases[c + 1] = bases[c] + chunkText[c][i].size();
+                        column.text.resize(bases[chunks]);
+                        parallelFor(chunks, [&](size_t c) {
+                            std::string& arena = chunkText[c][i];
+                            if (!arena.empty()) std::memcpy(&column.text[bases[c]], arena.data(), arena.size());
+                            for (size_t r = rowOffsets[c] + 1; r <= rowOffsets[c + 1]; r++) column.offsets[r] += bases[c];
+                            std::string().swap(arena);
+                        });
+                    }
+                    for (auto& column : table.columnList) {
+                        column.nulls = total - static_cast<size_t>(Column::countBytes(column.valid.data(), total));
+                    }
+                }
+
+            private:
+                std::string_view text;
+                Options options;
+                size_t columns = 0;
+
+                // Kaydın bitişi ('\n' sonrası ya da metin sonu); tırnak içindeki satır sonları atlanır
+                size_t recordEnd(size_t position) const {
+                    bool quoted = false;
+                    for (size_t i = position; i < text.size(); i++) {
+                        char c = text[i];
+                        if (options.quote && c == options.quote) quoted = !quoted;
+                        else if (c == '\n' && !quoted) return i + 1;
+                    }
+                    return text.size();
+                }
+
+                // Parça sınırları: her parçanın başlangıç tırnak paritesi paralel sayımla bulunur,
+                // ardından sınır tırnak dışındaki ilk satır sonuna kaydırılır
+                std::vector<size_t> split(size_t start) {
+                    size_t length = text.size() - start;
+                    size_t threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+                    size_t target = std::max<size_t>(options.chunkSize, 64 * 1024);
+                    // En az thread sayısı kadar parça, ama 64 KB'den küçük parça yok
+                    size_t chunks = std::max((length + target - 1) / target, threads);
+                    chunks = std::max<size_t>(1, std::min(chunks, length / (64 * 1024)));
+                    std::vector<size_t> nominal(chunks + 1);
+                    for (size_t c = 0; c <= chunks; c++) nominal[c] = start + length * c / chunks;
+
+                    std::vector<size_t> quotes(chunks, 0);
+                    if (options.quote) {
+                        parallelFor(chunks, [&](size_t c) { quotes[c] = countQuotes(nominal[c], nominal[c + 1]); });
+                    }
+                    std::vector<size_t> bounds{start};
+                    size_t parity = 0;
+                    for (size_t c = 1; c < chunks; c++) {
+                        parity += quotes[c - 1];
+                        bool quoted = parity & 1;
+                        size_t i = nominal[c];
+                        for (; i < text.size(); i++) {
+                            char ch = text[i];
+                            if (options.quote && ch == options.quote) quoted = !quoted;
+                            else if (ch == '\n' && !quoted) break;
+                        }
+                        size_t boundary = std::min(i + 1, text.size());
+                        if (boundary > bounds.back()) bounds.push_back(boundary);
+                    }
+                    if (text.size() > bounds.back() || bounds.size() == 1) bounds.push_back(text.size());
+                    return bounds;
+                }
+
+                size_t countQuotes(size_t begin, size_t end) const {
+                    size_t count = 0;
+                    size_t i = begin;
+#if defined(__SSE2__)
+                    if (options.vectorized) {
+                        const __m128i quote = _mm_set1_epi8(options.quote);
+                        for (; i + 16 <= end; i += 16) {
+                            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+                            count += static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote))));
+                        }
+                    }
+#endif
+                    for (; i < end; i++) count += text[i] == options.quote;
+                    return count;
+                }
+
+                // Blok başına ayırıcı/tırnak/satır sonu maskeleri; tırnak içi önek XOR ile
+                struct Masks {
+                    uint64_t delimiter;
+                    uint64_t quote;
+                    uint64_t newline;
+                };
+
+                Masks classify(const char* block) const {
+                    Masks masks{0, 0, 0};
+#if defined(__SSE2__)
+                    if (options.vectorized) {
+                        const __m128i delimiter = _mm_set1_epi8(options.delimiter);
+                        const __m128i quote = _mm_set1_epi8(options.quote);
+                        const __m128i newline = _mm_set1_epi8('\n');
+                        for (int lane = 0; lane < 4; lane++) {
+                            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * lane));
+                            int shift = 16 * lane;
+                            masks.delimiter |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, delimiter)))) << shift;
+                            masks.quote |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)))) << shift;
+                            masks.newline |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, newline)))) << shift;
+                        }
+                        if (!options.quote) masks.quote = 0;
+                        return masks;
+                    }
+#endif
+                    for (int i = 0; i < 64; i++) {
+                        uint64_t bit = uint64_t(1) << i;
+                        if (block[i] == options.delimiter) masks.delimiter |= bit;
+                        if (block[i] == options.quote) masks.quote |= bit;
+                        if (block[i] == '\n') masks.newline |= bit;
+                    }
+                    if (!options.quote) masks.quote = 0;
+                    return masks;
+                }
+
+                static uint64_t prefixXor(uint64_t bits) {
+                    bits ^= bits << 1;
+                    bits ^= bits << 2;
+                    bits ^= bits << 4;
+                    bits ^= bits << 8;
+                    bits ^= bits << 16;
+                    bits ^= bits << 32;
+                    return bits;
+                }
+
+                // [begin, end) aralığını kayıt kayıt tara: onField(sütun, alan), onRecord(alan sayısı).
+                // begin bir kayıt başıdır. Tek boş alandan oluşan satırlar atlanır
+                template<typename OnField, typename OnRecord>
+                void scan(size_t begin, size_t end, OnField&& onField, OnRecord&& onRecord) const {
+                    size_t fieldStart = begin;
+                    size_t column = 0;
+                    uint64_t quoteCarry = 0;
+                    auto emit = [&](size_t stop, bool recordDone) {
+                        size_t fieldEnd = stop;
+                        if (recordDone && fieldEnd > fieldStart && text[fieldEnd - 1] == '\r') fieldEnd--;
+                        Field field{text.data() + fieldStart, fieldEnd - fieldStart, false};
+                        if (options.quote && field.size > 0 && field.data[0] == options.quote) field.quoted = true;
+                        if (recordDone && column == 0 && field.size == 0) {
+                            fieldStart = stop + 1;
+                            return;
+                        }
+                        onField(column, field);
+                        column++;
+                        if (recordDone) {
+                            onRecord(column);
+                            column = 0;
+                        }
+                        fieldStart = stop + 1;
+                    };
+
+                    size_t offset = begin;
+                    char tail[64];
+                    while (offset < end) {
+                        const char* block = text.data() + offset;
+                        size_t available = end - offset;
+                        if (available < 64) {
+                            // Son yarım blok: ayırıcı/tırnak/satır sonu olmayan bir baytla doldur
+                            std::memset(tail, 0, sizeof(tail));
+                            std::memcpy(tail, block, available);
+                            block = tail;
+                        }
+                        Masks masks = classify(block);
+                        uint64_t inside = prefixXor(masks.quote) ^ quoteCarry;
+                        quoteCarry = static_cast<uint64_t>(static_cast<int64_t>(inside) >> 63);
+                        uint64_t separators = (masks.delimiter | masks.newline) & ~inside;
+                        if (available < 64) separators &= (uint64_t(1) << available) - 1;
+                        while (separators) {
+                            int bit = __builtin_ctzll(separators);
+                            separators &= separators - 1;
+                            emit(offset + static_cast<size_t>(bit), (masks.newline >> bit) & 1);
+                        }
+                        offset += std::min<size_t>(64, available);
+                    }
+                    // Satır sonu olmadan biten son kayıt
+                    if (fieldStart < end || column > 0) {
+                        if (fieldStart > end) fieldStart = end;
+                        emit(end, true);
+                    }
+                }
+
+                [[noreturn]] void tooManyFields(const Field& field) const {
+                    throw std::runtime_error("Too many fields in record near offset " +
+                        std::to_string(static_cast<size_t>(field.data - text.data())) + " (expected " + std::to_string(columns) + ")");
+                }
+
+                // Tırnaklı alanın içeriği ("" -> ")
+                std::string unquote(const Field& field) const {
+                    std::string result;
+                    appendUnquoted(result, field);
+                    return result;
+                }
+
+                void appendUnquoted(std::string& out, const Field& field) const {
+                    if (!field.quoted) {
+                        out.append(field.data, field.size);
+                        return;
+                    }
+                    size_t end = field.size;
+                    // Kapanış tırnağından sonrası (ör. "a"b) olduğu gibi eklenir
+                    size_t i = 1;
+                    while (i < end) {
+                        const char* next = static_cast<const char*>(std::memchr(field.data + i, options.quote, end - i));
+                        if (!next) {
+                            out.append(field.data + i, end - i);
+                            break;
+                        }
+                        size_t at = static_cast<size_t>(next - field.data);
+                        out.append(field.data + i, at - i);
+                        if (at + 1 < end && field.data[at + 1] == options.quote) {
+                            out += options.quote;
+                            i = at + 2;
+                        } else {
+                            out.append(field.data + at + 1, end - at - 1);
+                            break;
+                        }
+                    }
+                }
+
+                // Tırnaklı sayısal alanlar için içerik görünümü (kaçış içermiyorsa)
+                std::string_view content(const Field& field) const {
+                    if (!field.quoted) return std::string_view(field.data, field.size);
+                    if (field.size >= 2 && field.data[field.size - 1] == options.quote) {
+                        std::string_view inner(field.data + 1, field.size - 2);
+                        if (inner.find(options.quote) == std::string_view::npos) return inner;
+                    }
+                    return std::string_view();
+                }
+
+                static bool isBoolean(std::string_view value, bool& result) {
+                    if (value == "true" || value == "TRUE" || value == "True") {
+                        result = true;
+                        return true;
+                    }
+                    if (value == "false" || value == "FALSE" || value == "False") {
+                        result = false;
+                        return true;
+                    }
+                    return false;
+                }
+
+                // Yalnızca ondalık sayı dilbilgisi kabul edilir (inf/nan/hex dize sayılır)
+                static bool isDecimal(std::string_view value, bool& integral) {
+                    size_t i = 0;
+                    size_t size = value.size();
+                    if (i < size && (value[i] == '-' || value[i] == '+')) i++;
+                    size_t digits = 0;
+                    while (i < size && value[i] >= '0' && value[i] <= '9') {
+                        i++;
+                        digits++;
+                    }
+                    integral = true;
+                    if (i < size && value[i] == '.') {
+                        integral = false;
+                        i++;
+                        while (i < size && value[i] >= '0' && value[i] <= '9') {
+                            i++;
+                            digits++;
+                        }
+                    }
+                    if (digits == 0) return false;
+                    if (i < size && (value[i] == 'e' || value[i] == 'E')) {
+                        integral = false;
+                        i++;
+                        if (i < size && (value[i] == '-' || value[i] == '+')) i++;
+                        size_t exponent = 0;
+                        while (i < size && value[i] >= '0' && value[i] <= '9') {
+                            i++;
+                            exponent++;
+                        }
+                        if (exponent == 0) return false;
+                    }
+                    return i == size;
+                }
+
+                uint8_t classify(const Field& field) const {
+                    if (field.size == 0) return EMPTY;
+                    std::string_view value = content(field);
+                    if (value.empty()) return STRING_KIND;
+                    bool integral;
+                    if (isDecimal(value, integral)) {
+                        if (!integral) return FLOAT_KIND;
+                        // 18 haneye kadar int64'e sığar
+                        if (value.size() <= 18) return INTEGER_KIND;
+                        int64_t parsed;
+                        const char* begin = value.data() + (value[0] == '+');
+                        auto result = std::from_chars(begin, value.data() + value.size(), parsed);
+                        return result.ec == std::errc() ? INTEGER_KIND : FLOAT_KIND;
+                    }
+                    bool flag;
+                    return isBoolean(value, flag) ? BOOLEAN_KIND : STRING_KIND;
+                }
+
+                static ColumnType resolve(uint8_t kinds) {
+                    if (kinds & STRING_KIND || kinds == EMPTY) return ColumnType::STRING;
+                    if (kinds & BOOLEAN_KIND) return kinds == BOOLEAN_KIND ? ColumnType::BOOLEAN : ColumnType::STRING;
+                    if (kinds & FLOAT_KIND) return ColumnType::FLOAT;
+                    return ColumnType::INTEGER;
+                }
+
+                // Tip INTEGER ise her dolu alan işaret + rakamlardan oluşur (1. geçişte doğrulandı)
+                static int64_t parseInteger(std::string_view value) {
+                    int64_t parsed = 0;
+                    if (value.size() > 18) {
+                        std::from_chars(value.data() + (value[0] == '+'), value.data() + value.size(), parsed);
+                        return parsed;
+                    }
+                    size_t i = value[0] == '-' || value[0] == '+';
+                    for (; i < value.size(); i++) parsed = parsed * 10 + (value[i] - '0');
+                    return value[0] == '-' ? -parsed : parsed;
+                }
+
+                // Clinger hızlı yolu: mantis < 2^53 ve ondalık hane <= 22 ise tek bölme doğru yuvarlanır
+                static bool fastDecimal(std::string_view value, double& result) {
+                    static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                                     1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+                    size_t i = 0;
+                    size_t size = value.size();
+                    bool negative = size > 0 && value[0] == '-';
+                    if (size > 0 && (value[0] == '-' || value[0] == '+')) i++;
+                    uint64_t mantissa = 0;
+                    size_t digits = 0;
+                    size_t scale = 0;
+                    for (; i < size && value[i] >= '0' && value[i] <= '9'; i++, digits++) mantissa = mantissa * 10 + static_cast<uint64_t>(value[i] - '0');
+                    if (i < size && value[i] == '.') {
+                        for (i++; i < size && value[i] >= '0' && value[i] <= '9'; i++, digits++, scale++) {
+                            mantissa = mantissa * 10 + static_cast<uint64_t>(value[i] - '0');
+                        }
+                    }
+                    if (i != size || digits > 19 || scale > 22 || mantissa > (uint64_t(1) << 53)) return false;
+                    result = static_cast<double>(mantissa) / powers[scale];
+                    if (negative) result = -result;
+                    return true;
+                }
+
+                static double parseFloat(std::string_view value) {
+                    double parsed = 0;
+                    if (fastDecimal(value, parsed)) return parsed;
+                    const char* begin = value.data() + (value[0] == '+');
+                    auto result = std::from_chars(begin, value.data() + value.size(), parsed);
+                    // Taşma/alttan taşma: strtod ±inf ya da ±0 verir
+                    if (result.ec == std::errc::result_out_of_range) parsed = std::strtod(std::string(value).c_str(), nullptr);
+                    return parsed;
+                }
+
+                void convert(Column& column, size_t row, const Field& field) const {
+                    std::string_view value = content(field);
+                    switch (column.type) {
+                        case ColumnType::INTEGER:
+                            column.integerValues[row] = parseInteger(value);
+                            break;
+                        case ColumnType::FLOAT:
+                            column.floatValues[row] = parseFloat(value);
+                            break;
+                        case ColumnType::BOOLEAN: {
+                            bool flag = false;
+                            isBoolean(value, flag);
+                            column.booleanValues[row] = flag;
+                            break;
+                        }
+                        case ColumnType::STRING:
+                            break;
+                    }
+                }
+
+                // Bağımsız parçaları thread'lere dağıt; ilk hata yeniden fırlatılır
+                template<typename Function>
+                void parallelFor(size_t jobs, Function&& function) const {
+                    std::atomic<size_t> next{0};
+                    std::atomic<bool> stopped{false};
+                    std::mutex failureMutex;
+                    std::exception_ptr failure;
+                    auto work = [&]() {
+                        while (!stopped.load(std::memory_order_relaxed)) {
+                            size_t index = next.fetch_add(1);
+                            if (index >= jobs) break;
+                            try {
+                                function(index);
+                            } catch (...) {
+                                std::lock_guard<std::mutex> lock(failureMutex);
+                                if (!failure) failure = std::current_exception();
+                                stopped = true;
+                            }
+                        }
+                    };
+                    size_t threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+                    threads = std::min(threads, jobs);
+                    std::vector<std::thread> workers;
+                    for (size_t t = 1; t < threads; t++) workers.emplace_back(work);
+                    work();
+                    for (auto& worker : workers) worker.join();
+                    if (failure) std::rethrow_exception(failure);
+                }
+            };
+        };
+    }
+}
+
+#endif // WHOLF_TABLE_HPP
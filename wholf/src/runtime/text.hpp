@@ -0,0 +1,237 @@
+#ifndef WHOLF_TEXT_HPP
+#define WHOLF_TEXT_HPP
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace Wholf {
+    // StdLib::String'in altyapısı: paylaşılan tampon, intern tablosu, SIMD arama ve harf dönüşümü
+    namespace Text {
+        constexpr size_t npos = std::string_view::npos;
+
+        // Tek ayırmalı, referans sayımlı bayt tamponu (başlık + veri)
+        class Buffer {
+        public:
+            static Buffer* create(size_t size) {
+                void* memory = ::operator new(sizeof(Buffer) + size);
+                return new (memory) Buffer(size);
+            }
+
+            static Buffer* copy(const char* data, size_t size) {
+                Buffer* buffer = create(size);
+                if (size) std::memcpy(buffer->data(), data, size);
+                return buffer;
+            }
+
+            char* data() { return reinterpret_cast<char*>(this + 1); }
+            const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+            size_t size() const { return length; }
+
+            void retain() { references.fetch_add(1, std::memory_order_relaxed); }
+
+            void release() {
+                if (references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    this->~Buffer();
+                    ::operator delete(this);
+                }
+            }
+
+            size_t useCount() const { return references.load(std::memory_order_relaxed); }
+
+        private:
+            explicit Buffer(size_t size) : length(size) {}
+
+            std::atomic<size_t> references{1};
+            size_t length;
+        };
+
+        // Süreç boyu yaşayan intern tablosu: aynı metin tek kopya, görünümler hiç geçersizleşmez
+        class Interner {
+        public:
+            static Interner& global() {
+                static Interner* instance = new Interner();
+                return *instance;
+            }
+
+            std::string_view intern(std::string_view text) {
+                {
+                    std::shared_lock<std::shared_mutex> lock(mutex);
+                    auto it = entries.find(text);
+                    if (it != entries.end()) return *it;
+                }
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                auto it = entries.find(text);
+                if (it != entries.end()) return *it;
+                std::string_view stored(store(text), text.size());
+                entries.insert(stored);
+                return stored;
+            }
+
+            size_t size() const {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                return entries.size();
+            }
+
+        private:
+            static constexpr size_t CHUNK_BYTES = 64 * 1024;
+
+            struct Block {
+                std::unique_ptr<char[]> data;
+                size_t capacity;
+                size_t used;
+            };
+
+            mutable std::shared_mutex mutex;
+            std::unordered_set<std::string_view> entries;
+            std::vector<Block> blocks;
+
+            const char* store(std::string_view text) {
+                if (blocks.empty() || blocks.back().capacity - blocks.back().used < text.size()) {
+                    size_t capacity = std::max(CHUNK_BYTES, text.size());
+                    blocks.push_back(Block{std::unique_ptr<char[]>(new char[capacity]), capacity, 0});
+                }
+                Block& block = blocks.back();
+                char* target = block.data.get() + block.used;
+                if (!text.empty()) std::memcpy(target, text.data(), text.size());
+                block.used += text.size();
+                return target;
+            }
+        };
+
+        // İğnenin ilk ve son baytı 16'lık bloklarda birlikte aranır, adaylar memcmp ile doğrulanır
+        inline size_t find(std::string_view haystack, std::string_view needle, size_t from = 0) {
+            size_t size = haystack.size();
+            size_t length = needle.size();
+            if (from > size) return npos;
+            if (length == 0) return from;
+            if (length > size - from) return npos;
+            if (length == 1) {
+                const void* hit = std::memchr(haystack.data() + from, needle[0], size - from);
+                return hit ? static_cast<size_t>(static_cast<const char*>(hit) - haystack.data()) : npos;
+            }
+            size_t i = from;
+#if defined(__SSE2__)
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last = _mm_set1_epi8(needle[length - 1]);
+            for (; i + length - 1 + 16 <= size; i += 16) {
+                __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack.data() + i));
+                __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack.data() + i + length - 1));
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+                while (mask) {
+                    size_t candidate = i + static_cast<size_t>(__builtin_ctz(mask));
+                    if (std::memcmp(haystack.data() + candidate + 1, needle.data() + 1, length - 2) == 0) return candidate;
+                    mask &= mask - 1;
+                }
+            }
+#endif
+            for (; i + length <= size; i++) {
+                if (haystack[i] == needle[0] && std::memcmp(haystack.data() + i + 1, needle.data() + 1, length - 1) == 0) return i;
+            }
+            return npos;
+        }
+
+        namespace Detail {
+            // U+0080..U+017F (Latin-1 ve Latin Genişletilmiş-A) harf eşlemesi; Türkçe ı/İ ASCII'ye iner
+            inline uint32_t upper(uint32_t c) {
+                if (c == 0x131) return 'I';
+                if (c >= 0xE0 && c <= 0xFE && c != 0xF7) return c - 0x20;
+                if (c == 0xFF) return 0x178;
+                if (c >= 0x100 && c <= 0x137 && (c & 1)) return c - 1;
+                if (c >= 0x139 && c <= 0x148 && !(c & 1)) return c - 1;
+                if (c >= 0x14A && c <= 0x177 && (c & 1)) return c - 1;
+                if (c == 0x17A || c == 0x17C || c == 0x17E) return c - 1;
+                return c;
+            }
+
+            inline uint32_t lower(uint32_t c) {
+                if (c == 0x130) return 'i';
+                if (c >= 0xC0 && c <= 0xDE && c != 0xD7) return c + 0x20;
+                if (c >= 0x100 && c <= 0x137 && !(c & 1)) return c + 1;
+                if (c >= 0x139 && c <= 0x148 && (c & 1)) return c + 1;
+                if (c >= 0x14A && c <= 0x177 && !(c & 1)) return c + 1;
+                if (c == 0x178) return 0xFF;
+                if (c == 0x179 || c == 0x17B || c == 0x17D) return c + 1;
+                return c;
+            }
+
+            // ASCII olmayan tek kod noktasını dönüştür; tüketilen girdi baytını döndürür
+            inline size_t convertSequence(const unsigned char* in, size_t remaining, char*& out, bool toUpper) {
+                unsigned char lead = in[0];
+                // 2 baytlık U+0080..U+017F dizileri (öncü C2..C5)
+                if (lead >= 0xC2 && lead <= 0xC5 && remaining >= 2 && (in[1] & 0xC0) == 0x80) {
+                    uint32_t c = ((lead & 0x1Fu) << 6) | (in[1] & 0x3Fu);
+                    uint32_t mapped = toUpper ? upper(c) : lower(c);
+                    if (mapped < 0x80) {
+                        *out++ = static_cast<char>(mapped);
+                    } else {
+                        *out++ = static_cast<char>(0xC0 | (mapped >> 6));
+                        *out++ = static_cast<char>(0x80 | (mapped & 0x3F));
+                    }
+                    return 2;
+                }
+                // Diğer diziler (ve geçersiz baytlar) olduğu gibi kopyalanır
+                size_t length = 1;
+                if (lead >= 0xC0) {
+                    size_t expected = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+                    while (length < expected && length < remaining && (in[length] & 0xC0) == 0x80) length++;
+                }
+                std::memcpy(out, in, length);
+                out += length;
+                return length;
+            }
+        }
+
+        // Yerel ayardan bağımsız harf dönüşümü. out en az size bayt olmalı (çıktı hiç uzamaz) ve in ile
+        // örtüşmemeli; yazılan bayt sayısını döndürür. ASCII 16'lık bloklar SSE2 ile dönüştürülür.
+        inline size_t convertCase(const char* in, size_t size, char* out, bool toUpper) {
+            const char* begin = out;
+            const unsigned char* input = reinterpret_cast<const unsigned char*>(in);
+            size_t i = 0;
+            const char from = toUpper ? 'a' : 'A';
+#if defined(__SSE2__)
+            const __m128i low = _mm_set1_epi8(static_cast<char>(from - 1));
+            const __m128i high = _mm_set1_epi8(static_cast<char>(from + 26));
+            const __m128i flip = _mm_set1_epi8(0x20);
+#endif
+            while (i < size) {
+#if defined(__SSE2__)
+                if (i + 16 <= size) {
+                    // İşaretli karşılaştırma: ASCII olmayan baytlar negatif, aralığa girmez ve değişmeden yazılır.
+                    // Bloğun tamamı yazılır ama yalnızca ilk ASCII olmayan bayta kadar ilerlenir
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(chunk, low), _mm_cmplt_epi8(chunk, high));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_xor_si128(chunk, _mm_and_si128(letters, flip)));
+                    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(chunk));
+                    size_t ascii = mask ? static_cast<size_t>(__builtin_ctz(mask)) : 16;
+                    out += ascii;
+                    i += ascii;
+                    if (mask) i += Detail::convertSequence(input + i, size - i, out, toUpper);
+                    continue;
+                }
+#endif
+                unsigned char c = input[i];
+                if (c < 0x80) {
+                    *out++ = static_cast<char>(c >= static_cast<unsigned char>(from) && c < static_cast<unsigned char>(from + 26) ? c ^ 0x20 : c);
+                    i++;
+                } else {
+                    i += Detail::convertSequence(input + i, size - i, out, toUpper);
+                }
+            }
+            return static_cast<size_t>(out - begin);
+        }
+    }
+}
+
+#endif // WHOLF_TEXT_HPP
@@ -0,0 +1,181 @@
+#ifndef WHOLF_URING_HPP
+#define WHOLF_URING_HPP
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Wholf {
+    namespace Uring {
+        // liburing olmadan, ham sistem çağrılarıyla io_uring halkası.
+        // Tek thread'den kullanılmak üzere tasarlanmıştır (gönderim ve tamamlama aynı thread'de).
+        class Ring {
+        public:
+            explicit Ring(unsigned entries) {
+                io_uring_params params;
+                std::memset(&params, 0, sizeof(params));
+                fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+                if (fd < 0) throw std::runtime_error(std::string("io_uring_setup failed: ") + std::strerror(errno));
+
+                sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+                if (single) sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+
+                sqRing = ::mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+                if (sqRing == MAP_FAILED) fail("sq ring");
+                cqRing = single ? sqRing : ::mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+                if (cqRing == MAP_FAILED) fail("cq ring");
+                sqeSize = params.sq_entries * sizeof(io_uring_sqe);
+                void* sqeMemory = ::mmap(nullptr, sqeSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+                if (sqeMemory == MAP_FAILED) fail("sqes");
+                sqes = static_cast<io_uring_sqe*>(sqeMemory);
+
+                char* sq = static_cast<char*>(sqRing);
+                sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+                sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+                sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+                sqEntries = params.sq_entries;
+                // SQE'ler kuyruk sırasıyla doldurulur; dizin tablosu bir kez kimlik olarak kurulur
+                unsigned* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+                for (unsigned i = 0; i < sqEntries; i++) array[i] = i;
+
+                char* cq = static_cast<char*>(cqRing);
+                cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+                cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+                cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+                cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+                localTail = *sqTail;
+                submittedTail = localTail;
+            }
+
+            ~Ring() {
+                release();
+            }
+
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            // Verilen işlem kodlarının hepsi çekirdekte destekleniyor mu
+            bool supports(std::initializer_list<unsigned> opcodes) const {
+                size_t size = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+                std::vector<char> memory(size, 0);
+                auto probe = reinterpret_cast<io_uring_probe*>(memory.data());
+                if (::syscall(__NR_io_uring_register, fd, IORING_REGISTER_PROBE, probe, 256) < 0) return false;
+                for (unsigned opcode : opcodes) {
+                    if (opcode > probe->last_op || !(probe->ops[opcode].flags & IO_URING_OP_SUPPORTED)) return false;
+                }
+                return true;
+            }
+
+            // Boş gönderim kuyruğu girdisi sayısı
+            unsigned space() const {
+                return sqEntries - (localTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE));
+            }
+
+            // Sıfırlanmış bir SQE ayır; kuyruk doluysa nullptr
+            io_uring_sqe* acquire() {
+                if (space() == 0) return nullptr;
+                io_uring_sqe* sqe = &sqes[localTail & sqMask];
+                std::memset(sqe, 0, sizeof(*sqe));
+                localTail++;
+                return sqe;
+            }
+
+            // Bekleyen SQE'leri gönder; minComplete > 0 ise en az o kadar tamamlanma bekle.
+            // Gönderilen sayıyı ya da -errno döner
+            int submit(unsigned minComplete = 0) {
+                __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+                unsigned count = localTail - submittedTail;
+                unsigned flags = minComplete ? IORING_ENTER_GETEVENTS : 0;
+                long result = ::syscall(__NR_io_uring_enter, fd, count, minComplete, flags, nullptr, 0);
+                if (result < 0) return -errno;
+                submittedTail += static_cast<unsigned>(result);
+                return static_cast<int>(result);
+            }
+
+            // Çekirdeğin henüz almadığı SQE'leri geri çek; her birinin user_data'sı işleyiciye verilir.
+            // Yalnızca submit başarısız olduktan sonra anlamlıdır (SQPOLL yok, çekirdek SQE'leri enter içinde alır)
+            template<typename Handler>
+            unsigned withdraw(Handler&& handler) {
+                unsigned count = 0;
+                while (localTail != submittedTail) {
+                    localTail--;
+                    handler(sqes[localTail & sqMask].user_data);
+                    count++;
+                }
+                __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+                return count;
+            }
+
+            // Hazır tamamlanmaları sırayla işle
+            template<typename Handler>
+            unsigned reap(Handler&& handler) {
+                unsigned head = __atomic_load_n(cqHead, __ATOMIC_RELAXED);
+                unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+                unsigned count = 0;
+                while (head != tail) {
+                    const io_uring_cqe& cqe = cqes[head & cqMask];
+                    uint64_t data = cqe.user_data;
+                    int result = cqe.res;
+                    // Girdiyi çekirdeğe işleyiciden önce geri ver; işleyici yeni SQE hazırlayabilir
+                    head++;
+                    __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+                    handler(data, result);
+                    count++;
+                    tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+                }
+                return count;
+            }
+
+        private:
+            int fd = -1;
+            void* sqRing = MAP_FAILED;
+            void* cqRing = MAP_FAILED;
+            io_uring_sqe* sqes = nullptr;
+            size_t sqRingSize = 0;
+            size_t cqRingSize = 0;
+            size_t sqeSize = 0;
+
+            unsigned* sqHead = nullptr;
+            unsigned* sqTail = nullptr;
+            unsigned sqMask = 0;
+            unsigned sqEntries = 0;
+            unsigned* cqHead = nullptr;
+            unsigned* cqTail = nullptr;
+            unsigned cqMask = 0;
+            io_uring_cqe* cqes = nullptr;
+
+            unsigned localTail = 0;
+            unsigned submittedTail = 0;
+
+            void release() {
+                if (sqes) ::munmap(sqes, sqeSize);
+                if (cqRing != MAP_FAILED && cqRing != sqRing) ::munmap(cqRing, cqRingSize);
+                if (sqRing != MAP_FAILED) ::munmap(sqRing, sqRingSize);
+                if (fd >= 0) ::close(fd);
+                sqes = nullptr;
+                cqRing = sqRing = MAP_FAILED;
+                fd = -1;
+            }
+
+            [[noreturn]] void fail(const char* what) {
+                int error = errno;
+                release();
+                throw std::runtime_error(std::string("io_uring mmap failed (") + what + "): " + std::strerror(error));
+            }
+        };
+    }
+}
+
+#endif // WHOLF_URING_HPP
@@ -0,0 +1,77 @@
+#ifndef WHOLF_CHECK_HPP
+#define WHOLF_CHECK_HPP
+
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Wholf {
+    namespace Test {
+        struct Case {
+            std::string name;
+            std::function<void()> function;
+        };
+
+        inline std::vector<Case>& registry() {
+            static std::vector<Case> cases;
+            return cases;
+        }
+
+        inline size_t& failures() {
+            static size_t count = 0;
+            return count;
+        }
+
+        struct Registration {
+            Registration(const std::string& name, std::function<void()> function) {
+                registry().push_back(Case{name, std::move(function)});
+            }
+        };
+
+        inline void fail(const char* file, int line, const std::string& message) {
+            std::fprintf(stderr, "%s:%d: %s\n", file, line, message.c_str());
+            failures()++;
+        }
+
+        // Tüm testleri çalıştır; beklenmeyen istisna testi başarısız sayar
+        inline int run() {
+            for (const auto& test : registry()) {
+                size_t before = failures();
+                try {
+                    test.function();
+                } catch (const std::exception& error) {
+                    fail(test.name.c_str(), 0, std::string("unexpected exception: ") + error.what());
+                }
+                std::printf("%-56s %s\n", test.name.c_str(), failures() == before ? "ok" : "FAILED");
+            }
+            std::printf("\n%zu test(s), %zu failure(s)\n", registry().size(), failures());
+            return failures() == 0 ? 0 : 1;
+        }
+    }
+}
+
+#define WHOLF_TEST_CONCAT_INNER(a, b) a##b
+#define WHOLF_TEST_CONCAT(a, b) WHOLF_TEST_CONCAT_INNER(a, b)
+
+// Test kaydı: WHOLF_TEST("grup/isim") { WHOLF_CHECK(...); }
+#define WHOLF_TEST(name) \
+    static void WHOLF_TEST_CONCAT(wholfTest, __LINE__)(); \
+    static ::Wholf::Test::Registration WHOLF_TEST_CONCAT(wholfTestRegistration, __LINE__)(name, &WHOLF_TEST_CONCAT(wholfTest, __LINE__)); \
+    static void WHOLF_TEST_CONCAT(wholfTest, __LINE__)()
+
+#define WHOLF_CHECK(condition) \
+    do { if (!(condition)) ::Wholf::Test::fail(__FILE__, __LINE__, "check failed: " #condition); } while (0)
+
+#define WHOLF_CHECK_THROWS(expression, type) \
+    do { \
+        bool wholfThrown = false; \
+        try { expression; } catch (const type&) { wholfThrown = true; } \
+        if (!wholfThrown) ::Wholf::Test::fail(__FILE__, __LINE__, "expected " #type " from: " #expression); \
+    } while (0)
+
+#define WHOLF_TEST_MAIN() \
+    int main() { return ::Wholf::Test::run(); }
+
+#endif // WHOLF_CHECK_HPP
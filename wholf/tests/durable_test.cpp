@@ -0,0 +1,144 @@
+// Kalıcı depo: kurtarma, sıkıştırma ve yarıda kalmış sıkıştırma
+
+#include "check.hpp"
+
+#include <unistd.h>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "runtime/durable.hpp"
+
+namespace {
+    using Wholf::Fegn::DurableStore;
+    using Wholf::Fegn::FsyncPolicy;
+
+    struct TemporaryDirectory {
+        std::filesystem::path path;
+
+        explicit TemporaryDirectory(const std::string& name) {
+            path = std::filesystem::temp_directory_path() / ("wholf_durable_test_" + name + "_" + std::to_string(::getpid()));
+            std::filesystem::remove_all(path);
+        }
+
+        ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+
+        std::string operator/(const std::string& name) const { return (path / name).string(); }
+    };
+
+    std::string valueFor(int i) { return "deger-" + std::to_string(i) + std::string(100, 'x'); }
+
+    // Dosyanın offset konumuna ham baytları yaz
+    template<typename T>
+    void patch(const std::string& path, size_t offset, const T& value) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+WHOLF_TEST("durable/recover-after-reopen") {
+    TemporaryDirectory directory("recover");
+    DurableStore::Options options;
+    options.fsync = FsyncPolicy::ALWAYS;
+    {
+        DurableStore store(directory.path.string(), options);
+        store.set("a", "1");
+        store.set("b", "2");
+        store.remove("a");
+        store.set("c", "3", std::chrono::hours(1));
+    }
+    DurableStore store(directory.path.string(), options);
+    WHOLF_CHECK(!store.contains("a"));
+    WHOLF_CHECK(store.get("b") == "2");
+    WHOLF_CHECK(store.get("c") == "3");
+    WHOLF_CHECK(store.replayedRecords() == 4);
+}
+
+WHOLF_TEST("durable/compaction-keeps-evicted-keys") {
+    TemporaryDirectory directory("budget");
+    {
+        DurableStore::Options options;
+        options.compactionBytes = 0;
+        // Bellek yalnızca birkaç girdi tutabilir; depo önbellek gibi davranır
+        options.memory.byteBudget = 4096;
+        DurableStore store(directory.path.string(), options);
+        for (int i = 0; i < 1000; i++) store.set("k" + std::to_string(i), valueFor(i));
+        WHOLF_CHECK(store.stats().evictions > 0);
+        store.compact();
+        store.set("son", "1");
+    }
+    DurableStore store(directory.path.string());
+    WHOLF_CHECK(store.size() == 1001);
+    WHOLF_CHECK(store.get("k0") == valueFor(0));
+    WHOLF_CHECK(store.get("k999") == valueFor(999));
+    // Snapshot'tan sonra yalnızca günlük kuyruğu oynatılır
+    WHOLF_CHECK(store.replayedRecords() == 1);
+}
+
+WHOLF_TEST("durable/interrupted-compaction-is-finished") {
+    TemporaryDirectory directory("interrupted");
+    DurableStore::Options options;
+    options.compactionBytes = 0;
+    {
+        DurableStore store(directory.path.string(), options);
+        store.set("eski", "1");
+        store.compact();
+        store.set("a", "1");
+        store.set("b", "2");
+    }
+    // Döndürme sonrası, snapshot yazılmadan önce çökmüş gibi
+    WHOLF_CHECK(std::rename((directory / "wal.log").c_str(), (directory / "wal.old").c_str()) == 0);
+    {
+        DurableStore store(directory.path.string(), options);
+        WHOLF_CHECK(!std::filesystem::exists(directory / "wal.old"));
+        WHOLF_CHECK(store.get("a") == "1");
+        store.set("c", "3");
+        store.remove("eski");
+        store.compact();
+    }
+    DurableStore store(directory.path.string(), options);
+    WHOLF_CHECK(store.size() == 3);
+    WHOLF_CHECK(!store.contains("eski"));
+    WHOLF_CHECK(store.get("b") == "2" && store.get("c") == "3");
+    WHOLF_CHECK(store.replayedRecords() == 0);
+}
+
+WHOLF_TEST("durable/corrupt-snapshot-is-rejected") {
+    using Wholf::Fegn::DurableFormat::Entry;
+    using Wholf::Fegn::DurableFormat::Header;
+    TemporaryDirectory directory("corrupt");
+    DurableStore::Options options;
+    options.compactionBytes = 0;
+    {
+        DurableStore store(directory.path.string(), options);
+        store.set("anahtar", "deger");
+        store.compact();
+    }
+    std::string snapshot = directory / "snapshot";
+    std::filesystem::copy_file(snapshot, directory / "snapshot.good");
+    auto reopens = [&]() {
+        try {
+            DurableStore store(directory.path.string(), options);
+            return true;
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+    };
+    WHOLF_CHECK(reopens());
+
+    // count * sizeof(Entry) taşarak küçük bir sayıya sarılır
+    patch(snapshot, offsetof(Header, count), (uint64_t(1) << 63) / sizeof(Entry) * 2 + 1);
+    WHOLF_CHECK(!reopens());
+
+    // dataOffset + keyOffset taşar
+    std::filesystem::copy_file(directory / "snapshot.good", snapshot, std::filesystem::copy_options::overwrite_existing);
+    patch(snapshot, sizeof(Header) + offsetof(Entry, keyOffset), ~uint64_t(0) - 8);
+    WHOLF_CHECK(!reopens());
+    std::filesystem::copy_file(directory / "snapshot.good", snapshot, std::filesystem::copy_options::overwrite_existing);
+    WHOLF_CHECK(reopens());
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,184 @@
+// Komut bütçesi, son tarih, iptal ve zaman dilimli zamanlayıcı
+
+#include "check.hpp"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "interpreter/Scheduler.hpp"
+
+namespace {
+    using Wholf::ExecutionControl;
+    using Wholf::ExecutionInterrupted;
+    using Wholf::InterruptReason;
+    using Wholf::Interpreter;
+    using Wholf::Scheduler;
+    using Wholf::ScriptTask;
+
+    InterruptReason interruptReason(Interpreter& interpreter, const std::string& code) {
+        try {
+            interpreter.interpret(code);
+        } catch (const ExecutionInterrupted& interrupted) {
+            return interrupted.reason;
+        }
+        throw std::runtime_error("script was not interrupted");
+    }
+
+    bool waitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout = std::chrono::milliseconds(5000)) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    // Betik hangi thread'lerde çalıştı
+    std::mutex placesMutex;
+    std::map<int, std::set<std::thread::id>> places;
+
+    int where(int task) {
+        std::lock_guard<std::mutex> lock(placesMutex);
+        places[task].insert(std::this_thread::get_id());
+        return task;
+    }
+}
+
+WHOLF_TEST("execution/instruction-budget") {
+    Interpreter interpreter;
+    ExecutionControl control;
+    control.setInstructionLimit(5000);
+    interpreter.setExecutionControl(&control);
+    WHOLF_CHECK(interruptReason(interpreter, "while (true) { }") == InterruptReason::BUDGET_EXCEEDED);
+    WHOLF_CHECK(control.executedInstructions() == 5000);
+}
+
+WHOLF_TEST("execution/deadline") {
+    Interpreter interpreter;
+    ExecutionControl control;
+    control.setTimeout(std::chrono::milliseconds(20));
+    interpreter.setExecutionControl(&control);
+    WHOLF_CHECK(interruptReason(interpreter, "let i = 0; while (true) { i = i + 1; }") == InterruptReason::DEADLINE_EXCEEDED);
+}
+
+WHOLF_TEST("execution/cancel-from-another-thread") {
+    Interpreter interpreter;
+    ExecutionControl control;
+    interpreter.setExecutionControl(&control);
+    std::thread canceller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        control.cancel();
+    });
+    WHOLF_CHECK(interruptReason(interpreter, "while (true) { }") == InterruptReason::CANCELLED);
+    canceller.join();
+}
+
+WHOLF_TEST("scheduler/short-script-overtakes-long") {
+    Scheduler::Options options;
+    options.threads = 1;
+    options.sliceInstructions = 1000;
+    Scheduler scheduler(options);
+    auto longTask = scheduler.submit("batch", "while (true) { }");
+    WHOLF_CHECK(waitFor([&]() { return longTask->slicesUsed() > 0; }));
+    auto shortTask = scheduler.submit("web", "let s = 0; for (let i = 0; i < 10; i = i + 1) { s = s + i; } s");
+    WHOLF_CHECK(shortTask->result().wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    WHOLF_CHECK(std::get<int>(shortTask->result().get().data) == 45);
+    WHOLF_CHECK(longTask->state() != ScriptTask::State::FINISHED);
+    longTask->cancel();
+    WHOLF_CHECK_THROWS(longTask->result().get(), ExecutionInterrupted);
+}
+
+WHOLF_TEST("scheduler/suspend-at-safepoint") {
+    Scheduler::Options options;
+    options.threads = 1;
+    // Dilim çok uzun: askıya alma dilim sonunu beklememeli
+    options.sliceInstructions = 1000000000;
+    Scheduler scheduler(options);
+    auto task = scheduler.submit("batch", "let i = 0; while (i < 200000) { i = i + 1; } i");
+    WHOLF_CHECK(waitFor([&]() { return task->state() == ScriptTask::State::RUNNING; }));
+    task->suspend();
+    WHOLF_CHECK(waitFor([&]() { return task->state() == ScriptTask::State::SUSPENDED; }));
+    // Döngü bitmeden, ilk dilimin içinde durdu
+    WHOLF_CHECK(task->result().wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout);
+    WHOLF_CHECK(task->control.executedInstructions() < 1000000);
+    WHOLF_CHECK(task->slicesUsed() == 1);
+    task->resume();
+    WHOLF_CHECK(task->result().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    WHOLF_CHECK(std::get<int>(task->result().get().data) == 200000);
+}
+
+WHOLF_TEST("scheduler/fibers-stay-on-their-thread") {
+    places.clear();
+    Scheduler::Options options;
+    options.threads = 4;
+    options.sliceInstructions = 500;
+    std::vector<std::shared_ptr<ScriptTask>> tasks;
+    {
+        Scheduler scheduler(options);
+        for (int id = 0; id < 8; id++) {
+            auto interpreter = std::make_shared<Interpreter>();
+            interpreter->bind("where", &where);
+            tasks.push_back(scheduler.submit("t", "for (let i = 0; i < 2000; i = i + 1) { where(" + std::to_string(id) + "); }", interpreter));
+        }
+        for (const auto& task : tasks) {
+            WHOLF_CHECK(task->result().wait_for(std::chrono::seconds(30)) == std::future_status::ready);
+        }
+    }
+    for (const auto& task : tasks) WHOLF_CHECK(task->slicesUsed() > 1);
+    WHOLF_CHECK(places.size() == 8);
+    for (const auto& entry : places) WHOLF_CHECK(entry.second.size() == 1);
+}
+
+WHOLF_TEST("scheduler/shutdown-unwinds-running-fibers") {
+    std::shared_ptr<ScriptTask> running;
+    std::shared_ptr<ScriptTask> parked;
+    std::shared_ptr<ScriptTask> unstarted;
+    {
+        Scheduler::Options options;
+        options.threads = 1;
+        options.sliceInstructions = 1000;
+        Scheduler scheduler(options);
+        running = scheduler.submit("batch", "let s = \"uzun bir metin\"; while (true) { s = s + \"\"; }");
+        parked = scheduler.submit("batch", "while (true) { }");
+        WHOLF_CHECK(waitFor([&]() { return running->slicesUsed() > 0 && parked->slicesUsed() > 0; }));
+        parked->suspend();
+        WHOLF_CHECK(waitFor([&]() { return parked->state() == ScriptTask::State::SUSPENDED; }));
+        unstarted = scheduler.submit("batch", "1");
+        unstarted->suspend();
+    }
+    // Yarıda kalan fiber'lar iptal edilip çözüldü (yığınlarındaki nesneler serbest bırakıldı)
+    WHOLF_CHECK(running->state() == ScriptTask::State::FINISHED);
+    WHOLF_CHECK(parked->state() == ScriptTask::State::FINISHED);
+    try {
+        running->result().get();
+        WHOLF_CHECK(false);
+    } catch (const ExecutionInterrupted& interrupted) {
+        WHOLF_CHECK(interrupted.reason == InterruptReason::CANCELLED);
+    }
+    WHOLF_CHECK_THROWS(parked->result().get(), ExecutionInterrupted);
+    // Başlamamış betiğin future'ı da kapanır (task hâlâ canlıyken bile)
+    WHOLF_CHECK(unstarted->result().wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    WHOLF_CHECK_THROWS(unstarted->result().get(), ExecutionInterrupted);
+}
+
+WHOLF_TEST("scheduler/resume-after-shutdown") {
+    std::shared_ptr<ScriptTask> task;
+    {
+        Scheduler::Options options;
+        options.threads = 1;
+        options.sliceInstructions = 1000;
+        Scheduler scheduler(options);
+        task = scheduler.submit("batch", "while (true) { }");
+        WHOLF_CHECK(waitFor([&]() { return task->slicesUsed() > 0; }));
+        task->suspend();
+        WHOLF_CHECK(waitFor([&]() { return task->state() == ScriptTask::State::SUSPENDED; }));
+    }
+    // Zamanlayıcı artık yok; resume() yıkılmış nesneye dokunmaz
+    task->resume();
+    WHOLF_CHECK(task->state() == ScriptTask::State::FINISHED);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,168 @@
+// Fegn::DataStore: TTL ve CLOCK tahliyesi; Epoch::Manager thread sayısı; EventBus ve Integration olayları
+
+#include "check.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/fegn.hpp"
+
+namespace {
+    using Wholf::Epoch::Manager;
+    using Wholf::Fegn::DataStore;
+    using Wholf::Fegn::EventBus;
+    using Wholf::Fegn::EventMessage;
+
+    size_t threadCount() {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task")) {
+            (void)entry;
+            count++;
+        }
+        return count;
+    }
+}
+
+WHOLF_TEST("datastore/expired-entries-swept-without-budget") {
+    DataStore::Options options;
+    options.shards = 1;
+    DataStore store(options);
+    for (int i = 0; i < 100; i++) store.set("gecici" + std::to_string(i), "x", std::chrono::milliseconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    WHOLF_CHECK(!store.contains("gecici0"));
+    // Okunmayan süreli girdiler, yazmalar saat ibresini ilerlettikçe silinir
+    for (int i = 0; i < 2000; i++) store.set("kalici" + std::to_string(i), "y");
+    DataStore::Stats stats = store.stats();
+    WHOLF_CHECK(stats.expirations == 100);
+    WHOLF_CHECK(stats.entries == 2000);
+    WHOLF_CHECK(stats.evictions == 0);
+}
+
+WHOLF_TEST("datastore/budget-evicts") {
+    DataStore::Options options;
+    options.shards = 4;
+    options.byteBudget = 64 * 1024;
+    DataStore store(options);
+    for (int i = 0; i < 5000; i++) store.set("anahtar" + std::to_string(i), std::string(32, 'v'));
+    WHOLF_CHECK(store.bytes() <= options.byteBudget);
+    WHOLF_CHECK(store.stats().evictions > 0);
+}
+
+WHOLF_TEST("epoch/more-readers-than-one-block") {
+    // Aynı anda bir slot bloğundan fazla okuyucu; yeni bloklar eklenir
+    const size_t readers = Manager::SLOTS_PER_BLOCK * 3 + 5;
+    std::atomic<size_t> inside{0};
+    std::atomic<bool> release{false};
+    std::atomic<int> freed{0};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < readers; i++) {
+        threads.emplace_back([&]() {
+            Manager::Guard guard;
+            inside++;
+            while (!release.load()) std::this_thread::yield();
+        });
+    }
+    while (inside.load() < readers) std::this_thread::yield();
+    Manager::instance().retire([&]() { freed++; });
+    Manager::instance().reclaim();
+    // Okuyucular hâlâ içeride: silinmemeli
+    WHOLF_CHECK(freed.load() == 0);
+    release = true;
+    for (auto& thread : threads) thread.join();
+    Manager::instance().reclaim();
+    WHOLF_CHECK(freed.load() == 1);
+}
+
+WHOLF_TEST("events/flush-inside-handler-throws") {
+    EventBus bus;
+    std::atomic<int> delivered{0};
+    std::atomic<bool> rejected{false};
+    bus.subscribe("olay", [&](const EventMessage&) {
+        try {
+            bus.flush();
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        delivered++;
+    });
+    for (int i = 0; i < 10; i++) bus.publish("olay");
+    // Eskiden dağıtıcı kendi işleyicisini beklerken kilitlenirdi
+    bus.flush();
+    WHOLF_CHECK(delivered == 10);
+    WHOLF_CHECK(rejected);
+}
+
+WHOLF_TEST("events/unsubscribe-waits-for-in-flight-handler") {
+    EventBus bus;
+    std::atomic<bool> entered{false};
+    std::atomic<bool> finished{false};
+    std::atomic<int> calls{0};
+    auto id = bus.subscribe("olay", [&](const EventMessage&) {
+        calls++;
+        entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    });
+    bus.publish("olay");
+    while (!entered) std::this_thread::yield();
+    WHOLF_CHECK(bus.unsubscribe(id));
+    // Dönüşte işleyici bitmiş olmalı; sonrası yayınlar ona ulaşmaz
+    WHOLF_CHECK(finished);
+    bus.publish("olay");
+    bus.flush();
+    WHOLF_CHECK(calls == 1);
+    WHOLF_CHECK(!bus.unsubscribe(id));
+}
+
+WHOLF_TEST("events/handler-can-unsubscribe-itself") {
+    EventBus bus;
+    std::atomic<int> calls{0};
+    EventBus::SubscriptionId id = 0;
+    id = bus.subscribe("olay", [&](const EventMessage&) {
+        calls++;
+        bus.unsubscribe(id);
+    }, Wholf::Fegn::Delivery::SYNC);
+    bus.publish("olay");
+    bus.publish("olay");
+    WHOLF_CHECK(calls == 1);
+}
+
+WHOLF_TEST("events/dispatchers-start-on-first-async-subscriber") {
+    size_t before = threadCount();
+    Wholf::Fegn::EventBus::Options options;
+    options.dispatchers = 4;
+    EventBus bus(options);
+    bus.subscribe("senkron", [](const EventMessage&) {}, Wholf::Fegn::Delivery::SYNC);
+    WHOLF_CHECK(threadCount() == before);
+    bus.subscribe("asenkron", [](const EventMessage&) {});
+    WHOLF_CHECK(threadCount() == before + 1);
+}
+
+WHOLF_TEST("integration/trigger-is-synchronous-by-default") {
+    size_t before = threadCount();
+    Wholf::Fegn::Integration integration;
+    std::thread::id caller = std::this_thread::get_id();
+    std::thread::id handled;
+    int calls = 0;
+    integration.addEvent("kaydet", [&]() {
+        handled = std::this_thread::get_id();
+        calls++;
+    });
+    integration.triggerEvent("kaydet");
+    // flushEvents gerekmeden triggerEvent dönmeden çalışmış olmalı
+    WHOLF_CHECK(calls == 1);
+    WHOLF_CHECK(handled == caller);
+    WHOLF_CHECK(threadCount() == before);
+
+    std::atomic<int> asynchronous{0};
+    integration.addEvent("arkaplan", [&]() { asynchronous++; }, Wholf::Fegn::Delivery::ASYNC);
+    integration.triggerEvent("arkaplan");
+    integration.flushEvents();
+    WHOLF_CHECK(asynchronous == 1);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,389 @@
+// Dosya işlemleri ve dosya izleyici
+
+#include "check.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "interpreter/WholfInterpreter.hpp"
+#include "runtime/file.hpp"
+
+namespace {
+    using Wholf::File::AsyncBackend;
+    using Wholf::File::AsyncFileOperations;
+    using Wholf::File::ChangeKind;
+    using Wholf::File::FileChange;
+    using Wholf::File::FileOperations;
+    using Wholf::File::FileWatcher;
+    using Wholf::File::LineReader;
+
+    struct TemporaryDirectory {
+        std::filesystem::path path;
+
+        explicit TemporaryDirectory(const std::string& name) {
+            path = std::filesystem::temp_directory_path() / ("wholf_file_test_" + name + "_" + std::to_string(::getpid()));
+            std::filesystem::remove_all(path);
+            std::filesystem::create_directories(path);
+        }
+
+        ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+
+        std::string operator/(const std::string& name) const { return (path / name).string(); }
+    };
+
+    void writeText(const std::string& path, const std::string& text) {
+        std::ofstream(path, std::ios::trunc) << text;
+    }
+
+    std::string readText(const std::string& path) {
+        std::string content;
+        FileOperations().readFile(path, content);
+        return content;
+    }
+
+    std::vector<std::string> readAll(LineReader reader) {
+        std::vector<std::string> lines;
+        for (std::string_view line : reader) lines.emplace_back(line);
+        return lines;
+    }
+
+    // Thread havuzu her zaman; io_uring çekirdek izin veriyorsa
+    std::vector<AsyncBackend> asyncBackends() {
+        std::vector<AsyncBackend> backends{AsyncBackend::THREADS};
+        AsyncFileOperations::Options options;
+        options.backend = AsyncBackend::AUTO;
+        if (AsyncFileOperations(options).usesUring()) backends.push_back(AsyncBackend::URING);
+        return backends;
+    }
+
+    // İzleyicinin teslim ettiği değişiklik kümeleri
+    struct Batches {
+        std::mutex mutex;
+        std::vector<FileWatcher::ChangeSet> received;
+
+        FileWatcher::Callback callback() {
+            return [this](const FileWatcher::ChangeSet& changes) {
+                std::lock_guard<std::mutex> lock(mutex);
+                received.push_back(changes);
+            };
+        }
+
+        size_t changes() {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t count = 0;
+            for (const auto& batch : received) count += batch.size();
+            return count;
+        }
+
+        size_t batches() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return received.size();
+        }
+
+        bool waitForChanges(size_t count) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (changes() < count) {
+                if (std::chrono::steady_clock::now() > deadline) return false;
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            return true;
+        }
+
+        std::vector<FileChange> all() {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<FileChange> result;
+            for (const auto& batch : received) result.insert(result.end(), batch.begin(), batch.end());
+            return result;
+        }
+    };
+}
+
+WHOLF_TEST("watcher/single-file-survives-rename-over-save") {
+    TemporaryDirectory directory("rename");
+    std::string target = directory / "ayar.wholf";
+    writeText(target, "1");
+    FileWatcher::Options options;
+    options.debounce = std::chrono::milliseconds(10);
+    FileWatcher watcher(options);
+    Batches batches;
+    watcher.watch(target, batches.callback());
+
+    // Editör gibi kaydet: geçici dosyaya yaz, hedefin üzerine taşı (inode değişir)
+    for (int save = 0; save < 3; save++) {
+        writeText(directory / ".ayar.wholf.swp", std::to_string(save));
+        std::filesystem::rename(directory / ".ayar.wholf.swp", target);
+        WHOLF_CHECK(batches.waitForChanges(static_cast<size_t>(save) + 1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    }
+    // Yerinde yazma da görülür; kardeş dosyalar süzülür
+    writeText(directory / "baska.wholf", "x");
+    writeText(target, "son");
+    WHOLF_CHECK(batches.waitForChanges(4));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    for (const auto& change : batches.all()) WHOLF_CHECK(change.path == target);
+    WHOLF_CHECK(batches.changes() == 4);
+
+    std::filesystem::remove(target);
+    WHOLF_CHECK(batches.waitForChanges(5));
+    WHOLF_CHECK(batches.all().back().kind == ChangeKind::DELETED);
+}
+
+WHOLF_TEST("watcher/burst-is-one-batch") {
+    TemporaryDirectory directory("burst");
+    for (int d = 0; d < 100; d++) std::filesystem::create_directories(directory / ("d" + std::to_string(d)));
+    FileWatcher watcher;
+    Batches batches;
+    watcher.watch(directory.path.string(), batches.callback());
+    for (int f = 0; f < 1000; f++) writeText(directory / ("d" + std::to_string(f % 100) + "/f" + std::to_string(f)), "x");
+    WHOLF_CHECK(batches.waitForChanges(1000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    WHOLF_CHECK(batches.changes() == 1000);
+    WHOLF_CHECK(batches.batches() == 1);
+    for (const auto& change : batches.all()) WHOLF_CHECK(change.kind == ChangeKind::CREATED);
+}
+
+WHOLF_TEST("append/reopens-after-rotation") {
+    TemporaryDirectory directory("rotate");
+    std::string log = directory / "uygulama.log";
+    FileOperations operations;
+    operations.appendFile(log, "bir\n");
+    // Günlük döndürme: eski dosya taşınır, yenisi aynı adla oluşur
+    std::filesystem::rename(log, directory / "uygulama.log.1");
+    operations.appendFile(log, "iki\n");
+    WHOLF_CHECK(readText(directory / "uygulama.log.1") == "bir\n");
+    WHOLF_CHECK(readText(log) == "iki\n");
+    std::filesystem::remove(log);
+    operations.appendFile(log, "uc\n");
+    WHOLF_CHECK(readText(log) == "uc\n");
+    operations.closeAppended(log);
+    operations.appendFile(log, "dort\n");
+    operations.closeAppended();
+    WHOLF_CHECK(readText(log) == "uc\ndort\n");
+}
+
+WHOLF_TEST("writer/atomic-keeps-mode-and-symlink") {
+    TemporaryDirectory directory("atomic");
+    std::string real = directory / "ayar.conf";
+    std::string link = directory / "etkin.conf";
+    writeText(real, "eski");
+    ::chmod(real.c_str(), 0600);
+    std::filesystem::create_symlink("ayar.conf", link);
+    FileOperations().writeFileAtomic(link, "yeni", Wholf::File::Durability::NONE);
+    WHOLF_CHECK(std::filesystem::is_symlink(link));
+    WHOLF_CHECK(readText(real) == "yeni");
+    struct stat info;
+    WHOLF_CHECK(::stat(real.c_str(), &info) == 0 && (info.st_mode & 07777) == 0600);
+}
+
+WHOLF_TEST("writer/write-errors-throw") {
+    TemporaryDirectory directory("errors");
+    WHOLF_CHECK_THROWS(FileOperations().writeFile(directory / "yok/dosya", "x"), std::runtime_error);
+}
+
+WHOLF_TEST("read/unmapped-view-survives-truncation") {
+    TemporaryDirectory directory("truncate");
+    std::string path = directory / "big.txt";
+    writeText(path, std::string(256 * 1024, 'w'));
+    FileOperations files;
+    WHOLF_CHECK(files.readView(path)->isMapped());
+    Wholf::File::ReadOptions options;
+    options.map = false;
+    auto view = files.readView(path, options);
+    WHOLF_CHECK(!view->isMapped());
+    // Eşlenmiş görünümde bu kısaltma sonrası okuma SIGBUS olurdu
+    WHOLF_CHECK(::truncate(path.c_str(), 0) == 0);
+    WHOLF_CHECK(view->view().size() == 256 * 1024 && view->view().back() == 'w');
+}
+
+WHOLF_TEST("walk/throwing-callback-closes-descriptors") {
+    TemporaryDirectory directory("walk");
+    for (int d = 0; d < 8; d++) {
+        std::filesystem::create_directories(directory / ("d" + std::to_string(d)));
+        writeText(directory / ("d" + std::to_string(d) + "/dosya"), "x");
+    }
+    auto openDescriptors = []() {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd")) {
+            (void)entry;
+            count++;
+        }
+        return count;
+    };
+    size_t before = openDescriptors();
+    Wholf::File::WalkOptions options;
+    options.threads = 1;
+    for (int round = 0; round < 20; round++) {
+        WHOLF_CHECK_THROWS(Wholf::File::DirectoryOperations().walk(directory.path.string(), options,
+            [](const Wholf::File::DirectoryEntry&) -> Wholf::File::WalkAction { throw std::runtime_error("geri çağrı hatası"); }),
+            std::runtime_error);
+    }
+    WHOLF_CHECK(openDescriptors() == before);
+}
+
+WHOLF_TEST("walk/followed-symlink-cycles-terminate") {
+    TemporaryDirectory directory("cycle");
+    std::filesystem::create_directories(directory / "a/b");
+    writeText(directory / "a/b/dosya", "x");
+    // Üst dizine ve kendine dönen bağlantılar; maxDepth varsayılanı sınırsız
+    std::filesystem::create_directory_symlink("..", directory / "a/b/yukari");
+    std::filesystem::create_directory_symlink(".", directory / "a/kendi");
+    std::filesystem::create_directory_symlink(directory / "a/b", directory / "kisayol");
+    Wholf::File::WalkOptions options;
+    options.followSymlinks = true;
+    options.threads = 2;
+    std::atomic<int> files{0};
+    auto stats = Wholf::File::DirectoryOperations().walk(directory.path.string(), options,
+        [&](const Wholf::File::DirectoryEntry& entry) {
+            if (entry.type == Wholf::File::EntryType::FILE) files++;
+            return Wholf::File::WalkAction::CONTINUE;
+        });
+    // Kök, a ve a/b birer kez taranır; dosyaya iki yoldan değil tek yoldan ulaşılır
+    WHOLF_CHECK(stats.directories == 3);
+    WHOLF_CHECK(files == 1);
+}
+
+WHOLF_TEST("async/default-backend-is-thread-pool") {
+    WHOLF_CHECK(!AsyncFileOperations().usesUring());
+    AsyncFileOperations::Options options;
+    options.backend = AsyncBackend::THREADS;
+    WHOLF_CHECK(!AsyncFileOperations(options).usesUring());
+}
+
+WHOLF_TEST("async/round-trip-on-each-backend") {
+    for (AsyncBackend backend : asyncBackends()) {
+        TemporaryDirectory directory(backend == AsyncBackend::URING ? "async_uring" : "async_threads");
+        AsyncFileOperations::Options options;
+        options.backend = backend;
+        // Derinlikten fazla işlem: kuyruğa alınanlar sırayla halkaya girer
+        options.queueDepth = 8;
+        options.threads = 3;
+        AsyncFileOperations files(options);
+        WHOLF_CHECK(files.usesUring() == (backend == AsyncBackend::URING));
+
+        std::vector<AsyncFileOperations::WriteRequest> writes;
+        std::vector<std::string> paths;
+        for (int i = 0; i < 40; i++) {
+            paths.push_back(directory / ("f" + std::to_string(i)));
+            writes.push_back({paths.back(), std::string(static_cast<size_t>(i) * 997, static_cast<char>('a' + i % 26))});
+        }
+        // Tek parçada bitmeyen büyük dosya
+        paths.push_back(directory / "buyuk");
+        writes.push_back({paths.back(), std::string(3 << 20, 'b')});
+        auto written = files.writeFiles(writes);
+        for (size_t i = 0; i < written.size(); i++) WHOLF_CHECK(written[i].get() == writes[i].content.size());
+
+        auto contents = files.readFiles(paths);
+        bool same = true;
+        for (size_t i = 0; i < contents.size(); i++) same = same && contents[i].get() == writes[i].content;
+        WHOLF_CHECK(same);
+
+        // Boyutu bilinmeyen (procfs) dosya sonuna kadar okunur
+        WHOLF_CHECK(files.readFile("/proc/self/status").get().find("Name:") != std::string::npos);
+
+        Wholf::Value value = files.readValue(paths[3]).get();
+        WHOLF_CHECK(value.type == Wholf::DataType::STRING && value.text() == writes[3].content);
+
+        files.createFile(directory / "bos").get();
+        WHOLF_CHECK(std::filesystem::exists(directory / "bos") && std::filesystem::file_size(directory / "bos") == 0);
+        files.deleteFile(directory / "bos").get();
+        WHOLF_CHECK(!std::filesystem::exists(directory / "bos"));
+
+        WHOLF_CHECK_THROWS(files.readFile(directory / "yok").get(), std::runtime_error);
+        WHOLF_CHECK_THROWS(files.deleteFile(directory / "yok").get(), std::runtime_error);
+        WHOLF_CHECK_THROWS(files.writeFile(directory / "yok/dosya", "x").get(), std::runtime_error);
+    }
+}
+
+WHOLF_TEST("async/destructor-finishes-queued-work") {
+    for (AsyncBackend backend : asyncBackends()) {
+        TemporaryDirectory directory("async_drain");
+        std::vector<std::future<size_t>> futures;
+        {
+            AsyncFileOperations::Options options;
+            options.backend = backend;
+            AsyncFileOperations files(options);
+            for (int i = 0; i < 200; i++) futures.push_back(files.writeFile(directory / std::to_string(i), "veri"));
+        }
+        size_t total = 0;
+        for (auto& future : futures) total += future.get();
+        WHOLF_CHECK(total == 200 * 4);
+    }
+}
+
+WHOLF_TEST("lines/crlf-and-unterminated-last-line") {
+    TemporaryDirectory directory("crlf");
+    std::string path = directory / "satirlar.txt";
+    writeText(path, "bir\r\niki\r\n\r\nuc\rdort\r\nson");
+    std::vector<std::string> expected = {"bir", "iki", "", "uc\rdort", "son"};
+    WHOLF_CHECK(readAll(LineReader(path)) == expected);
+
+    LineReader::Options raw;
+    raw.trimCarriageReturn = false;
+    WHOLF_CHECK(readAll(LineReader(path, raw)).front() == "bir\r");
+
+    // Ayraçla biten dosyada fazladan boş kayıt yok; boş dosyada hiç kayıt yok
+    writeText(path, "a\nb\n");
+    WHOLF_CHECK(readAll(LineReader(path)) == (std::vector<std::string>{"a", "b"}));
+    writeText(path, "");
+    WHOLF_CHECK(readAll(LineReader(path)).empty());
+}
+
+WHOLF_TEST("lines/records-span-buffer-boundaries") {
+    TemporaryDirectory directory("boundary");
+    std::string path = directory / "uzun.txt";
+    // 4096 baytlık tamponun her sınırına denk gelen, tampondan uzun olanlar dahil satırlar
+    std::vector<std::string> expected;
+    std::string text;
+    for (size_t length : {0, 1, 4094, 4095, 4096, 4097, 3, 9000, 12, 20000, 4095, 7}) {
+        std::string line;
+        for (size_t i = 0; i < length; i++) line += static_cast<char>('a' + (i + expected.size()) % 26);
+        expected.push_back(line);
+        text += line + (expected.size() % 3 ? "\n" : "\r\n");
+    }
+    // Son satır ayraçsız
+    text.resize(text.size() - (expected.size() % 3 ? 1 : 2));
+    writeText(path, text);
+
+    LineReader::Options options;
+    options.bufferSize = 4096;
+    WHOLF_CHECK(readAll(LineReader(path, options)) == expected);
+
+    options.delimiter = ';';
+    writeText(path, "x;" + std::string(5000, 'y') + ";z");
+    WHOLF_CHECK(readAll(LineReader(path, options)) == (std::vector<std::string>{"x", std::string(5000, 'y'), "z"}));
+}
+
+WHOLF_TEST("lines/script-reads-through-handles") {
+    TemporaryDirectory directory("script");
+    std::string path = directory / "kayit.log";
+    writeText(path, "alfa\r\nbeta\ngama");
+    Wholf::Interpreter interpreter;
+    Wholf::File::LineHandles::bind(interpreter);
+    interpreter.setGlobal("yol", Wholf::Value(path));
+
+    Wholf::Value joined = interpreter.interpret(
+        "let h = openLines(yol); let s = \"\"; let line = readLine(h);"
+        "while (line != null) { s = s + line + \"|\"; line = readLine(h); }"
+        "closeLines(h); s");
+    WHOLF_CHECK(std::get<std::string>(joined.data) == "alfa|beta|gama|");
+
+    Wholf::Value batch = interpreter.interpret("let k = openLines(yol); readLines(k, 2)");
+    const auto& lines = std::get<std::vector<Wholf::Value>>(batch.data);
+    WHOLF_CHECK(lines.size() == 2 && std::get<std::string>(lines[1].data) == "beta");
+    WHOLF_CHECK(std::get<std::vector<Wholf::Value>>(interpreter.interpret("readLines(k, 2)").data).size() == 1);
+    WHOLF_CHECK(std::get<std::vector<Wholf::Value>>(interpreter.interpret("readLines(k, 2)").data).empty());
+    WHOLF_CHECK(std::get<bool>(interpreter.interpret("closeLines(k)").data));
+    WHOLF_CHECK_THROWS(interpreter.interpret("readLine(k)"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("openLines(\"/yok/dosya\")"), std::runtime_error);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,262 @@
+// Http::Client: keep-alive, eski bağlantıda yeniden deneme, parçalı gövde, ara yanıtlar ve ardışık istekler
+
+#include "check.hpp"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/http.hpp"
+
+namespace {
+    using Wholf::Http::Client;
+    using Wholf::Http::LocalServer;
+    using Wholf::Http::Request;
+    using Wholf::Http::Response;
+
+    // Her kabul edilen bağlantıyı sırayla bir betiğe veren ham sunucu; LocalServer'ın
+    // üretmediği yanıtlar (ara yanıtlar, bozuk uzunluklar, yanıtsız kapanma) için
+    class ScriptedServer {
+    public:
+        using Script = std::function<void(int)>;
+
+        explicit ScriptedServer(std::vector<Script> scripts) : scripts(std::move(scripts)) {
+            listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 8) != 0) {
+                throw std::runtime_error("Cannot listen");
+            }
+            socklen_t length = sizeof(address);
+            ::getsockname(listener, reinterpret_cast<sockaddr*>(&address), &length);
+            port = ntohs(address.sin_port);
+            thread = std::thread([this]() {
+                for (auto& script : this->scripts) {
+                    int fd = ::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+                    if (fd < 0) return;
+                    script(fd);
+                    ::close(fd);
+                }
+            });
+        }
+
+        ~ScriptedServer() {
+            ::shutdown(listener, SHUT_RDWR);
+            thread.join();
+            ::close(listener);
+        }
+
+        std::string url(const std::string& path = "/") const {
+            return "http://127.0.0.1:" + std::to_string(port) + path;
+        }
+
+    private:
+        std::vector<Script> scripts;
+        int listener = -1;
+        uint16_t port = 0;
+        std::thread thread;
+    };
+
+    // Tek bir isteği (başlık + Content-Length gövdesi) oku; bağlantı kapandıysa false
+    bool readRequest(int fd) {
+        std::string data;
+        char byte;
+        while (data.size() < 4 || data.compare(data.size() - 4, 4, "\r\n\r\n") != 0) {
+            if (::recv(fd, &byte, 1, 0) != 1) return false;
+            data += byte;
+        }
+        Wholf::Http::Headers headers;
+        Wholf::Http::parseHeaderLines(data, headers);
+        std::string length = Wholf::Http::findHeader(headers, "Content-Length");
+        for (size_t remaining = length.empty() ? 0 : std::stoul(length); remaining; remaining--) {
+            if (::recv(fd, &byte, 1, 0) != 1) return false;
+        }
+        return true;
+    }
+
+    void sendText(int fd, const std::string& text) {
+        ::send(fd, text.data(), text.size(), MSG_NOSIGNAL);
+    }
+
+    ScriptedServer::Script reply(const std::string& text) {
+        return [text](int fd) {
+            if (readRequest(fd)) sendText(fd, text);
+        };
+    }
+
+    Request get(const std::string& url) {
+        Request request;
+        request.url = url;
+        return request;
+    }
+
+    // Yolu gövde olarak döndüren sunucu
+    LocalServer::Handler echoPath(std::atomic<int>* calls = nullptr) {
+        return [calls](const Request& request, Response& response) {
+            if (calls) (*calls)++;
+            response.body = request.url;
+        };
+    }
+}
+
+WHOLF_TEST("http/keep-alive-reuses-connection") {
+    LocalServer server(echoPath());
+    Client client;
+    for (int i = 0; i < 5; i++) {
+        Response response = client.send(get(server.url("/istek" + std::to_string(i))));
+        WHOLF_CHECK(response.ok());
+        WHOLF_CHECK(response.body == "/istek" + std::to_string(i));
+    }
+    auto stats = client.stats();
+    WHOLF_CHECK(stats.connectionsCreated == 1);
+    WHOLF_CHECK(stats.connectionsReused == 4);
+}
+
+WHOLF_TEST("http/stale-connection-is-retried") {
+    // İlk bağlantı ikinci isteği alıp yanıtsız kapanır: boşta kapanmış keep-alive bağlantısı gibi
+    ScriptedServer server({
+        [](int fd) {
+            if (!readRequest(fd)) return;
+            sendText(fd, "HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\nbir");
+            readRequest(fd);
+        },
+        reply("HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\niki"),
+    });
+    Client client;
+    WHOLF_CHECK(client.send(get(server.url())).body == "bir");
+    Response response = client.send(get(server.url()));
+    WHOLF_CHECK(response.body == "iki");
+    WHOLF_CHECK(client.stats().retries == 1);
+    WHOLF_CHECK(client.stats().connectionsCreated == 2);
+}
+
+WHOLF_TEST("http/stale-connection-does-not-retry-post") {
+    ScriptedServer server({
+        [](int fd) {
+            if (!readRequest(fd)) return;
+            sendText(fd, "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n");
+            readRequest(fd);
+        },
+    });
+    Client client;
+    WHOLF_CHECK(client.send(get(server.url())).ok());
+    Request post = get(server.url());
+    post.method = "POST";
+    post.body = "kayit";
+    WHOLF_CHECK_THROWS(client.send(post), std::runtime_error);
+    WHOLF_CHECK(client.stats().retries == 0);
+}
+
+WHOLF_TEST("http/chunked-body") {
+    std::string body;
+    for (int i = 0; i < 10000; i++) body += static_cast<char>('a' + i % 26);
+    LocalServer server([&](const Request& request, Response& response) {
+        if (request.url == "/parcali") response.headers.emplace_back("Transfer-Encoding", "chunked");
+        response.body = body;
+    });
+    Client client;
+    Response chunked = client.send(get(server.url("/parcali")));
+    WHOLF_CHECK(chunked.ok());
+    WHOLF_CHECK(chunked.body == body);
+
+    std::string streamed;
+    size_t pieces = 0;
+    client.stream(get(server.url("/parcali")), [&](std::string_view piece) {
+        streamed.append(piece);
+        pieces++;
+    });
+    WHOLF_CHECK(streamed == body);
+    WHOLF_CHECK(pieces >= 1);
+    // Son parça ve boş satır tüketildiyse bağlantı bir sonraki istek için temiz kalır
+    WHOLF_CHECK(client.send(get(server.url("/duz"))).body == body);
+    WHOLF_CHECK(client.stats().connectionsCreated == 1);
+}
+
+WHOLF_TEST("http/chunk-extensions-and-malformed-sizes") {
+    ScriptedServer server({
+        reply("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n5;ad=deger\r\nmerha\r\n2 \r\nba\r\n0\r\n\r\n"),
+        reply("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\nmerhaba\r\n0\r\n\r\n"),
+        reply("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n-1\r\nmerhaba\r\n0\r\n\r\n"),
+        reply("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n1ffffffffffffffff\r\nmerhaba\r\n0\r\n\r\n"),
+        reply("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nmerhaba\r\n0\r\n\r\n"),
+    });
+    Client client;
+    WHOLF_CHECK(client.send(get(server.url())).body == "merhaba");
+    for (int i = 0; i < 4; i++) WHOLF_CHECK_THROWS(client.send(get(server.url())), std::runtime_error);
+}
+
+WHOLF_TEST("http/content-length-is-validated") {
+    ScriptedServer server({
+        // Güvenilmeyen dev uzunluk önceden ayrılmaz; bağlantı kısa kesilince hata verir
+        reply("HTTP/1.1 200 OK\r\nContent-Length: 1000000000000\r\n\r\nabc"),
+        reply("HTTP/1.1 200 OK\r\nContent-Length: 3abc\r\n\r\nabc"),
+        reply("HTTP/1.1 200 OK\r\nContent-Length: -3\r\n\r\nabc"),
+        reply("HTTP/1.1 200 OK\r\nContent-Length: 99999999999999999999999\r\n\r\nabc"),
+    });
+    Client client;
+    for (int i = 0; i < 4; i++) WHOLF_CHECK_THROWS(client.send(get(server.url())), std::runtime_error);
+}
+
+WHOLF_TEST("http/interim-responses-are-skipped") {
+    ScriptedServer server({
+        reply("HTTP/1.1 100 Continue\r\n\r\n"
+              "HTTP/1.1 103 Early Hints\r\nLink: </stil.css>; rel=preload\r\n\r\n"
+              "HTTP/1.1 201 Created\r\nContent-Length: 5\r\n\r\ntamam"),
+    });
+    Client client;
+    Request post = get(server.url());
+    post.method = "POST";
+    post.body = "veri";
+    Response response = client.send(post);
+    WHOLF_CHECK(response.status == 201);
+    WHOLF_CHECK(response.body == "tamam");
+    WHOLF_CHECK(response.header("Link").empty());
+}
+
+WHOLF_TEST("http/pipelined-responses-stay-in-order") {
+    LocalServer server(echoPath());
+    Client client;
+    std::vector<Request> requests;
+    for (int i = 0; i < 8; i++) requests.push_back(get(server.url("/" + std::to_string(i))));
+    std::vector<Response> responses = client.pipeline(requests);
+    WHOLF_CHECK(responses.size() == 8);
+    for (int i = 0; i < 8 && i < static_cast<int>(responses.size()); i++) {
+        WHOLF_CHECK(responses[i].body == "/" + std::to_string(i));
+    }
+    WHOLF_CHECK(client.stats().connectionsCreated == 1);
+
+    auto futures = client.sendBatch(requests);
+    for (int i = 0; i < 8; i++) WHOLF_CHECK(futures[i].get().body == "/" + std::to_string(i));
+}
+
+WHOLF_TEST("http/pipeline-retries-only-idempotent-after-close") {
+    std::atomic<int> calls{0};
+    LocalServer server(echoPath(&calls));
+    Client client;
+    // Sunucu Connection: close isteğinden sonrakileri okumadan kapatır; kalan GET'ler yeniden gönderilir
+    std::vector<Request> requests = {get(server.url("/a")), get(server.url("/b")), get(server.url("/c")), get(server.url("/d"))};
+    requests[1].headers.emplace_back("Connection", "close");
+    std::vector<Response> responses = client.pipeline(requests);
+    WHOLF_CHECK(responses.size() == 4);
+    WHOLF_CHECK(responses.size() == 4 && responses[2].body == "/c" && responses[3].body == "/d");
+    WHOLF_CHECK(client.stats().retries == 2);
+
+    // POST yanıtsız kaldıysa kendiliğinden tekrarlanmaz
+    calls = 0;
+    std::vector<Request> mixed = {get(server.url("/a")), get(server.url("/kaydet"))};
+    mixed[0].headers.emplace_back("Connection", "close");
+    mixed[1].method = "POST";
+    mixed[1].body = "x";
+    WHOLF_CHECK_THROWS(client.pipeline(mixed), std::runtime_error);
+    WHOLF_CHECK(calls == 1);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,202 @@
+// İçe aktarma yöneticisi: varsayılan derleyici, çalıştırma, önbellek ve yeniden yükleme
+
+#include "check.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/import.hpp"
+
+namespace {
+    using Wholf::Import::ImportManager;
+
+    struct TemporaryDirectory {
+        std::filesystem::path path;
+
+        TemporaryDirectory() {
+            path = std::filesystem::temp_directory_path() / ("wholf_import_test_" + std::to_string(::getpid()));
+            std::filesystem::remove_all(path);
+            std::filesystem::create_directories(path);
+        }
+
+        ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+
+        std::string write(const std::string& name, const std::string& content) const {
+            std::ofstream file(path / name, std::ios::trunc);
+            file << content;
+            return (path / name).string();
+        }
+    };
+
+    int integer(const Wholf::Value& value) {
+        if (value.type != Wholf::DataType::INTEGER) throw std::runtime_error("not an integer");
+        return std::get<int>(value.data);
+    }
+
+    int same(int value) { return value; }
+    int twice(int value) { return value * 2; }
+    int zero(int) { return 0; }
+}
+
+WHOLF_TEST("import/default-compiler-parses-programs") {
+    TemporaryDirectory directory;
+    std::string main = directory.write("main.wholf", "import \"./util\";\nlet x = topla(1, 2);\n");
+    directory.write("util.wholf", "function topla(a, b) { return a + b; }\n");
+    ImportManager::Options options;
+    options.threads = 4;
+    ImportManager manager(options);
+
+    auto order = manager.loadOrder(main);
+    WHOLF_CHECK(order.size() == 2);
+    WHOLF_CHECK(order[0]->path == (directory.path / "util.wholf").string());
+    WHOLF_CHECK(order[0]->program && order[1]->program);
+    WHOLF_CHECK(order[1]->compiled == order[1]->program);
+    WHOLF_CHECK(manager.stats().compiles == 2);
+}
+
+WHOLF_TEST("import/execute-runs-dependencies-first") {
+    TemporaryDirectory directory;
+    std::string main = directory.write("main.wholf", "// giriş\nimport \"./util\";\nimport \"./sabit\";\nlet x = topla(1, taban);\nx * 10;\n");
+    directory.write("util.wholf", "import \"./sabit\";\nfunction topla(a, b) { return a + b + taban; }\n");
+    directory.write("sabit.wholf", "let taban = 2;\n");
+    ImportManager::Options options;
+    options.threads = 3;
+    ImportManager manager(options);
+
+    Wholf::Interpreter interpreter;
+    WHOLF_CHECK(integer(manager.execute(interpreter, main)) == 50);
+    // İkinci interpreter aynı programları yeniden parse etmeden çalıştırır
+    Wholf::Interpreter other;
+    WHOLF_CHECK(integer(manager.execute(other, main)) == 50);
+    WHOLF_CHECK(manager.stats().compiles == 3);
+    WHOLF_CHECK(manager.stats().reads == 3);
+}
+
+WHOLF_TEST("import/shared-program-resolves-natives-per-interpreter") {
+    TemporaryDirectory directory;
+    std::string path = directory.write("m.wholf", "let toplam = 0;\nlet i = 0;\nwhile (i < 200) { toplam = toplam + olcek(i); i = i + 1; }\ntoplam;\n");
+    ImportManager manager;
+    auto module = manager.importModule(path);
+
+    // Aynı ada farklı slotta farklı fonksiyonlar: önbelleğe alınan slot diğer interpreter'a sızmamalı
+    std::vector<int> results(2);
+    std::thread first([&]() {
+        Wholf::Interpreter interpreter;
+        interpreter.bind("olcek", &same);
+        for (int i = 0; i < 20; i++) results[0] = integer(interpreter.execute(module->program));
+    });
+    std::thread second([&]() {
+        Wholf::Interpreter interpreter;
+        interpreter.bind("bos", &zero);
+        interpreter.bind("olcek", &twice);
+        for (int i = 0; i < 20; i++) results[1] = integer(interpreter.execute(module->program));
+    });
+    first.join();
+    second.join();
+    WHOLF_CHECK(results[0] == 19900);
+    WHOLF_CHECK(results[1] == 39800);
+}
+
+WHOLF_TEST("import/custom-compiler-cannot-execute") {
+    TemporaryDirectory directory;
+    std::string path = directory.write("m.wholf", "1;\n");
+    ImportManager::Options options;
+    options.compiler = [](const std::string&, const std::string& source) {
+        return std::make_shared<const std::string>(source);
+    };
+    ImportManager manager(options);
+    Wholf::Interpreter interpreter;
+    WHOLF_CHECK(!manager.importModule(path)->program);
+    WHOLF_CHECK_THROWS(manager.execute(interpreter, path), std::runtime_error);
+}
+
+WHOLF_TEST("import/cache-is-per-path") {
+    TemporaryDirectory directory;
+    // Aynı içerikli iki dosya birbirinin derlenmiş biçimini paylaşmaz (derleyiciye yol da verilir)
+    std::string first = directory.write("a.wholf", "let x = 1;\n");
+    std::string second = directory.write("b.wholf", "let x = 1;\n");
+    std::vector<std::string> compiledPaths;
+    ImportManager::Options options;
+    options.threads = 2;
+    options.compiler = [&](const std::string& path, const std::string&) {
+        compiledPaths.push_back(path);
+        return std::make_shared<const std::string>(path);
+    };
+    ImportManager manager(options);
+    auto a = manager.importModule(first);
+    auto b = manager.importModule(second);
+    WHOLF_CHECK(compiledPaths.size() == 2);
+    WHOLF_CHECK(*std::static_pointer_cast<const std::string>(a->compiled) == first);
+    WHOLF_CHECK(*std::static_pointer_cast<const std::string>(b->compiled) == second);
+}
+
+WHOLF_TEST("import/reload-replaces-old-revision") {
+    TemporaryDirectory directory;
+    std::string path = directory.write("m.wholf", "let x = 1;\n");
+    ImportManager::Options options;
+    options.threads = 2;
+    ImportManager manager(options);
+    auto first = manager.importModule(path);
+    std::weak_ptr<const void> oldCompiled = first->compiled;
+    first.reset();
+
+    // İçerik değişmeden geçersiz kılma: önbellekten gelir
+    manager.invalidate(path);
+    auto same = manager.importModule(path);
+    WHOLF_CHECK(manager.stats().compiles == 1);
+    WHOLF_CHECK(manager.stats().cacheHits == 1);
+    same.reset();
+
+    directory.write("m.wholf", "let x = 2; let y = 3;\n");
+    manager.invalidate(path);
+    auto changed = manager.importModule(path);
+    WHOLF_CHECK(manager.stats().compiles == 2);
+    // Eski sürümü artık kimse tutmuyor: önbellekte de kalmadı
+    WHOLF_CHECK(oldCompiled.expired());
+    WHOLF_CHECK(changed->program && changed->compiled == changed->program);
+}
+
+WHOLF_TEST("import/invalidation-during-load-keeps-module-stale") {
+    TemporaryDirectory directory;
+    std::string path = directory.write("m.wholf", "1;\n");
+    ImportManager::Options options;
+    options.threads = 1;
+    ImportManager* self = nullptr;
+    int compiles = 0;
+    // Derleme sürerken dosya değişir ve geçersiz kılınır: yükleme eski içeriği güncel diye işaretlememeli
+    options.compiler = [&](const std::string& compiledPath, const std::string& source) {
+        if (++compiles == 1) {
+            std::ofstream(compiledPath, std::ios::trunc) << "2;\n";
+            self->invalidate(compiledPath);
+        }
+        return std::make_shared<const std::string>(source);
+    };
+    ImportManager manager(options);
+    self = &manager;
+    WHOLF_CHECK(*std::static_pointer_cast<const std::string>(manager.importModule(path)->compiled) == "1;\n");
+    WHOLF_CHECK(*std::static_pointer_cast<const std::string>(manager.importModule(path)->compiled) == "2;\n");
+    WHOLF_CHECK(compiles == 2);
+}
+
+WHOLF_TEST("import/missing-module-reports-importer") {
+    TemporaryDirectory directory;
+    std::string main = directory.write("main.wholf", "import \"./yok\";\n");
+    ImportManager::Options options;
+    options.threads = 3;
+    ImportManager manager(options);
+    bool reported = false;
+    try {
+        manager.importModule(main);
+    } catch (const std::runtime_error& error) {
+        reported = std::string(error.what()).find("imported by " + main) != std::string::npos;
+    }
+    WHOLF_CHECK(reported);
+    // Eksik modül eklenince grafik yeniden denenir; havuz hatadan sonra da çalışır
+    directory.write("yok.wholf", "1\n");
+    WHOLF_CHECK(manager.loadOrder(main).size() == 2);
+}
+
+WHOLF_TEST_MAIN()
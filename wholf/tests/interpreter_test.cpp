@@ -0,0 +1,146 @@
+// Yorumlayıcı: ayrıştırma, değerlendirme ve yerel fonksiyon çağrıları
+
+#include "check.hpp"
+
+#include <string>
+#include <string_view>
+
+#include "interpreter/WholfInterpreter.hpp"
+
+namespace {
+    using Wholf::DataType;
+    using Wholf::Interpreter;
+    using Wholf::Value;
+
+    int addIntegers(int a, int b) { return a + b; }
+    float half(float value) { return value / 2.0f; }
+    int length(std::string_view text) { return static_cast<int>(text.size()); }
+    std::string greet(const std::string& name) { return "merhaba " + name; }
+    bool isPositive(int value) { return value > 0; }
+
+    int counter = 0;
+    void increment() { counter++; }
+    int count() { return counter; }
+
+    int integer(const Value& value) {
+        if (value.type != DataType::INTEGER) throw std::runtime_error("not an integer");
+        return std::get<int>(value.data);
+    }
+
+    // Yerel fonksiyonlar double döndüremez (float'a sessiz daraltma olurdu)
+    static_assert(!Wholf::Native::IsResultSupported<double>::value, "double results must be rejected");
+    static_assert(Wholf::Native::IsResultSupported<float>::value, "float results are supported");
+}
+
+WHOLF_TEST("interpreter/arithmetic") {
+    Interpreter interpreter;
+    WHOLF_CHECK(integer(interpreter.interpret("1 + 2 * 3")) == 7);
+    WHOLF_CHECK(integer(interpreter.interpret("(1 + 2) * 3")) == 9);
+    WHOLF_CHECK(integer(interpreter.interpret("2 ^ 3 ^ 2")) == 512);
+    WHOLF_CHECK(integer(interpreter.interpret("7 % 4 - -1")) == 4);
+    Value fraction = interpreter.interpret("1 / 4");
+    WHOLF_CHECK(fraction.type == DataType::FLOAT && std::get<float>(fraction.data) == 0.25f);
+    WHOLF_CHECK(std::get<std::string>(interpreter.interpret("\"a\" + 1").data) == "a1");
+}
+
+WHOLF_TEST("interpreter/variables-and-functions") {
+    Interpreter interpreter;
+    WHOLF_CHECK(integer(interpreter.interpret("let x = 10; x = x + 1; x")) == 11);
+    // Global sonraki interpret çağrısında da görünür
+    WHOLF_CHECK(integer(interpreter.interpret("x * 2")) == 22);
+    interpreter.interpret("function fib(n) { if (n < 2) return n; return fib(n - 1) + fib(n - 2); }");
+    WHOLF_CHECK(integer(interpreter.interpret("fib(15)")) == 610);
+    // Parametre çağrı sonunda geri yüklenir
+    WHOLF_CHECK(integer(interpreter.interpret("let n = 5; fib(3); n")) == 5);
+    WHOLF_CHECK_THROWS(interpreter.interpret("fib(1, 2)"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("function loop() { return loop(); } loop()"), std::runtime_error);
+}
+
+WHOLF_TEST("interpreter/if-and-loops") {
+    Interpreter interpreter;
+    WHOLF_CHECK(integer(interpreter.interpret("if (1 < 2) { 10 } else { 20 }")) == 10);
+    WHOLF_CHECK(integer(interpreter.interpret("if (1 > 2) { 10 } else { 20 }")) == 20);
+    WHOLF_CHECK(integer(interpreter.interpret("let i = 0; while (i < 100) { i = i + 1; } i")) == 100);
+    WHOLF_CHECK(integer(interpreter.interpret(
+        "let s = 0; for (let j = 0; j < 10; j = j + 1) { if (j % 2 == 0) continue; s = s + j; } s")) == 25);
+    WHOLF_CHECK(integer(interpreter.interpret("let k = 0; while (true) { k = k + 1; if (k == 7) break; } k")) == 7);
+    // && kısa devre: sağ taraf hiç değerlendirilmez
+    WHOLF_CHECK(interpreter.interpret("false && undefinedFunction()").type == DataType::BOOLEAN);
+}
+
+WHOLF_TEST("interpreter/parse-errors") {
+    Interpreter interpreter;
+    WHOLF_CHECK_THROWS(interpreter.interpret("let = 1;"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("1 +"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("\"unterminated"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("foreach (x) {}"), std::runtime_error);
+}
+
+WHOLF_TEST("interpreter/nesting-limit") {
+    Interpreter interpreter;
+    // Sınırın altı çalışır; üstü yığın taşması yerine parse hatası verir
+    WHOLF_CHECK(integer(interpreter.interpret(std::string(150, '(') + "7" + std::string(150, ')'))) == 7);
+    WHOLF_CHECK_THROWS(interpreter.interpret(std::string(100000, '(') + "1" + std::string(100000, ')')), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret(std::string(100000, '-') + "1"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret(std::string(100000, '{') + std::string(100000, '}')), std::runtime_error);
+    std::string chain;
+    for (int i = 0; i < 100000; i++) chain += "if (true) ";
+    WHOLF_CHECK_THROWS(interpreter.interpret(chain + "1"), std::runtime_error);
+}
+
+WHOLF_TEST("native/call-from-script") {
+    Interpreter interpreter;
+    interpreter.bind<&addIntegers>("topla");
+    interpreter.bind("yarim", &half);
+    interpreter.bind("uzunluk", &length);
+    interpreter.bind("selam", &greet);
+    interpreter.bind("pozitif", &isPositive);
+
+    WHOLF_CHECK(integer(interpreter.interpret("topla(2, 3) * 2")) == 10);
+    Value halved = interpreter.interpret("yarim(3)");
+    WHOLF_CHECK(halved.type == DataType::FLOAT && std::get<float>(halved.data) == 1.5f);
+    WHOLF_CHECK(integer(interpreter.interpret("uzunluk(\"wholf\")")) == 5);
+    WHOLF_CHECK(std::get<std::string>(interpreter.interpret("selam(\"dünya\")").data) == "merhaba dünya");
+    WHOLF_CHECK(std::get<bool>(interpreter.interpret("pozitif(topla(-5, 3))").data) == false);
+
+    // Döngü içinde aynı node'un çözülmüş slotu tekrar kullanılır
+    WHOLF_CHECK(integer(interpreter.interpret("let t = 0; for (let i = 0; i < 50; i = i + 1) { t = topla(t, i); } t")) == 1225);
+}
+
+WHOLF_TEST("native/argument-errors") {
+    Interpreter interpreter;
+    interpreter.bind<&addIntegers>("topla");
+    interpreter.bind("uzunluk", &length);
+    WHOLF_CHECK_THROWS(interpreter.interpret("topla(1)"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("uzunluk(42)"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("yok(1)"), std::runtime_error);
+    // int parametresine NaN ya da aralık dışı float verilemez
+    WHOLF_CHECK_THROWS(interpreter.interpret("topla(0.0 / 0.0, 1)"), std::runtime_error);
+    WHOLF_CHECK_THROWS(interpreter.interpret("topla(3000000000.0, 1)"), std::runtime_error);
+    WHOLF_CHECK(integer(interpreter.interpret("topla(2.5, 1)")) == 3);
+}
+
+WHOLF_TEST("native/no-shadowing") {
+    Interpreter interpreter;
+    interpreter.interpret("function kare(n) { return n * n; }");
+    WHOLF_CHECK_THROWS(interpreter.bind<&addIntegers>("kare"), std::runtime_error);
+    WHOLF_CHECK(integer(interpreter.interpret("kare(4)")) == 16);
+    interpreter.bind<&addIntegers>("topla");
+    WHOLF_CHECK_THROWS(interpreter.interpret("function topla(a, b) { return a - b; }"), std::runtime_error);
+    WHOLF_CHECK(integer(interpreter.interpret("topla(4, 3)")) == 7);
+}
+
+WHOLF_TEST("native/void-and-rebind") {
+    Interpreter interpreter;
+    counter = 0;
+    interpreter.bind("artir", &increment);
+    size_t slot = interpreter.bind("say", &count);
+    interpreter.interpret("let i = 0; while (i < 3) { artir(); i = i + 1; }");
+    WHOLF_CHECK(counter == 3);
+    WHOLF_CHECK(integer(interpreter.callNative(interpreter.resolveNative("say"), {})) == 3);
+    // Aynı isimle tekrar bağlama slotu korur
+    WHOLF_CHECK(interpreter.bind<&addIntegers>("say") == slot);
+    WHOLF_CHECK(integer(interpreter.interpret("say(20, 22)")) == 42);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,46 @@
+// JSON: yapısal indeks ve derlenmiş şema doğrulaması
+
+#include "check.hpp"
+
+#include <string>
+
+#include "runtime/json.hpp"
+
+namespace {
+    using Wholf::Json::Document;
+    using Wholf::Json::Schema;
+    using Wholf::Json::ValidationResult;
+}
+
+WHOLF_TEST("json/parse-spans-blocks") {
+    // 64 baytlık blok sınırını aşan belge; konum tamponu büyümek zorunda kalır
+    std::string text = "[";
+    for (int i = 0; i < 200; i++) text += (i ? "," : "") + std::to_string(i);
+    text += "]";
+    Document document = Document::parse(text);
+    WHOLF_CHECK(document.root().size() == 200);
+    WHOLF_CHECK_THROWS(Document::parse("[1, \"acik"), std::runtime_error);
+}
+
+WHOLF_TEST("schema/inclusive-and-exclusive-bounds") {
+    Schema schema(R"({"type": "number", "minimum": 0, "exclusiveMinimum": 5, "maximum": 10, "exclusiveMaximum": 20})");
+    WHOLF_CHECK(!schema.validate("0"));
+    WHOLF_CHECK(!schema.validate("5"));
+    WHOLF_CHECK(schema.validate("6"));
+    WHOLF_CHECK(schema.validate("10"));
+    WHOLF_CHECK(!schema.validate("11"));
+
+    // Sıra fark etmez: dışlayan sınır kapsayanı ezmez
+    Schema reversed(R"({"exclusiveMinimum": 5, "minimum": 7})");
+    WHOLF_CHECK(!reversed.validate("6"));
+    WHOLF_CHECK(reversed.validate("7"));
+}
+
+WHOLF_TEST("schema/error-path-escapes-pointer-tokens") {
+    Schema schema(R"({"properties": {"a/b": {"properties": {"c~d": {"type": "string"}}}}})");
+    ValidationResult result = schema.validate(R"({"a/b": {"c~d": 1}})");
+    WHOLF_CHECK(!result);
+    WHOLF_CHECK(result.path == "/a~1b/c~0d");
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,58 @@
+// Ölçüm kaydı: thread parçalarının birleştirilmesi ve sonlanan thread'lerin geri alınması
+
+#include "check.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "runtime/metrics.hpp"
+
+namespace {
+    using Wholf::Metrics::Counter;
+    using Wholf::Metrics::Histogram;
+    using Wholf::Metrics::Registry;
+}
+
+WHOLF_TEST("metrics/exited-threads-are-reclaimed") {
+    Registry& registry = Registry::instance();
+    Registry::add(Counter::MODULE_CALLS, 1);
+    size_t live = registry.liveShards();
+    uint64_t before = registry.snapshot().counter(Counter::MODULE_CALLS);
+    uint64_t recordedBefore = registry.snapshot().histogram(Histogram::MODULE_CALL_LATENCY).count;
+
+    for (int round = 0; round < 50; round++) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([]() {
+                for (int i = 0; i < 100; i++) Registry::add(Counter::MODULE_CALLS, 1);
+                Registry::record(Histogram::MODULE_CALL_LATENCY, 1500);
+            });
+        }
+        for (auto& thread : threads) thread.join();
+    }
+
+    // Parçalar serbest bırakıldı, sayılar emekli toplamda kaldı
+    WHOLF_CHECK(registry.liveShards() == live);
+    WHOLF_CHECK(registry.snapshot().counter(Counter::MODULE_CALLS) == before + 50 * 4 * 100);
+    WHOLF_CHECK(registry.snapshot().histogram(Histogram::MODULE_CALL_LATENCY).count == recordedBefore + 200);
+}
+
+WHOLF_TEST("metrics/live-threads-are-merged") {
+    Registry& registry = Registry::instance();
+    uint64_t before = registry.snapshot().counter(Counter::FILE_READS);
+    std::atomic<int> ready{0};
+    std::atomic<bool> release{false};
+    std::thread worker([&]() {
+        Registry::add(Counter::FILE_READS, 7);
+        ready = 1;
+        while (!release.load()) std::this_thread::yield();
+    });
+    while (!ready.load()) std::this_thread::yield();
+    WHOLF_CHECK(registry.snapshot().counter(Counter::FILE_READS) == before + 7);
+    release = true;
+    worker.join();
+    WHOLF_CHECK(registry.snapshot().counter(Counter::FILE_READS) == before + 7);
+}
+
+WHOLF_TEST_MAIN()
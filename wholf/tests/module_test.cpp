@@ -0,0 +1,61 @@
+// Module::ModuleManager: çalışan export'un değiştirilmesi ve hazırlanmış toplu çağrı
+
+#include "check.hpp"
+
+#include <string>
+#include <vector>
+
+#include "runtime/module.hpp"
+
+namespace {
+    using Wholf::Module::CallBatch;
+    using Wholf::Module::ModuleManager;
+}
+
+WHOLF_TEST("module/reexport-while-running") {
+    ModuleManager modules;
+    auto module = modules.loadModule("modul", "").get();
+    std::vector<std::string> log;
+    // Yakalanan string, fonksiyon kendini değiştirdikten sonra da okunur
+    std::string label = "eski";
+    module->exportFunction("f", [&log, module, label]() {
+        module->exportFunction("f", [&log]() { log.push_back("yeni"); });
+        log.push_back(label);
+    });
+    auto handle = modules.resolve("modul", "f");
+    modules.call(handle);
+    modules.call(handle);
+    WHOLF_CHECK((log == std::vector<std::string>{"eski", "yeni"}));
+}
+
+WHOLF_TEST("module/batch-after-reexport-calls-new-targets") {
+    ModuleManager modules;
+    auto module = modules.loadModule("modul", "").get();
+    std::vector<std::string> log;
+    module->exportFunction("a", [&log, module]() {
+        log.push_back("a");
+        module->exportFunction("b", [&log]() { log.push_back("b2"); });
+    });
+    module->exportFunction("b", [&log]() { log.push_back("b1"); });
+    module->exportFunction("c", [&log]() { log.push_back("c"); });
+    CallBatch batch;
+    batch.add(modules.resolve("modul", "a"));
+    batch.add(modules.resolve("modul", "b"));
+    batch.add(modules.resolve("modul", "c"));
+    modules.callBatch(batch);
+    WHOLF_CHECK((log == std::vector<std::string>{"a", "b2", "c"}));
+    log.clear();
+    modules.callBatch(batch);
+    WHOLF_CHECK((log == std::vector<std::string>{"a", "b2", "c"}));
+}
+
+WHOLF_TEST("module/stale-handle-throws") {
+    ModuleManager modules;
+    modules.loadModule("modul", "")->exportFunction("f", []() {});
+    auto handle = modules.resolve("modul", "f");
+    modules.loadModule("modul", "")->exportFunction("f", []() {});
+    WHOLF_CHECK(!modules.isValid(handle));
+    WHOLF_CHECK_THROWS(modules.call(handle), std::runtime_error);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,270 @@
+// Sayısal çekirdekler: her ISA'da skaler referans döngülerle karşılaştırma, vektör genişliğine bölünmeyen kuyruklar
+
+#include "check.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "runtime/numeric.hpp"
+
+namespace {
+    using Wholf::ElementType;
+    using Wholf::TypedArray;
+    using Wholf::Numeric::Isa;
+    using Wholf::Numeric::Operation;
+    namespace Numeric = Wholf::Numeric;
+    namespace Detail = Wholf::Numeric::Detail;
+
+    // 8/16 şeritli döngülerin tam blok, yarım blok ve kuyruk dallarının hepsine düşen uzunluklar
+    const size_t LENGTHS[] = {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 23, 31, 33, 63, 64, 65, 127, 1000, 1003};
+    const Operation OPERATIONS[] = {Operation::ADD, Operation::SUBTRACT, Operation::MULTIPLY, Operation::DIVIDE};
+
+    // Test sonunda algılanan ISA'ya döner
+    struct IsaScope {
+        ~IsaScope() { Numeric::setIsa(Numeric::detectIsa()); }
+    };
+
+    std::vector<Isa> isas() {
+        std::vector<Isa> result{Isa::SCALAR};
+        if (Numeric::detectIsa() == Isa::AVX2) result.push_back(Isa::AVX2);
+        return result;
+    }
+
+    // Tekrarlanabilir sözde rastgele dizi (xorshift)
+    struct Random {
+        uint64_t state = 0x9e3779b97f4a7c15ull;
+
+        uint64_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        double real() { return static_cast<double>(next() % 2000001) / 1000.0 - 1000.0; }
+        int32_t integer() { return static_cast<int32_t>(static_cast<uint32_t>(next())); }
+        int32_t small() { return static_cast<int32_t>(next() % 2001) - 1000; }
+    };
+
+    template<typename T>
+    std::vector<T> values(size_t count, Random& random, bool wide = false) {
+        std::vector<T> result(count);
+        for (auto& value : result) {
+            if constexpr (std::is_same_v<T, int32_t>) value = wide ? random.integer() : random.small();
+            else value = static_cast<T>(random.real());
+        }
+        return result;
+    }
+
+    // Referans: bağımsız yazılmış skaler döngüler. Int32 aritmetiği ikiye tümleyende sarar
+    template<typename T>
+    T reference(Operation op, T a, T b) {
+        if constexpr (std::is_same_v<T, int32_t>) {
+            uint32_t left = static_cast<uint32_t>(a);
+            uint32_t right = static_cast<uint32_t>(b);
+            switch (op) {
+                case Operation::ADD: return static_cast<int32_t>(left + right);
+                case Operation::SUBTRACT: return static_cast<int32_t>(left - right);
+                case Operation::MULTIPLY: return static_cast<int32_t>(left * right);
+                case Operation::DIVIDE: return b == -1 ? static_cast<int32_t>(0u - left) : a / b;
+            }
+            return 0;
+        } else {
+            switch (op) {
+                case Operation::ADD: return a + b;
+                case Operation::SUBTRACT: return a - b;
+                case Operation::MULTIPLY: return a * b;
+                case Operation::DIVIDE: return a / b;
+            }
+            return 0;
+        }
+    }
+
+    template<typename T>
+    bool sameBits(T a, T b) {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    // Sıra değişikliği yuvarlamayı etkiler: toplam mutlak büyüklüğe göre göreli tolerans
+    bool close(double got, double expected, double magnitude) {
+        return std::fabs(got - expected) <= 1e-12 * (magnitude + 1);
+    }
+
+    // out tamponunun sonundaki nöbetçiler: kuyruk döngüsü count'un ötesine yazmamalı
+    constexpr size_t GUARD = 16;
+
+    template<typename T>
+    bool checkBinary(Random& random) {
+        bool ok = true;
+        for (size_t count : LENGTHS) {
+            std::vector<T> a = values<T>(count, random, true);
+            std::vector<T> b = values<T>(count, random, true);
+            for (auto& value : b) {
+                if (value == 0) value = 1;
+            }
+            T scalar = std::is_same_v<T, int32_t> ? static_cast<T>(-7) : static_cast<T>(2.5);
+            for (Operation op : OPERATIONS) {
+                std::vector<T> out(count + GUARD, static_cast<T>(42));
+                std::vector<T> broadcast(count + GUARD, static_cast<T>(42));
+                Detail::dispatch<false>(op, a.data(), b.data(), T(0), out.data(), count);
+                Detail::dispatch<true>(op, a.data(), static_cast<const T*>(nullptr), scalar, broadcast.data(), count);
+                for (size_t i = 0; i < count; i++) {
+                    ok = ok && sameBits(out[i], reference(op, a[i], b[i]));
+                    ok = ok && sameBits(broadcast[i], reference(op, a[i], scalar));
+                }
+                for (size_t i = count; i < count + GUARD; i++) ok = ok && out[i] == 42 && broadcast[i] == 42;
+            }
+        }
+        return ok;
+    }
+
+    template<typename T>
+    bool checkSum(Random& random) {
+        bool ok = true;
+        for (size_t count : LENGTHS) {
+            std::vector<T> data = values<T>(count, random, true);
+            long double expected = 0;
+            double magnitude = 0;
+            for (T value : data) {
+                expected += static_cast<long double>(value);
+                magnitude += std::fabs(static_cast<double>(value));
+            }
+            double got = Detail::sum(data.data(), count);
+            if constexpr (std::is_same_v<T, int32_t>) ok = ok && got == static_cast<double>(expected);
+            else ok = ok && close(got, static_cast<double>(expected), magnitude);
+        }
+        return ok;
+    }
+
+    template<typename T>
+    bool checkDot(Random& random) {
+        bool ok = true;
+        for (size_t count : LENGTHS) {
+            std::vector<T> a = values<T>(count, random);
+            std::vector<T> b = values<T>(count, random);
+            long double expected = 0;
+            double magnitude = 0;
+            for (size_t i = 0; i < count; i++) {
+                double product = static_cast<double>(a[i]) * static_cast<double>(b[i]);
+                expected += product;
+                magnitude += std::fabs(product);
+            }
+            double got = Detail::dot(a.data(), b.data(), count);
+            // Küçük tam sayıların çarpım toplamı double'da kesindir
+            if constexpr (std::is_same_v<T, int32_t>) ok = ok && got == static_cast<double>(expected);
+            else ok = ok && close(got, static_cast<double>(expected), magnitude);
+        }
+        return ok;
+    }
+
+    template<typename T>
+    bool checkExtreme(Random& random) {
+        bool ok = true;
+        for (size_t count : LENGTHS) {
+            std::vector<T> data = values<T>(count, random, true);
+            // NaN'lar hem vektör şeritlerine hem kuyruğa düşer
+            if constexpr (!std::is_same_v<T, int32_t>) {
+                for (size_t i = 0; i < count; i += 5) data[i] = std::numeric_limits<T>::quiet_NaN();
+                if (count) data[count - 1] = std::numeric_limits<T>::quiet_NaN();
+            }
+            for (bool maximum : {false, true}) {
+                T initial = maximum ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+                T expected = initial;
+                for (T value : data) {
+                    if (value != value) continue;
+                    if (maximum ? value > expected : value < expected) expected = value;
+                }
+                ok = ok && sameBits(Detail::extreme(data.data(), count, initial, maximum), expected);
+            }
+        }
+        return ok;
+    }
+
+    TypedArray filled(ElementType type, const std::vector<double>& items) {
+        TypedArray array(type, items.size());
+        for (size_t i = 0; i < items.size(); i++) array.set(i, items[i]);
+        return array;
+    }
+}
+
+WHOLF_TEST("numeric/binary-matches-reference") {
+    IsaScope scope;
+    for (Isa isa : isas()) {
+        Numeric::setIsa(isa);
+        Random random;
+        WHOLF_CHECK(checkBinary<double>(random));
+        WHOLF_CHECK(checkBinary<float>(random));
+        WHOLF_CHECK(checkBinary<int32_t>(random));
+    }
+}
+
+WHOLF_TEST("numeric/sum-matches-reference") {
+    IsaScope scope;
+    for (Isa isa : isas()) {
+        Numeric::setIsa(isa);
+        Random random;
+        WHOLF_CHECK(checkSum<double>(random));
+        WHOLF_CHECK(checkSum<float>(random));
+        WHOLF_CHECK(checkSum<int32_t>(random));
+    }
+}
+
+WHOLF_TEST("numeric/dot-matches-reference") {
+    IsaScope scope;
+    for (Isa isa : isas()) {
+        Numeric::setIsa(isa);
+        Random random;
+        WHOLF_CHECK(checkDot<double>(random));
+        WHOLF_CHECK(checkDot<float>(random));
+        WHOLF_CHECK(checkDot<int32_t>(random));
+    }
+}
+
+WHOLF_TEST("numeric/extreme-skips-nan") {
+    IsaScope scope;
+    for (Isa isa : isas()) {
+        Numeric::setIsa(isa);
+        Random random;
+        WHOLF_CHECK(checkExtreme<double>(random));
+        WHOLF_CHECK(checkExtreme<float>(random));
+        WHOLF_CHECK(checkExtreme<int32_t>(random));
+    }
+}
+
+WHOLF_TEST("numeric/typed-array-operations") {
+    IsaScope scope;
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double infinity = std::numeric_limits<double>::infinity();
+    for (Isa isa : isas()) {
+        Numeric::setIsa(isa);
+        // Yerinde işlem: out, a ile aynı tampon
+        TypedArray a = filled(ElementType::FLOAT32, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+        TypedArray b = filled(ElementType::FLOAT32, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+        Numeric::compute(Operation::ADD, a, b, a);
+        WHOLF_CHECK(a.get(0) == 2 && a.get(10) == 12);
+        WHOLF_CHECK(Numeric::sum(a) == 77);
+        WHOLF_CHECK(Numeric::mean(a) == 7);
+
+        // Boş ya da tamamı NaN: NaN; gerçekten -inf olan eleman bulunur
+        WHOLF_CHECK(std::isnan(Numeric::max(TypedArray(ElementType::FLOAT64, 0))));
+        WHOLF_CHECK(std::isnan(Numeric::min(filled(ElementType::FLOAT64, {nan, nan, nan, nan, nan}))));
+        WHOLF_CHECK(Numeric::max(filled(ElementType::FLOAT64, {-infinity, nan, -infinity, -infinity, -infinity})) == -infinity);
+        WHOLF_CHECK(std::isnan(Numeric::min(TypedArray(ElementType::INT32, 0))));
+
+        // Int32 bölmesi sıfır bölene izin vermez; INT32_MIN / -1 sarar
+        TypedArray integers = filled(ElementType::INT32, {INT32_MIN, 7, -9, 0, 5, 6, 7, 8, 9});
+        WHOLF_CHECK(Numeric::divide(integers, -1.0).get(0) == INT32_MIN);
+        WHOLF_CHECK_THROWS(Numeric::divide(integers, 0.0), std::runtime_error);
+        WHOLF_CHECK_THROWS(Numeric::divide(integers, integers), std::runtime_error);
+        WHOLF_CHECK_THROWS(Numeric::add(integers, 1.5), std::runtime_error);
+        WHOLF_CHECK_THROWS(Numeric::add(integers, a), std::runtime_error);
+    }
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,120 @@
+// Paket deposu: sürüm aralıkları, bütünlük, dosya kipleri ve bağlantılar
+
+#include "check.hpp"
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "runtime/package.hpp"
+
+namespace {
+    using Wholf::Packages::LockedPackage;
+    using Wholf::Packages::Range;
+    using Wholf::Packages::Store;
+    using Wholf::Packages::Version;
+
+    struct TemporaryDirectory {
+        std::filesystem::path path;
+
+        explicit TemporaryDirectory(const std::string& name) {
+            path = std::filesystem::temp_directory_path() / ("wholf_package_test_" + name + "_" + std::to_string(::getpid()));
+            std::filesystem::remove_all(path);
+            std::filesystem::create_directories(path);
+        }
+
+        ~TemporaryDirectory() {
+            // Depo nesneleri salt okunurdur; silmeden önce yazılabilir yapılır
+            std::error_code error;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path, error)) {
+                if (!entry.is_symlink()) ::chmod(entry.path().c_str(), 0755);
+            }
+            std::filesystem::remove_all(path);
+        }
+
+        std::string operator/(const std::string& name) const { return (path / name).string(); }
+    };
+
+    void writeText(const std::string& path, const std::string& content) {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        std::ofstream(path) << content;
+    }
+
+    LockedPackage locked(const std::string& name, const std::string& version) {
+        LockedPackage package;
+        package.name = name;
+        package.version = Version::parse(version);
+        return package;
+    }
+}
+
+WHOLF_TEST("range/caret-on-zero-versions") {
+    Range patch = Range::parse("^0.0.3");
+    WHOLF_CHECK(patch.matches(Version::parse("0.0.3")));
+    WHOLF_CHECK(!patch.matches(Version::parse("0.0.4")));
+    Range minor = Range::parse("^0.2.3");
+    WHOLF_CHECK(minor.matches(Version::parse("0.2.9")));
+    WHOLF_CHECK(!minor.matches(Version::parse("0.3.0")));
+    WHOLF_CHECK(Range::parse("^1.2.0").matches(Version::parse("1.9.0")));
+}
+
+WHOLF_TEST("store/integrity-checked-before-publishing") {
+    TemporaryDirectory directory("integrity");
+    writeText(directory / "paket/index.wholf", "1");
+    Store store(directory / "store");
+    WHOLF_CHECK_THROWS(store.ingest("paket", Version::parse("1.0.0"), directory / "paket", "sha256-yanlis"), std::runtime_error);
+    WHOLF_CHECK(!store.contains("paket", Version::parse("1.0.0")));
+    std::string integrity = store.ingest("paket", Version::parse("1.0.0"), directory / "paket");
+    WHOLF_CHECK(store.contains("paket", Version::parse("1.0.0")));
+    WHOLF_CHECK(integrity.compare(0, 7, "sha256-") == 0);
+}
+
+WHOLF_TEST("store/keeps-modes-and-symlinks") {
+    TemporaryDirectory directory("modes");
+    std::string package = directory / "paket";
+    writeText(package + "/bin/calistir", "#!/bin/sh\n");
+    ::chmod((package + "/bin/calistir").c_str(), 0755);
+    writeText(package + "/lib/ana.wholf", "1");
+    std::filesystem::create_symlink("lib/ana.wholf", package + "/ana.wholf");
+
+    Store::Options options;
+    options.link = Wholf::Packages::LinkMode::COPY;
+    Store store(directory / "store", options);
+    LockedPackage entry = locked("paket", "1.0.0");
+    entry.integrity = store.ingest("paket", entry.version, package);
+    std::string target = directory / "modules/paket";
+    std::filesystem::create_directories(directory / "modules");
+    WHOLF_CHECK(store.link(entry, target));
+
+    struct stat info;
+    WHOLF_CHECK(::stat((target + "/bin/calistir").c_str(), &info) == 0 && (info.st_mode & S_IXUSR));
+    WHOLF_CHECK(::stat((target + "/lib/ana.wholf").c_str(), &info) == 0 && !(info.st_mode & S_IXUSR));
+    WHOLF_CHECK(std::filesystem::is_symlink(target + "/ana.wholf"));
+    WHOLF_CHECK(std::filesystem::read_symlink(target + "/ana.wholf") == "lib/ana.wholf");
+
+    // Paketin dışına çıkan bağlantı reddedilir
+    std::filesystem::create_symlink("../../disarisi", package + "/lib/kacak");
+    WHOLF_CHECK_THROWS(store.ingest("paket", Version::parse("1.0.1"), package), std::runtime_error);
+}
+
+WHOLF_TEST("store/link-detects-corrupt-object") {
+    TemporaryDirectory directory("corrupt");
+    writeText(directory / "paket/index.wholf", "dogru icerik");
+    LockedPackage entry = locked("paket", "1.0.0");
+    {
+        Store store(directory / "store");
+        entry.integrity = store.ingest("paket", entry.version, directory / "paket");
+    }
+    for (const auto& object : std::filesystem::recursive_directory_iterator(directory / "store/objects")) {
+        if (!object.is_regular_file()) continue;
+        ::chmod(object.path().c_str(), 0644);
+        std::ofstream(object.path()) << "bozuk icerik";
+    }
+    Store store(directory / "store");
+    std::filesystem::create_directories(directory / "modules");
+    WHOLF_CHECK_THROWS(store.link(entry, directory / "modules/paket"), std::runtime_error);
+}
+
+WHOLF_TEST_MAIN()
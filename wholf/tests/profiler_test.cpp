@@ -0,0 +1,73 @@
+// Örnekleyici profilleyici: betik çağrı yığını ve katlanmış yığın çıktısı
+
+#include "check.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "interpreter/WholfInterpreter.hpp"
+
+namespace {
+    using Wholf::Interpreter;
+    using Wholf::Profiling::Profiler;
+
+    std::string readFile(const std::string& path) {
+        std::ifstream file(path);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    std::string temporaryPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("wholf_profiler_test_" + name)).string();
+    }
+}
+
+WHOLF_TEST("profiler/collapsed-stacks") {
+    Interpreter interpreter;
+    interpreter.interpret(
+        "function yavas(n) {\n"
+        "    let s = 0;\n"
+        "    for (let i = 0; i < n; i = i + 1) { s = s + i % 7; }\n"
+        "    return s;\n"
+        "}\n");
+
+    Profiler& profiler = Profiler::instance();
+    profiler.reset();
+    profiler.start(std::chrono::microseconds(200));
+    // Profil zamanlayıcısı CPU süresi sayar; birkaç yüz örnek düşecek kadar çalış
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+    do {
+        interpreter.interpret("yavas(20000)");
+    } while (std::chrono::steady_clock::now() < deadline);
+    profiler.stop();
+
+    std::string collapsedPath = temporaryPath("collapsed.txt");
+    std::string tablePath = temporaryPath("table.tsv");
+    profiler.writeCollapsed(collapsedPath);
+    profiler.writeTable(tablePath);
+    std::string collapsed = readFile(collapsedPath);
+    std::string table = readFile(tablePath);
+    std::remove(collapsedPath.c_str());
+    std::remove(tablePath.c_str());
+
+    // "<script>:1;yavas:3 17" biçiminde: kök çerçeve ve fonksiyonun satırı
+    WHOLF_CHECK(collapsed.find("<script>:1;yavas:") != std::string::npos);
+    WHOLF_CHECK(table.rfind("function\tself_ms", 0) == 0);
+    WHOLF_CHECK(table.find("yavas\t") != std::string::npos);
+}
+
+WHOLF_TEST("profiler/stack-unwinds-on-error") {
+    Interpreter interpreter;
+    interpreter.interpret("function patla() { return yok(); }");
+    WHOLF_CHECK_THROWS(interpreter.interpret("patla()"), std::runtime_error);
+    // Hata sonrası gölge yığın boşalmış olmalı
+    WHOLF_CHECK(interpreter.getCallStack()->size() == 0);
+    WHOLF_CHECK(Wholf::Profiling::CallStack::current() == nullptr);
+}
+
+WHOLF_TEST_MAIN()
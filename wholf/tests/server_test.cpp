@@ -0,0 +1,296 @@
+// Betik sunucusu: değer kodlaması ve yerel soket üzerinden uçtan uca istekler
+
+#include "check.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "runtime/server.hpp"
+
+namespace {
+    using Wholf::DataType;
+    using Wholf::ElementType;
+    using Wholf::TypedArray;
+    using Wholf::Value;
+    using Wholf::Server::Client;
+    using Wholf::Server::Codec;
+    using Wholf::Server::FrameType;
+    using Wholf::Server::RemoteError;
+    using Wholf::Server::ScriptServer;
+
+    Value roundTrip(const Value& value) {
+        std::string encoded;
+        Codec::encode(encoded, value);
+        const char* cursor = encoded.data();
+        Value decoded = Codec::decode(cursor, encoded.data() + encoded.size());
+        if (cursor != encoded.data() + encoded.size()) throw std::runtime_error("trailing bytes");
+        return decoded;
+    }
+
+    // Geçici soket yolu üzerinde çalışan sunucu
+    struct LoopbackServer {
+        std::string path;
+        std::unique_ptr<ScriptServer> server;
+
+        LoopbackServer(const std::string& name, size_t workers) : LoopbackServer(name, workers, ScriptServer::Options()) {}
+
+        LoopbackServer(const std::string& name, size_t workers, ScriptServer::Options options) {
+            path = socketPath(name);
+            options.socketPath = path;
+            options.workers = workers;
+            server = std::make_unique<ScriptServer>(options);
+            server->start();
+        }
+
+        static std::string socketPath(const std::string& name) {
+            return (std::filesystem::temp_directory_path() / ("wholf_server_test_" + name + "_" + std::to_string(::getpid()) + ".sock")).string();
+        }
+    };
+
+    // İstemci sınıfının göndermeyeceği çerçeveler için ham bağlantı
+    int rawConnect(const std::string& path) {
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+        if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            throw std::runtime_error("Cannot connect to " + path);
+        }
+        return fd;
+    }
+
+    void writeAll(int fd, const std::string& data) {
+        size_t written = 0;
+        while (written < data.size()) {
+            ssize_t count = ::write(fd, data.data() + written, data.size() - written);
+            if (count <= 0) throw std::runtime_error("write failed");
+            written += static_cast<size_t>(count);
+        }
+    }
+}
+
+WHOLF_TEST("codec/round-trip") {
+    std::map<std::string, Value> fields;
+    fields.emplace("ad", Value(std::string("wholf")));
+    fields.emplace("liste", Value(std::vector<Value>{Value(-3), Value(2.5f), Value(false), Value(nullptr)}));
+    Value decoded = roundTrip(Value(fields));
+    const auto& object = std::get<std::map<std::string, Value>>(decoded.data);
+    WHOLF_CHECK(std::string(object.at("ad").text()) == "wholf");
+    const auto& list = std::get<std::vector<Value>>(object.at("liste").data);
+    WHOLF_CHECK(std::get<int>(list[0].data) == -3 && std::get<float>(list[1].data) == 2.5f);
+    WHOLF_CHECK(list[3].type == DataType::NULL_TYPE);
+}
+
+WHOLF_TEST("codec/typed-arrays") {
+    TypedArray array(ElementType::FLOAT32, 5);
+    for (size_t i = 0; i < array.size(); i++) array.set(i, static_cast<double>(i) + 0.25);
+    Value decoded = roundTrip(Value(array));
+    WHOLF_CHECK(decoded.type == DataType::TYPED_ARRAY);
+    const auto& copy = std::get<TypedArray>(decoded.data);
+    WHOLF_CHECK(copy.type() == ElementType::FLOAT32 && copy.size() == 5 && copy.get(4) == 4.25);
+    WHOLF_CHECK(!copy.sharesBuffer(array));
+
+    // Eleman sayısı gövdeyi aşarsa reddedilir
+    std::string encoded;
+    Codec::encode(encoded, Value(array));
+    encoded.resize(encoded.size() - 1);
+    const char* cursor = encoded.data();
+    WHOLF_CHECK_THROWS(Codec::decode(cursor, encoded.data() + encoded.size()), std::runtime_error);
+}
+
+WHOLF_TEST("codec/rejects-deep-nesting") {
+    Value value(std::vector<Value>{});
+    for (size_t i = 0; i < Codec::MAX_DEPTH + 1; i++) value = Value(std::vector<Value>{value});
+    WHOLF_CHECK_THROWS(roundTrip(value), std::runtime_error);
+
+    value = Value(std::vector<Value>{});
+    for (size_t i = 0; i + 1 < Codec::MAX_DEPTH; i++) value = Value(std::vector<Value>{value});
+    WHOLF_CHECK(roundTrip(value).type == DataType::ARRAY);
+}
+
+WHOLF_TEST("server/evaluate-and-pipeline") {
+    LoopbackServer loopback("pipeline", 2);
+    Client client(loopback.path);
+    client.registerScript(1, "args");
+    client.registerScript(2, "let i = 0; while (i < 200000) { i = i + 1; } i");
+    Value echoed = client.evaluate(1, Value(std::vector<Value>{Value(7)}));
+    WHOLF_CHECK(std::get<int>(std::get<std::vector<Value>>(echoed.data)[0].data) == 7);
+
+    // Yavaş istek önce gönderilir; hızlı olanın yanıtı önce gelebilir, eşleme numarayla yapılır
+    uint32_t slow = client.send(2, Value(std::vector<Value>{}));
+    uint32_t fast = client.send(1, Value(std::vector<Value>{Value(1)}));
+    WHOLF_CHECK(std::get<std::vector<Value>>(client.wait(fast).data).size() == 1);
+    WHOLF_CHECK(std::get<int>(client.wait(slow).data) == 200000);
+
+    uint32_t missing = client.send(99, Value(std::vector<Value>{}));
+    try {
+        client.wait(missing);
+        WHOLF_CHECK(false);
+    } catch (const RemoteError& error) {
+        WHOLF_CHECK(error.requestId == missing);
+    }
+}
+
+WHOLF_TEST("server/requests-do-not-leak-globals") {
+    LoopbackServer loopback("isolation", 1);
+    Client client(loopback.path);
+    client.registerScript(1, "let seen = 1; function helper() { return 2; } helper()");
+    client.registerScript(2, "seen");
+    client.registerScript(3, "helper()");
+    client.registerScript(4, "args");
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{Value(5)})).data) == 2);
+    // Tek worker: aynı interpreter, ama önceki isteğin tanımları geri alındı
+    WHOLF_CHECK(client.evaluate(2, Value(std::vector<Value>{})).type == DataType::NULL_TYPE);
+    WHOLF_CHECK_THROWS(client.evaluate(3, Value(std::vector<Value>{})), RemoteError);
+    WHOLF_CHECK(std::get<std::vector<Value>>(client.evaluate(4, Value(std::vector<Value>{})).data).empty());
+}
+
+WHOLF_TEST("server/rejects-unknown-frame-type") {
+    LoopbackServer loopback("unknown", 1);
+    int fd = rawConnect(loopback.path);
+    writeAll(fd, Codec::frame(static_cast<FrameType>(42), 7, 1, std::string()));
+    char reply[64];
+    ssize_t count = ::read(fd, reply, sizeof(reply));
+    ::close(fd);
+    WHOLF_CHECK(count > static_cast<ssize_t>(Wholf::Server::FRAME_PREFIX));
+    WHOLF_CHECK(static_cast<FrameType>(reply[Wholf::Server::FRAME_PREFIX]) == FrameType::ERROR);
+    WHOLF_CHECK(loopback.server->metrics().failed.load() == 1);
+}
+
+WHOLF_TEST("server/client-closing-mid-pipeline") {
+    LoopbackServer loopback("close", 2);
+    {
+        Client setup(loopback.path);
+        setup.registerScript(1, "let i = 0; while (i < 20000) { i = i + 1; } i");
+    }
+    // Yanıtlar yazılırken bağlantısı kapanan istemciler sunucuyu düşürmemeli
+    for (int round = 0; round < 20; round++) {
+        int fd = rawConnect(loopback.path);
+        std::string burst;
+        for (uint32_t id = 1; id <= 16; id++) burst += Codec::frame(FrameType::EVALUATE, id, 1, std::string());
+        writeAll(fd, burst);
+        ::close(fd);
+    }
+    Client client(loopback.path);
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 20000);
+}
+
+WHOLF_TEST("server/drains-frames-after-half-close") {
+    LoopbackServer loopback("half-close", 1);
+    {
+        Client setup(loopback.path);
+        setup.registerScript(1, "args");
+    }
+    int fd = rawConnect(loopback.path);
+    std::string burst;
+    for (uint32_t id = 1; id <= 8; id++) {
+        std::string body;
+        Codec::encode(body, Value(std::vector<Value>{Value(static_cast<int>(id))}));
+        burst += Codec::frame(FrameType::EVALUATE, id, 1, body);
+    }
+    writeAll(fd, burst);
+    // Yazma yönü kapanır; sunucu tamponlanmış çerçevelerin hepsini yanıtlayıp sonra kapatır
+    ::shutdown(fd, SHUT_WR);
+    std::string replies;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = ::read(fd, buffer, sizeof(buffer))) > 0) replies.append(buffer, static_cast<size_t>(count));
+    ::close(fd);
+    size_t frames = 0;
+    for (size_t offset = 0; offset + Wholf::Server::FRAME_PREFIX <= replies.size(); frames++) {
+        uint32_t length;
+        std::memcpy(&length, replies.data() + offset, sizeof(length));
+        WHOLF_CHECK(static_cast<FrameType>(replies[offset + Wholf::Server::FRAME_PREFIX]) == FrameType::RESULT);
+        offset += Wholf::Server::FRAME_PREFIX + length;
+    }
+    WHOLF_CHECK(frames == 8);
+}
+
+WHOLF_TEST("server/backpressure-bounds-queue") {
+    ScriptServer::Options options;
+    options.maxQueuedJobs = 4;
+    options.maxPendingPerConnection = 3;
+    LoopbackServer loopback("backpressure", 1, options);
+    Client setup(loopback.path);
+    setup.registerScript(1, "let i = 0; while (i < 2000) { i = i + 1; } i");
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> deepest{0};
+    std::thread sampler([&]() {
+        while (!done.load()) {
+            uint64_t depth = loopback.server->metrics().queueDepth.load();
+            if (depth > deepest.load()) deepest.store(depth);
+            std::this_thread::yield();
+        }
+    });
+    std::vector<std::unique_ptr<Client>> clients;
+    for (int c = 0; c < 3; c++) clients.push_back(std::make_unique<Client>(loopback.path));
+    std::vector<std::vector<uint32_t>> sent(clients.size());
+    for (int request = 0; request < 40; request++) {
+        for (size_t c = 0; c < clients.size(); c++) sent[c].push_back(clients[c]->send(1, Value(std::vector<Value>{})));
+    }
+    for (size_t c = 0; c < clients.size(); c++) {
+        for (uint32_t id : sent[c]) WHOLF_CHECK(std::get<int>(clients[c]->wait(id).data) == 2000);
+    }
+    done = true;
+    sampler.join();
+    WHOLF_CHECK(deepest.load() <= 4);
+    WHOLF_CHECK(loopback.server->metrics().completed.load() == 120);
+}
+
+WHOLF_TEST("server/reregistered-script-is-reparsed") {
+    LoopbackServer loopback("reparse", 1);
+    Client client(loopback.path);
+    client.registerScript(1, "1 + 1");
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 2);
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 2);
+    client.registerScript(1, "function f() { return 3; } f()");
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 3);
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 3);
+    client.registerScript(2, "let = ;");
+    WHOLF_CHECK_THROWS(client.evaluate(2, Value(std::vector<Value>{})), RemoteError);
+}
+
+WHOLF_TEST("server/runaway-script-hits-default-budget") {
+    LoopbackServer loopback("budget", 1);
+    Client client(loopback.path);
+    client.registerScript(1, "while (true) { }");
+    client.registerScript(2, "7");
+    WHOLF_CHECK_THROWS(client.evaluate(1, Value(std::vector<Value>{})), RemoteError);
+    WHOLF_CHECK(std::get<int>(client.evaluate(2, Value(std::vector<Value>{})).data) == 7);
+}
+
+WHOLF_TEST("server/start-errors-are-reported") {
+    // Worker hazırlığındaki hata start()'tan fırlar, soket yolu bırakılmaz
+    ScriptServer::Options options;
+    options.socketPath = LoopbackServer::socketPath("setup");
+    options.setup = [](Wholf::Interpreter&) { throw std::runtime_error("setup failed"); };
+    WHOLF_CHECK_THROWS(ScriptServer(options).start(), std::runtime_error);
+    WHOLF_CHECK(!std::filesystem::exists(options.socketPath));
+
+    // Soket olmayan dosya silinmez
+    options.setup = nullptr;
+    options.socketPath = LoopbackServer::socketPath("regular");
+    std::ofstream(options.socketPath) << "veri";
+    WHOLF_CHECK_THROWS(ScriptServer(options).start(), std::runtime_error);
+    WHOLF_CHECK(std::filesystem::is_regular_file(options.socketPath));
+    std::filesystem::remove(options.socketPath);
+
+    // Çalışan sunucunun soketi devralınmaz
+    LoopbackServer running("busy", 1);
+    options.socketPath = running.path;
+    WHOLF_CHECK_THROWS(ScriptServer(options).start(), std::runtime_error);
+    Client client(running.path);
+    client.registerScript(1, "5");
+    WHOLF_CHECK(std::get<int>(client.evaluate(1, Value(std::vector<Value>{})).data) == 5);
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,204 @@
+// Snapshot: globallerin yazılıp eşlenmiş dosyadan geri yüklenmesi
+
+#include "check.hpp"
+
+#include <unistd.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "interpreter/WholfInterpreter.hpp"
+
+namespace {
+    using Wholf::DataType;
+    using Wholf::ElementType;
+    using Wholf::Interpreter;
+    using Wholf::TypedArray;
+    using Wholf::Value;
+
+    std::string temporaryPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("wholf_snapshot_test_" + std::to_string(::getpid()) + "_" + name)).string();
+    }
+
+    // Dosyadaki index numaralı kaydın alanlarını değiştir
+    void patchRecord(const std::string& path, uint64_t index, uint32_t type, uint64_t first, uint64_t second) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        Wholf::SnapshotFormat::Header header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        Wholf::SnapshotFormat::Record record{type, 0, first, second};
+        file.seekp(static_cast<std::streamoff>(header.recordsOffset + index * sizeof(record)));
+        file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+
+    std::string nativeGreeting(std::string name) { return "selam " + name; }
+
+    bool loads(const std::string& path) {
+        Value value(nullptr);
+        try {
+            Wholf::SnapshotImage::open(path)->load("deger", value);
+            return true;
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+    }
+}
+
+WHOLF_TEST("snapshot/round-trip") {
+    std::string path = temporaryPath("round-trip.snap");
+    {
+        Interpreter prelude;
+        prelude.interpret("let sayi = 42; let metin = \"merhaba\"; let kesir = 1 / 4;");
+        std::map<std::string, Value> config;
+        config.emplace("liste", Value(std::vector<Value>{Value(1), Value(true), Value(nullptr)}));
+        config.emplace("ad", Value(std::string("wholf")));
+        prelude.setGlobal("ayar", Value(config));
+        WHOLF_CHECK(prelude.saveSnapshot(path).empty());
+    }
+    Interpreter interpreter;
+    interpreter.restoreSnapshot(path);
+    WHOLF_CHECK(std::get<int>(interpreter.interpret("sayi + 1").data) == 43);
+    WHOLF_CHECK(std::string(interpreter.interpret("metin").text()) == "merhaba");
+    WHOLF_CHECK(std::get<float>(interpreter.interpret("kesir").data) == 0.25f);
+    Value config(nullptr);
+    WHOLF_CHECK(interpreter.getGlobal("ayar", config));
+    const auto& fields = std::get<std::map<std::string, Value>>(config.data);
+    WHOLF_CHECK(std::string(fields.at("ad").text()) == "wholf");
+    WHOLF_CHECK(std::get<std::vector<Value>>(fields.at("liste").data).size() == 3);
+    std::remove(path.c_str());
+}
+
+WHOLF_TEST("snapshot/typed-arrays") {
+    std::string path = temporaryPath("typed.snap");
+    {
+        Interpreter prelude;
+        TypedArray doubles(ElementType::FLOAT64, 1000);
+        TypedArray integers(ElementType::INT32, 3);
+        for (size_t i = 0; i < doubles.size(); i++) doubles.set(i, static_cast<double>(i) * 0.5);
+        integers.set(0, -7);
+        integers.set(2, 1e12);
+        prelude.setGlobal("agirliklar", Value(doubles));
+        prelude.setGlobal("sayilar", Value(integers));
+        prelude.setGlobal("bos", Value(TypedArray(ElementType::FLOAT32, 0)));
+        prelude.setGlobal("icinde", Value(std::vector<Value>{Value(integers)}));
+        WHOLF_CHECK(prelude.saveSnapshot(path).empty());
+    }
+    Interpreter interpreter;
+    interpreter.restoreSnapshot(path);
+    Value value(nullptr);
+    WHOLF_CHECK(interpreter.getGlobal("agirliklar", value) && value.type == DataType::TYPED_ARRAY);
+    const auto& doubles = std::get<TypedArray>(value.data);
+    WHOLF_CHECK(doubles.type() == ElementType::FLOAT64 && doubles.size() == 1000);
+    WHOLF_CHECK(doubles.get(999) == 499.5);
+
+    WHOLF_CHECK(interpreter.getGlobal("sayilar", value));
+    const auto& integers = std::get<TypedArray>(value.data);
+    WHOLF_CHECK(integers.type() == ElementType::INT32 && integers.get(0) == -7 && integers.get(2) == 2147483647);
+
+    WHOLF_CHECK(interpreter.getGlobal("bos", value));
+    WHOLF_CHECK(std::get<TypedArray>(value.data).type() == ElementType::FLOAT32 && std::get<TypedArray>(value.data).size() == 0);
+
+    WHOLF_CHECK(interpreter.getGlobal("icinde", value));
+    WHOLF_CHECK(std::get<std::vector<Value>>(value.data)[0].type == DataType::TYPED_ARRAY);
+    std::remove(path.c_str());
+}
+
+WHOLF_TEST("snapshot/functions-are-reported-as-skipped") {
+    std::string path = temporaryPath("skipped.snap");
+    Interpreter prelude;
+    prelude.setGlobal("geriCagirma", Value(std::function<Value()>([]() { return Value(1); })));
+    prelude.setGlobal("sayi", Value(1));
+    auto skipped = prelude.saveSnapshot(path);
+    WHOLF_CHECK(skipped.size() == 1 && skipped[0] == "geriCagirma");
+    std::remove(path.c_str());
+}
+
+WHOLF_TEST("snapshot/script-functions") {
+    std::string path = temporaryPath("functions.snap");
+    std::string copy = temporaryPath("functions-copy.snap");
+    {
+        Interpreter prelude;
+        prelude.interpret("function kare(n) { return n * n; }\n"
+                          "function selam(ad) { return \"merhaba\\t\" + ad; }\n"
+                          "function toplamKare(a, b) { return kare(a) + kare(b); }\n"
+                          "let taban = 3;");
+        WHOLF_CHECK(prelude.saveSnapshot(path).empty());
+    }
+    {
+        Interpreter interpreter;
+        interpreter.restoreSnapshot(path);
+        WHOLF_CHECK(std::get<int>(interpreter.interpret("toplamKare(taban, 4)").data) == 25);
+        WHOLF_CHECK(std::string(interpreter.interpret("selam(\"wholf\")").text()) == "merhaba\twholf");
+        // Çağrılmamış snapshot fonksiyonları da yeni snapshot'a taşınır; yerel isimle çakışamaz
+        WHOLF_CHECK(interpreter.saveSnapshot(copy).empty());
+    }
+    Interpreter interpreter;
+    interpreter.restoreSnapshot(copy);
+    WHOLF_CHECK(std::get<int>(interpreter.interpret("kare(9)").data) == 81);
+    WHOLF_CHECK_THROWS(interpreter.bind("selam", &nativeGreeting), std::runtime_error);
+    std::remove(path.c_str());
+    std::remove(copy.c_str());
+}
+
+WHOLF_TEST("snapshot/strings-reference-the-image") {
+    std::string path = temporaryPath("strings.snap");
+    {
+        Interpreter prelude;
+        prelude.interpret("let metin = \"eşlenmiş sayfada kalır\";");
+        prelude.saveSnapshot(path);
+    }
+    Value text(nullptr);
+    {
+        Interpreter interpreter;
+        interpreter.restoreSnapshot(path);
+        WHOLF_CHECK(interpreter.getGlobal("metin", text));
+        WHOLF_CHECK(std::holds_alternative<Wholf::StringRef>(text.data));
+        WHOLF_CHECK(std::string(interpreter.interpret("metin + \"!\"").text()) == "eşlenmiş sayfada kalır!");
+    }
+    // Eşleme, interpreter yıkıldıktan sonra da değer yaşadıkça açık kalır
+    std::remove(path.c_str());
+    WHOLF_CHECK(text.text() == "eşlenmiş sayfada kalır");
+}
+
+WHOLF_TEST("snapshot/corrupt-records-are-rejected") {
+    std::string path = temporaryPath("corrupt.snap");
+    auto save = [&](Value value) {
+        Interpreter prelude;
+        prelude.setGlobal("deger", value);
+        prelude.saveSnapshot(path);
+    };
+    auto array = static_cast<uint32_t>(DataType::ARRAY);
+    auto object = static_cast<uint32_t>(DataType::OBJECT);
+    // Kayıt 0 globalin kendisi, 1 ve 2 elemanları
+    save(Value(std::vector<Value>{Value(1), Value(2)}));
+    WHOLF_CHECK(loads(path));
+    patchRecord(path, 0, array, 1, uint64_t(1) << 40);
+    WHOLF_CHECK(!loads(path));
+    patchRecord(path, 0, array, 2, 2);
+    WHOLF_CHECK(!loads(path));
+    patchRecord(path, 0, array, ~uint64_t(0), 2);
+    WHOLF_CHECK(!loads(path));
+    // Kendine işaret eden dizi sonsuz özyineleme yerine reddedilir
+    patchRecord(path, 0, array, 0, 1);
+    WHOLF_CHECK(!loads(path));
+
+    std::map<std::string, Value> fields;
+    fields.emplace("a", Value(1));
+    save(Value(fields));
+    WHOLF_CHECK(loads(path));
+    patchRecord(path, 0, object, 1, 2);
+    WHOLF_CHECK(!loads(path));
+    patchRecord(path, 0, object, 1, ~uint64_t(0) / 2 + 1);
+    WHOLF_CHECK(!loads(path));
+    // Anahtar kaydı string değil
+    patchRecord(path, 0, object, 1, 1);
+    patchRecord(path, 1, array, 0, 0);
+    WHOLF_CHECK(!loads(path));
+
+    Value nested(nullptr);
+    for (size_t i = 0; i <= Wholf::SnapshotFormat::MAX_DEPTH + 1; i++) nested = Value(std::vector<Value>{nested});
+    WHOLF_CHECK_THROWS(save(nested), std::runtime_error);
+    std::remove(path.c_str());
+}
+
+WHOLF_TEST_MAIN()
@@ -0,0 +1,122 @@
+// Fegn::Stream: sıralı aşamalar, sıra penceresi ve hata sonrası durma
+
+#include "check.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "runtime/stream.hpp"
+
+namespace {
+    using Wholf::Fegn::Batch;
+    using Wholf::Fegn::Record;
+    using Wholf::Fegn::StageOptions;
+    using Wholf::Fegn::Stream;
+
+    std::vector<Record> numbers(int count) {
+        std::vector<Record> records;
+        for (int i = 0; i < count; i++) records.emplace_back(std::to_string(i));
+        return records;
+    }
+}
+
+WHOLF_TEST("stream/ordered-stage-keeps-sequence") {
+    // Paralel thread'ler partileri karışık sırayla bitirir; çıktı yine giriş sırasında olmalı
+    StageOptions options;
+    options.parallelism = 4;
+    std::vector<int> seen;
+    Stream stream;
+    stream.fromRecords(numbers(400), 1)
+        .stage([](Batch& batch) {
+            int value = std::stoi(batch.front().str());
+            std::this_thread::sleep_for(std::chrono::microseconds((value * 7919) % 200));
+        }, options)
+        .pipe([&](const Batch& batch) {
+            for (const auto& record : batch) seen.push_back(std::stoi(record.str()));
+        });
+    auto stats = stream.run();
+    WHOLF_CHECK(stats.records == 400);
+    WHOLF_CHECK(seen.size() == 400);
+    bool inOrder = true;
+    for (size_t i = 0; i < seen.size(); i++) inOrder = inOrder && seen[i] == static_cast<int>(i);
+    WHOLF_CHECK(inOrder);
+}
+
+WHOLF_TEST("stream/ordered-stage-bounds-work-ahead") {
+    // İlk parti yavaşken diğer thread'ler en fazla queueCapacity - 1 parti ileri gidebilir;
+    // eskiden tüm girdi işlenip reorder'da birikirdi
+    StageOptions options;
+    options.parallelism = 4;
+    options.queueCapacity = 3;
+    std::atomic<bool> slow{false};
+    std::atomic<int> processed{0};
+    int ahead = 0;
+    std::vector<int> seen;
+    Stream stream;
+    stream.fromRecords(numbers(200), 1)
+        .stage([&](Batch& batch) {
+            if (batch.front().str() == "0") {
+                slow = true;
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                ahead = processed.load();
+            }
+            processed++;
+        }, options)
+        .pipe([&](const Batch& batch) { seen.push_back(std::stoi(batch.front().str())); });
+    stream.run();
+    WHOLF_CHECK(slow);
+    WHOLF_CHECK(ahead <= 2);
+    WHOLF_CHECK(seen.size() == 200);
+    bool inOrder = true;
+    for (size_t i = 0; i < seen.size(); i++) inOrder = inOrder && seen[i] == static_cast<int>(i);
+    WHOLF_CHECK(inOrder);
+}
+
+WHOLF_TEST("stream/ordered-stage-error-releases-waiting-workers") {
+    // Sıradaki parti hata verince pencerede bekleyen thread'ler kilitlenmemeli
+    StageOptions options;
+    options.parallelism = 4;
+    options.queueCapacity = 2;
+    Stream stream;
+    stream.fromRecords(numbers(100), 1)
+        .stage([](Batch& batch) {
+            if (batch.front().str() == "0") {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                throw std::runtime_error("stage failed");
+            }
+        }, options);
+    WHOLF_CHECK_THROWS(stream.run(), std::runtime_error);
+}
+
+WHOLF_TEST("stream/failing-sink-is-not-called-again") {
+    size_t calls = 0;
+    Stream stream;
+    stream.fromRecords(numbers(1000), 1).pipe([&](const Batch&) {
+        // Bu sırada hedef kuyruğu dolar
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        calls++;
+        throw std::runtime_error("sink failed");
+    });
+    WHOLF_CHECK_THROWS(stream.run(), std::runtime_error);
+    WHOLF_CHECK(calls == 1);
+}
+
+WHOLF_TEST("stream/stage-error-stops-delivery") {
+    std::vector<int> seen;
+    Stream stream;
+    stream.fromRecords(numbers(1000), 1)
+        .stage([](Batch& batch) {
+            if (batch.front().str() == "5") throw std::runtime_error("stage failed");
+        })
+        .pipe([&](const Batch& batch) { seen.push_back(std::stoi(batch.front().str())); });
+    WHOLF_CHECK_THROWS(stream.run(), std::runtime_error);
+    bool before = true;
+    for (int value : seen) before = before && value < 5;
+    WHOLF_CHECK(before);
+}
+
+WHOLF_TEST_MAIN()
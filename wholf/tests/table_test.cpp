@@ -0,0 +1,147 @@
+// Tablo okuyucu: tırnaklı alanlar, gömülü ayırıcı/satır sonu ve eksik/fazla alanlı satırlar; SSE2 ve skaler yol
+
+#include "check.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "runtime/table.hpp"
+
+namespace {
+    using Wholf::Table::ColumnType;
+    using Wholf::Table::Table;
+
+    // Her test iki tarama yoluyla da çalışır
+    const bool PATHS[] = {true, false};
+
+    Table parse(const std::string& text, bool vectorized, size_t threads = 1, char delimiter = ',') {
+        Table::Options options;
+        options.vectorized = vectorized;
+        options.threads = threads;
+        options.delimiter = delimiter;
+        return Table::parse(text, options);
+    }
+
+    std::string quote(const std::string& value) {
+        std::string result = "\"";
+        for (char c : value) {
+            if (c == '"') result += '"';
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    // Ayırıcı, tırnak ve satır sonu içeren, 64 baytlık blok sınırlarına denk gelen alanlar
+    std::string awkward(size_t row) {
+        std::string value(row % 97, static_cast<char>('a' + row % 26));
+        if (row % 3 == 0) value += ",virgul";
+        if (row % 5 == 0) value += "\n";
+        if (row % 7 == 0) value += "\"\"";
+        if (row % 11 == 0) value += "\r\nson";
+        return value;
+    }
+}
+
+WHOLF_TEST("table/quoted-fields") {
+    const std::string text =
+        "ad,not,adet\n"
+        "\"Ali, Veli\",\"iki\nsatir\",1\n"
+        "\"\"\"tirnak\"\"\",\"\",2\n"
+        "duz,,3\n";
+    for (bool vectorized : PATHS) {
+        Table table = parse(text, vectorized);
+        WHOLF_CHECK(table.rowCount() == 3);
+        const auto& name = table.column("ad");
+        const auto& note = table.column("not");
+        WHOLF_CHECK(name.string(0) == "Ali, Veli");
+        WHOLF_CHECK(note.string(0) == "iki\nsatir");
+        WHOLF_CHECK(name.string(1) == "\"tirnak\"");
+        // Tırnaklı boş alan boş dizedir, tırnaksız boş alan boş değer
+        WHOLF_CHECK(!note.isNull(1) && note.string(1).empty());
+        WHOLF_CHECK(note.isNull(2));
+        WHOLF_CHECK(table.column("adet").type == ColumnType::INTEGER);
+        WHOLF_CHECK(table.column("adet").integerSum() == 6);
+    }
+}
+
+WHOLF_TEST("table/crlf-and-unterminated-last-record") {
+    for (bool vectorized : PATHS) {
+        Table table = parse("a\tb\r\n1\t\"x\r\ny\"\r\n2\tz", vectorized, 1, '\t');
+        WHOLF_CHECK(table.rowCount() == 2);
+        WHOLF_CHECK(table.column("b").string(0) == "x\r\ny");
+        WHOLF_CHECK(table.column("b").string(1) == "z");
+        WHOLF_CHECK(table.column("a").integerSum() == 3);
+    }
+}
+
+WHOLF_TEST("table/ragged-rows") {
+    for (bool vectorized : PATHS) {
+        // Eksik alanlar boştur; boş satırlar atlanır
+        Table table = parse("a,b,c\n1,x,2.5\n2\n\n3,y\n", vectorized);
+        WHOLF_CHECK(table.rowCount() == 3);
+        WHOLF_CHECK(table.column("b").isNull(1) && table.column("b").string(2) == "y");
+        WHOLF_CHECK(table.column("c").nullCount() == 2);
+        WHOLF_CHECK(table.column("c").type == ColumnType::FLOAT);
+        WHOLF_CHECK(table.column("a").integerSum() == 6);
+
+        // Başlıktan fazla alan hatadır; tırnak içindeki ayırıcı alan sayılmaz
+        WHOLF_CHECK_THROWS(parse("a,b\n1,2,3\n", vectorized), std::runtime_error);
+        WHOLF_CHECK(parse("a,b\n1,\"2,3\"\n", vectorized).column("b").string(0) == "2,3");
+    }
+}
+
+WHOLF_TEST("table/block-boundaries-match-reference") {
+    // Her satır farklı uzunlukta: tırnaklar ve ayırıcılar 64 baytlık blokların her konumuna düşer
+    std::string text = "id,metin,deger\n";
+    const size_t rows = 600;
+    for (size_t row = 0; row < rows; row++) {
+        text += std::to_string(row) + "," + quote(awkward(row)) + "," + std::to_string(row * 3) + "\n";
+    }
+    for (bool vectorized : PATHS) {
+        Table table = parse(text, vectorized);
+        WHOLF_CHECK(table.rowCount() == rows);
+        bool same = true;
+        for (size_t row = 0; row < rows && row < table.rowCount(); row++) {
+            same = same && table.column("id").integers()[row] == static_cast<int64_t>(row);
+            same = same && table.column("metin").string(row) == awkward(row);
+            same = same && table.column("deger").integers()[row] == static_cast<int64_t>(row * 3);
+        }
+        WHOLF_CHECK(same);
+    }
+}
+
+WHOLF_TEST("table/parallel-chunks-match-single-thread") {
+    // Parça sınırları tırnak paritesiyle bulunur: satır sonu içeren alanlar parçalara bölünmemeli
+    std::string text = "id,metin\n";
+    size_t rows = 0;
+    while (text.size() < 600 * 1024) {
+        text += std::to_string(rows) + "," + quote(awkward(rows)) + "\n";
+        rows++;
+    }
+    for (bool vectorized : PATHS) {
+        Table single = parse(text, vectorized, 1);
+        Table parallel = parse(text, vectorized, 4);
+        WHOLF_CHECK(single.rowCount() == rows);
+        WHOLF_CHECK(parallel.rowCount() == rows);
+        bool same = true;
+        for (size_t row = 0; row < rows && row < parallel.rowCount(); row++) {
+            same = same && parallel.column("id").integers()[row] == static_cast<int64_t>(row);
+            same = same && parallel.column("metin").string(row) == awkward(row);
+        }
+        WHOLF_CHECK(same);
+    }
+}
+
+WHOLF_TEST("table/quote-handling-disabled") {
+    for (bool vectorized : PATHS) {
+        Table::Options options;
+        options.vectorized = vectorized;
+        options.quote = 0;
+        Table table = Table::parse("a,b\n\"x,y\"\n", options);
+        WHOLF_CHECK(table.column("a").string(0) == "\"x");
+        WHOLF_CHECK(table.column("b").string(0) == "y\"");
+    }
+}
+
+WHOLF_TEST_MAIN()
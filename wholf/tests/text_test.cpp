@@ -0,0 +1,152 @@
+// Metin: SIMD arama ve harf dönüşümü ile StdLib::String; ASCII olmayan girdi, boş metin ve blok/satır içi sınırları
+
+#include "check.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "runtime/stdlib.hpp"
+
+namespace {
+    using Wholf::StdLib::String;
+    namespace Text = Wholf::Text;
+
+    std::string convert(std::string_view text, bool upper) {
+        std::string out(text.size(), '\0');
+        out.resize(Text::convertCase(text.data(), text.size(), &out[0], upper));
+        return out;
+    }
+
+    // Referans: her kod noktası ayrı dönüştürülür (16 bayttan kısa girdi hep skaler yoldan gider)
+    std::string convertEach(std::string_view text, bool upper) {
+        std::string out;
+        for (size_t i = 0; i < text.size();) {
+            unsigned char lead = static_cast<unsigned char>(text[i]);
+            size_t length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+            size_t end = i + 1;
+            while (end < i + length && end < text.size() && (static_cast<unsigned char>(text[end]) & 0xC0) == 0x80) end++;
+            out += convert(text.substr(i, end - i), upper);
+            i = end;
+        }
+        return out;
+    }
+
+    std::vector<std::string> parts(const String& text, std::string_view delimiter) {
+        std::vector<std::string> result;
+        for (const String& part : text.split(delimiter)) result.push_back(part.str());
+        return result;
+    }
+}
+
+WHOLF_TEST("text/find-matches-reference") {
+    // Küçük alfabe çok aday üretir; ASCII olmayan baytlar işaretli karşılaştırmaları zorlar
+    const char alphabet[] = {'a', 'b', '\xC5', '\x9F'};
+    uint32_t state = 12345;
+    auto next = [&]() {
+        state = state * 1103515245u + 12345u;
+        return state >> 16;
+    };
+    bool same = true;
+    for (size_t size = 0; size <= 70; size++) {
+        std::string haystack;
+        for (size_t i = 0; i < size; i++) haystack += alphabet[next() % 4];
+        for (size_t length = 0; length <= 20; length++) {
+            // İğne çoğunlukla samanlığın bir parçası, özellikle sonu: son bloğun sınırı
+            std::string needle;
+            if (length <= size && next() % 2) needle = haystack.substr(size - length);
+            else for (size_t i = 0; i < length; i++) needle += alphabet[next() % 4];
+            for (size_t from = 0; from <= size + 1; from++) {
+                same = same && Text::find(haystack, needle, from) == std::string_view(haystack).find(needle, from);
+            }
+        }
+    }
+    WHOLF_CHECK(same);
+}
+
+WHOLF_TEST("text/case-conversion-non-ascii") {
+    WHOLF_CHECK(convert("ığüşöç İĞÜŞÖÇ", true) == "IĞÜŞÖÇ İĞÜŞÖÇ");
+    WHOLF_CHECK(convert("IĞÜŞÖÇ İĞÜŞÖÇ", false) == "iğüşöç iğüşöç");
+    WHOLF_CHECK(convert("straße ÿ", true) == "STRAßE Ÿ");
+    // Kapsam dışı diziler ve geçersiz/yarım baytlar olduğu gibi kalır
+    WHOLF_CHECK(convert("Ωmega 🙂 \xFF \xC5", true) == "ΩMEGA 🙂 \xFF \xC5");
+    WHOLF_CHECK(convert("", true).empty());
+}
+
+WHOLF_TEST("text/case-conversion-across-block-boundaries") {
+    // Çok baytlı dizi 16'lık bloğun her konumuna (ve sınırın üstüne) düşer
+    const std::string samples[] = {"ş", "İ", "ı", "🙂", "\xC5", "€"};
+    bool same = true;
+    for (const auto& sample : samples) {
+        for (size_t prefix = 0; prefix <= 40; prefix++) {
+            for (size_t suffix : {0, 1, 15, 16, 17}) {
+                std::string text = std::string(prefix, 'q') + sample + std::string(suffix, 'Z') + sample;
+                same = same && convert(text, true) == convertEach(text, true);
+                same = same && convert(text, false) == convertEach(text, false);
+            }
+        }
+    }
+    WHOLF_CHECK(same);
+}
+
+WHOLF_TEST("string/empty") {
+    String empty;
+    WHOLF_CHECK(empty.empty() && empty.length() == 0 && empty.isInline());
+    WHOLF_CHECK(empty == "" && empty == String(""));
+    WHOLF_CHECK(empty == String::intern(""));
+    WHOLF_CHECK(empty.substring(-5, 5).empty());
+    WHOLF_CHECK(empty.find("") == 0 && empty.find("a") == String::npos && empty.find("", 1) == String::npos);
+    WHOLF_CHECK(empty.startsWith("") && empty.endsWith("") && !empty.startsWith("a"));
+    WHOLF_CHECK(empty.toUpperCase().empty());
+    WHOLF_CHECK((empty + "").empty());
+    WHOLF_CHECK(parts(empty, "").empty());
+    WHOLF_CHECK(parts(empty, ",") == std::vector<std::string>{""});
+    WHOLF_CHECK(parts(String(",,"), ",") == std::vector<std::string>({"", "", ""}));
+}
+
+WHOLF_TEST("string/inline-boundary") {
+    const std::string base = "abcdefghijklmnopqrstuvwxyz";
+    for (size_t size : {String::INLINE_CAPACITY - 1, String::INLINE_CAPACITY, String::INLINE_CAPACITY + 1}) {
+        String text(base.substr(0, size));
+        WHOLF_CHECK(text.isInline() == (size <= String::INLINE_CAPACITY));
+        WHOLF_CHECK(text.size() == size && text == base.substr(0, size));
+        // Kopya ve taşıma her biçimde içeriği korur
+        String copy = text;
+        String moved = std::move(copy);
+        WHOLF_CHECK(moved == text && copy.empty());
+        WHOLF_CHECK(text.toUpperCase() == convert(base.substr(0, size), true));
+    }
+
+    // Satır içi sığan dilimler kopyalanır, büyükleri tamponu paylaşır
+    String large(base);
+    String small = large.substring(0, static_cast<int>(String::INLINE_CAPACITY));
+    String shared = large.substring(0, static_cast<int>(String::INLINE_CAPACITY + 1));
+    WHOLF_CHECK(small.isInline() && !small.sharesBuffer(large));
+    WHOLF_CHECK(shared.sharesBuffer(large) && shared == base.substr(0, String::INLINE_CAPACITY + 1));
+
+    // 23 baytlık girdi İ -> i ile 22 bayta kısalır
+    String shrinking("İ" + std::string(String::INLINE_CAPACITY - 1, 'A'));
+    WHOLF_CHECK(shrinking.size() == String::INLINE_CAPACITY + 1);
+    String lowered = shrinking.toLowerCase();
+    WHOLF_CHECK(lowered.size() == String::INLINE_CAPACITY && lowered == "i" + std::string(String::INLINE_CAPACITY - 1, 'a'));
+}
+
+WHOLF_TEST("string/non-ascii") {
+    String text("aşı🙂b");
+    // Uzunluk ve konumlar bayt cinsinden
+    WHOLF_CHECK(text.length() == 10);
+    WHOLF_CHECK(text.find("ı") == 3 && text.find("🙂") == 5);
+    WHOLF_CHECK(parts(text, "") == std::vector<std::string>({"a", "ş", "ı", "🙂", "b"}));
+    WHOLF_CHECK(parts(text, "ı") == std::vector<std::string>({"aş", "🙂b"}));
+    WHOLF_CHECK(text.toUpperCase() == "AŞI🙂B");
+    WHOLF_CHECK(text.startsWith("aş") && text.endsWith("🙂b"));
+    // Yarım kalan dizi boş ayırıcıyla tek parça olarak verilir
+    WHOLF_CHECK(parts(String("a\xF0\x9F"), "") == std::vector<std::string>({"a", "\xF0\x9F"}));
+
+    String interned = String::intern("ğüşiöç");
+    WHOLF_CHECK(interned.isInterned() && interned == String::intern(std::string("ğüşiöç")));
+    WHOLF_CHECK(interned.data() == String::intern("ğüşiöç").data());
+    WHOLF_CHECK(interned.toUpperCase() == "ĞÜŞIÖÇ");
+}
+
+WHOLF_TEST_MAIN()
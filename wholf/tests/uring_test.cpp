@@ -0,0 +1,101 @@
+// Uring::Ring: ham io_uring halkası; çekirdek io_uring'e izin vermiyorsa testler atlanır
+
+#include "check.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "runtime/uring.hpp"
+
+namespace {
+    using Wholf::Uring::Ring;
+
+    std::unique_ptr<Ring> openRing(unsigned entries) {
+        try {
+            return std::make_unique<Ring>(entries);
+        } catch (const std::runtime_error& error) {
+            std::printf("io_uring yok, atlanıyor: %s\n", error.what());
+            return nullptr;
+        }
+    }
+
+    void prepareNop(Ring& ring, uint64_t data) {
+        io_uring_sqe* sqe = ring.acquire();
+        sqe->opcode = IORING_OP_NOP;
+        sqe->user_data = data;
+    }
+}
+
+WHOLF_TEST("uring/nop-round-trip") {
+    auto ring = openRing(8);
+    if (!ring) return;
+    WHOLF_CHECK(ring->supports({IORING_OP_NOP}));
+    WHOLF_CHECK(ring->space() == 8);
+    for (uint64_t i = 1; i <= 3; i++) prepareNop(*ring, i * 16);
+    WHOLF_CHECK(ring->space() == 5);
+    WHOLF_CHECK(ring->submit(3) == 3);
+
+    std::vector<uint64_t> seen;
+    unsigned reaped = ring->reap([&](uint64_t data, int result) {
+        WHOLF_CHECK(result == 0);
+        seen.push_back(data);
+    });
+    WHOLF_CHECK(reaped == 3);
+    WHOLF_CHECK(seen == (std::vector<uint64_t>{16, 32, 48}));
+    WHOLF_CHECK(ring->space() == 8);
+    WHOLF_CHECK(ring->reap([](uint64_t, int) {}) == 0);
+}
+
+WHOLF_TEST("uring/full-queue-returns-null") {
+    auto ring = openRing(4);
+    if (!ring) return;
+    // Çekirdek girdi sayısını ikinin kuvvetine yuvarlar
+    unsigned capacity = ring->space();
+    for (unsigned i = 0; i < capacity; i++) WHOLF_CHECK(ring->acquire() != nullptr);
+    WHOLF_CHECK(ring->acquire() == nullptr);
+    // Gönderilmemiş girdiler geri çekilir, halka yeniden boşalır
+    unsigned withdrawn = ring->withdraw([](uint64_t) {});
+    WHOLF_CHECK(withdrawn == capacity);
+    WHOLF_CHECK(ring->space() == capacity);
+}
+
+WHOLF_TEST("uring/read-reports-result-and-errors") {
+    auto ring = openRing(8);
+    if (!ring) return;
+    if (!ring->supports({IORING_OP_READ})) return;
+    int pipes[2];
+    WHOLF_CHECK(::pipe2(pipes, O_CLOEXEC) == 0);
+    WHOLF_CHECK(::write(pipes[1], "wholf", 5) == 5);
+
+    char buffer[16] = {};
+    io_uring_sqe* sqe = ring->acquire();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = pipes[0];
+    sqe->addr = reinterpret_cast<uint64_t>(buffer);
+    sqe->len = sizeof(buffer);
+    sqe->user_data = 1;
+    // Geçersiz tanımlayıcı: sonuç -EBADF olarak tamamlanmada döner
+    sqe = ring->acquire();
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(buffer);
+    sqe->len = sizeof(buffer);
+    sqe->user_data = 2;
+    WHOLF_CHECK(ring->submit(2) == 2);
+
+    int results[3] = {0, 0, 0};
+    ring->reap([&](uint64_t data, int result) {
+        if (data < 3) results[data] = result;
+    });
+    WHOLF_CHECK(results[1] == 5 && std::string(buffer, 5) == "wholf");
+    WHOLF_CHECK(results[2] == -EBADF);
+    ::close(pipes[0]);
+    ::close(pipes[1]);
+}
+
+WHOLF_TEST_MAIN()